@@ -24,19 +24,23 @@ _sym_db = _symbol_database.Default()
 
 
 
-DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\x14messages_drone.proto\"W\n\x13WrapperDroneCommand\x12\x35\n\x16\x63ommand_message_normal\x18\x01 \x01(\x0b\x32\x13.DroneCommandStringH\x00\x42\t\n\x07payload\"P\n\x12\x44roneCommandString\x12\x14\n\x0ctype_command\x18\x01 \x01(\t\x12$\n\x07\x63ommand\x18\x02 \x01(\x0b\x32\x13.DroneCommandMision\"\xe1\x01\n\x12\x44roneCommandMision\x12\x14\n\x0clatitude_deg\x18\x01 \x01(\x01\x12\x15\n\rlongitude_deg\x18\x02 \x01(\x01\x12\x1b\n\x13relative_altitude_m\x18\x03 \x01(\x02\x12\x11\n\tspeed_m_s\x18\x04 \x01(\x02\x12\x16\n\x0eis_fly_through\x18\x05 \x01(\x08\x12\x18\n\x10gimbal_pitch_deg\x18\x06 \x01(\x02\x12\x16\n\x0egimbal_yaw_deg\x18\x07 \x01(\x02\x12$\n\rcamera_action\x18\x08 \x01(\x0e\x32\r.CameraAction*\x9f\x02\n\x0c\x43\x61meraAction\x12\x16\n\x12\x43\x41MERA_ACTION_NONE\x10\x00\x12\x1c\n\x18\x43\x41MERA_ACTION_TAKE_PHOTO\x10\x01\x12&\n\"CAMERA_ACTION_START_PHOTO_INTERVAL\x10\x02\x12%\n!CAMERA_ACTION_STOP_PHOTO_INTERVAL\x10\x03\x12\x1d\n\x19\x43\x41MERA_ACTION_START_VIDEO\x10\x04\x12\x1c\n\x18\x43\x41MERA_ACTION_STOP_VIDEO\x10\x05\x12&\n\"CAMERA_ACTION_START_PHOTO_DISTANCE\x10\x06\x12%\n!CAMERA_ACTION_STOP_PHOTO_DISTANCE\x10\x07\x62\x06proto3')
+DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\x14messages_drone.proto\"\x82\x01\n\x13WrapperDroneCommand\x12\x35\n\x16\x63ommand_message_normal\x18\x01 \x01(\x0b\x32\x13.DroneCommandStringH\x00\x12)\n\x0cmission_plan\x18\x02 \x01(\x0b\x32\x11.DroneMissionPlanH\x00\x42\t\n\x07payload\"t\n\x12\x44roneCommandString\x12\x14\n\x0ctype_command\x18\x01 \x01(\t\x12$\n\x07\x63ommand\x18\x02 \x01(\x0b\x32\x13.DroneCommandMision\x12\"\n\x0c\x63ommand_type\x18\x03 \x01(\x0e\x32\x0c.CommandType\"\xe1\x01\n\x12\x44roneCommandMision\x12\x14\n\x0clatitude_deg\x18\x01 \x01(\x01\x12\x15\n\rlongitude_deg\x18\x02 \x01(\x01\x12\x1b\n\x13relative_altitude_m\x18\x03 \x01(\x02\x12\x11\n\tspeed_m_s\x18\x04 \x01(\x02\x12\x16\n\x0eis_fly_through\x18\x05 \x01(\x08\x12\x18\n\x10gimbal_pitch_deg\x18\x06 \x01(\x02\x12\x16\n\x0egimbal_yaw_deg\x18\x07 \x01(\x02\x12$\n\rcamera_action\x18\x08 \x01(\x0e\x32\r.CameraAction\"\xf1\x01\n\x10\x44roneMissionPlan\x12\x10\n\x08\x64rone_id\x18\x01 \x01(\x05\x12\x14\n\x0clatitude_deg\x18\x02 \x03(\x01\x12\x15\n\rlongitude_deg\x18\x03 \x03(\x01\x12\x1b\n\x13relative_altitude_m\x18\x04 \x01(\x02\x12\x11\n\tspeed_m_s\x18\x05 \x01(\x02\x12\x16\n\x0eis_fly_through\x18\x06 \x01(\x08\x12\x18\n\x10gimbal_pitch_deg\x18\x07 \x01(\x02\x12\x16\n\x0egimbal_yaw_deg\x18\x08 \x01(\x02\x12$\n\rcamera_action\x18\t \x01(\x0e\x32\r.CameraAction*u\n\x0b\x43ommandType\x12\x19\n\x15\x43OMMAND_TYPE_WAYPOINT\x10\x00\x12\x16\n\x12\x43OMMAND_TYPE_START\x10\x01\x12\x17\n\x13\x43OMMAND_TYPE_FINISH\x10\x02\x12\x1a\n\x16\x43OMMAND_TYPE_START_ALL\x10\x03*\x9f\x02\n\x0c\x43\x61meraAction\x12\x16\n\x12\x43\x41MERA_ACTION_NONE\x10\x00\x12\x1c\n\x18\x43\x41MERA_ACTION_TAKE_PHOTO\x10\x01\x12&\n\"CAMERA_ACTION_START_PHOTO_INTERVAL\x10\x02\x12%\n!CAMERA_ACTION_STOP_PHOTO_INTERVAL\x10\x03\x12\x1d\n\x19\x43\x41MERA_ACTION_START_VIDEO\x10\x04\x12\x1c\n\x18\x43\x41MERA_ACTION_STOP_VIDEO\x10\x05\x12&\n\"CAMERA_ACTION_START_PHOTO_DISTANCE\x10\x06\x12%\n!CAMERA_ACTION_STOP_PHOTO_DISTANCE\x10\x07\x62\x06proto3')
 
 _globals = globals()
 _builder.BuildMessageAndEnumDescriptors(DESCRIPTOR, _globals)
 _builder.BuildTopDescriptorsAndMessages(DESCRIPTOR, 'messages_drone_pb2', _globals)
 if not _descriptor._USE_C_DESCRIPTORS:
   DESCRIPTOR._loaded_options = None
-  _globals['_CAMERAACTION']._serialized_start=424
-  _globals['_CAMERAACTION']._serialized_end=711
-  _globals['_WRAPPERDRONECOMMAND']._serialized_start=24
-  _globals['_WRAPPERDRONECOMMAND']._serialized_end=111
-  _globals['_DRONECOMMANDSTRING']._serialized_start=113
-  _globals['_DRONECOMMANDSTRING']._serialized_end=193
-  _globals['_DRONECOMMANDMISION']._serialized_start=196
-  _globals['_DRONECOMMANDMISION']._serialized_end=421
+  _globals['_COMMANDTYPE']._serialized_start=747
+  _globals['_COMMANDTYPE']._serialized_end=864
+  _globals['_CAMERAACTION']._serialized_start=867
+  _globals['_CAMERAACTION']._serialized_end=1154
+  _globals['_WRAPPERDRONECOMMAND']._serialized_start=25
+  _globals['_WRAPPERDRONECOMMAND']._serialized_end=155
+  _globals['_DRONECOMMANDSTRING']._serialized_start=157
+  _globals['_DRONECOMMANDSTRING']._serialized_end=273
+  _globals['_DRONECOMMANDMISION']._serialized_start=276
+  _globals['_DRONECOMMANDMISION']._serialized_end=501
+  _globals['_DRONEMISSIONPLAN']._serialized_start=504
+  _globals['_DRONEMISSIONPLAN']._serialized_end=745
 # @@protoc_insertion_point(module_scope)
@@ -24,7 +24,7 @@ _sym_db = _symbol_database.Default()
 
 
 
-DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\x16messages_planner.proto\"@\n\x07Wrapper\x12*\n\x0fplanner_message\x18\x01 \x01(\x0b\x32\x0f.PlannerMessageH\x00\x42\t\n\x07payload\"h\n\x0ePlannerMessage\x12\x36\n\x14signal_server_config\x18\x01 \x03(\x0b\x32\x18.SignalServerConfigProto\x12\x1e\n\ndrone_data\x18\x02 \x01(\x0b\x32\n.DroneData\"\x9e\x07\n\x17SignalServerConfigProto\x12\x15\n\rsdf_directory\x18\x01 \x01(\t\x12\x13\n\x0boutput_file\x18\x02 \x01(\t\x12\x1e\n\x11user_terrain_file\x18\x03 \x01(\tH\x00\x88\x01\x01\x12\x1f\n\x12terrain_background\x18\x04 \x01(\tH\x01\x88\x01\x01\x12\x10\n\x08latitude\x18\x05 \x01(\x01\x12\x11\n\tlongitude\x18\x06 \x01(\x01\x12\x11\n\ttx_height\x18\x07 \x01(\x01\x12\x12\n\nrx_heights\x18\x08 \x03(\x01\x12\x15\n\rfrequency_mhz\x18\t \x01(\x01\x12\x11\n\terp_watts\x18\n \x01(\x01\x12\x19\n\x0crx_threshold\x18\x0b \x01(\x01H\x02\x88\x01\x01\x12\x1b\n\x0ehorizontal_pol\x18\x0c \x01(\x08H\x03\x88\x01\x01\x12\x1b\n\x0eground_clutter\x18\r \x01(\x01H\x04\x88\x01\x01\x12\x19\n\x0cterrain_code\x18\x0e \x01(\x05H\x05\x88\x01\x01\x12\x1f\n\x12terrain_dielectric\x18\x0f \x01(\x01H\x06\x88\x01\x01\x12!\n\x14terrain_conductivity\x18\x10 \x01(\x01H\x07\x88\x01\x01\x12\x19\n\x0c\x63limate_code\x18\x11 \x01(\x05H\x08\x88\x01\x01\x12\x19\n\x11propagation_model\x18\x12 \x01(\x05\x12\x1c\n\x0fknife_edge_diff\x18\x13 \x01(\x08H\t\x88\x01\x01\x12\x1d\n\x10win32_tile_names\x18\x14 \x01(\x08H\n\x88\x01\x01\x12\x17\n\ndebug_mode\x18\x15 \x01(\x08H\x0b\x88\x01\x01\x12\x19\n\x0cmetric_units\x18\x16 \x01(\x08H\x0c\x88\x01\x01\x12\x15\n\x08plot_dbm\x18\x17 \x01(\x08H\r\x88\x01\x01\x12\x0e\n\x06radius\x18\x18 \x01(\x01\x12\x12\n\nresolution\x18\x19 \x01(\x05\x42\x14\n\x12_user_terrain_fileB\x15\n\x13_terrain_backgroundB\x0f\n\r_rx_thresholdB\x11\n\x0f_horizontal_polB\x11\n\x0f_ground_clutterB\x0f\n\r_terrain_codeB\x15\n\x13_terrain_dielectricB\x17\n\x15_terrain_conductivityB\x0f\n\r_climate_codeB\x12\n\x10_knife_edge_diffB\x13\n\x11_win32_tile_namesB\r\n\x0b_debug_modeB\x0f\n\r_metric_unitsB\x0b\n\t_plot_dbm\"9\n\tDroneData\x12\x12\n\nnum_drones\x18\x01 \x01(\x05\x12\x0b\n\x03lon\x18\x02 \x03(\x01\x12\x0b\n\x03lat\x18\x03 \x03(\x01\x62\x06proto3')
+DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\x16messages_planner.proto\"j\n\x07Wrapper\x12*\n\x0fplanner_message\x18\x01 \x01(\x0b\x32\x0f.PlannerMessageH\x00\x12(\n\x0e\x63\x61ncel_message\x18\x02 \x01(\x0b\x32\x0e.CancelMessageH\x00\x42\t\n\x07payload\"#\n\rCancelMessage\x12\x12\n\nrequest_id\x18\x01 \x01(\x04\"\xad\x01\n\x0ePlannerMessage\x12\x36\n\x14signal_server_config\x18\x01 \x03(\x0b\x32\x18.SignalServerConfigProto\x12\x1e\n\ndrone_data\x18\x02 \x01(\x0b\x32\n.DroneData\x12\x12\n\nrequest_id\x18\x03 \x01(\x04\x12\x18\n\x10\x63ompact_response\x18\x04 \x01(\x08\x12\x15\n\rstream_routes\x18\x05 \x01(\x08\"\x9e\x07\n\x17SignalServerConfigProto\x12\x15\n\rsdf_directory\x18\x01 \x01(\t\x12\x13\n\x0boutput_file\x18\x02 \x01(\t\x12\x1e\n\x11user_terrain_file\x18\x03 \x01(\tH\x00\x88\x01\x01\x12\x1f\n\x12terrain_background\x18\x04 \x01(\tH\x01\x88\x01\x01\x12\x10\n\x08latitude\x18\x05 \x01(\x01\x12\x11\n\tlongitude\x18\x06 \x01(\x01\x12\x11\n\ttx_height\x18\x07 \x01(\x01\x12\x12\n\nrx_heights\x18\x08 \x03(\x01\x12\x15\n\rfrequency_mhz\x18\t \x01(\x01\x12\x11\n\terp_watts\x18\n \x01(\x01\x12\x19\n\x0crx_threshold\x18\x0b \x01(\x01H\x02\x88\x01\x01\x12\x1b\n\x0ehorizontal_pol\x18\x0c \x01(\x08H\x03\x88\x01\x01\x12\x1b\n\x0eground_clutter\x18\r \x01(\x01H\x04\x88\x01\x01\x12\x19\n\x0cterrain_code\x18\x0e \x01(\x05H\x05\x88\x01\x01\x12\x1f\n\x12terrain_dielectric\x18\x0f \x01(\x01H\x06\x88\x01\x01\x12!\n\x14terrain_conductivity\x18\x10 \x01(\x01H\x07\x88\x01\x01\x12\x19\n\x0c\x63limate_code\x18\x11 \x01(\x05H\x08\x88\x01\x01\x12\x19\n\x11propagation_model\x18\x12 \x01(\x05\x12\x1c\n\x0fknife_edge_diff\x18\x13 \x01(\x08H\t\x88\x01\x01\x12\x1d\n\x10win32_tile_names\x18\x14 \x01(\x08H\n\x88\x01\x01\x12\x17\n\ndebug_mode\x18\x15 \x01(\x08H\x0b\x88\x01\x01\x12\x19\n\x0cmetric_units\x18\x16 \x01(\x08H\x0c\x88\x01\x01\x12\x15\n\x08plot_dbm\x18\x17 \x01(\x08H\r\x88\x01\x01\x12\x0e\n\x06radius\x18\x18 \x01(\x01\x12\x12\n\nresolution\x18\x19 \x01(\x05\x42\x14\n\x12_user_terrain_fileB\x15\n\x13_terrain_backgroundB\x0f\n\r_rx_thresholdB\x11\n\x0f_horizontal_polB\x11\n\x0f_ground_clutterB\x0f\n\r_terrain_codeB\x15\n\x13_terrain_dielectricB\x17\n\x15_terrain_conductivityB\x0f\n\r_climate_codeB\x12\n\x10_knife_edge_diffB\x13\n\x11_win32_tile_namesB\r\n\x0b_debug_modeB\x0f\n\r_metric_unitsB\x0b\n\t_plot_dbm\"e\n\tDroneData\x12\x12\n\nnum_drones\x18\x01 \x01(\x05\x12\x0b\n\x03lon\x18\x02 \x03(\x01\x12\x0b\n\x03lat\x18\x03 \x03(\x01\x12\x14\n\x0clon_e7_delta\x18\x04 \x03(\x11\x12\x14\n\x0clat_e7_delta\x18\x05 \x03(\x11\x62\x06proto3')
 
 _globals = globals()
 _builder.BuildMessageAndEnumDescriptors(DESCRIPTOR, _globals)
@@ -32,11 +32,13 @@ _builder.BuildTopDescriptorsAndMessages(DESCRIPTOR, 'messages_planner_pb2', _glo
 if not _descriptor._USE_C_DESCRIPTORS:
   DESCRIPTOR._loaded_options = None
   _globals['_WRAPPER']._serialized_start=26
-  _globals['_WRAPPER']._serialized_end=90
-  _globals['_PLANNERMESSAGE']._serialized_start=92
-  _globals['_PLANNERMESSAGE']._serialized_end=196
-  _globals['_SIGNALSERVERCONFIGPROTO']._serialized_start=199
-  _globals['_SIGNALSERVERCONFIGPROTO']._serialized_end=1125
-  _globals['_DRONEDATA']._serialized_start=1127
-  _globals['_DRONEDATA']._serialized_end=1184
+  _globals['_WRAPPER']._serialized_end=132
+  _globals['_CANCELMESSAGE']._serialized_start=134
+  _globals['_CANCELMESSAGE']._serialized_end=169
+  _globals['_PLANNERMESSAGE']._serialized_start=172
+  _globals['_PLANNERMESSAGE']._serialized_end=345
+  _globals['_SIGNALSERVERCONFIGPROTO']._serialized_start=348
+  _globals['_SIGNALSERVERCONFIGPROTO']._serialized_end=1274
+  _globals['_DRONEDATA']._serialized_start=1276
+  _globals['_DRONEDATA']._serialized_end=1377
 # @@protoc_insertion_point(module_scope)
@@ -25,31 +25,39 @@ _sym_db = _symbol_database.Default()
 import messages_planner_pb2 as messages__planner__pb2
 
 
-DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\x12messages_pld.proto\x1a\x16messages_planner.proto\"h\n\x0eWrapperPlanner\x12\x30\n\x10planner_response\x18\x01 \x01(\x0b\x32\x14.PlannerResponseListH\x00\x12\x19\n\x06status\x18\x02 \x01(\x0b\x32\x07.StatusH\x00\x42\t\n\x07payload\"4\n\x0cWrapperDrone\x12\x19\n\x06status\x18\x01 \x01(\x0b\x32\x07.StatusH\x00\x42\t\n\x07payload\"6\n\x13PlannerResponseList\x12\x1f\n\x05items\x18\x01 \x03(\x0b\x32\x10.PlannerResponse\"+\n\x0fPlannerResponse\x12\x0b\n\x03lon\x18\x01 \x03(\x01\x12\x0b\n\x03lat\x18\x02 \x03(\x01\"\x1d\n\x06Status\x12\x13\n\x0btype_status\x18\x01 \x01(\t\"^\n\x11WrapperFromClient\x12!\n\x06\x63onfig\x18\x01 \x01(\x0b\x32\x0f.Config_missionH\x00\x12\x1b\n\x07message\x18\x02 \x01(\x0b\x32\x08.CommandH\x00\x42\t\n\x07payload\"\x1a\n\x07\x43ommand\x12\x0f\n\x07\x63ommand\x18\x01 \x01(\t\"2\n\nWrapperPLD\x12\x19\n\x06status\x18\x01 \x01(\x0b\x32\x07.StatusH\x00\x42\t\n\x07payload\"\x92\x01\n\x0e\x43onfig_mission\x12\'\n\x0eplanner_config\x18\x01 \x01(\x0b\x32\x0f.PlannerMessage\x12\"\n\x0cinfo_planner\x18\x02 \x01(\x0b\x32\x0c.Info_Module\x12 \n\ninfo_drone\x18\x03 \x01(\x0b\x32\x0c.Info_Module\x12\x11\n\tdrone_sim\x18\x04 \x01(\t\"\x83\x01\n\x0bInfo_Module\x12\x13\n\x0b\x64ocker_name\x18\x01 \x01(\t\x12\x13\n\x0b\x64ocker_file\x18\x02 \x01(\t\x12\x11\n\tmodule_ip\x18\x03 \x01(\t\x12\x0e\n\x06ssh_ip\x18\x04 \x01(\t\x12\x0c\n\x04port\x18\x05 \x01(\t\x12\x0c\n\x04user\x18\x06 \x01(\t\x12\x0b\n\x03key\x18\x07 \x01(\tb\x06proto3')
+DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\x12messages_pld.proto\x1a\x16messages_planner.proto\"\x90\x01\n\x0eWrapperPlanner\x12\x30\n\x10planner_response\x18\x01 \x01(\x0b\x32\x14.PlannerResponseListH\x00\x12\x19\n\x06status\x18\x02 \x01(\x0b\x32\x07.StatusH\x00\x12&\n\rplanner_route\x18\x03 \x01(\x0b\x32\r.PlannerRouteH\x00\x42\t\n\x07payload\"4\n\x0cWrapperDrone\x12\x19\n\x06status\x18\x01 \x01(\x0b\x32\x07.StatusH\x00\x42\t\n\x07payload\"c\n\x13PlannerResponseList\x12\x1f\n\x05items\x18\x01 \x03(\x0b\x32\x10.PlannerResponse\x12\x12\n\nrequest_id\x18\x02 \x01(\x04\x12\x17\n\x0fstreamed_routes\x18\x03 \x01(\r\"R\n\x0cPlannerRoute\x12\x12\n\nrequest_id\x18\x01 \x01(\x04\x12\r\n\x05\x64rone\x18\x02 \x01(\r\x12\x1f\n\x05route\x18\x03 \x01(\x0b\x32\x10.PlannerResponse\"W\n\x0fPlannerResponse\x12\x0b\n\x03lon\x18\x01 \x03(\x01\x12\x0b\n\x03lat\x18\x02 \x03(\x01\x12\x14\n\x0clon_e7_delta\x18\x03 \x03(\x11\x12\x14\n\x0clat_e7_delta\x18\x04 \x03(\x11\"\xc9\x02\n\x06Status\x12\x13\n\x0btype_status\x18\x01 \x01(\t\x12\x12\n\nrequest_id\x18\x02 \x01(\x04\x12\x0f\n\x07profile\x18\x03 \x01(\t\x12\x1b\n\x13\x63ompact_coordinates\x18\x04 \x01(\x08\x12(\n\x0eplanner_status\x18\x05 \x01(\x0e\x32\x0e.PlannerStatusH\x00\x12$\n\x0c\x64rone_status\x18\x06 \x01(\x0e\x32\x0c.DroneStatusH\x00\x12 \n\npld_status\x18\x07 \x01(\x0e\x32\n.PldStatusH\x00\x12\x17\n\x0fqueued_missions\x18\x08 \x01(\r\x12\x18\n\x10planned_missions\x18\t \x01(\r\x12\x1f\n\x17last_mission_latency_ms\x18\n \x01(\x04\x12\x12\n\nmission_id\x18\x0b \x01(\tB\x0e\n\x0ctyped_status\"^\n\x11WrapperFromClient\x12!\n\x06\x63onfig\x18\x01 \x01(\x0b\x32\x0f.Config_missionH\x00\x12\x1b\n\x07message\x18\x02 \x01(\x0b\x32\x08.CommandH\x00\x42\t\n\x07payload\".\n\x07\x43ommand\x12\x0f\n\x07\x63ommand\x18\x01 \x01(\t\x12\x12\n\nmission_id\x18\x02 \x01(\t\"2\n\nWrapperPLD\x12\x19\n\x06status\x18\x01 \x01(\x0b\x32\x07.StatusH\x00\x42\t\n\x07payload\"\xa6\x01\n\x0e\x43onfig_mission\x12\'\n\x0eplanner_config\x18\x01 \x01(\x0b\x32\x0f.PlannerMessage\x12\"\n\x0cinfo_planner\x18\x02 \x01(\x0b\x32\x0c.Info_Module\x12 \n\ninfo_drone\x18\x03 \x01(\x0b\x32\x0c.Info_Module\x12\x11\n\tdrone_sim\x18\x04 \x01(\t\x12\x12\n\nmission_id\x18\x05 \x01(\t\"\x83\x01\n\x0bInfo_Module\x12\x13\n\x0b\x64ocker_name\x18\x01 \x01(\t\x12\x13\n\x0b\x64ocker_file\x18\x02 \x01(\t\x12\x11\n\tmodule_ip\x18\x03 \x01(\t\x12\x0e\n\x06ssh_ip\x18\x04 \x01(\t\x12\x0c\n\x04port\x18\x05 \x01(\t\x12\x0c\n\x04user\x18\x06 \x01(\t\x12\x0b\n\x03key\x18\x07 \x01(\t*\xc1\x01\n\rPlannerStatus\x12\x1a\n\x16PLANNER_STATUS_UNKNOWN\x10\x00\x12!\n\x1dPLANNER_STATUS_EXPECTING_DATA\x10\x01\x12\x18\n\x14PLANNER_STATUS_ERROR\x10\x02\x12\x1e\n\x1aPLANNER_STATUS_CALCULATING\x10\x03\x12\x19\n\x15PLANNER_STATUS_FINISH\x10\x04\x12\x1c\n\x18PLANNER_STATUS_CANCELLED\x10\x05*\x9b\x01\n\x0b\x44roneStatus\x12\x18\n\x14\x44RONE_STATUS_UNKNOWN\x10\x00\x12\x1d\n\x19\x44RONE_STATUS_STARTING_SIM\x10\x01\x12\x16\n\x12\x44RONE_STATUS_ERROR\x10\x02\x12\"\n\x1e\x44RONE_STATUS_EXECUTING_MISSION\x10\x03\x12\x17\n\x13\x44RONE_STATUS_FINISH\x10\x04*\xb0\x01\n\tPldStatus\x12\x16\n\x12PLD_STATUS_UNKNOWN\x10\x00\x12\x14\n\x10PLD_STATUS_ERROR\x10\x01\x12\x1b\n\x17PLD_STATUS_WAITING_INFO\x10\x02\x12\x1f\n\x1bPLD_STATUS_PLANNING_MISSION\x10\x03\x12 \n\x1cPLD_STATUS_EXECUTING_MISSION\x10\x04\x12\x15\n\x11PLD_STATUS_FINISH\x10\x05\x62\x06proto3')
 
 _globals = globals()
 _builder.BuildMessageAndEnumDescriptors(DESCRIPTOR, _globals)
 _builder.BuildTopDescriptorsAndMessages(DESCRIPTOR, 'messages_pld_pb2', _globals)
 if not _descriptor._USE_C_DESCRIPTORS:
   DESCRIPTOR._loaded_options = None
-  _globals['_WRAPPERPLANNER']._serialized_start=46
-  _globals['_WRAPPERPLANNER']._serialized_end=150
-  _globals['_WRAPPERDRONE']._serialized_start=152
-  _globals['_WRAPPERDRONE']._serialized_end=204
-  _globals['_PLANNERRESPONSELIST']._serialized_start=206
-  _globals['_PLANNERRESPONSELIST']._serialized_end=260
-  _globals['_PLANNERRESPONSE']._serialized_start=262
-  _globals['_PLANNERRESPONSE']._serialized_end=305
-  _globals['_STATUS']._serialized_start=307
-  _globals['_STATUS']._serialized_end=336
-  _globals['_WRAPPERFROMCLIENT']._serialized_start=338
-  _globals['_WRAPPERFROMCLIENT']._serialized_end=432
-  _globals['_COMMAND']._serialized_start=434
-  _globals['_COMMAND']._serialized_end=460
-  _globals['_WRAPPERPLD']._serialized_start=462
-  _globals['_WRAPPERPLD']._serialized_end=512
-  _globals['_CONFIG_MISSION']._serialized_start=515
-  _globals['_CONFIG_MISSION']._serialized_end=661
-  _globals['_INFO_MODULE']._serialized_start=664
-  _globals['_INFO_MODULE']._serialized_end=795
+  _globals['_PLANNERSTATUS']._serialized_start=1353
+  _globals['_PLANNERSTATUS']._serialized_end=1546
+  _globals['_DRONESTATUS']._serialized_start=1549
+  _globals['_DRONESTATUS']._serialized_end=1704
+  _globals['_PLDSTATUS']._serialized_start=1707
+  _globals['_PLDSTATUS']._serialized_end=1883
+  _globals['_WRAPPERPLANNER']._serialized_start=47
+  _globals['_WRAPPERPLANNER']._serialized_end=191
+  _globals['_WRAPPERDRONE']._serialized_start=193
+  _globals['_WRAPPERDRONE']._serialized_end=245
+  _globals['_PLANNERRESPONSELIST']._serialized_start=247
+  _globals['_PLANNERRESPONSELIST']._serialized_end=346
+  _globals['_PLANNERROUTE']._serialized_start=348
+  _globals['_PLANNERROUTE']._serialized_end=430
+  _globals['_PLANNERRESPONSE']._serialized_start=432
+  _globals['_PLANNERRESPONSE']._serialized_end=519
+  _globals['_STATUS']._serialized_start=522
+  _globals['_STATUS']._serialized_end=851
+  _globals['_WRAPPERFROMCLIENT']._serialized_start=853
+  _globals['_WRAPPERFROMCLIENT']._serialized_end=947
+  _globals['_COMMAND']._serialized_start=949
+  _globals['_COMMAND']._serialized_end=995
+  _globals['_WRAPPERPLD']._serialized_start=997
+  _globals['_WRAPPERPLD']._serialized_end=1047
+  _globals['_CONFIG_MISSION']._serialized_start=1050
+  _globals['_CONFIG_MISSION']._serialized_end=1216
+  _globals['_INFO_MODULE']._serialized_start=1219
+  _globals['_INFO_MODULE']._serialized_end=1350
 # @@protoc_insertion_point(module_scope)
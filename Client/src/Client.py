@@ -19,6 +19,7 @@ class ClientManager:
         self._setup_logging()
         self.logger = logging.getLogger(__name__)
         self.offline_mode = offline_mode
+        self.mission_id = ""  # From the last configuration sent, FINISH is addressed to that mission
 
         self.current_status = "UNKNOWN"
         self.comm_manager = CommunicationManager(
@@ -72,6 +73,7 @@ class ClientManager:
             config_mission = MessageEncoderDecoder.create_config_mission_from_yaml(
                 Config.CONFIG_FILE_PATH
             )
+            self.mission_id = config_mission.mission_id
             return self.comm_manager.send_config(config_mission)
         except (FileNotFoundError, KeyError, TypeError, ValueError) as e:
             self.logger.error(f"Error loading/encoding configuration: {e}")
@@ -83,7 +85,7 @@ class ClientManager:
             return False
 
     def send_finish_command(self):
-        return self.comm_manager.send_command(MessageEncoderDecoder.COMMAND_FINISH)
+        return self.comm_manager.send_command(MessageEncoderDecoder.COMMAND_FINISH, self.mission_id)
 
     def start_listening(self):
         self.comm_manager.start_listening(Config.SOCKET_TIMEOUT)
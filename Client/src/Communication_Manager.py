@@ -113,10 +113,10 @@ class CommunicationManager:
             self._write_message_log(self.messages_sent_path, "config_mission", log_data)
         return success
 
-    def send_command(self, command_str):
+    def send_command(self, command_str, mission_id=""):
         if not self.connected:
             self.logger.warning("Not connected to PLD. Try later")
-        encoded = MessageEncoderDecoder.create_command_message(command_str)
+        encoded = MessageEncoderDecoder.create_command_message(command_str, mission_id)
         success = self.send_message(encoded)
         if success:
             self.logger.info(f"Command '{command_str}' sent successfully")
@@ -118,22 +118,32 @@ class MessageEncoderDecoder:
 
     @staticmethod
     def decode_status(data):
+        # data is the payload of a single frame, the length prefix is already stripped by the reader
         try:
-            if len(data) > 4:
-                inner_length = struct.unpack('>I', data[:4])[0]
-                actual_msg_data = data[4:4+inner_length]
-            else:
-                actual_msg_data = data
-
             wrapper = messages_pld_pb2.WrapperPLD()
-            wrapper.ParseFromString(actual_msg_data)
+            wrapper.ParseFromString(data)
 
             if wrapper.HasField('status'):
+                # Typed status from current PLD builds, legacy string from older ones
+                if wrapper.status.HasField('pld_status'):
+                    name = messages_pld_pb2.PldStatus.Name(wrapper.status.pld_status)
+                    mission = f"[{wrapper.status.mission_id}] " if wrapper.status.mission_id else ""
+                    return mission + name[len('PLD_STATUS_'):] + MessageEncoderDecoder._format_mission_queue(wrapper.status)
                 return wrapper.status.type_status
             return None
         except Exception as e:
             raise ValueError(f"Error decoding status: {e}")
 
+    @staticmethod
+    def _format_mission_queue(status):
+        # Missions sent while another one runs are queued by the PLD and planned in the background
+        parts = []
+        if status.queued_missions or status.planned_missions:
+            parts.append(f"queued {status.queued_missions}, planned {status.planned_missions}")
+        if status.last_mission_latency_ms:
+            parts.append(f"last mission started after {status.last_mission_latency_ms} ms")
+        return f" ({'; '.join(parts)})" if parts else ""
+
     @staticmethod
     def create_config_mission_from_yaml(yaml_path):
         with open(yaml_path, 'r') as f:
@@ -158,6 +168,7 @@ class MessageEncoderDecoder:
         MessageEncoderDecoder._set_module_info(config.info_drone, info_drone)
 
         config.drone_sim = config_data['drone_sim']
+        config.mission_id = config_data.get('mission_id') or ""
 
         return config
 
@@ -223,6 +234,8 @@ info_drone:  # REQUIRED
   key: ""
 
 drone_sim: ""  # REQUIRED
+
+mission_id: ""  # OPTIONAL: missions with different ids run concurrently in the PLD
 """
         os.makedirs(os.path.dirname(example_path), exist_ok=True)
         with open(example_path, 'w') as f:
@@ -235,9 +248,10 @@ drone_sim: ""  # REQUIRED
         return MessageEncoderDecoder.encode_message(wrapper)
 
     @staticmethod
-    def create_command_message(command_str):
+    def create_command_message(command_str, mission_id=""):
         wrapper = messages_pld_pb2.WrapperFromClient()
         wrapper.message.command = command_str
+        wrapper.message.mission_id = mission_id
         return MessageEncoderDecoder.encode_message(wrapper)
 
     @staticmethod
@@ -283,7 +297,8 @@ drone_sim: ""  # REQUIRED
                 "user": config_mission.info_drone.user,
                 "key": config_mission.info_drone.key
             },
-            "drone_sim": config_mission.drone_sim
+            "drone_sim": config_mission.drone_sim,
+            "mission_id": config_mission.mission_id
         }
 
     @staticmethod
@@ -9,13 +9,17 @@
  * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 #include "Communication_Manager.h"
 
+#include <algorithm>
 #include <thread>
 #include <chrono>
 #include "common_libs/Logger.h"
 #include "common_libs/Enc_Dec_Drone.h"
 
 constexpr int NUMBER_ATTEMPS_MAX = 10;
+constexpr int RATE_STANDBY_RECONNECT_MAX = 2; // Seconds between attempts while waiting in the PLD warm pool
 constexpr int RATE_STATUS_MESSAGE = 1;
+constexpr size_t COMPRESSION_THRESHOLD_BYTES = 4 * 1024; // Telemetry is latency sensitive: LZ4 only on larger frames
+constexpr size_t DELIVERY_WINDOW_FRAMES = 32; // Commands from PLD are acknowledged and resumed after a reconnect
 
 Communication_Manager::Communication_Manager(boost::asio::io_context& io_context, 
                                              const tcp::endpoint& endpoint): io_context_(io_context),
@@ -30,6 +34,8 @@ Communication_Manager::Communication_Manager(boost::asio::io_context& io_context
     handler_obj.call_connect = std::bind(&Communication_Manager::on_connect, this);
     handler_obj.call_message = std::bind(&Communication_Manager::on_message, this, std::placeholders::_1);
     server_.set_handlers(handler_obj);
+    server_.set_compression(Server::Compression::LZ4, COMPRESSION_THRESHOLD_BYTES);
+    server_.set_reliable_delivery(DELIVERY_WINDOW_FRAMES);
 
     std::stringstream ss;
     ss << "Start connecting to PLD at " << endpoint_.address().to_string() << ":" << endpoint_.port();
@@ -66,6 +72,7 @@ void Communication_Manager::shutdown()
 void Communication_Manager::on_connect()
 {
     attemps_ = 0;
+    connected_once_ = true;
     Logger::log_message(Logger::Type::INFO,"Succesfully connected to PLD");
     boost::system::error_code ec;
     send_status_message(ec);
@@ -88,7 +95,7 @@ void Communication_Manager::send_status_message(const boost::system::error_code&
     if (!Enc_Dec_Drone::encode_status_drone(get_status(),message)) {
         Logger::log_message(Logger::Type::WARNING,"Problems encoding status message");
     } else {
-        deliver(message);
+        deliver(std::move(message));
     }
     
     if (!shutting_down_) {
@@ -120,6 +127,18 @@ void Communication_Manager::on_error(const boost::system::error_code& ec, const
         return;
     }
 
+    // Until the first mission connects the module is a warm standby started ahead by the PLD,
+    // so it keeps retrying quietly with a capped backoff instead of exiting
+    if (!connected_once_) {
+        attemps_++;
+        retry_timer_ = std::make_shared<boost::asio::steady_timer>(io_context_, std::chrono::seconds(std::min(attemps_, RATE_STANDBY_RECONNECT_MAX)));
+        retry_timer_->async_wait([this](const boost::system::error_code& ec) {
+            if (ec || shutting_down_) return;
+            server_.connect(endpoint_);
+        });
+        return;
+    }
+
     Logger::log_message(Logger::Type::WARNING, "on_error callback triggered");
     std::string log;
     switch (type_error){
@@ -164,24 +183,21 @@ void Communication_Manager::set_message_handler(message_handler handler)
     message_handler_ = std::move(handler);
 }
 
-void Communication_Manager::on_message(const std::string& msg)
+void Communication_Manager::on_message(std::string_view msg)
 {    
     if (shutting_down_) return;
     Logger::log_message(Logger::Type::INFO, "Message received from PLD");
 
-    std::string data = msg.substr(4);
-
     if (message_handler_) {
-        message_handler_(data);
+        message_handler_(msg);
     } else {
         Logger::log_message(Logger::Type::WARNING, "No message handler set");
     }
 }
 
-void Communication_Manager::deliver(const std::string &msg)
+void Communication_Manager::deliver(std::string msg)
 {
-    std::lock_guard<std::mutex> lock(mutex_deliver_);
-    server_.deliver(msg);
+    server_.deliver(std::move(msg));
 }
 
 Struct_Drone::Status Communication_Manager::get_status()
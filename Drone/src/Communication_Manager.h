@@ -15,7 +15,7 @@
 
 using boost::asio::ip::tcp;
 
-using message_handler = std::function<void(const std::string &)>;
+using message_handler = std::function<void(std::string_view)>;
 
 class Communication_Manager {
 
@@ -26,15 +26,15 @@ private:
     boost::asio::steady_timer status_timer;
     std::shared_ptr<boost::asio::steady_timer> retry_timer_;
     int attemps_ = 0;
+    bool connected_once_ = false; // Standby until the PLD hands the module its first mission
     Struct_Drone::Status status_;
     message_handler message_handler_;
     std::mutex mutex_status_;
-    std::mutex mutex_deliver_;
     std::atomic<bool> shutting_down_{false};
 
     void on_connect();
     void on_error(const boost::system::error_code& ec, const Type_Error &type_error);
-    void on_message(const std::string& msg);
+    void on_message(std::string_view msg);
     void send_status_message(const boost::system::error_code& ec);
     Struct_Drone::Status get_status();
 
@@ -43,7 +43,7 @@ public:
     ~Communication_Manager();
     void set_status(const Struct_Drone::Status &new_status);
     void set_message_handler(message_handler handler);
-    void deliver(const std::string &msg);
+    void deliver(std::string msg);
     void shutdown();
 
 };
\ No newline at end of file
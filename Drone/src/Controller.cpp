@@ -26,7 +26,7 @@ Controller::Controller(std::shared_ptr<Communication_Manager> comm_mng,
     drone_manager_->start_all();
 }
 
-void Controller::handler_message(const std::string &message)
+void Controller::handler_message(std::string_view message)
 {
     Logger::log_message(Logger::Type::INFO, "Adding new commands to the list");
     drone_manager_->dispatch_command(message);
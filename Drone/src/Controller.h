@@ -21,7 +21,7 @@ public:
                std::shared_ptr<Multi_Drone_Manager> drone_manager,
                const Struct_Drone::Config_struct &cnf);
     ~Controller() = default;
-    void handler_message(const std::string &message);
+    void handler_message(std::string_view message);
     void mission_complete();
     void error_callback(int drone_id);
     void missions_ready();
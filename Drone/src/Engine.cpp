@@ -21,12 +21,17 @@ void Engine::start_engine()
     // Concrete engine implementations must provide their own startup logic.
 }
 
-void Engine::send_command(const std::string &command)
+void Engine::send_command(std::string_view command)
 {
     // Intentionally empty: Engine acts as an interface-like base class.
     // Concrete engine implementations must provide command handling.
 }
 
+void Engine::send_mission_plan(const DroneMissionPlan &plan)
+{
+    // Intentionally empty, like send_command: concrete engines load the plan.
+}
+
 void Engine::set_start_signal(std::shared_future<void> signal)
 {
     start_signal_ = signal;
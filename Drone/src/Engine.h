@@ -10,8 +10,11 @@
 #pragma once
 #include "structs/Structs_Drone.h"
 #include <functional>
+#include <string_view>
 #include <future>
 
+class DroneMissionPlan;
+
 using f_handler_normal = std::function<void()>;
 
 // Interface
@@ -31,7 +34,8 @@ public:
     Engine& operator=(Engine&&) = delete;
     virtual ~Engine();
     virtual void start_engine();
-    virtual void send_command(const std::string &command);
+    virtual void send_command(std::string_view command);
+    virtual void send_mission_plan(const DroneMissionPlan &plan); // Already decoded by the Multi_Drone_Manager
     virtual void set_handler(Handlers f);
     virtual void set_start_signal(std::shared_future<void> start_signal);
     virtual void mark_commands_ready();
@@ -78,58 +78,71 @@ void Multi_Drone_Manager::handle_start_all_command()
     }
 }
 
-void Multi_Drone_Manager::handle_mission_block_command(const std::string &message, const std::string &cmd_type)
+void Multi_Drone_Manager::handle_mission_block_command(std::string_view message, Struct_Drone::Command_Type cmd_type)
 {
     // Group commands by START-FINISH blocks
     // START begins a mission for current drone, FINISH completes it
-    if (cmd_type == "START") {
+    if (drones_.empty()) {
+        Logger::log_message(Logger::Type::WARNING, "No drones to route [" + Struct_Drone::to_string(cmd_type) + "] to");
+        notify_manager_error(-1);
+        return;
+    }
+
+    if (cmd_type == Struct_Drone::Command_Type::START) {
         current_drone_index_ = next_drone_.fetch_add(1) % drones_.size();
         Logger::log_message(Logger::Type::INFO,
             "Starting mission block for Drone " + std::to_string(current_drone_index_));
     }
 
     Logger::log_message(Logger::Type::INFO,
-        "Routing command [" + cmd_type + "] to Drone " + std::to_string(current_drone_index_));
+        "Routing command [" + Struct_Drone::to_string(cmd_type) + "] to Drone " + std::to_string(current_drone_index_));
 
     // Send command to current drone
     drones_[current_drone_index_]->send_command(message);
 
-    if (cmd_type == "FINISH") {
+    if (cmd_type == Struct_Drone::Command_Type::FINISH) {
         Logger::log_message(Logger::Type::INFO,
             "Finished mission block for Drone " + std::to_string(current_drone_index_));
     }
 }
 
-void Multi_Drone_Manager::dispatch_command(const std::string &message)
+void Multi_Drone_Manager::handle_mission_plan_command(const DroneMissionPlan &plan)
 {
-    auto decoded = Enc_Dec_Drone::decode_to_drone(message);
-    if (decoded.first == Enc_Dec_Drone::Drone::ERROR) {
-        Logger::log_message(Logger::Type::ERROR, "Error decoding message in Multi_Drone_Manager");
-        notify_manager_error(-1); // -1 indicates error not from specific drone
-        return;
-    }
-
-    if (decoded.first == Enc_Dec_Drone::Drone::UNKNOWN) {
-        Logger::log_message(Logger::Type::WARNING, "Unknown message type in Multi_Drone_Manager");
+    // A plan carries the whole route of one drone, so it is routed by its id instead of by START-FINISH blocks
+    const int drone_id = plan.drone_id();
+    if (drone_id < 0 || static_cast<size_t>(drone_id) >= drones_.size()) {
+        Logger::log_message(Logger::Type::WARNING,
+            "Mission plan for drone " + std::to_string(drone_id) + " rejected, the fleet has " + std::to_string(drones_.size()) + " drones");
         notify_manager_error(-1);
         return;
     }
 
-    if (decoded.first != Enc_Dec_Drone::Drone::COMMAND) {
-        return;
-    }
-
-    auto command = dynamic_cast<DroneCommandString*>(decoded.second.get());
-    if (!command) {
-        return;
-    }
+    Logger::log_message(Logger::Type::INFO, "Routing mission plan to Drone " + std::to_string(drone_id));
+    drones_[static_cast<size_t>(drone_id)]->send_mission_plan(plan);
+}
 
-    std::string cmd_type = command->type_command();
-    if (cmd_type == "START_ALL") {
-        handle_start_all_command();
-    } else {
-        handle_mission_block_command(message, cmd_type);
-    }
+void Multi_Drone_Manager::dispatch_command(std::string_view message)
+{
+    dispatch(Enc_Dec_Drone::decode_to_drone(message),
+        [this](const DroneMissionPlan &plan) {
+            handle_mission_plan_command(plan);
+        },
+        [this, message](const DroneCommandString &command) {
+            const Struct_Drone::Command_Type cmd_type = Enc_Dec_Drone::decode_command_type(command);
+            if (cmd_type == Struct_Drone::Command_Type::START_ALL) {
+                handle_start_all_command();
+            } else {
+                handle_mission_block_command(message, cmd_type);
+            }
+        },
+        [this](Decode_Error) {
+            Logger::log_message(Logger::Type::ERROR, "Error decoding message in Multi_Drone_Manager");
+            notify_manager_error(-1); // -1 indicates error not from specific drone
+        },
+        [this](Unknown_Message) {
+            Logger::log_message(Logger::Type::WARNING, "Unknown message type in Multi_Drone_Manager");
+            notify_manager_error(-1);
+        });
 }
 
 void Multi_Drone_Manager::flush_all_recorders()
@@ -29,13 +29,14 @@ public:
 
     void set_handlers(Handlers handlers);
     void start_all();
-    void dispatch_command(const std::string &message);
+    void dispatch_command(std::string_view message);
     void flush_all_recorders();
 
 private:
     void notify_manager_error(int drone_id);
     void handle_start_all_command();
-    void handle_mission_block_command(const std::string &message, const std::string &cmd_type);
+    void handle_mission_block_command(std::string_view message, Struct_Drone::Command_Type cmd_type);
+    void handle_mission_plan_command(const DroneMissionPlan &plan);
     void on_drone_complete();
     void on_drone_error(int drone_id);
     void ensure_start_signal();
@@ -15,6 +15,7 @@
 #include <sstream>
 #include <fstream>
 #include <cmath>
+#include <iterator>
 #include <signal.h>
 #include <sys/wait.h>
 
@@ -260,65 +261,93 @@ void PX4_Wrapper::start_engine()
     execute_mission();
 }
 
-void PX4_Wrapper::send_command(const std::string &command)
+void PX4_Wrapper::send_command(std::string_view command)
 {
     if (command_upload_) return;
-    auto [type, decoded_msg] = Enc_Dec_Drone::decode_to_drone(command);
 
-    switch (type) {
-        case Enc_Dec_Drone::Drone::UNKNOWN:
-            log_message(Logger::Type::WARNING, "Unknown message received");
-            if (handlers().error) {
-                handlers().error(drone_config().drone_id);
-            }
-            break;
-        case Enc_Dec_Drone::Drone::ERROR:
-            log_message(Logger::Type::WARNING, "Error decoding message");
-            if (handlers().error) {
-                handlers().error(drone_config().drone_id);
-            }
-            break;
-        case Enc_Dec_Drone::Drone::COMMAND: {
-            auto my_msg = dynamic_cast<DroneCommandString*>(decoded_msg.get());
-            if (my_msg) {
-
-                Struct_Drone::MessagePX4 mission_cmd;
-                if (!Enc_Dec_Drone::decode_PX4_command(*my_msg, mission_cmd))
-                {
-                    log_message(Logger::Type::WARNING, "Unabled to decode Command message");
-                    return;
-                }
-                log_message(Logger::Type::INFO, "Processing command: " + mission_cmd.type);
-                log_message(Logger::Type::INFO, "Mission coords: (" + 
-                    std::to_string(mission_cmd.mission_item.latitude_deg) + ", " + 
-                    std::to_string(mission_cmd.mission_item.longitude_deg) + ")");
-                
-                if (recorder_) {
-                    Drone_Recorder::Command_Log cmd_log{
-                        get_current_timestamp(),
-                        drone_config().drone_id,
-                        "COMMAND_RECEIVED",
-                        "SUCCESS",
-                        "Type: " + mission_cmd.type + " at (" + 
-                        std::to_string(mission_cmd.mission_item.latitude_deg) + ", " +
-                        std::to_string(mission_cmd.mission_item.longitude_deg) + ")"
-                    };
-                    recorder_->log_command(cmd_log);
-                }
-                
-                {
-                    std::lock_guard<std::mutex> lock(mission_mutex_);
-                    commands_.push_back(mission_cmd);
-                }
-            }
-            break;
-        }
-        default:
-            log_message(Logger::Type::WARNING, "Unhandled message type");
-            if (handlers().error) {
-                handlers().error(drone_config().drone_id);
-            }
-            break;
+    dispatch(Enc_Dec_Drone::decode_to_drone(command),
+        [this](const DroneCommandString &message) { queue_command(message); },
+        [this](const DroneMissionPlan &plan) { queue_mission_plan(plan); },
+        [this](Decode_Error) { reject_command("Error decoding message"); },
+        [this](Unknown_Message) { reject_command("Unknown message received"); });
+}
+
+void PX4_Wrapper::send_mission_plan(const DroneMissionPlan &plan)
+{
+    if (command_upload_) return;
+
+    queue_mission_plan(plan);
+}
+
+void PX4_Wrapper::reject_command(const std::string &reason)
+{
+    log_message(Logger::Type::WARNING, reason);
+    if (handlers().error) {
+        handlers().error(drone_config().drone_id);
+    }
+}
+
+void PX4_Wrapper::queue_command(const DroneCommandString &command)
+{
+    Struct_Drone::MessagePX4 mission_cmd;
+    if (!Enc_Dec_Drone::decode_PX4_command(command, mission_cmd))
+    {
+        log_message(Logger::Type::WARNING, "Unabled to decode Command message");
+        return;
+    }
+    log_message(Logger::Type::INFO, "Processing command: " + Struct_Drone::to_string(mission_cmd.type));
+    log_message(Logger::Type::INFO, "Mission coords: (" + 
+        std::to_string(mission_cmd.mission_item.latitude_deg) + ", " + 
+        std::to_string(mission_cmd.mission_item.longitude_deg) + ")");
+
+    if (recorder_) {
+        Drone_Recorder::Command_Log cmd_log{
+            get_current_timestamp(),
+            drone_config().drone_id,
+            "COMMAND_RECEIVED",
+            "SUCCESS",
+            "Type: " + Struct_Drone::to_string(mission_cmd.type) + " at (" + 
+            std::to_string(mission_cmd.mission_item.latitude_deg) + ", " +
+            std::to_string(mission_cmd.mission_item.longitude_deg) + ")"
+        };
+        recorder_->log_command(cmd_log);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mission_mutex_);
+        commands_.push_back(mission_cmd);
+    }
+}
+
+void PX4_Wrapper::queue_mission_plan(const DroneMissionPlan &plan)
+{
+    int plan_drone_id = -1;
+    std::vector<Struct_Drone::MessagePX4> plan_commands;
+    if (!Enc_Dec_Drone::decode_mission_plan(plan, plan_drone_id, plan_commands))
+    {
+        log_message(Logger::Type::WARNING, "Unabled to decode Mission plan message");
+        return;
+    }
+    log_message(Logger::Type::INFO, "Processing mission plan with " + std::to_string(plan_commands.size()) + " waypoints");
+
+    if (recorder_) {
+        Drone_Recorder::Command_Log cmd_log{
+            get_current_timestamp(),
+            drone_config().drone_id,
+            "MISSION_PLAN_RECEIVED",
+            "SUCCESS",
+            "Waypoints: " + std::to_string(plan_commands.size()) + " from (" +
+            std::to_string(plan_commands.front().mission_item.latitude_deg) + ", " +
+            std::to_string(plan_commands.front().mission_item.longitude_deg) + ")"
+        };
+        recorder_->log_command(cmd_log);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mission_mutex_);
+        commands_.insert(commands_.end(),
+                         std::make_move_iterator(plan_commands.begin()),
+                         std::make_move_iterator(plan_commands.end()));
     }
 }
 
@@ -358,7 +387,7 @@ std::vector<Mission::MissionItem> PX4_Wrapper::build_mission_items() {
 
         auto& prev = sanitized_commands.back();
         if (same_coordinate(prev, cmd)) {
-            if (cmd.type == "FINISH" && prev.type != "FINISH") {
+            if (cmd.type == Struct_Drone::Command_Type::FINISH && prev.type != Struct_Drone::Command_Type::FINISH) {
                 log_message(Logger::Type::INFO,
                     "Collapsing duplicate waypoint into FINISH at (" +
                     std::to_string(cmd.mission_item.latitude_deg) + ", " +
@@ -379,7 +408,7 @@ std::vector<Mission::MissionItem> PX4_Wrapper::build_mission_items() {
             cmd.mission_item.latitude_deg,
             cmd.mission_item.longitude_deg);
 
-        if (spacing_m < min_waypoint_spacing_m && cmd.type != "FINISH") {
+        if (spacing_m < min_waypoint_spacing_m && cmd.type != Struct_Drone::Command_Type::FINISH) {
             log_message(Logger::Type::INFO,
                 "Skipping too-close waypoint (" + std::to_string(spacing_m) + "m < " +
                 std::to_string(min_waypoint_spacing_m) + "m) at (" +
@@ -400,7 +429,7 @@ std::vector<Mission::MissionItem> PX4_Wrapper::build_mission_items() {
     std::vector<Mission::MissionItem> mission_items;
 
     for (const auto& cmd : sanitized_commands) {
-        log_message(Logger::Type::INFO, "Adding waypoint [" + cmd.type + "] (" + 
+        log_message(Logger::Type::INFO, "Adding waypoint [" + Struct_Drone::to_string(cmd.type) + "] (" + 
                            std::to_string(cmd.mission_item.latitude_deg) + ", " +
                            std::to_string(cmd.mission_item.longitude_deg) + ") alt: " +
                            std::to_string(cmd.mission_item.relative_altitude_m) + "m");
@@ -14,6 +14,7 @@
 #include "Engine.h"
 #include "Drone_Recorder.h"
 #include "structs/Structs_Drone.h"
+#include "generated_proto/messages_drone.pb.h"
 
 #if __has_include(<mavsdk/mavsdk.h>)
 #include <mavsdk/mavsdk.h>
@@ -91,6 +92,9 @@ private:
         mavsdk::Mission::MissionItem::CameraAction camera_action);
     
     mavsdk::Mission::MissionItem::CameraAction convert_camera_action(Struct_Drone::CameraAction action);
+    void queue_command(const DroneCommandString &command);
+    void queue_mission_plan(const DroneMissionPlan &plan);
+    void reject_command(const std::string &reason);
     std::vector<mavsdk::Mission::MissionItem> build_mission_items();
     bool upload_mission_plan(const std::vector<mavsdk::Mission::MissionItem>& mission_items);
     bool wait_system_healthy();
@@ -113,7 +117,8 @@ public:
     void mark_commands_ready() override;
     void flush_recorder() override;
     void start_engine() override;
-    void send_command(const std::string &command) override;
+    void send_command(std::string_view command) override;
+    void send_mission_plan(const DroneMissionPlan &plan) override;
     void set_handler(Handlers f) override;
 };
 
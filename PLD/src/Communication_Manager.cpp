@@ -9,6 +9,7 @@
  * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 #include "Communication_Manager.h"
 
+#include <optional>
 #include <thread>
 #include <chrono>
 #include "common_libs/Logger.h"
@@ -16,13 +17,14 @@
 
 constexpr int NUMBER_ATTEMPS_MAX = 10;
 constexpr int RATE_STATUS_MESSAGE = 1;
+constexpr size_t COMPRESSION_THRESHOLD_BYTES = 16 * 1024;
 
 Communication_Manager::Communication_Manager(boost::asio::io_context& io_context, 
                                              const tcp::endpoint& endpoint): io_context_(io_context),
-                                                                             server_(io_context),
+                                                                             strand_(boost::asio::make_strand(io_context)),
+                                                                             server_(io_context, strand_),
                                                                              endpoint_(endpoint),
-                                                                             status_timer_(io_context_),
-                                                                             status_(Structs_PLD::Status::WAITING_INFO)
+                                                                             status_timer_(strand_)
 {
     Server::handlers handler_obj;
 
@@ -63,6 +65,11 @@ boost::asio::io_context& Communication_Manager::get_io_context() const
     return io_context_;
 }
 
+const io_strand& Communication_Manager::get_strand() const
+{
+    return strand_;
+}
+
 void Communication_Manager::on_connect_client()
 {
     attemps_ = 0;
@@ -84,11 +91,19 @@ void Communication_Manager::send_status_message(const boost::system::error_code&
 
     Logger::log_message(Logger::Type::INFO,"Sending status message");
 
-    std::string message;
-    if (!Enc_Dec_PLD::encode_status_pld(get_status(),message)) {
-        Logger::log_message(Logger::Type::WARNING,"Problems encoding status message");
-    } else {
-        deliver(message);
+    std::map<std::string, Mission_status> missions;
+    {
+        std::lock_guard<std::mutex> lock(mutex_status_);
+        missions = missions_;
+    }
+
+    for (const auto &[mission_id, mission] : missions) {
+        std::string message;
+        if (!Enc_Dec_PLD::encode_status_pld(mission.status,mission.queue,mission_id,message)) {
+            Logger::log_message(Logger::Type::WARNING,"Problems encoding status message");
+        } else {
+            deliver(std::move(message));
+        }
     }
     
     if (!shutting_down_) {
@@ -97,10 +112,22 @@ void Communication_Manager::send_status_message(const boost::system::error_code&
     }
 }
 
-void Communication_Manager::set_status(const Structs_PLD::Status &new_status)
+void Communication_Manager::set_status(const std::string &mission_id, const Structs_PLD::Status &new_status)
 {
     std::lock_guard<std::mutex> lock(mutex_status_);
-    status_ = new_status;
+    missions_[mission_id].status = new_status;
+}
+
+void Communication_Manager::set_queue_status(const std::string &mission_id, const Structs_PLD::Queue_status &queue_status)
+{
+    std::lock_guard<std::mutex> lock(mutex_status_);
+    missions_[mission_id].queue = queue_status;
+}
+
+void Communication_Manager::remove_mission(const std::string &mission_id)
+{
+    std::lock_guard<std::mutex> lock(mutex_status_);
+    missions_.erase(mission_id);
 }
 
 void Communication_Manager::on_error_client(const boost::system::error_code& ec, const Type_Error &type_error)
@@ -110,11 +137,11 @@ void Communication_Manager::on_error_client(const boost::system::error_code& ec,
     boost::system::error_code cancel_ec;
     status_timer_.cancel(cancel_ec);
     
-    if (get_status() == Structs_PLD::Status::FINISH) {
+    if (every_mission_is(Structs_PLD::Status::FINISH)) {
         Logger::log_message(Logger::Type::INFO,"Program task complete, leaving program...");
         io_context_.stop();
         return;
-    } else if (get_status() == Structs_PLD::Status::ERROR) {
+    } else if (every_mission_is(Structs_PLD::Status::ERROR)) {
         Logger::log_message(Logger::Type::ERROR, "Error detected, shutting down program...");
         io_context_.stop();
         return;
@@ -152,7 +179,7 @@ void Communication_Manager::set_message_handler(message_handler handler)
     message_handler_ = std::move(handler);
 }
 
-void Communication_Manager::on_message_client(const std::string& msg) const
+void Communication_Manager::on_message_client(std::string_view msg) const
 {    
     if (shutting_down_) return;
     Logger::log_message(Logger::Type::INFO, "Message received from Client");
@@ -164,19 +191,26 @@ void Communication_Manager::on_message_client(const std::string& msg) const
     }
 }
 
-void Communication_Manager::deliver(const std::string &msg)
+void Communication_Manager::deliver(std::string msg)
 {
-    std::lock_guard<std::mutex> lock(mutex_deliver_);
-    server_.deliver(msg);
+    server_.deliver(std::move(msg));
 }
 
-Structs_PLD::Status Communication_Manager::get_status()
+bool Communication_Manager::every_mission_is(const Structs_PLD::Status &status)
 {
     std::lock_guard<std::mutex> lock(mutex_status_);
-    return status_;
+    if (missions_.empty()) {
+        return false;
+    }
+    for (const auto &[mission_id, mission] : missions_) {
+        if (mission.status != status) {
+            return false;
+        }
+    }
+    return true;
 }
 
-int Communication_Manager::create_server(Server::handlers &handler_obj, const std::string &ip, const std::string &port)
+int Communication_Manager::create_server(const io_strand &strand, Server::handlers &handler_obj, const std::string &ip, const std::string &port, size_t delivery_window)
 {
 
     boost::asio::ip::tcp::endpoint endpoint;
@@ -198,18 +232,57 @@ int Communication_Manager::create_server(Server::handlers &handler_obj, const st
         return -1;
     }
 
-    auto s = std::make_shared<Server>(io_context_);
+    auto s = std::make_shared<Server>(io_context_, strand);
      
     s->set_handlers(handler_obj);
-    number_servers_++;
-    servers_created_[number_servers_] = s;
+    s->set_compression(Server::Compression::LZ4, COMPRESSION_THRESHOLD_BYTES); // Negotiated with Planner and Drone
+    s->set_reliable_delivery(delivery_window);
+
+    int n = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex_servers_);
+        n = static_cast<int>(++number_servers_);
+        servers_created_.emplace(n, Server_Entry{s, strand});
+    }
 
     std::stringstream ss;
-    ss << "Start listening to Server (" << number_servers_ << ") at " << endpoint.address().to_string() << ":" << endpoint.port();
+    ss << "Start listening to Server (" << n << ") at " << endpoint.address().to_string() << ":" << endpoint.port();
     Logger::log_message(Logger::Type::INFO, ss.str());
     s->start_listening(endpoint);
 
-    return number_servers_;
+    return n;
+}
+
+std::shared_ptr<Server> Communication_Manager::find_server(int n)
+{
+    std::lock_guard<std::mutex> lock(mutex_servers_);
+    auto it = servers_created_.find(n);
+    return it == servers_created_.end() ? nullptr : it->second.server;
+}
+
+bool Communication_Manager::accept_reconnection(const int &n)
+{
+    // The Server keeps its unacknowledged frames, so the module resumes where the dropped connection stopped
+    auto server = find_server(n);
+    if (!server) {
+        return false;
+    }
+
+    std::stringstream ss;
+    ss << "Waiting for Server (" << n << ") to reconnect";
+    Logger::log_message(Logger::Type::INFO, ss.str());
+    server->accept_new_connection();
+    return true;
+}
+
+bool Communication_Manager::set_server_handlers(const int &n, const Server::handlers &handler_obj)
+{
+    auto server = find_server(n);
+    if (!server) {
+        return false;
+    }
+    server->set_handlers(handler_obj);
+    return true;
 }
 
 void Communication_Manager::close_connection_to_server(const int &n)
@@ -217,15 +290,37 @@ void Communication_Manager::close_connection_to_server(const int &n)
     std::stringstream ss;
     ss << "Closing connection to Server (" << n << ")";
     Logger::log_message(Logger::Type::INFO, ss.str());
-    if (servers_created_.find(n) != servers_created_.end()) {
-        servers_created_[n]->server_close();
+
+    std::optional<Server_Entry> entry;
+    {
+        std::lock_guard<std::mutex> lock(mutex_servers_);
+        auto it = servers_created_.find(n);
+        if (it != servers_created_.end()) {
+            entry = std::move(it->second);
+            servers_created_.erase(it);
+        }
+    }
+
+    if (entry) {
+        const auto &server = entry->server;
+        const auto stats = server->compression_stats();
+        std::stringstream stats_log;
+        stats_log << "Server (" << n << ") frames received: " << stats.frames_received << " (" << stats.compressed_frames_received
+                  << " compressed), " << stats.payload_bytes_received << " payload bytes in " << stats.wire_bytes_received << " wire bytes";
+        Logger::log_message(Logger::Type::INFO, stats_log.str());
+        server->server_close();
+
+        // The handlers aborted by the close still reach the Server on its strand, it is released after them
+        boost::asio::post(entry->strand, [strand = entry->strand, server]() {
+            boost::asio::post(strand, [server]() {});
+        });
     }
 }
 
-bool Communication_Manager::send_message_to_server(const int &n, const std::string &msg)
+bool Communication_Manager::send_message_to_server(const int &n, std::string msg)
 {
-    if (servers_created_.find(n) != servers_created_.end()) {
-        servers_created_[n]->deliver(msg);
+    if (auto server = find_server(n)) {
+        server->deliver(std::move(msg));
         return true;
     } 
     return false;
@@ -11,47 +11,65 @@
 #include <boost/asio.hpp>
 #include <functional>
 #include <map>
+#include <mutex>
 #include "common_libs/Server.h"
 #include "structs/Structs_PLD.h"
 
 using boost::asio::ip::tcp;
 
-using message_handler = std::function<void(const std::string &)>;
+using message_handler = std::function<void(std::string_view)>;
 
 class Communication_Manager {
 
 private:
     boost::asio::io_context& io_context_;
+    io_strand strand_; // Client server, status timer and message handler
     Server server_;
     tcp::endpoint endpoint_;
     boost::asio::steady_timer status_timer_;
     int attemps_ = 0;
-    Structs_PLD::Status status_;
+    struct Mission_status {
+        Structs_PLD::Status status = Structs_PLD::Status::WAITING_INFO;
+        Structs_PLD::Queue_status queue;
+    };
+    std::map<std::string, Mission_status> missions_; // By mission id, one status message each
     message_handler message_handler_;
     std::mutex mutex_status_;
-    std::mutex mutex_deliver_;
     std::atomic<bool> shutting_down_{false};
+    std::mutex mutex_servers_; // Missions create and reach their servers from their own strands
     unsigned int number_servers_ = 0;
-    std::map<int, std::shared_ptr<Server>> servers_created_;
+    struct Server_Entry {
+        std::shared_ptr<Server> server;
+        io_strand strand; // The one its handlers run on
+    };
+    std::map<int, Server_Entry> servers_created_;
+
+    std::shared_ptr<Server> find_server(int n);
 
     void on_connect_client();
     void on_error_client(const boost::system::error_code& ec, const Type_Error &type_error);
-    void on_message_client(const std::string& msg) const;
+    void on_message_client(std::string_view msg) const;
     void send_status_message(const boost::system::error_code& ec);
-    Structs_PLD::Status get_status();
+    bool every_mission_is(const Structs_PLD::Status &status);
 
 public:
     Communication_Manager(boost::asio::io_context& io_context, const tcp::endpoint& endpoint);
     ~Communication_Manager();
-    void set_status(const Structs_PLD::Status &new_status);
-    void set_message_handler(message_handler handler);
-    void deliver(const std::string &msg);
+    void set_status(const std::string &mission_id, const Structs_PLD::Status &new_status);
+    void set_queue_status(const std::string &mission_id, const Structs_PLD::Queue_status &queue_status);
+    void remove_mission(const std::string &mission_id);
+    void set_message_handler(message_handler handler); // Called on get_strand()
+    void deliver(std::string msg);
     void shutdown();
 
-    int create_server(Server::handlers &handler_obj, const std::string &ip, const std::string &port);
+    // The server's handlers run on `strand`, the one of the state that owns it
+    int create_server(const io_strand &strand, Server::handlers &handler_obj, const std::string &ip, const std::string &port, size_t delivery_window = 0);
+    bool accept_reconnection(const int &n);
+    bool set_server_handlers(const int &n, const Server::handlers &handler_obj); // On the server's strand, when another state takes it over
     void close_connection_to_server(const int &n);
-    bool send_message_to_server(const int &n, const std::string &msg);
+    bool send_message_to_server(const int &n, std::string msg);
 
     boost::asio::io_context& get_io_context() const;
+    const io_strand& get_strand() const;
 
 };
\ No newline at end of file
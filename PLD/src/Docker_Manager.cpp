@@ -11,69 +11,100 @@
 #include <sstream>
 #include "common_libs/Logger.h"
 
-Docker_Manager::Docker_Manager(const std::string &user, 
+namespace {
+void run_start_container(const std::shared_ptr<SSH_Manager> &ssh, const std::string &compose_file, const std::string &container_name, module_handler handler)
+{
+    std::string cmd = "docker compose -f " + compose_file + " up -d " + container_name;
+    ssh->execute_command(cmd, [container_name, handler = std::move(handler)](int exit_code, const std::string &) {
+        const bool success = exit_code == 0;
+        if (success) {
+            Logger::log_message(Logger::Type::INFO, "Container '" + container_name + "' started successfully");
+        } else {
+            Logger::log_message(Logger::Type::ERROR, "Failed to start container '" + container_name + "'");
+        }
+        if (handler) handler(success);
+    });
+}
+
+void run_stop_container(const std::shared_ptr<SSH_Manager> &ssh, const std::string &container_name, module_handler handler)
+{
+    std::string cmd = "docker rm -f " + container_name;
+    ssh->execute_command(cmd, [container_name, handler = std::move(handler)](int exit_code, const std::string &) {
+        const bool success = exit_code == 0;
+        if (success) {
+            Logger::log_message(Logger::Type::INFO, "Container '" + container_name + "' stopped successfully");
+        } else {
+            Logger::log_message(Logger::Type::ERROR, "Failed to stop container '" + container_name + "'");
+        }
+        if (handler) handler(success);
+    });
+}
+
+void run_is_container_running(const std::shared_ptr<SSH_Manager> &ssh, const std::string &compose_file, const std::string &container_name, bool silent, module_handler handler)
+{
+    std::string cmd = "docker compose -f " + compose_file + " ps --services --filter \"status=running\"";
+    ssh->execute_command(cmd, [container_name, silent, handler = std::move(handler)](int exit_code, const std::string &output) {
+        if (exit_code != 0) {
+            Logger::log_message(Logger::Type::ERROR, "Failed to check container status");
+            if (handler) handler(false);
+            return;
+        }
+
+        bool is_running = (output.find(container_name) != std::string::npos);
+
+        if (!silent) {
+            if (is_running) {
+                Logger::log_message(Logger::Type::INFO, "Container '" + container_name + "' is running");
+            } else {
+                Logger::log_message(Logger::Type::INFO, "Container '" + container_name + "' is not running");
+            }
+        }
+
+        if (handler) handler(is_running);
+    });
+}
+}
+
+Docker_Manager::Docker_Manager(const boost::asio::any_io_executor &executor,
+                               const std::string &user, 
                                const std::string &host, 
                                const std::string &file, 
-                               const std::string &key): ssh_manager_(std::make_shared<SSH_Manager>(user, host, key)),
+                               const std::string &key): ssh_manager_(std::make_shared<SSH_Manager>(executor, user, host, key)),
                                                         compose_file_(file)
 {
 }
 
-bool Docker_Manager::start_container(const std::string &container_name) const
+void Docker_Manager::start_module(const std::string &container_name, module_handler handler) const
 {
-    std::string cmd = "docker compose -f " + compose_file_ + " up -d " + container_name;
-    std::string output;
-    bool success = ssh_manager_->execute_command(cmd,output);
-    
-    if (success) {
-        Logger::log_message(Logger::Type::INFO, "Container '" + container_name + "' started successfully");
-    } else {
-        Logger::log_message(Logger::Type::ERROR, "Failed to start container '" + container_name + "'");
-    }
-    
-    return success;
+    run_start_container(ssh_manager_, compose_file_, container_name, guard(std::move(handler)));
 }
 
-bool Docker_Manager::stop_container(const std::string &container_name) const
+void Docker_Manager::stop_module(const std::string &container_name, module_handler handler) const
 {
-    std::string cmd = "docker rm -f " + container_name;
-    std::string output;
-    bool success = ssh_manager_->execute_command(cmd,output);
-    
-    if (success) {
-        Logger::log_message(Logger::Type::INFO, "Container '" + container_name + "' stopped successfully");
-    } else {
-        Logger::log_message(Logger::Type::ERROR, "Failed to stop container '" + container_name + "'");
-    }
-    
-    return success;
+    run_stop_container(ssh_manager_, container_name, guard(std::move(handler)));
 }
 
-bool Docker_Manager::is_container_running(const std::string &container_name, const bool &silent) const
+void Docker_Manager::is_module_running(const std::string &container_name, const bool &silent, module_handler handler) const
 {
-    std::string cmd = "docker compose -f " + compose_file_ + " ps --services --filter \"status=running\"";
-    std::string output;
-    bool success = ssh_manager_->execute_command(cmd,output);
-    
-    if (!success) {
-        Logger::log_message(Logger::Type::ERROR, "Failed to check container status");
-        return false;
-    }
+    run_is_container_running(ssh_manager_, compose_file_, container_name, silent, guard(std::move(handler)));
+}
 
-    bool is_running = (output.find(container_name) != std::string::npos);
-    
-    if (!silent) {
-        if (is_running) {
-            Logger::log_message(Logger::Type::INFO, "Container '" + container_name + "' is running");
-        } else {
-            Logger::log_message(Logger::Type::INFO, "Container '" + container_name + "' is not running");
-        }
-    }
-    
-    return is_running;
+void Docker_Manager::stop_container_if_running(const std::string &container_name) const
+{
+    run_is_container_running(ssh_manager_, compose_file_, container_name, false,
+        [ssh = ssh_manager_, container_name](bool running) {
+            if (running) {
+                run_stop_container(ssh, container_name, nullptr);
+            }
+        });
+}
+
+void Docker_Manager::test_connection(module_handler handler) const
+{
+    ssh_manager_->test_connection(guard(std::move(handler)));
 }
 
-bool Docker_Manager::test_connection() const
+void Docker_Manager::close_connection(module_handler handler) const
 {
-    return ssh_manager_->test_connection();
+    ssh_manager_->close_master(guard(std::move(handler)));
 }
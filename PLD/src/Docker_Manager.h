@@ -8,22 +8,26 @@
  * ============================================================
  * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 #pragma once
+#include "Module_Launcher.h"
 #include "SSH_Manager.h"
 #include <string>
 #include <memory>
 #include <filesystem>
 
-class Docker_Manager {
+// Modules are Docker Compose services on the host reached over SSH, every operation runs asynchronously there
+class Docker_Manager : public Module_Launcher {
 public:
-    Docker_Manager(const std::string &user, const std::string &host,
+    Docker_Manager(const boost::asio::any_io_executor &executor, const std::string &user, const std::string &host,
                    const std::string &compose_path, const std::string &key = "");
 
-    ~Docker_Manager() = default;
+    void start_module(const std::string &container_name, module_handler handler = nullptr) const override;
+    void stop_module(const std::string &container_name, module_handler handler = nullptr) const override;
+    void is_module_running(const std::string &container_name, const bool &silent, module_handler handler) const override;
+    void test_connection(module_handler handler) const override;
+    void close_connection(module_handler handler) const override;
 
-    bool start_container(const std::string &container_name) const;
-    bool stop_container(const std::string &container_name) const;
-    bool is_container_running(const std::string &container_name, const bool &silent = false) const;
-    bool test_connection() const;
+    // Fire and forget: keeps going after the Docker_Manager is destroyed
+    void stop_container_if_running(const std::string &container_name) const;
 
 private:
     std::shared_ptr<SSH_Manager> ssh_manager_;
@@ -0,0 +1,306 @@
+/* ============================================================
+ *  Proyect  : I-Drone
+ *  Filename : Local_Process_Manager.cpp
+ *  Author   : Iván Gutiérrez
+ *  License  : GNU General Public License v3.0
+ *
+ *  © 2025 Iván Gutiérrez.
+ * ============================================================
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+#include "Local_Process_Manager.h"
+#include <cerrno>
+#include <csignal>
+#include <cstdint>
+#include <cstring>
+#include <fcntl.h>
+#include <map>
+#include <mutex>
+#include <sys/syscall.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <vector>
+#if __has_include(<linux/close_range.h>)
+#include <linux/close_range.h>
+#endif
+#include "common_libs/Logger.h"
+
+constexpr int STOP_POLL_MS = 20;
+constexpr int STOP_TIMEOUT_MS = 5000; // Then the module is killed
+constexpr size_t FD_LIST_BUFFER_BYTES = 4096;
+
+namespace {
+
+// Processes started by any launcher of this PLD, by module key
+std::mutex mutex_processes;
+std::map<std::string, pid_t> processes;
+
+// Reaps the module if it has exited, true while it is still running
+bool running_locked(const std::string &key)
+{
+    auto it = processes.find(key);
+    if (it == processes.end()) {
+        return false;
+    }
+    int status = 0;
+    if (waitpid(it->second, &status, WNOHANG) == 0) {
+        return true;
+    }
+    processes.erase(it);
+    return false;
+}
+
+pid_t running_pid(const std::string &key)
+{
+    std::lock_guard<std::mutex> lock(mutex_processes);
+    return running_locked(key) ? processes[key] : -1;
+}
+
+// Entry returned by getdents64, the raw syscall is used because readdir() may allocate
+struct Linux_Dirent64 {
+    uint64_t d_ino;
+    int64_t d_off;
+    unsigned short d_reclen;
+    unsigned char d_type;
+    char d_name[1]; // NUL-terminated, runs past the struct
+};
+
+// Marks every descriptor from first_fd up as close-on-exec; async-signal-safe, it runs between fork and exec.
+// close_range() needs Linux 5.11, older kernels get the descriptors listed in /proc/self/fd
+bool set_cloexec_from(int first_fd)
+{
+#if defined(SYS_close_range) && defined(CLOSE_RANGE_CLOEXEC)
+    if (syscall(SYS_close_range, static_cast<unsigned int>(first_fd), ~0U, CLOSE_RANGE_CLOEXEC) == 0) {
+        return true;
+    }
+#endif
+
+    const int dir = open("/proc/self/fd", O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (dir < 0) {
+        return false;
+    }
+
+    alignas(Linux_Dirent64) char buffer[FD_LIST_BUFFER_BYTES];
+    long bytes;
+    while ((bytes = syscall(SYS_getdents64, dir, buffer, sizeof(buffer))) > 0) {
+        for (long offset = 0; offset < bytes;) {
+            const auto *entry = reinterpret_cast<const Linux_Dirent64 *>(buffer + offset);
+            offset += entry->d_reclen;
+
+            int fd = 0;
+            const char *digit = entry->d_name;
+            if (*digit < '0' || *digit > '9') {
+                continue; // "." and ".."
+            }
+            for (; *digit >= '0' && *digit <= '9'; ++digit) {
+                fd = fd * 10 + (*digit - '0');
+            }
+
+            if (fd >= first_fd && fd != dir) {
+                const int flags = fcntl(fd, F_GETFD);
+                if (flags >= 0) {
+                    fcntl(fd, F_SETFD, flags | FD_CLOEXEC);
+                }
+            }
+        }
+    }
+    close(dir);
+    return bytes == 0;
+}
+
+// fork + exec, with the exec error sent back through a close-on-exec pipe so a missing binary is reported here.
+// Between fork and exec the child only makes async-signal-safe calls, the PLD is multithreaded
+pid_t spawn(std::vector<std::string> argv)
+{
+    std::vector<char*> args;
+    args.reserve(argv.size() + 1);
+    for (auto &arg : argv) {
+        args.push_back(arg.data());
+    }
+    args.push_back(nullptr);
+
+    const int dev_null = open("/dev/null", O_RDWR | O_CLOEXEC);
+    int fds[2];
+    if (dev_null < 0 || pipe2(fds, O_CLOEXEC) != 0) {
+        if (dev_null >= 0) close(dev_null);
+        return -1;
+    }
+
+    const pid_t pid = fork();
+    if (pid < 0) {
+        const int error = errno;
+        close(dev_null);
+        close(fds[0]);
+        close(fds[1]);
+        errno = error;
+        return -1;
+    }
+    if (pid == 0) {
+        // stdin and stdout are detached from the PLD's terminal, stderr is kept for crashes
+        dup2(dev_null, STDIN_FILENO);
+        dup2(dev_null, STDOUT_FILENO);
+        // The PLD's sockets must not outlive it in the module, it is not started if they cannot be closed
+        if (set_cloexec_from(STDERR_FILENO + 1)) {
+            execv(args.front(), args.data());
+        }
+        const int error = errno;
+        (void)!write(fds[1], &error, sizeof(error));
+        _exit(127);
+    }
+
+    close(dev_null);
+    close(fds[1]);
+    int error = 0;
+    ssize_t bytes_read;
+    do {
+        bytes_read = read(fds[0], &error, sizeof(error));
+    } while (bytes_read < 0 && errno == EINTR);
+    close(fds[0]);
+
+    if (bytes_read > 0) {
+        waitpid(pid, nullptr, 0);
+        errno = error;
+        return -1;
+    }
+    return pid;
+}
+
+struct Stop_Operation {
+    explicit Stop_Operation(const boost::asio::any_io_executor &executor): timer(executor) {}
+
+    boost::asio::steady_timer timer;
+    std::string key;
+    std::string name;
+    pid_t pid = -1;
+    int waited_ms = 0;
+    module_handler handler;
+};
+
+void wait_for_exit(const std::shared_ptr<Stop_Operation> &op);
+
+void poll_exit(const std::shared_ptr<Stop_Operation> &op)
+{
+    op->waited_ms += STOP_POLL_MS;
+    op->timer.expires_after(std::chrono::milliseconds(STOP_POLL_MS));
+    op->timer.async_wait([op](const boost::system::error_code &) {
+        wait_for_exit(op);
+    });
+}
+
+void wait_for_exit(const std::shared_ptr<Stop_Operation> &op)
+{
+    bool running;
+    {
+        std::lock_guard<std::mutex> lock(mutex_processes);
+        running = running_locked(op->key);
+    }
+
+    // Called without the lock, the handler may start the module again
+    if (!running) {
+        Logger::log_message(Logger::Type::INFO, "Module '" + op->name + "' stopped successfully");
+        if (op->handler) op->handler(true);
+        return;
+    }
+
+    if (op->waited_ms >= STOP_TIMEOUT_MS) {
+        Logger::log_message(Logger::Type::WARNING, "Module '" + op->name + "' did not stop in time, killing it");
+        kill(op->pid, SIGKILL);
+        op->waited_ms = 0; // SIGKILL cannot be ignored, the next polls reap it
+    }
+    poll_exit(op);
+}
+}
+
+Local_Process_Manager::Local_Process_Manager(const boost::asio::any_io_executor &executor,
+                                             const std::filesystem::path &module_dir,
+                                             const std::string &pld_address,
+                                             const std::string &pld_port): executor_(executor),
+                                                                           module_dir_(module_dir),
+                                                                           pld_address_(pld_address),
+                                                                           pld_port_(pld_port)
+{
+}
+
+std::string Local_Process_Manager::key_of(const std::string &name) const
+{
+    // Concurrent fleets run the same binary against different PLD ports
+    return (module_dir_ / name).string() + '@' + pld_address_ + ':' + pld_port_;
+}
+
+void Local_Process_Manager::post(module_handler handler, bool result) const
+{
+    if (!handler) {
+        return;
+    }
+    boost::asio::post(executor_, [handler = guard(std::move(handler)), result]() {
+        handler(result);
+    });
+}
+
+void Local_Process_Manager::start_module(const std::string &name, module_handler handler) const
+{
+    const std::string key = key_of(name);
+    std::unique_lock<std::mutex> lock(mutex_processes);
+    if (running_locked(key)) {
+        lock.unlock();
+        Logger::log_message(Logger::Type::INFO, "Module '" + name + "' is already running");
+        post(std::move(handler), true);
+        return;
+    }
+
+    const std::string binary = (module_dir_ / name).string();
+    const pid_t pid = spawn({binary, "--PLD_Address", pld_address_, "--PLD_port", pld_port_});
+    if (pid < 0) {
+        const std::string reason = std::strerror(errno);
+        lock.unlock();
+        Logger::log_message(Logger::Type::ERROR, "Failed to start module '" + name + "' from " + binary + ": " + reason);
+        post(std::move(handler), false);
+        return;
+    }
+    processes[key] = pid;
+    lock.unlock();
+
+    Logger::log_message(Logger::Type::INFO, "Module '" + name + "' started successfully with pid " + std::to_string(pid));
+    post(std::move(handler), true);
+}
+
+void Local_Process_Manager::stop_module(const std::string &name, module_handler handler) const
+{
+    const std::string key = key_of(name);
+    const pid_t pid = running_pid(key);
+    if (pid < 0) {
+        Logger::log_message(Logger::Type::INFO, "Module '" + name + "' stopped successfully");
+        post(std::move(handler), true);
+        return;
+    }
+
+    kill(pid, SIGTERM);
+    auto op = std::make_shared<Stop_Operation>(executor_);
+    op->key = key;
+    op->name = name;
+    op->pid = pid;
+    op->handler = guard(std::move(handler));
+    poll_exit(op);
+}
+
+void Local_Process_Manager::is_module_running(const std::string &name, const bool &silent, module_handler handler) const
+{
+    const bool is_running = running_pid(key_of(name)) >= 0;
+    if (!silent) {
+        if (is_running) {
+            Logger::log_message(Logger::Type::INFO, "Module '" + name + "' is running");
+        } else {
+            Logger::log_message(Logger::Type::INFO, "Module '" + name + "' is not running");
+        }
+    }
+    post(std::move(handler), is_running);
+}
+
+void Local_Process_Manager::test_connection(module_handler handler) const
+{
+    std::error_code ec;
+    const bool found = std::filesystem::is_directory(module_dir_, ec);
+    if (!found) {
+        Logger::log_message(Logger::Type::ERROR, "Module directory " + module_dir_.string() + " not found");
+    }
+    post(std::move(handler), found);
+}
@@ -0,0 +1,37 @@
+/* ============================================================
+ *  Proyect  : I-Drone
+ *  Filename : Local_Process_Manager.h
+ *  Author   : Iván Gutiérrez
+ *  License  : GNU General Public License v3.0
+ *
+ *  © 2025 Iván Gutiérrez.
+ * ============================================================
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+#pragma once
+#include <filesystem>
+#include <string>
+#include <boost/asio.hpp>
+#include "Module_Launcher.h"
+
+// Modules are processes on this machine: the executable `module_dir/<name>`, the real binary or a stand-in,
+// is forked and exec'd with the PLD address it has to connect to. Running modules are tracked for the
+// whole PLD, so every launcher for the same module sees the same process
+class Local_Process_Manager : public Module_Launcher {
+public:
+    Local_Process_Manager(const boost::asio::any_io_executor &executor, const std::filesystem::path &module_dir,
+                          const std::string &pld_address, const std::string &pld_port);
+
+    void start_module(const std::string &name, module_handler handler = nullptr) const override;
+    void stop_module(const std::string &name, module_handler handler = nullptr) const override;
+    void is_module_running(const std::string &name, const bool &silent, module_handler handler) const override;
+    void test_connection(module_handler handler) const override;
+
+private:
+    boost::asio::any_io_executor executor_;
+    std::filesystem::path module_dir_;
+    std::string pld_address_;
+    std::string pld_port_;
+
+    std::string key_of(const std::string &name) const;
+    void post(module_handler handler, bool result) const;
+};
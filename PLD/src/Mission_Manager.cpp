@@ -0,0 +1,149 @@
+/* ============================================================
+ *  Proyect  : I-Drone
+ *  Filename : Mission_Manager.cpp
+ *  Author   : Iván Gutiérrez
+ *  License  : GNU General Public License v3.0
+ *
+ *  © 2025 Iván Gutiérrez.
+ * ============================================================
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+#include "Mission_Manager.h"
+#include <algorithm>
+#include "./states/Off_State.h"
+#include "common_libs/Enc_Dec_PLD.h"
+#include "common_libs/Logger.h"
+
+constexpr const char* DEFAULT_MISSION_ID = ""; // Missions from a Client that sends no id
+constexpr size_t MAX_MISSION_ID_LENGTH = 64;
+
+namespace {
+bool is_valid_mission_id(const std::string &mission_id)
+{
+    if (mission_id.size() > MAX_MISSION_ID_LENGTH) {
+        return false;
+    }
+    return std::all_of(mission_id.begin(), mission_id.end(), [](char c) {
+        return (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') || c == '_' || c == '-';
+    });
+}
+}
+
+Mission_Manager::Mission_Manager(std::shared_ptr<Communication_Manager> comm_mng,
+                                 std::shared_ptr<Module_Pool> module_pool,
+                                 const std::filesystem::path &data_path): cmm_manager_(std::move(comm_mng)),
+                                                                          module_pool_(std::move(module_pool)),
+                                                                          data_path_(data_path)
+{
+}
+
+void Mission_Manager::start()
+{
+    cmm_manager_->set_message_handler([this](std::string_view message) { handle_message(message); });
+    create_mission(DEFAULT_MISSION_ID);
+}
+
+std::shared_ptr<State_Machine> Mission_Manager::create_mission(const std::string &mission_id)
+{
+    // Each fleet records its sessions in its own directory, the default one keeps the top level
+    const auto recorder_path = mission_id.empty() ? data_path_ : data_path_ / ("mission_" + mission_id);
+    auto recorder = std::make_shared<PLD_Recorder>(recorder_path);
+
+    auto state_machine = std::make_shared<State_Machine>(mission_id, cmm_manager_, recorder, module_pool_);
+    state_machine->set_finish_handler([weak = weak_from_this(), mission_id]() {
+        if (auto self = weak.lock()) {
+            self->on_mission_finished(mission_id);
+        }
+    });
+    missions_[mission_id] = state_machine;
+
+    if (!mission_id.empty()) {
+        Logger::log_message(Logger::Type::INFO, "Mission '" + mission_id + "' created, " + std::to_string(missions_.size()) + " missions hosted");
+    }
+
+    boost::asio::post(state_machine->get_strand(), [state_machine]() {
+        state_machine->transitionTo(std::make_unique<Off_State>(state_machine));
+    });
+    return state_machine;
+}
+
+void Mission_Manager::handle_message(std::string_view message)
+{
+    // Decoded once here, the mission's state works on the result. Undecodable messages go to the default
+    // mission, which reports them
+    Enc_Dec_PLD::From_Client decoded = Enc_Dec_PLD::decode_from_client(message);
+    std::string mission_id;
+    if (!Enc_Dec_PLD::mission_id_of(decoded, mission_id)) {
+        mission_id = DEFAULT_MISSION_ID;
+    }
+
+    if (!is_valid_mission_id(mission_id)) {
+        Logger::log_message(Logger::Type::WARNING, "Message with an invalid mission id ignored, ids are up to " +
+                            std::to_string(MAX_MISSION_ID_LENGTH) + " letters, digits, '_' or '-'");
+        return;
+    }
+
+    auto it = missions_.find(mission_id);
+    if (it == missions_.end()) {
+        // Only a configuration can open a mission, a command for an unknown one has nothing to act on
+        if (!std::holds_alternative<Config_mission>(decoded)) {
+            Logger::log_message(Logger::Type::WARNING, "Message for unknown mission '" + mission_id + "' ignored");
+            return;
+        }
+        deliver_to(create_mission(mission_id), std::move(decoded), message);
+        return;
+    }
+
+    deliver_to(it->second, std::move(decoded), message);
+}
+
+void Mission_Manager::deliver_to(const std::shared_ptr<State_Machine> &state_machine, Enc_Dec_PLD::From_Client message, std::string_view raw)
+{
+    // The view dies with this call, the copy is what crosses to the mission's strand. Client messages are small
+    boost::asio::post(state_machine->get_strand(), [state_machine, message = std::move(message), raw = std::string(raw)]() {
+        state_machine->handleMessage(message, raw);
+    });
+}
+
+void Mission_Manager::on_mission_finished(const std::string &mission_id)
+{
+    // Called on the mission's strand, with the Off State that received the FINISH still on the stack
+    boost::asio::post(cmm_manager_->get_strand(), [self = shared_from_this(), mission_id]() {
+        auto it = self->missions_.find(mission_id);
+        if (it == self->missions_.end()) {
+            return;
+        }
+        auto state_machine = it->second;
+        self->missions_.erase(it);
+        Logger::log_message(Logger::Type::INFO, "Mission '" + mission_id + "' closed, " + std::to_string(self->missions_.size()) + " missions hosted");
+
+        // Its states are torn down on its own strand, then the table is checked again: a new mission may have come in
+        boost::asio::post(state_machine->get_strand(), [self, state_machine]() {
+            state_machine->close();
+            boost::asio::post(self->cmm_manager_->get_strand(), [self]() {
+                self->shutdown_if_empty();
+            });
+        });
+    });
+}
+
+void Mission_Manager::shutdown_if_empty()
+{
+    if (!missions_.empty()) {
+        return;
+    }
+
+    // Idle modules would otherwise keep running, the Drone simulation waiting for a PLD that is gone
+    Logger::log_message(Logger::Type::INFO, "No missions left, shutting down");
+    module_pool_->drain([self = shared_from_this()]() {
+        self->cmm_manager_->get_io_context().stop();
+    });
+}
+
+void Mission_Manager::close_recorders()
+{
+    for (const auto &[mission_id, state_machine] : missions_) {
+        if (state_machine->getRecorder()) {
+            state_machine->getRecorder()->close();
+        }
+    }
+}
@@ -0,0 +1,42 @@
+/* ============================================================
+ *  Proyect  : I-Drone
+ *  Filename : Mission_Manager.h
+ *  Author   : Iván Gutiérrez
+ *  License  : GNU General Public License v3.0
+ *
+ *  © 2025 Iván Gutiérrez.
+ * ============================================================
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+#pragma once
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <string>
+#include <string_view>
+#include "Communication_Manager.h"
+#include "Module_Pool.h"
+#include "State_Machine.h"
+
+// Hosts one State_Machine per mission id, all on the same io_context, each on its own strand. Client
+// messages are routed by the mission id they carry, on the Client server's strand, which also guards the
+// mission table; a Client that sends none drives the default mission, created at start. Mission ids name
+// the mission's recording directory, so only letters, digits, '_' and '-' are accepted
+class Mission_Manager : public std::enable_shared_from_this<Mission_Manager> {
+public:
+    Mission_Manager(std::shared_ptr<Communication_Manager> comm_mng, std::shared_ptr<Module_Pool> module_pool, const std::filesystem::path &data_path);
+
+    void start();
+    void close_recorders(); // Once the io_context threads have stopped
+
+private:
+    std::shared_ptr<Communication_Manager> cmm_manager_;
+    std::shared_ptr<Module_Pool> module_pool_;
+    std::filesystem::path data_path_;
+    std::map<std::string, std::shared_ptr<State_Machine>> missions_;
+
+    void handle_message(std::string_view message);
+    std::shared_ptr<State_Machine> create_mission(const std::string &mission_id);
+    void deliver_to(const std::shared_ptr<State_Machine> &state_machine, Enc_Dec_PLD::From_Client message, std::string_view raw);
+    void on_mission_finished(const std::string &mission_id);
+    void shutdown_if_empty();
+};
@@ -0,0 +1,36 @@
+/* ============================================================
+ *  Proyect  : I-Drone
+ *  Filename : Module_Launcher.cpp
+ *  Author   : Iván Gutiérrez
+ *  License  : GNU General Public License v3.0
+ *
+ *  © 2025 Iván Gutiérrez.
+ * ============================================================
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+#include "Module_Launcher.h"
+
+Module_Launcher::Module_Launcher(): alive_(std::make_shared<std::atomic<bool>>(true))
+{
+}
+
+Module_Launcher::~Module_Launcher()
+{
+    *alive_ = false;
+}
+
+void Module_Launcher::close_connection(module_handler handler) const
+{
+    if (handler) handler(true); // Nothing is kept open by default
+}
+
+module_handler Module_Launcher::guard(module_handler handler) const
+{
+    if (!handler) {
+        return nullptr;
+    }
+    return [alive = alive_, handler = std::move(handler)](bool result) {
+        if (*alive) {
+            handler(result);
+        }
+    };
+}
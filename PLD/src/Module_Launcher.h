@@ -0,0 +1,45 @@
+/* ============================================================
+ *  Proyect  : I-Drone
+ *  Filename : Module_Launcher.h
+ *  Author   : Iván Gutiérrez
+ *  License  : GNU General Public License v3.0
+ *
+ *  © 2025 Iván Gutiérrez.
+ * ============================================================
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+#pragma once
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <string>
+
+using module_handler = std::function<void(bool)>;
+
+// How the PLD brings the Planner and Drone modules up: Docker containers over SSH, or local processes
+// for integration and load runs on a single machine
+enum class Module_Backend {
+    DOCKER,
+    LOCAL
+};
+
+// Starts, stops and checks one module, named by its service. Every operation is asynchronous and its
+// handler is called on the executor the launcher was created with, the owner's strand. Handlers are
+// dropped once the launcher is destroyed, so a state can pass `this` safely. The destruction itself is
+// expected on that strand too: a handler already running there is not waited for
+class Module_Launcher {
+public:
+    Module_Launcher();
+    virtual ~Module_Launcher();
+
+    virtual void start_module(const std::string &name, module_handler handler = nullptr) const = 0;
+    virtual void stop_module(const std::string &name, module_handler handler = nullptr) const = 0;
+    virtual void is_module_running(const std::string &name, const bool &silent, module_handler handler) const = 0; // true if running
+    virtual void test_connection(module_handler handler) const = 0; // true if modules can be started
+    virtual void close_connection(module_handler handler) const; // Releases what the launcher keeps open to the host
+
+    // Wraps a handler so it is dropped once this launcher is destroyed
+    module_handler guard(module_handler handler) const;
+
+private:
+    std::shared_ptr<std::atomic<bool>> alive_; // Shared with the guarded handlers
+};
@@ -0,0 +1,278 @@
+/* ============================================================
+ *  Proyect  : I-Drone
+ *  Filename : Module_Pool.cpp
+ *  Author   : Iván Gutiérrez
+ *  License  : GNU General Public License v3.0
+ *
+ *  © 2025 Iván Gutiérrez.
+ * ============================================================
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+#include "Module_Pool.h"
+#include "Docker_Manager.h"
+#include "Local_Process_Manager.h"
+#include "common_libs/Logger.h"
+
+Module_Pool::Module_Pool(boost::asio::io_context &io_context, size_t capacity, Module_Backend backend, std::filesystem::path module_dir):
+    strand_(boost::asio::make_strand(io_context)),
+    capacity_(capacity),
+    backend_(backend),
+    module_dir_(std::move(module_dir))
+{
+}
+
+std::shared_ptr<Module_Launcher> Module_Pool::make_launcher(const boost::asio::any_io_executor &executor, const Structs_PLD::Info_Module &module) const
+{
+    if (backend_ == Module_Backend::LOCAL) {
+        // The module connects back to the server the PLD opens for it
+        return std::make_shared<Local_Process_Manager>(executor, module_dir_, module.module_ip, module.port);
+    }
+    return std::make_shared<Docker_Manager>(executor, module.user, module.ssh_ip, module.docker_file, module.key);
+}
+
+size_t Module_Pool::capacity() const
+{
+    return capacity_;
+}
+
+std::string Module_Pool::key_of(const Structs_PLD::Info_Module &module)
+{
+    return module.user + '@' + module.ssh_ip + ':' + module.docker_file + '#' + module.docker_name;
+}
+
+Module_Pool::Instance& Module_Pool::instance_for(const Structs_PLD::Info_Module &module)
+{
+    auto it = instances_.find(key_of(module));
+    if (it == instances_.end()) {
+        Instance instance;
+        instance.module = module;
+        instance.launcher = make_launcher(strand_, module);
+        it = instances_.emplace(key_of(module), std::move(instance)).first;
+    }
+    return it->second;
+}
+
+size_t Module_Pool::idle_count() const
+{
+    size_t count = 0;
+    for (const auto &[key, instance] : instances_) {
+        if (instance.idle) count++;
+    }
+    return count;
+}
+
+void Module_Pool::acquire(const Structs_PLD::Info_Module &module, module_handler handler)
+{
+    boost::asio::post(strand_, [this, module, handler = std::move(handler)]() mutable {
+        acquire_on_strand(module, std::move(handler));
+    });
+}
+
+void Module_Pool::acquire_on_strand(const Structs_PLD::Info_Module &module, module_handler handler)
+{
+    Instance &instance = instance_for(module);
+
+    // Wait for the start or stop in flight instead of racing it
+    if (instance.settling) {
+        Logger::log_message(Logger::Type::INFO, "Module '" + module.docker_name + "' is starting or stopping, waiting for it");
+        instance.deferred.push_back([this, module, handler = std::move(handler)]() mutable {
+            acquire_on_strand(module, std::move(handler));
+        });
+        return;
+    }
+
+    instance.users++;
+    instance.idle = false;
+    start_for_mission(instance, std::move(handler));
+}
+
+void Module_Pool::start_for_mission(Instance &instance, module_handler handler)
+{
+    // Instances live as long as the pool, std::map keeps their address stable
+    instance.settling = true;
+    instance.launcher->is_module_running(instance.module.docker_name, true, [this, &instance, handler = std::move(handler)](bool running) {
+        if (running) {
+            Logger::log_message(Logger::Type::INFO, "Module '" + instance.module.docker_name + "' already running, reusing it");
+            settle(instance);
+        } else {
+            // The mission does not wait for the start, it waits for the module to connect
+            instance.launcher->start_module(instance.module.docker_name, [this, &instance](bool) {
+                settle(instance);
+            });
+        }
+        if (handler) handler(running);
+    });
+}
+
+void Module_Pool::release(const Structs_PLD::Info_Module &module, bool reusable)
+{
+    boost::asio::post(strand_, [this, module, reusable]() {
+        release_on_strand(module, reusable);
+    });
+}
+
+void Module_Pool::release_on_strand(const Structs_PLD::Info_Module &module, bool reusable)
+{
+    auto it = instances_.find(key_of(module));
+    if (it == instances_.end() || it->second.users == 0) {
+        return;
+    }
+
+    Instance &instance = it->second;
+    if (instance.settling) {
+        instance.deferred.push_back([this, module, reusable]() {
+            release_on_strand(module, reusable);
+        });
+        return;
+    }
+
+    if (--instance.users > 0) {
+        return; // Still serving another mission
+    }
+    instance.released_at = ++release_count_;
+
+    if (capacity_ == 0) {
+        retire(instance);
+        return;
+    }
+
+    if (reusable) {
+        Logger::log_message(Logger::Type::INFO, "Module '" + module.docker_name + "' kept idle for the next mission");
+        instance.idle = true;
+        evict_idle();
+        return;
+    }
+
+    replenish(instance);
+}
+
+void Module_Pool::replenish(Instance &instance)
+{
+    Logger::log_message(Logger::Type::INFO, "Restarting module '" + instance.module.docker_name + "' in the background for the next mission");
+    retire(instance, [this, &instance]() {
+        instance.launcher->start_module(instance.module.docker_name, [this, &instance](bool started) {
+            instance.idle = started;
+            settle(instance);
+            evict_idle();
+        });
+    });
+}
+
+void Module_Pool::retire(Instance &instance, std::function<void()> done)
+{
+    instance.settling = true;
+    instance.idle = false;
+
+    // Without a continuation the instance settles here, otherwise the continuation settles it
+    auto finish = [this, &instance, done = std::move(done)]() {
+        if (done) {
+            done();
+        } else {
+            settle(instance);
+        }
+    };
+
+    instance.launcher->is_module_running(instance.module.docker_name, true, [&instance, finish = std::move(finish)](bool running) {
+        if (!running) {
+            finish();
+            return;
+        }
+        instance.launcher->stop_module(instance.module.docker_name, [finish](bool) {
+            finish();
+        });
+    });
+}
+
+void Module_Pool::settle(Instance &instance)
+{
+    instance.settling = false;
+    auto deferred = std::move(instance.deferred);
+    instance.deferred.clear();
+    for (auto &run : deferred) {
+        run();
+    }
+}
+
+void Module_Pool::evict_idle()
+{
+    while (idle_count() > capacity_) {
+        Instance* oldest = nullptr;
+        for (auto &[key, instance] : instances_) {
+            if (instance.idle && !instance.settling && (!oldest || instance.released_at < oldest->released_at)) {
+                oldest = &instance;
+            }
+        }
+        if (!oldest) {
+            return;
+        }
+        Logger::log_message(Logger::Type::INFO, "Warm pool full, stopping idle module '" + oldest->module.docker_name + "'");
+        retire(*oldest);
+    }
+}
+
+void Module_Pool::drain(std::function<void()> done)
+{
+    boost::asio::post(strand_, [this, done = std::move(done)]() mutable {
+        drain_on_strand(std::move(done));
+    });
+}
+
+void Module_Pool::drain_on_strand(std::function<void()> done)
+{
+    auto pending = std::make_shared<size_t>(1);
+    auto finish_one = [this, pending, done = std::move(done)]() {
+        if (--*pending == 0) {
+            close_connections(done);
+        }
+    };
+
+    for (auto &[key, instance] : instances_) {
+        auto stop_idle = [this, &instance, finish_one]() {
+            if (instance.users > 0) {
+                finish_one();
+                return;
+            }
+            retire(instance, [this, &instance, finish_one]() {
+                settle(instance);
+                finish_one();
+            });
+        };
+
+        if (instance.settling) {
+            // Stop it once the restart in flight has brought it up
+            ++*pending;
+            instance.deferred.push_back(std::move(stop_idle));
+        } else if (instance.idle) {
+            ++*pending;
+            stop_idle();
+        }
+    }
+    finish_one();
+}
+
+void Module_Pool::close_connections(std::function<void()> done)
+{
+    // Instances on the same host share one connection, it is only closed once none of them serves a mission
+    std::map<std::string, std::shared_ptr<Module_Launcher>> hosts;
+    for (const auto &[key, instance] : instances_) {
+        const std::string host = instance.module.user + '@' + instance.module.ssh_ip;
+        if (instance.users > 0) {
+            hosts[host] = nullptr;
+        } else if (!hosts.count(host)) {
+            hosts[host] = instance.launcher;
+        }
+    }
+
+    auto pending = std::make_shared<size_t>(1);
+    auto finish_one = [pending, done = std::move(done)]() {
+        if (--*pending == 0 && done) done();
+    };
+    for (const auto &[host, launcher] : hosts) {
+        if (launcher) {
+            ++*pending;
+            launcher->close_connection([finish_one](bool) {
+                finish_one();
+            });
+        }
+    }
+    finish_one();
+}
@@ -0,0 +1,79 @@
+/* ============================================================
+ *  Proyect  : I-Drone
+ *  Filename : Module_Pool.h
+ *  Author   : Iván Gutiérrez
+ *  License  : GNU General Public License v3.0
+ *
+ *  © 2025 Iván Gutiérrez.
+ * ============================================================
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+#pragma once
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include <boost/asio.hpp>
+#include "Module_Launcher.h"
+#include "structs/Structs_PLD.h"
+
+// Owns the lifecycle of the modules so missions do not pay their startup cost. A module is
+// acquired by a state for one mission and released when the state closes; up to `capacity` released
+// modules are kept running idle, and a module that cannot serve another mission as is gets replaced by
+// a fresh one in the background. Each module is one compose service, so it is one instance at most,
+// shared by the missions that name it. Missions call in from their own strands; the pool does its work,
+// and calls handlers, on its own strand
+class Module_Pool {
+public:
+    // module_dir holds the module executables for the local backend
+    Module_Pool(boost::asio::io_context &io_context, size_t capacity, Module_Backend backend = Module_Backend::DOCKER,
+                std::filesystem::path module_dir = {});
+
+    // A launcher for the module on the configured backend, its handlers are called on the executor
+    std::shared_ptr<Module_Launcher> make_launcher(const boost::asio::any_io_executor &executor, const Structs_PLD::Info_Module &module) const;
+
+    // Hands the module to a mission, starting it unless it is already running.
+    // The handler gets true when a warm instance was handed over, on the pool's strand
+    void acquire(const Structs_PLD::Info_Module &module, module_handler handler = nullptr);
+
+    // reusable: the module can serve the next mission as it is, otherwise it is restarted
+    void release(const Structs_PLD::Info_Module &module, bool reusable);
+
+    // Stops every idle module and closes the connections to hosts left without a running mission, then calls done
+    void drain(std::function<void()> done);
+
+    size_t capacity() const;
+
+private:
+    struct Instance {
+        Structs_PLD::Info_Module module;
+        std::shared_ptr<Module_Launcher> launcher;
+        unsigned int users = 0; // Missions holding it, concurrent missions may share a module
+        bool idle = false;      // Running without a mission
+        bool settling = false;  // Stop or restart in flight
+        uint64_t released_at = 0;
+        std::vector<std::function<void()>> deferred; // Run once settled
+    };
+
+    boost::asio::strand<boost::asio::io_context::executor_type> strand_;
+    size_t capacity_;
+    Module_Backend backend_;
+    std::filesystem::path module_dir_;
+    uint64_t release_count_ = 0;
+    std::map<std::string, Instance> instances_;
+
+    static std::string key_of(const Structs_PLD::Info_Module &module);
+    Instance& instance_for(const Structs_PLD::Info_Module &module);
+    size_t idle_count() const;
+    void acquire_on_strand(const Structs_PLD::Info_Module &module, module_handler handler);
+    void release_on_strand(const Structs_PLD::Info_Module &module, bool reusable);
+    void drain_on_strand(std::function<void()> done);
+    void close_connections(std::function<void()> done);
+    void start_for_mission(Instance &instance, module_handler handler);
+    void replenish(Instance &instance);
+    void retire(Instance &instance, std::function<void()> done = nullptr);
+    void evict_idle();
+    void settle(Instance &instance);
+};
@@ -113,7 +113,7 @@ bool PLD_Recorder::write_message_sent(const std::string &destination, const std:
     return write_json_entry("message", data.str());
 }
 
-bool PLD_Recorder::write_raw_message(const std::string &source, const std::string &raw_data)
+bool PLD_Recorder::write_raw_message(const std::string &source, std::string_view raw_data)
 {
     std::stringstream data;
     data << "{\n";
@@ -152,6 +152,7 @@ void PLD_Recorder::close()
     // Write closing bracket for JSON array
     recorder_->write("  {}\n]\n");
     recorder_->close();
+    recorder_.reset(); // A mission closes its recorder when it ends, and again on shutdown
     Logger::log_message(Logger::Type::INFO, "PLD Recorder closed successfully");
 }
 
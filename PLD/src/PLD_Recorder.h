@@ -22,7 +22,7 @@ public:
 
     bool write_message_received(const std::string &source, const std::string &message_type, const std::string &decoded_content);
     bool write_message_sent(const std::string &destination, const std::string &message_type, const std::string &content);
-    bool write_raw_message(const std::string &source, const std::string &raw_data);
+    bool write_raw_message(const std::string &source, std::string_view raw_data);
     bool write_state_transition(const std::string &from_state, const std::string &to_state);
     bool write_error(const std::string &error_message);
     void close();
@@ -0,0 +1,124 @@
+/* ============================================================
+ *  Proyect  : I-Drone
+ *  Filename : Process_Executor.cpp
+ *  Author   : Iván Gutiérrez
+ *  License  : GNU General Public License v3.0
+ *
+ *  © 2025 Iván Gutiérrez.
+ * ============================================================
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+#include "Process_Executor.h"
+#include <array>
+#include <fcntl.h>
+#include <spawn.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "common_libs/Logger.h"
+
+extern char **environ;
+
+constexpr size_t READ_CHUNK_BYTES = 4096;
+constexpr int REAP_POLL_MS = 10; // The child closes stdout right before exiting, so this is rarely needed twice
+
+namespace {
+
+struct Process_Operation {
+    explicit Process_Operation(const boost::asio::any_io_executor &executor): pipe(executor), reap_timer(executor) {}
+
+    boost::asio::posix::stream_descriptor pipe;
+    boost::asio::steady_timer reap_timer;
+    pid_t pid = -1;
+    std::string output;
+    std::array<char, READ_CHUNK_BYTES> buffer;
+    process_handler handler;
+};
+
+void reap(const std::shared_ptr<Process_Operation> &op)
+{
+    int status = 0;
+    const pid_t result = waitpid(op->pid, &status, WNOHANG);
+    if (result == 0) {
+        op->reap_timer.expires_after(std::chrono::milliseconds(REAP_POLL_MS));
+        op->reap_timer.async_wait([op](const boost::system::error_code &) {
+            reap(op);
+        });
+        return;
+    }
+
+    const int exit_code = (result == op->pid && WIFEXITED(status)) ? WEXITSTATUS(status) : -1;
+    boost::system::error_code ignored;
+    op->pipe.close(ignored);
+    if (op->handler) {
+        op->handler(exit_code, std::move(op->output));
+    }
+}
+
+void read_output(const std::shared_ptr<Process_Operation> &op)
+{
+    op->pipe.async_read_some(boost::asio::buffer(op->buffer),
+        [op](const boost::system::error_code &ec, std::size_t bytes_read) {
+            if (!ec) {
+                op->output.append(op->buffer.data(), bytes_read);
+                read_output(op);
+                return;
+            }
+            reap(op); // EOF: the child has closed its end
+        });
+}
+}
+
+Process_Executor::Process_Executor(const boost::asio::any_io_executor &executor): executor_(executor)
+{
+}
+
+void Process_Executor::run(std::vector<std::string> argv, process_handler handler) const
+{
+    auto fail = [this, &handler]() {
+        boost::asio::post(executor_, [handler = std::move(handler)]() {
+            if (handler) handler(-1, "");
+        });
+    };
+
+    if (argv.empty()) {
+        fail();
+        return;
+    }
+
+    int fds[2];
+    if (pipe2(fds, O_CLOEXEC) != 0) {
+        Logger::log_message(Logger::Type::ERROR, "Unable to create pipe for '" + argv.front() + "'");
+        fail();
+        return;
+    }
+
+    // stdout goes to the pipe, stdin is detached so ssh never reads from the PLD's terminal
+    posix_spawn_file_actions_t actions;
+    posix_spawn_file_actions_init(&actions);
+    posix_spawn_file_actions_adddup2(&actions, fds[1], STDOUT_FILENO);
+    posix_spawn_file_actions_addopen(&actions, STDIN_FILENO, "/dev/null", O_RDONLY, 0);
+
+    std::vector<char*> args;
+    args.reserve(argv.size() + 1);
+    for (auto &arg : argv) {
+        args.push_back(arg.data());
+    }
+    args.push_back(nullptr);
+
+    pid_t pid = -1;
+    const int rc = posix_spawnp(&pid, args.front(), &actions, nullptr, args.data(), environ);
+    posix_spawn_file_actions_destroy(&actions);
+    close(fds[1]);
+
+    if (rc != 0) {
+        close(fds[0]);
+        Logger::log_message(Logger::Type::ERROR, "Unable to start '" + argv.front() + "'");
+        fail();
+        return;
+    }
+
+    auto op = std::make_shared<Process_Operation>(executor_);
+    op->pid = pid;
+    op->handler = std::move(handler);
+    op->pipe.assign(fds[0]);
+    read_output(op);
+}
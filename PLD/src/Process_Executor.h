@@ -0,0 +1,31 @@
+/* ============================================================
+ *  Proyect  : I-Drone
+ *  Filename : Process_Executor.h
+ *  Author   : Iván Gutiérrez
+ *  License  : GNU General Public License v3.0
+ *
+ *  © 2025 Iván Gutiérrez.
+ * ============================================================
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+#pragma once
+#include <boost/asio.hpp>
+#include <functional>
+#include <string>
+#include <vector>
+
+// exit_code is -1 when the process could not be started or did not exit normally
+using process_handler = std::function<void(int exit_code, std::string output)>;
+
+// Runs external commands without blocking the io_context: the child is started with posix_spawn, its
+// stdout is read through a pipe on a stream_descriptor and the handler is called on the executor
+// once the output is drained and the child has been reaped
+class Process_Executor {
+public:
+    explicit Process_Executor(const boost::asio::any_io_executor &executor);
+
+    // argv[0] is looked up in PATH; no shell is involved
+    void run(std::vector<std::string> argv, process_handler handler) const;
+
+private:
+    boost::asio::any_io_executor executor_;
+};
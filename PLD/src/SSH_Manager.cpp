@@ -8,68 +8,135 @@
  * ============================================================
  * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 #include "SSH_Manager.h"
-#include <fstream>
-#include <sstream>
-#include <array>
-#include <memory>
-#include <cstdio>
 #include "common_libs/Logger.h"
+#include <cstdlib>
+#include <sys/stat.h>
+#include <unistd.h>
 
-SSH_Manager::SSH_Manager(const std::string &user, 
+constexpr const char* SSH_CONTROL_DIR = "idrone-ssh"; // Under $XDG_RUNTIME_DIR, or ~/.ssh without it
+constexpr const char* SSH_CONTROL_PERSIST = "ControlPersist=600"; // Seconds the idle master stays up
+
+namespace {
+// A private directory, owned by this user and closed to everyone else, so no other user can plant
+// or reach the master's socket
+bool is_private_dir(const std::string &path)
+{
+    struct stat st{};
+    return lstat(path.c_str(), &st) == 0 && S_ISDIR(st.st_mode) && st.st_uid == geteuid() && (st.st_mode & 077) == 0;
+}
+
+std::string make_control_dir()
+{
+    std::string base;
+    if (const char *runtime = std::getenv("XDG_RUNTIME_DIR"); runtime && *runtime) {
+        base = runtime;
+    } else if (const char *home = std::getenv("HOME"); home && *home) {
+        base = std::string(home) + "/.ssh";
+        mkdir(base.c_str(), 0700);
+    } else {
+        return {};
+    }
+
+    const std::string dir = base + '/' + SSH_CONTROL_DIR;
+    mkdir(dir.c_str(), 0700);
+    return is_private_dir(dir) ? dir : std::string();
+}
+
+// Empty when no private directory is available; commands then open their own connection
+const std::string& control_dir()
+{
+    static const std::string dir = [] {
+        std::string path = make_control_dir();
+        if (path.empty()) {
+            Logger::log_message(Logger::Type::WARNING, "No private directory for SSH control sockets, SSH connections are not shared");
+        }
+        return path;
+    }();
+    return dir;
+}
+}
+
+SSH_Manager::SSH_Manager(const boost::asio::any_io_executor &executor,
+                         const std::string &user, 
                          const std::string &host,
-                         const std::string &password): user_(user), 
+                         const std::string &password): executor_(executor),
+                                                       backend_(is_local_host(host) ? Backend::LOCAL : Backend::SSH),
+                                                       user_(user), 
                                                        host_(host),
                                                        key_(password),
                                                        has_password_(!password.empty())
 {
+    if (backend_ == Backend::LOCAL) {
+        Logger::log_message(Logger::Type::INFO, "Module host " + host_ + " is local, commands run without SSH");
+    }
 }
 
-bool SSH_Manager::execute_command(const std::string &command, std::string &output) const
+bool SSH_Manager::is_local_host(const std::string &host)
 {
-    std::string ssh_cmd = build_ssh_command(command);
-    output.clear();
-    
-    std::array<char, 128> buffer;
-    FILE* pipe_raw = popen(ssh_cmd.c_str(), "r");
-    std::unique_ptr<FILE, int(*)(FILE*)> pipe(pipe_raw, &pclose);
-    
-    if (!pipe) {
-        Logger::log_message(Logger::Type::ERROR, "Failed to execute command");
-        return false;
-    }
+    return host == "localhost" || host == "::1" || host.rfind("127.", 0) == 0;
+}
+
+void SSH_Manager::execute_command(const std::string &command, process_handler handler) const
+{
+    executor_.run(build_command(command), std::move(handler));
+}
 
-    while (fgets(buffer.data(), buffer.size(), pipe.get()) != nullptr) {
-        output += buffer.data();
+void SSH_Manager::close_master(std::function<void(bool)> handler) const
+{
+    if (backend_ == Backend::LOCAL || control_dir().empty()) {
+        if (handler) handler(true);
+        return;
     }
 
-    int exit_code = pclose(pipe.release());
-    
-    return (exit_code == 0);
+    // Fails when no master is up, which leaves nothing to close either
+    std::vector<std::string> ssh_cmd = {"ssh", "-o", control_path(), "-O", "exit", user_ + "@" + host_};
+    executor_.run(std::move(ssh_cmd), [handler = std::move(handler)](int, const std::string &) {
+        if (handler) handler(true);
+    });
+}
+
+std::string SSH_Manager::control_path()
+{
+    // %C is a hash of the local host, remote host, port and user, so the socket path stays short
+    return "ControlPath=" + control_dir() + "/%C";
 }
 
-bool SSH_Manager::test_connection() const
+void SSH_Manager::test_connection(std::function<void(bool)> handler) const
 {
-    std::string test_cmd = "echo 'connection_test'";
-    std::string output;
-    return execute_command(test_cmd,output);
+    execute_command("echo 'connection_test'", [handler = std::move(handler)](int exit_code, const std::string &) {
+        if (handler) handler(exit_code == 0);
+    });
 }
 
-std::string SSH_Manager::build_ssh_command(const std::string &remote_command) const
+std::vector<std::string> SSH_Manager::build_command(const std::string &remote_command) const
 {
-    std::ostringstream ssh_cmd;
-    
-    ssh_cmd << "ssh -o StrictHostKeyChecking=no -o UserKnownHostsFile=/dev/null "
-            << "-o LogLevel=ERROR "
-            << "-o BatchMode=yes "
-            << "-o ConnectTimeout=5 "
-            << "-o PasswordAuthentication=no ";
-    
+    if (backend_ == Backend::LOCAL) {
+        return {"sh", "-c", remote_command};
+    }
+
+    // Passed to ssh as separate arguments, so only the remote shell parses remote_command. The first command
+    // starts a master in the background (its stdio goes to /dev/null, so the executor still sees EOF) and
+    // later ones are multiplexed over it
+    std::vector<std::string> ssh_cmd = {
+        "ssh",
+        "-o", "StrictHostKeyChecking=no",
+        "-o", "UserKnownHostsFile=/dev/null",
+        "-o", "LogLevel=ERROR",
+        "-o", "BatchMode=yes",
+        "-o", "ConnectTimeout=5",
+        "-o", "PasswordAuthentication=no"
+    };
+
+    if (!control_dir().empty()) {
+        ssh_cmd.insert(ssh_cmd.end(), {"-o", "ControlMaster=auto", "-o", control_path(), "-o", SSH_CONTROL_PERSIST});
+    }
+
     if (has_password_) {
-        ssh_cmd << "-i " << key_ << " ";
+        ssh_cmd.push_back("-i");
+        ssh_cmd.push_back(key_);
     }
-    
-    ssh_cmd << user_ << "@" << host_ 
-            << " '" << remote_command << "'";
-    
-    return ssh_cmd.str();
-}
+
+    ssh_cmd.push_back(user_ + "@" + host_);
+    ssh_cmd.push_back(remote_command);
+    return ssh_cmd;
+}
\ No newline at end of file
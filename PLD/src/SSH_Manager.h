@@ -10,23 +10,38 @@
 #pragma once
 #include <string>
 #include <optional>
+#include <vector>
+#include "Process_Executor.h"
 
+// Runs commands on a module host. Remote hosts share one persistent OpenSSH ControlMaster connection per
+// user@host, so only the first command pays for the SSH handshake; loopback hosts run commands locally.
+// The master's socket lives in a directory only this user can reach
 class SSH_Manager {
 public:
-    SSH_Manager(const std::string &user, const std::string &host, 
+    SSH_Manager(const boost::asio::any_io_executor &executor, const std::string &user, const std::string &host, 
                 const std::string &password = "");
 
     ~SSH_Manager() = default;
 
-    bool execute_command(const std::string &command, std::string &output) const;
-    bool test_connection() const;
+    // Both complete through the handler on the executor, they never block it
+    void execute_command(const std::string &command, process_handler handler) const;
+    void test_connection(std::function<void(bool)> handler) const;
+    void close_master(std::function<void(bool)> handler) const; // Ends the shared connection to user@host, if any
 
 private:
+    enum class Backend {
+        SSH,
+        LOCAL
+    };
+
+    Process_Executor executor_;
+    Backend backend_;
     std::string user_;
     std::string host_;
     std::string key_;
-    std::string last_output_;
     bool has_password_;
 
-    std::string build_ssh_command(const std::string &remote_command) const;
+    static bool is_local_host(const std::string &host);
+    static std::string control_path();
+    std::vector<std::string> build_command(const std::string &remote_command) const;
 };
@@ -9,16 +9,19 @@
  * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 #include "State_Machine.h"
 #include "./states/Off_State.h"
+#include "./states/Planner_State.h"
+#include "./states/Drone_Mission_State.h"
 #include "common_libs/Logger.h"
 
-State_Machine::State_Machine(std::shared_ptr<Communication_Manager> comm_mng, std::shared_ptr<PLD_Recorder> recorder)
-    : cmm_manager_(std::move(comm_mng)), recorder_(std::move(recorder))
+State_Machine::State_Machine(std::string mission_id, std::shared_ptr<Communication_Manager> comm_mng, std::shared_ptr<PLD_Recorder> recorder, std::shared_ptr<Module_Pool> module_pool)
+    : mission_id_(std::move(mission_id)), cmm_manager_(std::move(comm_mng)), recorder_(std::move(recorder)), module_pool_(std::move(module_pool)),
+      strand_(boost::asio::make_strand(cmm_manager_->get_io_context()))
 {
-    cmm_manager_->set_message_handler([this](const std::string &message) { handleMessage(message); });
 }
 
 void State_Machine::transitionTo(std::unique_ptr<State> next_state)
 {
+    idle_ = false;
     actual_state_ = std::move(next_state);
     Logger::log_message(Logger::Type::INFO, "Transition complete");
     if (actual_state_) {
@@ -26,10 +29,10 @@ void State_Machine::transitionTo(std::unique_ptr<State> next_state)
     }
 }
 
-void State_Machine::handleMessage(const std::string &message)
+void State_Machine::handleMessage(const Enc_Dec_PLD::From_Client &message, std::string_view raw)
 {
     if (actual_state_) {
-        actual_state_->handleMessage(message);
+        actual_state_->handleMessage(message, raw);
     } else {
         Logger::log_message(Logger::Type::ERROR, "Message received from Client while is no set the actual state");
     }
@@ -45,7 +48,178 @@ std::shared_ptr<PLD_Recorder> State_Machine::getRecorder() const
     return recorder_;
 }
 
+std::shared_ptr<Module_Pool> State_Machine::getModulePool() const
+{
+    return module_pool_;
+}
+
 boost::asio::io_context& State_Machine::get_io_context() const
 {
     return cmm_manager_->get_io_context();
+}
+
+const io_strand& State_Machine::get_strand() const
+{
+    return strand_;
+}
+
+const std::string& State_Machine::mission_id() const
+{
+    return mission_id_;
+}
+
+void State_Machine::set_status(const Structs_PLD::Status &status)
+{
+    cmm_manager_->set_status(mission_id_, status);
+}
+
+void State_Machine::set_finish_handler(std::function<void()> handler)
+{
+    finish_handler_ = std::move(handler);
+}
+
+void State_Machine::finish()
+{
+    if (finish_handler_) {
+        finish_handler_();
+    }
+}
+
+void State_Machine::close()
+{
+    background_planner_.reset();
+    actual_state_.reset();
+    queued_missions_.clear();
+    planned_missions_.clear();
+    cmm_manager_->remove_mission(mission_id_);
+    if (recorder_) {
+        recorder_->close();
+    }
+}
+
+void State_Machine::enqueue_mission(const Structs_PLD::Config_mission &config)
+{
+    queued_missions_.push_back({config, std::chrono::steady_clock::now()});
+    Logger::log_message(Logger::Type::INFO, "Mission queued, " + std::to_string(queued_missions_.size()) + " waiting to be planned");
+    publish_queue_status();
+
+    // Posted so the state that received the mission is not replaced while it handles the message
+    boost::asio::post(strand_, [self = shared_from_this()]() {
+        self->start_next_mission();
+        self->plan_in_background();
+    });
+}
+
+void State_Machine::on_idle()
+{
+    idle_ = true;
+    boost::asio::post(strand_, [self = shared_from_this()]() {
+        self->start_next_mission();
+    });
+}
+
+void State_Machine::set_fleet_busy(bool busy)
+{
+    fleet_busy_ = busy;
+    if (busy) {
+        boost::asio::post(strand_, [self = shared_from_this()]() {
+            self->plan_in_background();
+        });
+    }
+}
+
+void State_Machine::start_next_mission()
+{
+    if (!idle_) {
+        return;
+    }
+
+    if (!planned_missions_.empty()) {
+        Planned_Mission mission = std::move(planned_missions_.front());
+        planned_missions_.pop_front();
+        current_received_ = mission.received;
+        publish_queue_status();
+
+        Logger::log_message(Logger::Type::INFO, "Routes of the next mission already planned, starting Drone Mission State");
+        auto drone_state = std::make_unique<Drone_Mission_State>(shared_from_this());
+        drone_state->set_data(mission.data);
+        transitionTo(std::move(drone_state));
+        return;
+    }
+
+    // The mission being planned in the background starts when its routes arrive
+    if (background_planner_ || queued_missions_.empty()) {
+        return;
+    }
+
+    Queued_Mission mission = std::move(queued_missions_.front());
+    queued_missions_.pop_front();
+    current_received_ = mission.received;
+    publish_queue_status();
+
+    auto planner_state = std::make_unique<Planner_State>(shared_from_this());
+    planner_state->set_data(mission.config);
+    transitionTo(std::move(planner_state));
+}
+
+void State_Machine::plan_in_background()
+{
+    if (!fleet_busy_ || background_planner_ || queued_missions_.empty()) {
+        return;
+    }
+
+    Queued_Mission mission = std::move(queued_missions_.front());
+    queued_missions_.pop_front();
+    background_received_ = mission.received;
+
+    Logger::log_message(Logger::Type::INFO, "Planning the next mission while the fleet flies");
+    auto planner_state = std::make_unique<Planner_State>(shared_from_this());
+    planner_state->set_data(mission.config);
+    planner_state->set_pipelined();
+    background_planner_ = std::move(planner_state);
+    publish_queue_status();
+    background_planner_->start();
+}
+
+void State_Machine::on_mission_planned(const Structs_PLD::Config_drone &planned)
+{
+    planned_missions_.push_back({planned, background_received_});
+    Logger::log_message(Logger::Type::INFO, "Next mission planned, " + std::to_string(planned_missions_.size()) + " waiting for the fleet");
+    finish_background_planning();
+}
+
+void State_Machine::on_background_planning_failed()
+{
+    Logger::log_message(Logger::Type::ERROR, "Background planning failed, mission dropped from the queue");
+    finish_background_planning();
+}
+
+void State_Machine::finish_background_planning()
+{
+    // The background Planner State is the caller, it is destroyed once its handler has returned
+    boost::asio::post(strand_, [self = shared_from_this()]() {
+        self->background_planner_.reset();
+        self->publish_queue_status();
+        self->start_next_mission();
+        self->plan_in_background();
+    });
+}
+
+void State_Machine::on_mission_started()
+{
+    last_mission_latency_ms_ = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - current_received_).count());
+    Logger::log_message(Logger::Type::INFO, "Mission started " + std::to_string(last_mission_latency_ms_) + " ms after its configuration was received");
+    if (recorder_) {
+        recorder_->write_message_sent("Drone", "MISSION_LATENCY", std::to_string(last_mission_latency_ms_) + " ms from configuration to START_ALL");
+    }
+    publish_queue_status();
+}
+
+void State_Machine::publish_queue_status()
+{
+    Structs_PLD::Queue_status queue_status;
+    queue_status.queued_missions = static_cast<uint32_t>(queued_missions_.size() + (background_planner_ ? 1 : 0));
+    queue_status.planned_missions = static_cast<uint32_t>(planned_missions_.size());
+    queue_status.last_mission_latency_ms = last_mission_latency_ms_;
+    cmm_manager_->set_queue_status(mission_id_, queue_status);
 }
\ No newline at end of file
@@ -8,22 +8,72 @@
  * ============================================================
  * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 #pragma once
+#include <chrono>
+#include <deque>
 #include <memory>
 #include "./states/State.h"
 #include "Communication_Manager.h"
 #include "PLD_Recorder.h"
+#include "Module_Pool.h"
 
-class State_Machine {
+// Runs the missions of one fleet, one at a time through Off -> Planner -> Drone -> Off. Missions received
+// meanwhile are queued; while the fleet flies, the next one is planned by a background Planner State so
+// its routes are ready to upload as soon as the fleet is free. Everything a fleet does (its states, their
+// timers and module servers) runs on the fleet's strand, so fleets proceed in parallel without locks
+class State_Machine : public std::enable_shared_from_this<State_Machine> {
 public:
-    State_Machine(std::shared_ptr<Communication_Manager> comm_mng, std::shared_ptr<PLD_Recorder> recorder);
+    State_Machine(std::string mission_id, std::shared_ptr<Communication_Manager> comm_mng, std::shared_ptr<PLD_Recorder> recorder, std::shared_ptr<Module_Pool> module_pool);
     void transitionTo(std::unique_ptr<State> next_state);
-    void handleMessage(const std::string &message);
+    void handleMessage(const Enc_Dec_PLD::From_Client &message, std::string_view raw);
     std::shared_ptr<Communication_Manager> getCommunicationManager() const;
     std::shared_ptr<PLD_Recorder> getRecorder() const;
+    std::shared_ptr<Module_Pool> getModulePool() const;
     boost::asio::io_context& get_io_context() const;
+    const io_strand& get_strand() const;
+    const std::string& mission_id() const;
+
+    void set_status(const Structs_PLD::Status &status); // Reported to the Client under this mission id
+    void set_finish_handler(std::function<void()> handler);
+    void finish();  // FINISH received while idle: this fleet has no more missions, the owner closes it
+    void close();   // Destroys the states, which hold the State_Machine alive
+
+    void enqueue_mission(const Structs_PLD::Config_mission &config);
+    void on_idle();                 // Off State entered, the next queued mission can start
+    void set_fleet_busy(bool busy); // Drone Mission State running, queued missions are planned in the background
+    void on_mission_planned(const Structs_PLD::Config_drone &planned); // From the background Planner State
+    void on_background_planning_failed();
+    void on_mission_started();      // START_ALL of the current mission delivered to the Drone module
+
 private:
+    struct Queued_Mission {
+        Structs_PLD::Config_mission config;
+        std::chrono::steady_clock::time_point received;
+    };
+
+    struct Planned_Mission {
+        Structs_PLD::Config_drone data;
+        std::chrono::steady_clock::time_point received;
+    };
+
+    std::string mission_id_;
     std::unique_ptr<State> actual_state_;
+    std::function<void()> finish_handler_;
     std::shared_ptr<Communication_Manager> cmm_manager_;
     std::shared_ptr<PLD_Recorder> recorder_;
+    std::shared_ptr<Module_Pool> module_pool_;
+    io_strand strand_;
+
+    std::deque<Queued_Mission> queued_missions_;
+    std::deque<Planned_Mission> planned_missions_;
+    std::unique_ptr<State> background_planner_;
+    std::chrono::steady_clock::time_point background_received_;
+    std::chrono::steady_clock::time_point current_received_;
+    uint64_t last_mission_latency_ms_ = 0;
+    bool idle_ = false;
+    bool fleet_busy_ = false;
 
-};
\ No newline at end of file
+    void start_next_mission();
+    void plan_in_background();
+    void finish_background_planning();
+    void publish_queue_status();
+};
@@ -8,18 +8,23 @@
  * ============================================================
  * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
+#include <algorithm>
 #include <iostream>
 #include <sstream>
+#include <thread>
+#include <vector>
 #include <boost/asio.hpp>
 #include "Config.h"
 #include "common_libs/Logger.h"
 #include "common_libs/Signal_Handler.h"
 #include "Communication_Manager.h"
-#include "State_Machine.h"
-#include "PLD_Recorder.h"
-#include "./states/Off_State.h"
+#include "Mission_Manager.h"
+#include "Module_Pool.h"
 #include "structs/Structs_PLD.h"
 
+constexpr size_t WARM_POOL_DEFAULT = 2; // Idle modules kept running between missions: one Planner and one Drone
+constexpr size_t IO_THREADS_DEFAULT = 4; // Client server, module pool and a couple of fleets at once
+
 int main(int argc, char* argv[]) {
     // Initialize logger
     Structs_PLD::Config_struct cnf = Config::get_config();
@@ -34,6 +39,10 @@ int main(int argc, char* argv[]) {
     // Parser arguments
     std::string own_address;
     int own_port = -1;
+    size_t warm_pool = WARM_POOL_DEFAULT;
+    size_t io_threads = IO_THREADS_DEFAULT;
+    Module_Backend backend = Module_Backend::DOCKER;
+    std::string module_dir;
 
     for (int i = 1; i < argc; ++i) {
         std::string arg = argv[i];
@@ -41,6 +50,20 @@ int main(int argc, char* argv[]) {
             own_address = argv[++i];
         } else if (arg == "--Own_port" && i + 1 < argc) {
             own_port = std::stoi(argv[++i]);
+        } else if (arg == "--Warm_Pool" && i + 1 < argc) {
+            warm_pool = std::stoul(argv[++i]);
+        } else if (arg == "--Threads" && i + 1 < argc) {
+            io_threads = std::max<size_t>(1, std::stoul(argv[++i]));
+        } else if (arg == "--Launcher" && i + 1 < argc) {
+            std::string launcher = argv[++i];
+            if (launcher == "local") {
+                backend = Module_Backend::LOCAL;
+            } else if (launcher != "docker") {
+                Logger::log_message(Logger::Type::ERROR, "Unknown --Launcher '" + launcher + "', expected docker or local");
+                return EXIT_FAILURE;
+            }
+        } else if (arg == "--Module_Dir" && i + 1 < argc) {
+            module_dir = argv[++i];
         }
     }
 
@@ -48,6 +71,10 @@ int main(int argc, char* argv[]) {
         Logger::log_message(Logger::Type::ERROR, "Mandatory arguments missing --Own_Address and --Own_port");
         return EXIT_FAILURE;
     }
+    if (backend == Module_Backend::LOCAL && module_dir.empty()) {
+        Logger::log_message(Logger::Type::ERROR, "--Launcher local needs --Module_Dir with the Planner and Drone executables");
+        return EXIT_FAILURE;
+    }
     boost::asio::io_context io_context;
 
     boost::asio::ip::tcp::endpoint own_endpoint;
@@ -72,27 +99,35 @@ int main(int argc, char* argv[]) {
     }
 
     auto comm_mng_ptr = std::make_shared<Communication_Manager>(io_context, own_endpoint);
-    auto recorder_ptr = std::make_shared<PLD_Recorder>(cnf.data_path);
 
-    auto state_machine_ptr = std::make_shared<State_Machine>(comm_mng_ptr, recorder_ptr);
-    std::unique_ptr<State> off_state = std::make_unique<Off_State>(state_machine_ptr);
-    state_machine_ptr->transitionTo(std::move(off_state));
+    auto module_pool_ptr = std::make_shared<Module_Pool>(io_context, warm_pool, backend, module_dir);
+    if (backend == Module_Backend::LOCAL) {
+        Logger::log_message(Logger::Type::INFO, "Modules run as local processes from " + module_dir);
+    }
+    Logger::log_message(Logger::Type::INFO, "Warm pool keeps up to " + std::to_string(warm_pool) + " idle modules");
 
-    Signal_Handler signal_handler(io_context, [&recorder_ptr]() {
-        if (recorder_ptr) {
-            recorder_ptr->close();
-        }
+    auto mission_manager_ptr = std::make_shared<Mission_Manager>(comm_mng_ptr, module_pool_ptr, cnf.data_path);
+    mission_manager_ptr->start();
+
+    // Recorders are closed below, once no thread can be writing to them
+    Signal_Handler signal_handler(io_context, []() {
         Logger::log_message(Logger::Type::INFO, "Shutdown complete");
     });
 
-    Logger::log_message(Logger::Type::INFO, "Starting io_context...");
+    Logger::log_message(Logger::Type::INFO, "Starting io_context on " + std::to_string(io_threads) + " threads...");
+    std::vector<std::thread> workers;
+    workers.reserve(io_threads - 1);
+    for (size_t i = 1; i < io_threads; ++i) {
+        workers.emplace_back([&io_context]() { io_context.run(); });
+    }
     io_context.run();
+    for (auto &worker : workers) {
+        worker.join();
+    }
 
     Logger::log_message(Logger::Type::INFO, "No more async functions to do, exiting program...");
     
-    if (recorder_ptr) {
-        recorder_ptr->close();
-    }
+    mission_manager_ptr->close_recorders();
     Logger::close();
     return 0;
 }
\ No newline at end of file
@@ -14,14 +14,13 @@
 #include "common_libs/Enc_Dec_Drone.h"
 #include "common_libs/Enc_Dec_PLD.h"
 #include "structs/Structs_Planner.h"
+#include <algorithm>
 
-constexpr int RATE_WAIT_FOR_MESSAGE = 300;
-constexpr int RATE_FOR_SEND_MESSAGES = 1;
+constexpr int RATE_WAIT_FOR_MESSAGE = 300; // Upper bound, the start process continues as soon as the Drone module is ready
 constexpr int NUMBER_ATTEMPS_MAX = 3;
 
 Drone_Mission_State::Drone_Mission_State(std::shared_ptr<State_Machine> state_machine_ptr): State(state_machine_ptr),
-                                                                                            wait_timer_(state_machine()->get_io_context()),
-                                                                                            send_timer_(state_machine()->get_io_context())
+                                                                                            wait_timer_(state_machine()->get_strand())
 
 {
 }
@@ -40,28 +39,38 @@ Drone_Mission_State::~Drone_Mission_State() noexcept
 void Drone_Mission_State::close_state()
 {
     state_closing_ = true;
+    state_machine()->set_fleet_busy(false);
     wait_timer_.cancel();
-    send_timer_.cancel();
     if (server_number_ != -1) {
         state_machine()->getCommunicationManager()->close_connection_to_server(server_number_);
         server_number_ = -1;
     }
 
-    if(docker_manager_ && docker_manager_->is_container_running(config_.drone_module_data.docker_name)) {
-        docker_manager_->stop_container(config_.drone_module_data.docker_name);
+    // A simulation that has flown a mission is not reused, the pool brings up a fresh one in the background
+    if (module_acquired_) {
+        state_machine()->getModulePool()->release(config_.drone_module_data, false);
+        module_acquired_ = false;
     }
 }
 
 void Drone_Mission_State::start()
 {
     Logger::log_message(Logger::Type::INFO, "Entering Drone Mission State");
-    state_machine()->getCommunicationManager()->set_status(Structs_PLD::Status::EXECUTING_MISSION);
+    state_machine()->set_status(Structs_PLD::Status::EXECUTING_MISSION);
+    state_machine()->set_fleet_busy(true);
     
     if (state_machine()->getRecorder()) {
         state_machine()->getRecorder()->write_state_transition("Planner_State", "Drone_Mission_State");
     }
-    docker_manager_ = std::make_shared<Docker_Manager>(config_.drone_module_data.user,config_.drone_module_data.ssh_ip,config_.drone_module_data.docker_file,config_.drone_module_data.key);
-    if (docker_manager_->test_connection()){
+    module_launcher_ = state_machine()->getModulePool()->make_launcher(state_machine()->get_strand(), config_.drone_module_data);
+    module_launcher_->test_connection([this](bool connected) {
+        on_connection_tested(connected);
+    });
+}
+
+void Drone_Mission_State::on_connection_tested(bool connected)
+{
+    if (connected){
         std::stringstream log;
         log << "Connection successful to " << config_.drone_module_data.user << ":" << config_.drone_module_data.ssh_ip;
         Logger::log_message(Logger::Type::INFO, log.str());
@@ -74,6 +83,30 @@ void Drone_Mission_State::start()
         return;
     }
 
+    // A link opened while planning is already up, with the plans that were ready queued on it
+    if (server_number_ == -1) {
+        Server::handlers handler_obj = drone_handlers();
+        server_number_ = state_machine()->getCommunicationManager()->create_server(state_machine()->get_strand(),handler_obj,config_.drone_module_data.module_ip,config_.drone_module_data.port,DELIVERY_WINDOW_FRAMES);
+    }
+
+    if (server_number_ == -1) {
+        Logger::log_message(Logger::Type::ERROR, "Unable to complete transition to Drone State, returning to Off State");
+        auto off_state = std::make_unique<Off_State>(state_machine());
+        state_machine()->transitionTo(std::move(off_state));
+        return;
+    }
+
+    if (!module_acquired_) {
+        module_acquired_ = true;
+        state_machine()->getModulePool()->acquire(config_.drone_module_data);
+    }
+
+    wait_for_module(RATE_WAIT_FOR_MESSAGE);
+    on_readiness_event(); // The adopted link may have connected and reported already
+}
+
+Server::handlers Drone_Mission_State::drone_handlers()
+{
     Server::handlers handler_obj;
     handler_obj.call_error = [this](const boost::system::error_code& ec, const Type_Error &type_error) {
         on_error_drone(ec, type_error);
@@ -81,34 +114,47 @@ void Drone_Mission_State::start()
     handler_obj.call_connect = [this]() {
         on_connect_drone();
     };
-    handler_obj.call_message = [this](const std::string& msg) {
+    handler_obj.call_message = [this](std::string_view msg) {
         on_message_drone(msg);
     };
+    handler_obj.call_delivered = [this](uint64_t frames) {
+        on_frames_delivered(frames);
+    };
+    return handler_obj;
+}
 
-    server_number_ = state_machine()->getCommunicationManager()->create_server(handler_obj,config_.drone_module_data.module_ip,config_.drone_module_data.port);
+void Drone_Mission_State::end()
+{
+    Logger::log_message(Logger::Type::INFO, "Drone State functionality complete, transitioning to Off State to wait until next mission");
+    
+    close_state();
+    auto off_state = std::make_unique<Off_State>(state_machine());
+    state_machine()->transitionTo(std::move(off_state));
+}
 
-    if (server_number_ == -1) {
-        Logger::log_message(Logger::Type::ERROR, "Unable to complete transition to Drone State, returning to Off State");
-        auto off_state = std::make_unique<Off_State>(state_machine());
-        state_machine()->transitionTo(std::move(off_state));
-        return;
+void Drone_Mission_State::wait_for_module(int timeout_seconds)
+{
+    if (!waiting_for_module_) {
+        waiting_for_module_ = true;
+        wait_started_ = std::chrono::steady_clock::now();
     }
 
-    docker_manager_->start_container(config_.drone_module_data.docker_name);
-
-    wait_timer_.expires_after(std::chrono::seconds(RATE_WAIT_FOR_MESSAGE));
+    wait_timer_.expires_after(std::chrono::seconds(timeout_seconds));
     wait_timer_.async_wait([this](const boost::system::error_code& ec) {
         continue_start_process(ec);
     });
 }
 
-void Drone_Mission_State::end()
+void Drone_Mission_State::on_readiness_event()
 {
-    Logger::log_message(Logger::Type::INFO, "Drone State functionality complete, transitioning to Off State to wait until next mission");
-    
-    close_state();
-    auto off_state = std::make_unique<Off_State>(state_machine());
-    state_machine()->transitionTo(std::move(off_state));
+    // A connection and a first status are all the start process needs, the timer only bounds the wait
+    if (!waiting_for_module_ || !drone_module_running_ || last_status_ == Struct_Drone::Status::UNKNOWN) {
+        return;
+    }
+
+    // Re-arming the timer aborts the pending wait; the start process then runs from the io_context,
+    // after the handler that reported readiness has returned
+    wait_for_module(0);
 }
 
 void Drone_Mission_State::continue_start_process(const boost::system::error_code& ec)
@@ -127,29 +173,21 @@ void Drone_Mission_State::continue_start_process(const boost::system::error_code
     if (!drone_module_running_){
         Logger::log_message(Logger::Type::WARNING, "Drone Module module is not running");
         attemps_++;
-        if (attemps_ <= NUMBER_ATTEMPS_MAX) {
+        if (attemps_ <= NUMBER_ATTEMPS_MAX && plans_queued()) {
+            // A new server would lose the queued mission, keep waiting on the pending reconnection
+            wait_for_module(RATE_WAIT_FOR_MESSAGE);
+            return;
+        } else if (attemps_ <= NUMBER_ATTEMPS_MAX) {
             if (server_number_ != -1){
                 state_machine()->getCommunicationManager()->close_connection_to_server(server_number_);
                 server_number_ = -1;
             }
 
-            Server::handlers handler_obj;
-            handler_obj.call_error = [this](const boost::system::error_code& ec, const Type_Error &type_error) {
-                on_error_drone(ec, type_error);
-            };
-            handler_obj.call_connect = [this]() {
-                on_connect_drone();
-            };
-            handler_obj.call_message = [this](const std::string& msg) {
-                on_message_drone(msg);
-            };
-
-            server_number_ = state_machine()->getCommunicationManager()->create_server(handler_obj,config_.drone_module_data.module_ip,config_.drone_module_data.port);
+            Server::handlers handler_obj = drone_handlers();
+
+            server_number_ = state_machine()->getCommunicationManager()->create_server(state_machine()->get_strand(),handler_obj,config_.drone_module_data.module_ip,config_.drone_module_data.port,DELIVERY_WINDOW_FRAMES);
             Logger::log_message(Logger::Type::INFO, "Retrying to start Drone module");
-            wait_timer_.expires_after(std::chrono::seconds(RATE_WAIT_FOR_MESSAGE));
-            wait_timer_.async_wait([this](const boost::system::error_code& ec) {
-                continue_start_process(ec);
-            });
+            wait_for_module(RATE_WAIT_FOR_MESSAGE);
             return;
         } else {
             Logger::log_message(Logger::Type::ERROR,"Number of allowed attempts exceeded. Transitioning to off state");
@@ -163,10 +201,7 @@ void Drone_Mission_State::continue_start_process(const boost::system::error_code
     if (last_status_ == Struct_Drone::Status::UNKNOWN) {
         attemps_++;
         if (attemps_ <= NUMBER_ATTEMPS_MAX) {
-            wait_timer_.expires_after(std::chrono::seconds(RATE_WAIT_FOR_MESSAGE));
-            wait_timer_.async_wait([this](const boost::system::error_code& ec) {
-                continue_start_process(ec);
-            });
+            wait_for_module(RATE_WAIT_FOR_MESSAGE);
             return;
         } else {
             Logger::log_message(Logger::Type::ERROR,"Number of allowed attempts exceeded. Transitioning to off state");
@@ -177,6 +212,15 @@ void Drone_Mission_State::continue_start_process(const boost::system::error_code
         }
     }
 
+    waiting_for_module_ = false;
+    const auto ready_ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - wait_started_).count();
+    Logger::log_message(Logger::Type::INFO, "Drone module ready after " + std::to_string(ready_ms) + " ms");
+
+    if (mission_sent_) {
+        Logger::log_message(Logger::Type::INFO, "Drone Module reconnected, resuming the mission upload");
+        return;
+    }
+
     if (config_.coor_points.empty()) {
         Logger::log_message(Logger::Type::ERROR,"There is no coordinate to send to Drone Module. Transitioning to off state");
         close_state();
@@ -185,92 +229,73 @@ void Drone_Mission_State::continue_start_process(const boost::system::error_code
         return;
     }
 
-    Logger::log_message(Logger::Type::INFO, "Starting to send positions messages to Drone Module");
-
-    drone_i_ = 0;
-    coor_j_ = 0;
-
-    send_timer_.expires_after(std::chrono::seconds(RATE_FOR_SEND_MESSAGES));
-    send_timer_.async_wait([this](const boost::system::error_code& ec) {
-        send_message(ec);
-    });
+    Logger::log_message(Logger::Type::INFO, "Starting to send mission plans to Drone Module");
+    send_mission_plans();
 }
 
-void Drone_Mission_State::prepare_next_drone_message(Struct_Planner::Coordinate& coor, std::string& type)
+void Drone_Mission_State::send_mission_plans()
 {
-    if (drone_i_ >= config_.coor_points.size()) {
-        return;
-    }
-
-    if (coor_j_ >= config_.coor_points[drone_i_].size()) {
-        drone_i_++;
-        if (drone_i_ >= config_.coor_points.size()) {
-            Logger::log_message(Logger::Type::INFO,"Starting all drones");
-            coor = Struct_Planner::Coordinate(0,0);
-            type = "START_ALL";
-            return;
+    // One message per drone with its whole route, back-to-back, then START_ALL. Plans queued while
+    // planning are already ahead of them on the link
+    for (size_t drone_i = 0; drone_i < config_.coor_points.size(); ++drone_i) {
+        if (drone_i < plan_sent_.size() && plan_sent_[drone_i]) {
+            continue;
         }
 
-        coor_j_ = 0;
-
-        coor = config_.coor_points[drone_i_][0];
-        if (1 == config_.coor_points[drone_i_].size()) {// If only have 1 coordinate add another one slightly offset for FINISH
-            config_.coor_points[drone_i_].push_back(coor);
+        auto &route = config_.coor_points[drone_i];
+        if (route.size() == 1) {// If only have 1 coordinate add another one for FINISH
+            route.push_back(route.front());
         }
-        std::stringstream log;
-        log << "Sending coordinate "<< coor <<" number " << coor_j_ << " to drone " << drone_i_;
-        Logger::log_message(Logger::Type::INFO,log.str());
-        type = "START";
-        coor_j_ = 1;
-        return;
-    }
 
-    coor = config_.coor_points[drone_i_][coor_j_];
-    std::stringstream log;
-    log << "Sending coordinate "<< coor <<" number " << coor_j_ << " to drone " << drone_i_;
-    Logger::log_message(Logger::Type::INFO,log.str());
-    if (coor_j_ == 0) {
-        type = "START";
-        if (coor_j_ == config_.coor_points[drone_i_].size() - 1) {// If only have 1 coordinate add another one slightly offset for FINISH
-            config_.coor_points[drone_i_].push_back(coor);
+        std::string message_to_drone;
+        if (!Enc_Dec_Drone::create_mission_plan_to_drone(config_.drone_sim,static_cast<int>(drone_i),route,message_to_drone)) {
+            std::stringstream log;
+            log << "Unable to encode mission plan for drone " << drone_i << " to Drone Module (" << config_.drone_sim << "). Transitioning to off state";
+            Logger::log_message(Logger::Type::ERROR,log.str());
+            close_state();
+            auto off_state = std::make_unique<Off_State>(state_machine());
+            state_machine()->transitionTo(std::move(off_state));
+            return;
         }
-    } else if (coor_j_ == config_.coor_points[drone_i_].size() - 1) {
-        type = "FINISH";
-    } else {
-        type = std::string();
-    }
-
-    coor_j_++;
-}
 
-void Drone_Mission_State::send_message(const boost::system::error_code& ec)
-{
-    if (ec == boost::asio::error::operation_aborted) return;
-    if (ec) {
-        Logger::log_message(Logger::Type::ERROR, "Error in timer to continue start process in Drone State, transitioning to Off State");
-        close_state();
-        auto off_state = std::make_unique<Off_State>(state_machine());
-        state_machine()->transitionTo(std::move(off_state));
-        return;
+        std::stringstream info;
+        info << "Drone: " << drone_i << ", Waypoints: " << route.size() << ", Start: (" << route.front().lat << ", " << route.front().lon << ")";
+        Logger::log_message(Logger::Type::INFO,"Sending mission plan. " + info.str());
+        if (!send_message(std::move(message_to_drone), "MISSION_PLAN", info.str())) {
+            return;
+        }
     }
 
-    Struct_Planner::Coordinate coor;
-    std::string type;
-    prepare_next_drone_message(coor, type);
-
+    Logger::log_message(Logger::Type::INFO,"Starting all drones");
     std::string message_to_drone;
-
-    if (!Enc_Dec_Drone::create_message_to_drone(config_.drone_sim,coor,type,message_to_drone)) {
+    if (!Enc_Dec_Drone::create_message_to_drone(config_.drone_sim,Struct_Planner::Coordinate(0,0),Struct_Drone::Command_Type::START_ALL,message_to_drone)) {
         std::stringstream log;
-        log << "Unable to encode configuration message to Drone Module (" << config_.drone_sim << "). Transitioning to off state";
+        log << "Unable to encode start message to Drone Module (" << config_.drone_sim << "). Transitioning to off state";
         Logger::log_message(Logger::Type::ERROR,log.str());
         close_state();
         auto off_state = std::make_unique<Off_State>(state_machine());
         state_machine()->transitionTo(std::move(off_state));
         return;
     }
+    if (send_message(std::move(message_to_drone), "COMMAND", "Type: START_ALL")) {
+        mission_sent_ = true;
+        start_all_frame_ = frames_queued_; // The mission counts as started once the Drone module acknowledges it
+    }
+}
+
+void Drone_Mission_State::on_frames_delivered(uint64_t frames)
+{
+    if (start_all_frame_ == 0 || frames < start_all_frame_) {
+        return;
+    }
 
-    if (!state_machine()->getCommunicationManager()->send_message_to_server(server_number_,message_to_drone)){
+    start_all_frame_ = 0;
+    state_machine()->on_mission_started();
+}
+
+bool Drone_Mission_State::send_message(std::string message, const std::string &type, const std::string &info)
+{
+    if (!state_machine()->getCommunicationManager()->send_message_to_server(server_number_,std::move(message))){
         Logger::log_message(Logger::Type::ERROR,"Unable to send configuration message to Drone Module. Transitioning to off state");
         if (state_machine()->getRecorder()) {
             state_machine()->getRecorder()->write_error("Unable to send message to Drone Module");
@@ -278,22 +303,14 @@ void Drone_Mission_State::send_message(const boost::system::error_code& ec)
         close_state();
         auto off_state = std::make_unique<Off_State>(state_machine());
         state_machine()->transitionTo(std::move(off_state));
-        return;
+        return false;
     }
-    
+
+    frames_queued_++;
     if (state_machine()->getRecorder()) {
-        std::stringstream coord_info;
-        coord_info << "Type: " << type << ", Coordinate: (" << coor.lat << ", " << coor.lon << ")";
-        state_machine()->getRecorder()->write_message_sent("Drone", "COORDINATE", coord_info.str());
+        state_machine()->getRecorder()->write_message_sent("Drone", type, info);
     }
-
-    if (type == "START_ALL")
-        return;
-
-    send_timer_.expires_after(std::chrono::seconds(RATE_FOR_SEND_MESSAGES));
-    send_timer_.async_wait([this](const boost::system::error_code& ec) {
-        send_message(ec);
-    });
+    return true;
 }
 
 void Drone_Mission_State::on_connect_drone()
@@ -301,6 +318,7 @@ void Drone_Mission_State::on_connect_drone()
     Logger::log_message(Logger::Type::INFO, "Successful connection to Drone Module");
     drone_module_running_ = true;
     attemps_ = 0;
+    on_readiness_event();
 }
 
 void Drone_Mission_State::on_error_drone(const boost::system::error_code& ec, const Type_Error &type_error)
@@ -310,7 +328,6 @@ void Drone_Mission_State::on_error_drone(const boost::system::error_code& ec, co
     }
 
     wait_timer_.cancel();
-    send_timer_.cancel();
     if (last_status_ == Struct_Drone::Status::FINISH) {
         Logger::log_message(Logger::Type::INFO,"Drone module task complete, closing connection");
         if (server_number_ != -1){
@@ -322,8 +339,25 @@ void Drone_Mission_State::on_error_drone(const boost::system::error_code& ec, co
 
     Logger::log_message(Logger::Type::WARNING, "on_error callback triggered in Drone connection");
 
-    if (!docker_manager_->is_container_running(config_.drone_module_data.docker_name,false)) {
-        Logger::log_message(Logger::Type::ERROR, "Drone docker is not running, transitioning to off state");
+    // Errors reported while the container is being checked are handled by that check
+    if (error_check_pending_) {
+        return;
+    }
+    error_check_pending_ = true;
+    module_launcher_->is_module_running(config_.drone_module_data.docker_name, false, [this, ec, type_error](bool running) {
+        error_check_pending_ = false;
+        recover_from_error(running, ec, type_error);
+    });
+}
+
+void Drone_Mission_State::recover_from_error(bool container_running, const boost::system::error_code& ec, const Type_Error &type_error)
+{
+    if (state_closing_) {
+        return;
+    }
+
+    if (!container_running) {
+        Logger::log_message(Logger::Type::ERROR, "Drone module is not running, transitioning to off state");
         close_state();
         auto off_state = std::make_unique<Off_State>(state_machine());
         state_machine()->transitionTo(std::move(off_state));
@@ -348,25 +382,25 @@ void Drone_Mission_State::on_error_drone(const boost::system::error_code& ec, co
     Logger::log_message(Logger::Type::WARNING,log + ": " + ec.message());
     
     attemps_++;
-    if (attemps_ <= NUMBER_ATTEMPS_MAX) {
-        Server::handlers handler_obj;
-        handler_obj.call_error = [this](const boost::system::error_code& ec, const Type_Error &type_error) {
-            on_error_drone(ec, type_error);
-        };
-        handler_obj.call_connect = [this]() {
-            on_connect_drone();
-        };
-        handler_obj.call_message = [this](const std::string& msg) {
-            on_message_drone(msg);
-        };
+    if (attemps_ <= NUMBER_ATTEMPS_MAX && plans_queued()) {
+        // The mission stays queued in the connection: the Drone module gets the unacknowledged part on reconnect
+        drone_module_running_ = false;
+        if (!state_machine()->getCommunicationManager()->accept_reconnection(server_number_)) {
+            Logger::log_message(Logger::Type::ERROR,"Unable to wait for the Drone Module to reconnect. Transitioning to off state");
+            close_state();
+            auto off_state = std::make_unique<Off_State>(state_machine());
+            state_machine()->transitionTo(std::move(off_state));
+            return;
+        }
+
+        wait_for_module(RATE_WAIT_FOR_MESSAGE);
+    } else if (attemps_ <= NUMBER_ATTEMPS_MAX) {
+        Server::handlers handler_obj = drone_handlers();
         drone_module_running_ = false;
 
-        server_number_ = state_machine()->getCommunicationManager()->create_server(handler_obj,config_.drone_module_data.module_ip,config_.drone_module_data.port);
+        server_number_ = state_machine()->getCommunicationManager()->create_server(state_machine()->get_strand(),handler_obj,config_.drone_module_data.module_ip,config_.drone_module_data.port,DELIVERY_WINDOW_FRAMES);
 
-        wait_timer_.expires_after(std::chrono::seconds(RATE_WAIT_FOR_MESSAGE));
-        wait_timer_.async_wait([this](const boost::system::error_code& ec) {
-            continue_start_process(ec);
-        });
+        wait_for_module(RATE_WAIT_FOR_MESSAGE);
     } else {
         Logger::log_message(Logger::Type::ERROR,"Number of allowed attempts exceeded. Transitioning to off state");
         close_state();
@@ -375,35 +409,40 @@ void Drone_Mission_State::on_error_drone(const boost::system::error_code& ec, co
     }
 }
 
-void Drone_Mission_State::on_message_drone(const std::string& msg)
+void Drone_Mission_State::on_message_drone(std::string_view msg)
 {
     if (!drone_module_running_)
         drone_module_running_ = true;
 
     Logger::log_message(Logger::Type::INFO, "Message received from Drone module");
 
-    std::string data = msg.substr(4);
+    dispatch(Enc_Dec_PLD::decode_from_drone(msg),
+        [this](const Status &status) { on_drone_status(status); },
+        [this, msg](Decode_Error) { on_undecodable_drone_message(msg); },
+        [this, msg](Unknown_Message) { on_undecodable_drone_message(msg); });
+}
 
-    auto [type, decoded_msg] = Enc_Dec_PLD::decode_from_drone(data);
-    if (type != Enc_Dec_PLD::PLD::STATUS_DRONE) {
-        Logger::log_message(Logger::Type::WARNING, "Unable to decode Drone module message");
-        if (state_machine()->getRecorder()) {
-            state_machine()->getRecorder()->write_error("Unable to decode Drone module message");
-            state_machine()->getRecorder()->write_raw_message("Drone", msg);
-        }
-        return;
+void Drone_Mission_State::on_undecodable_drone_message(std::string_view msg)
+{
+    Logger::log_message(Logger::Type::WARNING, "Unable to decode Drone module message");
+    if (state_machine()->getRecorder()) {
+        state_machine()->getRecorder()->write_error("Unable to decode Drone module message");
+        state_machine()->getRecorder()->write_raw_message("Drone", msg);
     }
+}
 
-    auto my_msg = dynamic_cast<Status*>(decoded_msg.get());
-    if (!my_msg || last_status_ == Struct_Drone::to_enum(my_msg->type_status())) {
+void Drone_Mission_State::on_drone_status(const Status &status)
+{
+    const Struct_Drone::Status new_status = Enc_Dec_Drone::decode_status_drone(status);
+    if (last_status_ == new_status) {
         return;
     }
 
     if (state_machine()->getRecorder()) {
-        state_machine()->getRecorder()->write_message_received("Drone", "STATUS", my_msg->type_status());
+        state_machine()->getRecorder()->write_message_received("Drone", "STATUS", to_string(new_status));
     }
 
-    if (my_msg->type_status() == "ERROR"){
+    if (new_status == Struct_Drone::Status::ERROR){
         Logger::log_message(Logger::Type::ERROR, "Drone module status has changed to ERROR, transitioning to off state");
         if (state_machine()->getRecorder()) {
             state_machine()->getRecorder()->write_error("Drone module status ERROR");
@@ -415,8 +454,9 @@ void Drone_Mission_State::on_message_drone(const std::string& msg)
         return;
     }
 
-    last_status_ = Struct_Drone::to_enum(my_msg->type_status());
+    last_status_ = new_status;
     Logger::log_message(Logger::Type::INFO, "Drone module status has changed to " + to_string(last_status_));
+    on_readiness_event();
     if (last_status_ == Struct_Drone::Status::FINISH){
         end();
         return;
@@ -428,6 +468,30 @@ void Drone_Mission_State::set_data(const Structs_PLD::Config_drone &config)
     config_ = config;
 }
 
+void Drone_Mission_State::adopt_module()
+{
+    module_acquired_ = true;
+}
+
+void Drone_Mission_State::adopt_drone_link(int server_number, std::vector<bool> plans_sent, bool connected, Struct_Drone::Status status)
+{
+    // Its handlers point at the previous state, they are switched before that state is destroyed
+    if (!state_machine()->getCommunicationManager()->set_server_handlers(server_number, drone_handlers())) {
+        return;
+    }
+
+    server_number_ = server_number;
+    plan_sent_ = std::move(plans_sent);
+    frames_queued_ = static_cast<uint64_t>(std::count(plan_sent_.begin(), plan_sent_.end(), true));
+    drone_module_running_ = connected;
+    last_status_ = status;
+}
+
+bool Drone_Mission_State::plans_queued() const
+{
+    return mission_sent_ || std::find(plan_sent_.begin(), plan_sent_.end(), true) != plan_sent_.end();
+}
+
 const char* Drone_Mission_State::state_name() const
 {
     return "Drone Mission State";
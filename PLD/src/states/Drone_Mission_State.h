@@ -10,40 +10,60 @@
 #pragma once
 #include <boost/asio.hpp>
 #include "State.h"
-#include "../Docker_Manager.h"
+#include "../Module_Launcher.h"
 #include "structs/Structs_PLD.h"
 #include "structs/Structs_Drone.h"
 #include "common_libs/Server.h"
+#include "generated_proto/messages_pld.pb.h"
 
 class Drone_Mission_State: public State {
 public:
+    static constexpr size_t DELIVERY_WINDOW_FRAMES = 32; // Mission messages in flight before the Drone module acknowledges them
+
     explicit Drone_Mission_State(std::shared_ptr<State_Machine> state_machine_ptr);
     ~Drone_Mission_State() noexcept override;
 
     void start() override;
     void end() override;
     void set_data(const Structs_PLD::Config_drone &config);
+    void adopt_module(); // The Drone module was already acquired from the Module_Pool by the previous state
+    // The previous state opened the Drone link and queued the mission plans marked in plans_sent on it
+    void adopt_drone_link(int server_number, std::vector<bool> plans_sent, bool connected, Struct_Drone::Status status);
 
 private:
     Structs_PLD::Config_drone config_;
     int server_number_ = -1;
-    std::shared_ptr<Docker_Manager> docker_manager_;
-    boost::asio::steady_timer wait_timer_;
-    boost::asio::steady_timer send_timer_;
+    std::shared_ptr<Module_Launcher> module_launcher_;
+    boost::asio::steady_timer wait_timer_; // Upper bound for the module to become ready
+    bool waiting_for_module_ = false;
+    std::chrono::steady_clock::time_point wait_started_;
     bool drone_module_running_ = false;
     Struct_Drone::Status last_status_ = Struct_Drone::Status::UNKNOWN;
     int attemps_ = 0;
-    size_t  drone_i_ = 0;
-    size_t  coor_j_ = 0;
+    bool mission_sent_ = false; // Mission plans handed to the connection, which delivers them across reconnections
+    std::vector<bool> plan_sent_; // By drone, plans queued before the rest of the mission
+    uint64_t frames_queued_ = 0;   // Messages handed to the current connection
+    uint64_t start_all_frame_ = 0; // Position of START_ALL among them until the Drone module has it, 0 otherwise
+    bool module_acquired_ = false; // Handed over by the Module_Pool, released when the state closes
     bool state_closing_ = false;
+    bool error_check_pending_ = false;
 
     const char* state_name() const override;
     void handle_finish_command() override;
     void close_state();
+    void on_connection_tested(bool connected);
+    void wait_for_module(int timeout_seconds);
+    void on_readiness_event();
     void continue_start_process(const boost::system::error_code& ec);
+    Server::handlers drone_handlers();
     void on_connect_drone();
     void on_error_drone(const boost::system::error_code& ec, const Type_Error &type_error);
-    void on_message_drone(const std::string& msg);
-    void prepare_next_drone_message(Struct_Planner::Coordinate& coor, std::string& type);
-    void send_message(const boost::system::error_code& ec);
+    void recover_from_error(bool container_running, const boost::system::error_code& ec, const Type_Error &type_error);
+    void on_message_drone(std::string_view msg);
+    void on_drone_status(const Status &status);
+    void on_undecodable_drone_message(std::string_view msg);
+    void on_frames_delivered(uint64_t frames);
+    bool plans_queued() const;
+    void send_mission_plans();
+    bool send_message(std::string message, const std::string &type, const std::string &info);
 };
\ No newline at end of file
@@ -8,7 +8,6 @@
  * ============================================================
  * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 #include "Off_State.h"
-#include "Planner_State.h"
 #include "../State_Machine.h"
 #include "common_libs/Enc_Dec_PLD.h"
 #include "common_libs/Logger.h"
@@ -20,38 +19,27 @@ Off_State::Off_State(std::shared_ptr<State_Machine> state_machine_ptr): State(st
 void Off_State::start()
 {
     Logger::log_message(Logger::Type::INFO, "Entering Off State, waiting for Client");
-    state_machine()->getCommunicationManager()->set_status(Structs_PLD::Status::WAITING_INFO);
+    state_machine()->set_status(Structs_PLD::Status::WAITING_INFO);
     
     // Start new recording session when entering Off State
     if (state_machine()->getRecorder()) {
         state_machine()->getRecorder()->start_new_session();
         state_machine()->getRecorder()->write_state_transition("N/A", "Off_State");
     }
+    state_machine()->on_idle();
 }
 
 void Off_State::end()
 {
-    auto planner_state = std::make_unique<Planner_State>(state_machine());
-    planner_state->set_data(config_);
-
     Logger::log_message(Logger::Type::INFO, "Off State functionality complete, transitioning to the next state");
-    
-    state_machine()->transitionTo(std::move(planner_state));
+
+    // The State_Machine starts it, after any mission already planned in the background
+    state_machine()->enqueue_mission(config_);
 }
 
-void Off_State::handle_config_mission_message(const google::protobuf::Message* proto_msg, const std::string &raw_message)
+void Off_State::handle_config_mission_message(const Config_mission &config_proto)
 {
-    const auto* config_proto = dynamic_cast<const Config_mission*>(proto_msg);
-    if (!config_proto) {
-        Logger::log_message(Logger::Type::ERROR, "Unable to decode message config mission from Client");
-        if (state_machine()->getRecorder()) {
-            state_machine()->getRecorder()->write_error("Unable to decode CONFIG_MISSION from Client");
-            state_machine()->getRecorder()->write_raw_message("Client", raw_message);
-        }
-        return;
-    }
-
-    if (!Enc_Dec_PLD::decode_config_mission(*config_proto, config_)) {
+    if (!Enc_Dec_PLD::decode_config_mission(config_proto, config_)) {
         Logger::log_message(Logger::Type::ERROR, "Unable to decode message config mission from Client");
         if (state_machine()->getRecorder()) {
             state_machine()->getRecorder()->write_error("Unable to decode config mission from Client");
@@ -68,55 +56,37 @@ void Off_State::handle_config_mission_message(const google::protobuf::Message* p
     end();
 }
 
-void Off_State::handle_command_message(const google::protobuf::Message* proto_msg, const std::string &raw_message)
+void Off_State::handle_command_message(const Command &command)
 {
-    const auto* command = dynamic_cast<const Command*>(proto_msg);
-    if (!command) {
-        Logger::log_message(Logger::Type::WARNING, "Unable to decode command from Client");
-        if (state_machine()->getRecorder()) {
-            state_machine()->getRecorder()->write_error("Unable to decode COMMAND from Client");
-            state_machine()->getRecorder()->write_raw_message("Client", raw_message);
-        }
-        return;
-    }
-
     if (state_machine()->getRecorder()) {
-        state_machine()->getRecorder()->write_message_received("Client", "COMMAND", command->command());
+        state_machine()->getRecorder()->write_message_received("Client", "COMMAND", command.command());
     }
 
-    if (command->command() == "FINISH") {
-        Logger::log_message(Logger::Type::WARNING, "FINISH command received in Off State, shuting down...");
-        state_machine()->get_io_context().stop();
+    if (command.command() == "FINISH") {
+        Logger::log_message(Logger::Type::WARNING, "FINISH command received in Off State, closing the mission");
+        state_machine()->finish();
     } else {
-        Logger::log_message(Logger::Type::WARNING, "Unexpected command received from Client: " + command->command());
+        Logger::log_message(Logger::Type::WARNING, "Unexpected command received from Client: " + command.command());
         if (state_machine()->getRecorder()) {
-            state_machine()->getRecorder()->write_error("Unexpected command: " + command->command());
+            state_machine()->getRecorder()->write_error("Unexpected command: " + command.command());
         }
     }
 }
 
-void Off_State::handle_unexpected_message(Enc_Dec_PLD::PLD type, const std::string &raw_message)
+void Off_State::handle_unexpected_message(const std::string &reason, std::string_view raw_message)
 {
-    Logger::log_message(Logger::Type::WARNING, "Unexpected message received from Client, type: " + Enc_Dec_PLD::to_string(type));
+    Logger::log_message(Logger::Type::WARNING, reason + " received from Client");
     if (state_machine()->getRecorder()) {
-        state_machine()->getRecorder()->write_error("Unexpected message type: " + Enc_Dec_PLD::to_string(type));
+        state_machine()->getRecorder()->write_error(reason + " from Client");
         state_machine()->getRecorder()->write_raw_message("Client", raw_message);
     }
 }
 
-void Off_State::handleMessage(const std::string &message)
+void Off_State::handleMessage(const Enc_Dec_PLD::From_Client &message, std::string_view raw)
 {
-    auto [type, proto_msg] = Enc_Dec_PLD::decode_from_client(message);
-
-    if (type == Enc_Dec_PLD::PLD::CONFIG_MISSION) {
-        handle_config_mission_message(proto_msg.get(), message);
-        return;
-    }
-
-    if (type == Enc_Dec_PLD::PLD::COMMAND) {
-        handle_command_message(proto_msg.get(), message);
-        return;
-    }
-
-    handle_unexpected_message(type, message);
+    dispatch(message,
+        [this](const Config_mission &config_proto) { handle_config_mission_message(config_proto); },
+        [this](const Command &command) { handle_command_message(command); },
+        [this, raw](Decode_Error) { handle_unexpected_message("Undecodable message", raw); },
+        [this, raw](Unknown_Message) { handle_unexpected_message("Unexpected message", raw); });
 }
\ No newline at end of file
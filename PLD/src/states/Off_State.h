@@ -19,12 +19,12 @@ public:
 
     void start() override;
     void end() override;
-    void handleMessage(const std::string &message) override;
+    void handleMessage(const Enc_Dec_PLD::From_Client &message, std::string_view raw) override;
 
 private:
-    void handle_config_mission_message(const google::protobuf::Message* proto_msg, const std::string &raw_message);
-    void handle_command_message(const google::protobuf::Message* proto_msg, const std::string &raw_message);
-    void handle_unexpected_message(Enc_Dec_PLD::PLD type, const std::string &raw_message);
+    void handle_config_mission_message(const Config_mission &config_proto);
+    void handle_command_message(const Command &command);
+    void handle_unexpected_message(const std::string &reason, std::string_view raw_message);
     Structs_PLD::Config_mission config_;
 
 };
\ No newline at end of file
@@ -8,19 +8,33 @@
  * ============================================================
  * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 #include "Planner_State.h"
+#include <algorithm>
 #include "Off_State.h"
 #include "Drone_Mission_State.h"
 #include "../State_Machine.h"
 #include "common_libs/Logger.h"
+#include "common_libs/Enc_Dec_Drone.h"
 #include "common_libs/Enc_Dec_Planner.h"
 #include "common_libs/Enc_Dec_PLD.h"
 #include "structs/Structs_Planner.h"
 
-constexpr int RATE_WAIT_FOR_MESSAGE = 10;
+constexpr int RATE_WAIT_FOR_MESSAGE = 10; // Upper bound, the start process continues as soon as the Planner is ready
 constexpr int NUMBER_ATTEMPS_MAX = 3;
+constexpr int RATE_WAIT_FOR_CANCEL = 2;
+constexpr int RATE_WAIT_FOR_WARM_PLANNER = 3;
+
+namespace {
+// Seeded from the wall clock so ids stay unique for a Planner service that outlives a PLD restart
+uint64_t next_planner_request_id()
+{
+    static std::atomic<uint64_t> next_id{static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now().time_since_epoch()).count())};
+    return ++next_id;
+}
+}
 
 Planner_State::Planner_State(std::shared_ptr<State_Machine> state_machine_ptr): State(state_machine_ptr),
-                                                                                wait_timer_(state_machine()->get_io_context())
+                                                                                wait_timer_(state_machine()->get_strand())
 {
 }
 
@@ -44,14 +58,33 @@ void Planner_State::close_state()
         server_number_ = -1;
     }
 
-    if(docker_manager_ && docker_manager_->is_container_running(config_.planner_module_data.docker_name)) {
-        docker_manager_->stop_container(config_.planner_module_data.docker_name);
+    // On success the Planner service goes back to the pool as is, otherwise the pool restarts it
+    if (module_acquired_) {
+        state_machine()->getModulePool()->release(config_.planner_module_data, keep_planner_running_);
+        module_acquired_ = false;
+    }
+
+    // Planning failed: the prestarted simulation has not flown, so it goes back to the pool as is
+    // unless it already holds some of the mission plans
+    const bool plans_forwarded = std::find(route_forwarded_.begin(), route_forwarded_.end(), true) != route_forwarded_.end();
+    close_drone_link();
+    if (drone_prestarted_) {
+        state_machine()->getModulePool()->release(config_.drone_module_data, !plans_forwarded);
+        drone_prestarted_ = false;
     }
 }
 
 void Planner_State::transition_to_off_state()
 {
     close_state();
+    if (pipelined_) {
+        // The fleet is flying another mission, only the queued one is dropped
+        if (!pipeline_reported_) {
+            pipeline_reported_ = true;
+            state_machine()->on_background_planning_failed();
+        }
+        return;
+    }
     auto off_state = std::make_unique<Off_State>(state_machine());
     state_machine()->transitionTo(std::move(off_state));
 }
@@ -67,14 +100,33 @@ void Planner_State::record_planner_error_and_transition(const std::string& error
 
 void Planner_State::start()
 {
-    Logger::log_message(Logger::Type::INFO, "Entering Planner State");
-    state_machine()->getCommunicationManager()->set_status(Structs_PLD::Status::PLANNING_MISSION);
-    
-    if (state_machine()->getRecorder()) {
-        state_machine()->getRecorder()->write_state_transition("Off_State", "Planner_State");
+    if (pipelined_) {
+        // The fleet and the PLD status belong to the mission in flight
+        Logger::log_message(Logger::Type::INFO, "Entering Planner State in the background");
+    } else {
+        Logger::log_message(Logger::Type::INFO, "Entering Planner State");
+        state_machine()->set_status(Structs_PLD::Status::PLANNING_MISSION);
+
+        if (state_machine()->getRecorder()) {
+            state_machine()->getRecorder()->write_state_transition("Off_State", "Planner_State");
+        }
+        // The Drone simulation is the slowest module to start and its configuration is already known,
+        // so it starts while the Planner works and the Drone Mission State takes it over
+        Logger::log_message(Logger::Type::INFO, "Starting Drone module while planning");
+        drone_prestarted_ = true;
+        state_machine()->getModulePool()->acquire(config_.drone_module_data);
+        open_drone_link();
     }
-    docker_manager_ = std::make_shared<Docker_Manager>(config_.planner_module_data.user,config_.planner_module_data.ssh_ip,config_.planner_module_data.docker_file,config_.planner_module_data.key);
-    if (docker_manager_->test_connection()){
+
+    module_launcher_ = state_machine()->getModulePool()->make_launcher(state_machine()->get_strand(), config_.planner_module_data);
+    module_launcher_->test_connection([this](bool connected) {
+        on_connection_tested(connected);
+    });
+}
+
+void Planner_State::on_connection_tested(bool connected)
+{
+    if (connected){
         std::stringstream log;
         log << "Connection successful to " << config_.planner_module_data.user << ":" << config_.planner_module_data.ssh_ip;
         Logger::log_message(Logger::Type::INFO, log.str());
@@ -82,8 +134,7 @@ void Planner_State::start()
         std::stringstream log;
         log << "Unable to connect to " << config_.planner_module_data.user << ":" << config_.planner_module_data.ssh_ip << ". Transitioning to Off State";
         Logger::log_message(Logger::Type::ERROR, log.str());
-        auto off_state = std::make_unique<Off_State>(state_machine());
-        state_machine()->transitionTo(std::move(off_state));
+        transition_to_off_state();
         return;
     }
 
@@ -94,32 +145,61 @@ void Planner_State::start()
     handler_obj.call_connect = [this]() {
         on_connect_planner();
     };
-    handler_obj.call_message = [this](const std::string& msg) {
+    handler_obj.call_message = [this](std::string_view msg) {
         on_message_planner(msg);
     };
 
-    server_number_ = state_machine()->getCommunicationManager()->create_server(handler_obj,config_.planner_module_data.module_ip,config_.planner_module_data.port);
+    server_number_ = state_machine()->getCommunicationManager()->create_server(state_machine()->get_strand(),handler_obj,config_.planner_module_data.module_ip,config_.planner_module_data.port);
 
     if (server_number_ == -1) {
         Logger::log_message(Logger::Type::ERROR, "Unable to complete transition to Planner State, returning to Off State");
-        auto off_state = std::make_unique<Off_State>(state_machine());
-        state_machine()->transitionTo(std::move(off_state));
+        transition_to_off_state();
         return;
     }
 
-    docker_manager_->start_container(config_.planner_module_data.docker_name);
+    request_id_ = next_planner_request_id();
 
-    wait_timer_.expires_after(std::chrono::seconds(RATE_WAIT_FOR_MESSAGE));
-    wait_timer_.async_wait([this](const boost::system::error_code& ec) {
-        continue_start_process(ec);
+    module_acquired_ = true;
+    // The pool answers on its own strand; the guard is checked back on this state's strand, where it is destroyed
+    auto on_acquired = module_launcher_->guard([this](bool warm) {
+        on_module_acquired(warm);
     });
+    state_machine()->getModulePool()->acquire(config_.planner_module_data, [strand = state_machine()->get_strand(), on_acquired](bool warm) {
+        boost::asio::post(strand, [on_acquired, warm]() {
+            on_acquired(warm);
+        });
+    });
+}
 
+void Planner_State::on_module_acquired(bool warm)
+{
+    wait_for_module(warm ? RATE_WAIT_FOR_WARM_PLANNER : RATE_WAIT_FOR_MESSAGE);
+    on_readiness_event(); // A warm Planner may have connected and reported while the container was checked
 }
 
 void Planner_State::end()
 {
+    if (pipelined_) {
+        keep_planner_running_ = true;
+        close_state();
+        Logger::log_message(Logger::Type::INFO, "Planner State functionality complete, routes kept until the fleet is free");
+        if (!pipeline_reported_) {
+            pipeline_reported_ = true;
+            state_machine()->on_mission_planned(data_next_state_);
+        }
+        return;
+    }
+
     auto mission_drone_state = std::make_unique<Drone_Mission_State>(state_machine());
     mission_drone_state->set_data(data_next_state_);
+    mission_drone_state->adopt_module();
+    if (drone_server_ != -1) {
+        mission_drone_state->adopt_drone_link(drone_server_, std::move(route_forwarded_), drone_connected_, drone_status_);
+        drone_server_ = -1;
+        route_forwarded_.clear();
+    }
+    drone_prestarted_ = false;
+    keep_planner_running_ = true;
     close_state();
     Logger::log_message(Logger::Type::INFO, "Planner State functionality complete, transitioning to the next state");
     
@@ -131,6 +211,11 @@ void Planner_State::set_data(Structs_PLD::Config_mission config)
     config_ = config;
 }
 
+void Planner_State::set_pipelined()
+{
+    pipelined_ = true;
+}
+
 const char* Planner_State::state_name() const
 {
     return "Planner State";
@@ -138,10 +223,73 @@ const char* Planner_State::state_name() const
 
 void Planner_State::handle_finish_command()
 {
+    if (cancel_requested_) {
+        return;
+    }
+
+    if (request_planner_cancel()) {
+        Logger::log_message(Logger::Type::WARNING, "FINISH command received in Planner State, waiting for Planner to cancel calculation");
+        wait_timer_.cancel();
+        wait_timer_.expires_after(std::chrono::seconds(RATE_WAIT_FOR_CANCEL));
+        wait_timer_.async_wait([this](const boost::system::error_code& ec) {
+            if (ec == boost::asio::error::operation_aborted) return;
+            Logger::log_message(Logger::Type::WARNING, "Planner did not acknowledge cancel in time, transitioning to Off State");
+            transition_to_off_state();
+        });
+        return;
+    }
+
     Logger::log_message(Logger::Type::WARNING, "FINISH command received in Planner State, transitioning to Off State");
-    close_state();
-    auto off_state = std::make_unique<Off_State>(state_machine());
-    state_machine()->transitionTo(std::move(off_state));
+    transition_to_off_state();
+}
+
+bool Planner_State::request_planner_cancel()
+{
+    if (server_number_ == -1 || !request_sent_ || response_message_received_) {
+        return false;
+    }
+
+    std::string message_to_planner;
+    if (!Enc_Dec_Planner::encode_cancel_message(request_id_, message_to_planner)) {
+        Logger::log_message(Logger::Type::WARNING, "Unable to encode cancel message to Planner");
+        return false;
+    }
+
+    if (!state_machine()->getCommunicationManager()->send_message_to_server(server_number_, std::move(message_to_planner))) {
+        Logger::log_message(Logger::Type::WARNING, "Unable to send cancel message to Planner");
+        return false;
+    }
+
+    if (state_machine()->getRecorder()) {
+        state_machine()->getRecorder()->write_message_sent("Planner", "CANCEL_MESSAGE", "Cancel sent to Planner");
+    }
+    cancel_requested_ = true;
+    return true;
+}
+
+void Planner_State::wait_for_module(int timeout_seconds)
+{
+    if (!waiting_for_module_) {
+        waiting_for_module_ = true;
+        wait_started_ = std::chrono::steady_clock::now();
+    }
+
+    wait_timer_.expires_after(std::chrono::seconds(timeout_seconds));
+    wait_timer_.async_wait([this](const boost::system::error_code& ec) {
+        continue_start_process(ec);
+    });
+}
+
+void Planner_State::on_readiness_event()
+{
+    // A connection and a first status are all the start process needs, the timer only bounds the wait
+    if (!waiting_for_module_ || !planner_running_ || last_status_ == Struct_Planner::Status::UNKNOWN) {
+        return;
+    }
+
+    // Re-arming the timer aborts the pending wait; the start process then runs from the io_context,
+    // after the handler that reported readiness has returned
+    wait_for_module(0);
 }
 
 void Planner_State::continue_start_process(const boost::system::error_code& ec)
@@ -149,9 +297,7 @@ void Planner_State::continue_start_process(const boost::system::error_code& ec)
     if (ec == boost::asio::error::operation_aborted) return;
     if (ec) {
         Logger::log_message(Logger::Type::ERROR, "Error in timer to continue start process in Planner State, transitioning to Off State");
-        close_state();
-        auto off_state = std::make_unique<Off_State>(state_machine());
-        state_machine()->transitionTo(std::move(off_state));
+        transition_to_off_state();
         return;
     }
 
@@ -173,22 +319,17 @@ void Planner_State::continue_start_process(const boost::system::error_code& ec)
             handler_obj.call_connect = [this]() {
                 on_connect_planner();
             };
-            handler_obj.call_message = [this](const std::string& msg) {
+            handler_obj.call_message = [this](std::string_view msg) {
                 on_message_planner(msg);
             };
 
-            server_number_ = state_machine()->getCommunicationManager()->create_server(handler_obj,config_.planner_module_data.module_ip,config_.planner_module_data.port);
+            server_number_ = state_machine()->getCommunicationManager()->create_server(state_machine()->get_strand(),handler_obj,config_.planner_module_data.module_ip,config_.planner_module_data.port);
             Logger::log_message(Logger::Type::INFO, "Retrying to start Planner module");
-            wait_timer_.expires_after(std::chrono::seconds(RATE_WAIT_FOR_MESSAGE));
-            wait_timer_.async_wait([this](const boost::system::error_code& ec) {
-                continue_start_process(ec);
-            });
+            wait_for_module(RATE_WAIT_FOR_MESSAGE);
             return;
         } else {
             Logger::log_message(Logger::Type::ERROR,"Number of allowed attempts exceeded. Transitioning to off state");
-            close_state();
-            auto off_state = std::make_unique<Off_State>(state_machine());
-            state_machine()->transitionTo(std::move(off_state));
+            transition_to_off_state();
             return;
         }
     }
@@ -196,45 +337,41 @@ void Planner_State::continue_start_process(const boost::system::error_code& ec)
     if (last_status_ == Struct_Planner::Status::UNKNOWN) {
         attemps_++;
         if (attemps_ <= NUMBER_ATTEMPS_MAX) {
-            wait_timer_.expires_after(std::chrono::seconds(RATE_WAIT_FOR_MESSAGE));
-            wait_timer_.async_wait([this](const boost::system::error_code& ec) {
-                continue_start_process(ec);
-            });
+            wait_for_module(RATE_WAIT_FOR_MESSAGE);
             return;
         } else {
             Logger::log_message(Logger::Type::ERROR,"Number of allowed attempts exceeded. Transitioning to off state");
-            close_state();
-            auto off_state = std::make_unique<Off_State>(state_machine());
-            state_machine()->transitionTo(std::move(off_state));
+            transition_to_off_state();
             return;
         }
     }
 
+    waiting_for_module_ = false;
+    const auto ready_ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - wait_started_).count();
+    Logger::log_message(Logger::Type::INFO, "Planner module ready after " + std::to_string(ready_ms) + " ms");
+
     Logger::log_message(Logger::Type::INFO, "Sending config message to Planner Module");
 
     std::string message_to_planner;
 
-    if (!Enc_Dec_Planner::encode_config_message(config_.planner_info.signal_server_configs,config_.planner_info.dron_data,message_to_planner)) {
+    if (!Enc_Dec_Planner::encode_config_message(config_.planner_info.signal_server_configs,config_.planner_info.dron_data,request_id_,planner_compact_coordinates_,message_to_planner)) {
         Logger::log_message(Logger::Type::ERROR,"Unable to encode configuration message to Planner. Transitioning to off state");
-        close_state();
-        auto off_state = std::make_unique<Off_State>(state_machine());
-        state_machine()->transitionTo(std::move(off_state));
+        transition_to_off_state();
         return;
     }
 
-    if (!state_machine()->getCommunicationManager()->send_message_to_server(server_number_,message_to_planner)){
+    if (!state_machine()->getCommunicationManager()->send_message_to_server(server_number_,std::move(message_to_planner))){
         Logger::log_message(Logger::Type::ERROR,"Unable to send configuration message to Planner. Transitioning to off state");
         if (state_machine()->getRecorder()) {
             state_machine()->getRecorder()->write_error("Unable to send configuration message to Planner");
         }
-        close_state();
-        auto off_state = std::make_unique<Off_State>(state_machine());
-        state_machine()->transitionTo(std::move(off_state));
+        transition_to_off_state();
         return;
     }
     
+    request_sent_ = true;
     if (state_machine()->getRecorder()) {
-        state_machine()->getRecorder()->write_message_sent("Planner", "CONFIG_MESSAGE", "Configuration sent to Planner");
+        state_machine()->getRecorder()->write_message_sent("Planner", "CONFIG_MESSAGE", "Configuration sent to Planner, request " + std::to_string(request_id_));
     }
 }
 
@@ -243,6 +380,7 @@ void Planner_State::on_connect_planner()
     Logger::log_message(Logger::Type::INFO, "Successful connection to Planner Module");
     planner_running_ = true;
     attemps_ = 0;
+    on_readiness_event();
 }
     
 void Planner_State::on_error_planner(const boost::system::error_code& ec, const Type_Error &type_error)
@@ -263,11 +401,26 @@ void Planner_State::on_error_planner(const boost::system::error_code& ec, const
 
     Logger::log_message(Logger::Type::WARNING, "on_error callback triggered in Planner connection");
 
-    if (!docker_manager_->is_container_running(config_.planner_module_data.docker_name,false)) {
-        Logger::log_message(Logger::Type::ERROR, "Planner docker is not running, transitioning to off state");
-        close_state();
-        auto off_state = std::make_unique<Off_State>(state_machine());
-        state_machine()->transitionTo(std::move(off_state));
+    // Errors reported while the container is being checked are handled by that check
+    if (error_check_pending_) {
+        return;
+    }
+    error_check_pending_ = true;
+    module_launcher_->is_module_running(config_.planner_module_data.docker_name, false, [this, ec, type_error](bool running) {
+        error_check_pending_ = false;
+        recover_from_error(running, ec, type_error);
+    });
+}
+
+void Planner_State::recover_from_error(bool container_running, const boost::system::error_code& ec, const Type_Error &type_error)
+{
+    if (state_closing_) {
+        return;
+    }
+
+    if (!container_running) {
+        Logger::log_message(Logger::Type::ERROR, "Planner module is not running, transitioning to off state");
+        transition_to_off_state();
         return;
     }
 
@@ -297,73 +450,110 @@ void Planner_State::on_error_planner(const boost::system::error_code& ec, const
         handler_obj.call_connect = [this]() {
             on_connect_planner();
         };
-        handler_obj.call_message = [this](const std::string& msg) {
+        handler_obj.call_message = [this](std::string_view msg) {
             on_message_planner(msg);
         };
         planner_running_ = false;
 
-        server_number_ = state_machine()->getCommunicationManager()->create_server(handler_obj,config_.planner_module_data.module_ip,config_.planner_module_data.port);
+        server_number_ = state_machine()->getCommunicationManager()->create_server(state_machine()->get_strand(),handler_obj,config_.planner_module_data.module_ip,config_.planner_module_data.port);
 
-        wait_timer_.expires_after(std::chrono::seconds(RATE_WAIT_FOR_MESSAGE));
-        wait_timer_.async_wait([this](const boost::system::error_code& ec) {
-            continue_start_process(ec);
-        });
+        wait_for_module(RATE_WAIT_FOR_MESSAGE);
     } else {
         Logger::log_message(Logger::Type::ERROR,"Number of allowed attempts exceeded. Transitioning to off state");
-        close_state();
-        auto off_state = std::make_unique<Off_State>(state_machine());
-        state_machine()->transitionTo(std::move(off_state));
+        transition_to_off_state();
     }
 }
     
-void Planner_State::on_message_planner(const std::string& msg)
+void Planner_State::on_message_planner(std::string_view msg)
 {
     if (!planner_running_)
         planner_running_ = true;
 
     Logger::log_message(Logger::Type::INFO, "Message received from Planner");
 
-    std::string data = msg.substr(4);
+    dispatch(Enc_Dec_PLD::decode_from_planner(msg),
+        [this](const Status &status) { on_planner_status(status); },
+        [this](const PlannerResponseList &response) { on_planner_response(response); },
+        [this](const PlannerRoute &route) { on_planner_route(route); },
+        [this, msg](Decode_Error) { on_undecodable_planner_message(msg); },
+        [this, msg](Unknown_Message) { on_undecodable_planner_message(msg); });
+}
+
+void Planner_State::on_undecodable_planner_message(std::string_view msg)
+{
+    Logger::log_message(Logger::Type::WARNING, "Unable to decode Planner message");
+    if (state_machine()->getRecorder()) {
+        state_machine()->getRecorder()->write_error("Unable to decode Planner message");
+        state_machine()->getRecorder()->write_raw_message("Planner", msg);
+    }
+}
 
-    auto [type, decoded_msg] = Enc_Dec_PLD::decode_from_planner(data);
-    if (type != Enc_Dec_PLD::PLD::STATUS_Planner && type != Enc_Dec_PLD::PLD::Planner_RESPONSE) {
-        Logger::log_message(Logger::Type::WARNING, "Unable to decode Planner message");
+void Planner_State::on_planner_status(const Status &status)
+{
+    planner_compact_coordinates_ = status.compact_coordinates();
+    // Statuses tagged with another request id belong to other work queued in the Planner service
+    if (status.request_id() != 0 && status.request_id() != request_id_) {
+        return;
+    }
+
+    if (!status.profile().empty()) {
+        Logger::log_message(Logger::Type::INFO, "Planner profile for request " + std::to_string(request_id_) + ": " + status.profile());
         if (state_machine()->getRecorder()) {
-            state_machine()->getRecorder()->write_error("Unable to decode Planner message");
-            state_machine()->getRecorder()->write_raw_message("Planner", msg);
+            state_machine()->getRecorder()->write_message_received("Planner", "PROFILE", status.profile());
         }
+    }
+
+    const Struct_Planner::Status new_status = Enc_Dec_PLD::decode_status_planner(status);
+    if (last_status_ == new_status) {
         return;
     }
 
-    if (type == Enc_Dec_PLD::PLD::STATUS_Planner) {
-        auto my_msg = dynamic_cast<Status*>(decoded_msg.get());
-        if (!my_msg || last_status_ == Struct_Planner::to_enum(my_msg->type_status())) {
-            return;
-        }
+    if (state_machine()->getRecorder()) {
+        state_machine()->getRecorder()->write_message_received("Planner", "STATUS", to_string(new_status));
+    }
 
-        if (state_machine()->getRecorder()) {
-            state_machine()->getRecorder()->write_message_received("Planner", "STATUS", my_msg->type_status());
-        }
+    if (new_status == Struct_Planner::Status::ERROR){
+        Logger::log_message(Logger::Type::ERROR, "Planner status has changed to ERROR, transitioning to off state");
+        record_planner_error_and_transition("Planner status ERROR");
+        return;
+    }
 
-        if (my_msg->type_status() == "ERROR"){
-            Logger::log_message(Logger::Type::ERROR, "Planner status has changed to ERROR, transitioning to off state");
-            record_planner_error_and_transition("Planner status ERROR");
-            return;
+    last_status_ = new_status;
+    if (cancel_requested_) {
+        if (last_status_ == Struct_Planner::Status::CANCELLED || last_status_ == Struct_Planner::Status::EXPECTING_DATA) {
+            Logger::log_message(Logger::Type::INFO, "Planner calculation cancelled, transitioning to Off State");
+            transition_to_off_state();
         }
+        return;
+    }
 
-        last_status_ = Struct_Planner::to_enum(my_msg->type_status());
-        if (last_status_ == Struct_Planner::Status::FINISH && !response_message_received_){ //The next else if statement will transitionate to next state if the response is received
-            Logger::log_message(Logger::Type::ERROR, "Planner status has changed to FINISH without receiving response message, transitioning to off state");
-            record_planner_error_and_transition("Planner FINISH without response");
-            return;
-        }
+    if (last_status_ == Struct_Planner::Status::CANCELLED) {
+        Logger::log_message(Logger::Type::ERROR, "Planner cancelled the request, transitioning to off state");
+        record_planner_error_and_transition("Planner request cancelled");
+        return;
+    }
 
-        Logger::log_message(Logger::Type::INFO, "Planner status has changed to " + to_string(last_status_));
+    // A FINISH tagged with our request id is sent just before the response, only an untagged one means it was lost
+    if (last_status_ == Struct_Planner::Status::FINISH && !response_message_received_ && status.request_id() == 0){
+        Logger::log_message(Logger::Type::ERROR, "Planner status has changed to FINISH without receiving response message, transitioning to off state");
+        record_planner_error_and_transition("Planner FINISH without response");
         return;
     }
 
-    auto my_msg = dynamic_cast<PlannerResponseList*>(decoded_msg.get());
-    if (!my_msg) {
+    Logger::log_message(Logger::Type::INFO, "Planner status has changed to " + to_string(last_status_));
+    on_readiness_event();
+}
+
+void Planner_State::on_planner_response(const PlannerResponseList &response)
+{
+    if (cancel_requested_) {
+        return;
+    }
+
+    if (response.request_id() != request_id_) {
+        std::stringstream log;
+        log << "Planner response for request " << response.request_id() << " ignored, expecting " << request_id_;
+        Logger::log_message(Logger::Type::WARNING, log.str());
         return;
     }
 
@@ -373,17 +563,179 @@ void Planner_State::on_message_planner(const std::string& msg)
     }
 
     std::vector<std::vector<Struct_Planner::Coordinate>> result;
-    if (!Enc_Dec_PLD::decode_planner_response(*my_msg, result)) {
+    if (response.streamed_routes() > 0 && response.items_size() == 0) {
+        if (!take_streamed_routes(response.streamed_routes(), result)) {
+            record_planner_error_and_transition("Planner routes missing from the stream");
+            return;
+        }
+    } else if (!Enc_Dec_PLD::decode_planner_response(response, result)) {
         Logger::log_message(Logger::Type::ERROR, "Unable to decode planner response, transitioning to off state");
         record_planner_error_and_transition("Unable to decode planner response");
         return;
     }
 
+    on_routes_planned(std::move(result));
+}
+
+void Planner_State::on_planner_route(const PlannerRoute &route)
+{
+    if (cancel_requested_ || response_message_received_ || route.request_id() != request_id_) {
+        return;
+    }
+
+    // Decoded as it arrives, while the Planner is still expanding the routes of the next drones
+    const size_t drone = route.drone();
+    if (drone >= static_cast<size_t>(std::max(config_.planner_info.dron_data.num_drones, 0))) {
+        Logger::log_message(Logger::Type::WARNING, "Route for unknown drone " + std::to_string(drone) + " ignored");
+        return;
+    }
+    if (streamed_routes_.size() <= drone) {
+        streamed_routes_.resize(static_cast<size_t>(config_.planner_info.dron_data.num_drones));
+        route_received_.resize(streamed_routes_.size(), false);
+    }
+
+    if (!Enc_Dec_PLD::decode_planner_route(route.route(), streamed_routes_[drone])) {
+        Logger::log_message(Logger::Type::ERROR, "Unable to decode route of drone " + std::to_string(drone) + ", transitioning to off state");
+        record_planner_error_and_transition("Unable to decode planner route");
+        return;
+    }
+    route_received_[drone] = true;
+
+    std::stringstream info;
+    info << "Drone: " << drone << ", Waypoints: " << streamed_routes_[drone].size();
+    Logger::log_message(Logger::Type::INFO, "Planner route received. " + info.str());
+    if (state_machine()->getRecorder()) {
+        state_machine()->getRecorder()->write_message_received("Planner", "PLANNER_ROUTE", info.str());
+    }
+
+    forward_route(drone);
+}
+
+bool Planner_State::take_streamed_routes(uint32_t routes, std::vector<std::vector<Struct_Planner::Coordinate>> &result)
+{
+    const auto received = static_cast<size_t>(std::count(route_received_.begin(), route_received_.end(), true));
+    if (routes != streamed_routes_.size() || received != routes) {
+        std::stringstream log;
+        log << "Planner streamed " << routes << " routes but " << received << " arrived, transitioning to off state";
+        Logger::log_message(Logger::Type::ERROR, log.str());
+        return false;
+    }
+
+    result = std::move(streamed_routes_);
+    streamed_routes_.clear();
+    route_received_.clear();
+    return true;
+}
+
+void Planner_State::on_routes_planned(std::vector<std::vector<Struct_Planner::Coordinate>> result)
+{
     response_message_received_ = true;
-    data_next_state_.coor_points = result;
+    data_next_state_.coor_points = std::move(result);
     data_next_state_.drone_module_data = config_.drone_module_data;
     data_next_state_.drone_sim = config_.drone_sim;
 
     // Transitionate to the next state
     end();
+}
+
+void Planner_State::open_drone_link()
+{
+    // The Drone module connects to it as soon as it is up, and each streamed route is queued on it as it
+    // arrives; the Drone Mission State takes it over and only adds what is missing and START_ALL
+    Server::handlers handler_obj;
+    handler_obj.call_error = [this](const boost::system::error_code& ec, const Type_Error &type_error) {
+        on_drone_link_error(ec, type_error);
+    };
+    handler_obj.call_connect = [this]() {
+        Logger::log_message(Logger::Type::INFO, "Drone module connected while planning");
+        drone_connected_ = true;
+    };
+    handler_obj.call_message = [this](std::string_view msg) {
+        on_drone_link_message(msg);
+    };
+
+    drone_server_ = state_machine()->getCommunicationManager()->create_server(state_machine()->get_strand(),handler_obj,config_.drone_module_data.module_ip,config_.drone_module_data.port,Drone_Mission_State::DELIVERY_WINDOW_FRAMES);
+    if (drone_server_ == -1) {
+        Logger::log_message(Logger::Type::WARNING, "Unable to open the Drone link while planning, routes are sent once planning ends");
+    }
+}
+
+void Planner_State::close_drone_link()
+{
+    if (drone_server_ != -1) {
+        state_machine()->getCommunicationManager()->close_connection_to_server(drone_server_);
+        drone_server_ = -1;
+    }
+    drone_connected_ = false;
+    drone_status_ = Struct_Drone::Status::UNKNOWN;
+    route_forwarded_.clear();
+}
+
+void Planner_State::on_drone_link_error(const boost::system::error_code& ec, const Type_Error &type_error)
+{
+    if (state_closing_ || drone_server_ == -1) {
+        return;
+    }
+
+    // Queued plans survive a dropped connection; a link that cannot listen is left to the Drone Mission State
+    drone_connected_ = false;
+    if (type_error != Type_Error::CONNECTING && state_machine()->getCommunicationManager()->accept_reconnection(drone_server_)) {
+        Logger::log_message(Logger::Type::WARNING, "Drone link dropped while planning, waiting for the Drone module to reconnect: " + ec.message());
+        return;
+    }
+
+    Logger::log_message(Logger::Type::WARNING, "Drone link closed while planning, routes are sent once planning ends: " + ec.message());
+    close_drone_link();
+}
+
+void Planner_State::on_drone_link_message(std::string_view msg)
+{
+    dispatch(Enc_Dec_PLD::decode_from_drone(msg),
+        [this](const Status &status) {
+            const Struct_Drone::Status new_status = Enc_Dec_Drone::decode_status_drone(status);
+            if (new_status == drone_status_) {
+                return;
+            }
+            if (state_machine()->getRecorder()) {
+                state_machine()->getRecorder()->write_message_received("Drone", "STATUS", to_string(new_status));
+            }
+            if (new_status == Struct_Drone::Status::ERROR) {
+                Logger::log_message(Logger::Type::WARNING, "Drone module status ERROR while planning, routes are sent once planning ends");
+                close_drone_link();
+                return;
+            }
+            drone_status_ = new_status;
+            Logger::log_message(Logger::Type::INFO, "Drone module status has changed to " + to_string(drone_status_) + " while planning");
+        },
+        [](Decode_Error) { Logger::log_message(Logger::Type::WARNING, "Unable to decode Drone module message"); },
+        [](Unknown_Message) { Logger::log_message(Logger::Type::WARNING, "Unable to decode Drone module message"); });
+}
+
+void Planner_State::forward_route(size_t drone)
+{
+    if (drone_server_ == -1 || (drone < route_forwarded_.size() && route_forwarded_[drone])) {
+        return;
+    }
+
+    auto route = streamed_routes_[drone];
+    if (route.size() == 1) { // If only have 1 coordinate add another one for FINISH
+        route.push_back(route.front());
+    }
+
+    std::string message_to_drone;
+    if (!Enc_Dec_Drone::create_mission_plan_to_drone(config_.drone_sim, static_cast<int>(drone), route, message_to_drone) ||
+        !state_machine()->getCommunicationManager()->send_message_to_server(drone_server_, std::move(message_to_drone))) {
+        Logger::log_message(Logger::Type::WARNING, "Unable to queue the mission plan of drone " + std::to_string(drone) + ", it is sent once planning ends");
+        return;
+    }
+
+    route_forwarded_.resize(streamed_routes_.size(), false);
+    route_forwarded_[drone] = true;
+
+    std::stringstream info;
+    info << "Drone: " << drone << ", Waypoints: " << route.size() << ", Start: (" << route.front().lat << ", " << route.front().lon << ")";
+    Logger::log_message(Logger::Type::INFO, "Sending mission plan while planning. " + info.str());
+    if (state_machine()->getRecorder()) {
+        state_machine()->getRecorder()->write_message_sent("Drone", "MISSION_PLAN", info.str());
+    }
 }
\ No newline at end of file
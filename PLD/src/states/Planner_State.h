@@ -10,9 +10,11 @@
 #pragma once
 #include <boost/asio.hpp>
 #include "State.h"
-#include "../Docker_Manager.h"
+#include "../Module_Launcher.h"
 #include "structs/Structs_PLD.h"
+#include "structs/Structs_Drone.h"
 #include "common_libs/Server.h"
+#include "generated_proto/messages_pld.pb.h"
 
 class Planner_State: public State {
 public:
@@ -22,26 +24,62 @@ public:
     void start() override;
     void end() override;
     void set_data(Structs_PLD::Config_mission config);
+    void set_pipelined(); // Plans a queued mission while another one flies, results go back to the State_Machine
 
 private:
     Structs_PLD::Config_mission config_;
     int server_number_ = -1;
-    std::shared_ptr<Docker_Manager> docker_manager_;
-    boost::asio::steady_timer wait_timer_;
+    std::shared_ptr<Module_Launcher> module_launcher_;
+    boost::asio::steady_timer wait_timer_; // Upper bound for the module to become ready
+    bool waiting_for_module_ = false;
+    std::chrono::steady_clock::time_point wait_started_;
     bool planner_running_ = false;
     bool response_message_received_ = false;
     Struct_Planner::Status last_status_ = Struct_Planner::Status::UNKNOWN;
     int attemps_ = 0;
     Structs_PLD::Config_drone data_next_state_;
+    std::vector<std::vector<Struct_Planner::Coordinate>> streamed_routes_; // Decoded as each drone's route arrives
+    std::vector<bool> route_received_;
     bool state_closing_ = false;
+    bool cancel_requested_ = false;
+    bool request_sent_ = false;
+    bool keep_planner_running_ = false;
+    bool module_acquired_ = false; // Handed over by the Module_Pool, released when the state closes
+    bool pipelined_ = false;
+    bool pipeline_reported_ = false;
+    bool drone_prestarted_ = false; // Drone module acquired for the next state, handed over by end()
+    int drone_server_ = -1; // Drone link opened while planning, handed over by end() with the routes queued on it
+    bool drone_connected_ = false;
+    Struct_Drone::Status drone_status_ = Struct_Drone::Status::UNKNOWN;
+    std::vector<bool> route_forwarded_; // By drone, mission plan queued on the Drone link
+    bool error_check_pending_ = false;
+    uint64_t request_id_ = 0;
+    bool planner_compact_coordinates_ = false; // Advertised by the Planner in its status messages
 
     void transition_to_off_state();
     const char* state_name() const override;
     void handle_finish_command() override;
     void record_planner_error_and_transition(const std::string& error_message);
     void close_state();
+    bool request_planner_cancel();
+    void on_connection_tested(bool connected);
+    void on_module_acquired(bool warm);
+    void wait_for_module(int timeout_seconds);
+    void on_readiness_event();
     void continue_start_process(const boost::system::error_code& ec);
     void on_connect_planner();
     void on_error_planner(const boost::system::error_code& ec, const Type_Error &type_error);
-    void on_message_planner(const std::string& msg);
+    void recover_from_error(bool container_running, const boost::system::error_code& ec, const Type_Error &type_error);
+    void on_message_planner(std::string_view msg);
+    void on_planner_status(const Status &status);
+    void on_planner_response(const PlannerResponseList &response);
+    void on_planner_route(const PlannerRoute &route);
+    bool take_streamed_routes(uint32_t routes, std::vector<std::vector<Struct_Planner::Coordinate>> &result);
+    void on_routes_planned(std::vector<std::vector<Struct_Planner::Coordinate>> result);
+    void open_drone_link();
+    void close_drone_link();
+    void on_drone_link_error(const boost::system::error_code& ec, const Type_Error &type_error);
+    void on_drone_link_message(std::string_view msg);
+    void forward_route(size_t drone);
+    void on_undecodable_planner_message(std::string_view msg);
 };
\ No newline at end of file
@@ -26,50 +26,55 @@ void State::end()
 	// Intentionally empty: concrete state classes define teardown behavior.
 }
 
-void State::handleMessage(const std::string &message)
+void State::handleMessage(const Enc_Dec_PLD::From_Client &message, std::string_view raw)
 {
-	auto [type, proto_msg] = Enc_Dec_PLD::decode_from_client(message);
-
-	if (type == Enc_Dec_PLD::PLD::CONFIG_MISSION) {
-		Logger::log_message(Logger::Type::WARNING, std::string("unexpected CONFIG MISSION message received in ") + state_name() + ", ignoring");
-		if (state_machine()->getRecorder()) {
-			state_machine()->getRecorder()->write_message_received("Client", "CONFIG_MISSION", std::string("Unexpected in ") + state_name());
-		}
-		return;
-	}
+	dispatch(message,
+		[this](const Config_mission &config_proto) {
+			Structs_PLD::Config_mission config;
+			if (!Enc_Dec_PLD::decode_config_mission(config_proto, config)) {
+				Logger::log_message(Logger::Type::ERROR, "Unable to decode message config mission from Client");
+				if (state_machine()->getRecorder()) {
+					state_machine()->getRecorder()->write_error("Unable to decode config mission from Client");
+				}
+				return;
+			}
 
-	if (type == Enc_Dec_PLD::PLD::COMMAND) {
-		const auto* command = dynamic_cast<const Command*>(proto_msg.get());
-		if (!command) {
-			Logger::log_message(Logger::Type::WARNING, "Unable to decode command from Client");
+			// Planned while the current mission runs and started as soon as the fleet is free
+			Logger::log_message(Logger::Type::INFO, std::string("CONFIG MISSION message received in ") + state_name() + ", queued after the current mission");
 			if (state_machine()->getRecorder()) {
-				state_machine()->getRecorder()->write_error("Unable to decode COMMAND from Client");
-				state_machine()->getRecorder()->write_raw_message("Client", message);
+				state_machine()->getRecorder()->write_message_received("Client", "CONFIG_MISSION", std::string("Queued in ") + state_name());
+			}
+			state_machine()->enqueue_mission(config);
+		},
+		[this](const Command &command) {
+			if (state_machine()->getRecorder()) {
+				state_machine()->getRecorder()->write_message_received("Client", "COMMAND", command.command());
 			}
-			return;
-		}
-
-		if (state_machine()->getRecorder()) {
-			state_machine()->getRecorder()->write_message_received("Client", "COMMAND", command->command());
-		}
-
-		if (command->command() == "FINISH") {
-			handle_finish_command();
-			return;
-		}
 
-		Logger::log_message(Logger::Type::WARNING, "Unexpected command received from Client: " + command->command());
-		if (state_machine()->getRecorder()) {
-			state_machine()->getRecorder()->write_error("Unexpected command: " + command->command());
-		}
-		return;
-	}
+			if (command.command() == "FINISH") {
+				handle_finish_command();
+				return;
+			}
 
-	Logger::log_message(Logger::Type::WARNING, "unexpected message received from Client, type: " + Enc_Dec_PLD::to_string(type));
-	if (state_machine()->getRecorder()) {
-		state_machine()->getRecorder()->write_error("Unexpected message type: " + Enc_Dec_PLD::to_string(type));
-		state_machine()->getRecorder()->write_raw_message("Client", message);
-	}
+			Logger::log_message(Logger::Type::WARNING, "Unexpected command received from Client: " + command.command());
+			if (state_machine()->getRecorder()) {
+				state_machine()->getRecorder()->write_error("Unexpected command: " + command.command());
+			}
+		},
+		[this, raw](Decode_Error) {
+			Logger::log_message(Logger::Type::WARNING, "Unable to decode message from Client");
+			if (state_machine()->getRecorder()) {
+				state_machine()->getRecorder()->write_error("Unable to decode message from Client");
+				state_machine()->getRecorder()->write_raw_message("Client", raw);
+			}
+		},
+		[this, raw](Unknown_Message) {
+			Logger::log_message(Logger::Type::WARNING, "unexpected message received from Client, type: UNKNOWN");
+			if (state_machine()->getRecorder()) {
+				state_machine()->getRecorder()->write_error("Unexpected message type: UNKNOWN");
+				state_machine()->getRecorder()->write_raw_message("Client", raw);
+			}
+		});
 }
 
 const char* State::state_name() const
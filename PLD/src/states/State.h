@@ -10,6 +10,8 @@
 #pragma once
 #include <memory>
 #include <string>
+#include <string_view>
+#include "common_libs/Enc_Dec_PLD.h"
 
 // Forward declaration
 class State_Machine;
@@ -20,7 +22,8 @@ public:
     virtual ~State() = default;
     virtual void start();
     virtual void end();
-    virtual void handleMessage(const std::string &message);
+    // message is the Client message decoded once on arrival, raw its bytes for the recorder
+    virtual void handleMessage(const Enc_Dec_PLD::From_Client &message, std::string_view raw);
 
 protected:
     virtual const char* state_name() const;
@@ -0,0 +1,438 @@
+/* ============================================================
+ *  Proyect  : I-Drone                                   
+ *  Filename : Planner_Benchmark.cpp                    
+ *  Author   : Iván Gutiérrez                            
+ *  License  : GNU General Public License v3.0           
+ *
+ *  © 2025 Iván Gutiérrez.
+ * ============================================================
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "ortools/constraint_solver/routing.h"
+#include "ortools/constraint_solver/routing_index_manager.h"
+#include "Path_Cal.h"
+#include "Phase_Profiler.h"
+#include "Planner_Recorder.h"
+#include "Cancel_Token.h"
+#include "common_libs/Logger.h"
+#include "structs/Structs_Planner.h"
+
+// Synthetic coverage is placed on a grid finer than max_distance_for_neighbor so the kNN graph stays connected
+constexpr double GRID_STEP_DEG = 0.0003;
+constexpr double ORIGIN_LAT = 40.40;
+constexpr double ORIGIN_LON = -3.70;
+constexpr double NO_SIGNAL_DBM = -120.0;
+constexpr double THRESHOLD_DBM = -90.0;
+constexpr int RASTER_GROW_ATTEMPTS = 6;
+
+enum class Pattern {
+    BLOBS,
+    CORRIDORS,
+    ISLANDS
+};
+
+std::string to_string(Pattern pattern)
+{
+    switch (pattern) {
+        case Pattern::BLOBS:
+            return "blobs";
+        case Pattern::CORRIDORS:
+            return "corridors";
+        case Pattern::ISLANDS:
+            return "islands";
+        default:
+            return "unknown";
+    }
+}
+
+struct Bench_Options {
+    std::vector<size_t> scales{1000, 10000, 100000, 1000000};
+    std::vector<Pattern> patterns{Pattern::BLOBS, Pattern::CORRIDORS, Pattern::ISLANDS};
+    size_t max_graph_points = 25000; // kNN build is quadratic, larger cases only time raster generation
+    int targets = 16;
+    int drones = 3;
+    int ortools_seconds = 2;
+    unsigned int seed = 42;
+    std::string output = "planner_benchmark.json";
+    std::filesystem::path work_dir = std::filesystem::temp_directory_path() / "planner_benchmark";
+};
+
+// Raster of received power (dBm), row-major like the Signal-Server PPM decode
+struct Raster {
+    int side = 0;
+    std::vector<double> dbm;
+};
+
+// Friend of Path_Cal so the individual stages can be timed without going through calculate_path
+class Planner_Benchmark {
+public:
+    Planner_Benchmark(const Bench_Options &options, const Struct_Planner::Config_struct &cnf): options_(options), cnf_(cnf), path_cal_(cnf) {}
+
+    std::string run_case(Pattern pattern, size_t scale, uint64_t case_id);
+
+private:
+    const Bench_Options &options_;
+    Struct_Planner::Config_struct cnf_;
+    Path_Cal path_cal_;
+    Cancel_Token cancel_token_;
+
+    std::string time_stages(const std::vector<Struct_Planner::Coordinate> &coverage,
+                            const Struct_Planner::DroneData &drone_data,
+                            const std::shared_ptr<Planner_Recorder> &recorder);
+    Solver_Stats solve_nested_reference(const DistanceMatrix &dist_matrix, int targets, int drones);
+};
+
+namespace {
+
+void paint_disc(Raster &raster, double cx, double cy, double radius, double peak_dbm)
+{
+    const int r = static_cast<int>(std::ceil(radius * 2.0));
+    const int x0 = std::max(0, static_cast<int>(cx) - r);
+    const int x1 = std::min(raster.side - 1, static_cast<int>(cx) + r);
+    const int y0 = std::max(0, static_cast<int>(cy) - r);
+    const int y1 = std::min(raster.side - 1, static_cast<int>(cy) + r);
+
+    for (int y = y0; y <= y1; ++y) {
+        for (int x = x0; x <= x1; ++x) {
+            const double d2 = (x - cx) * (x - cx) + (y - cy) * (y - cy);
+            const double value = NO_SIGNAL_DBM + (peak_dbm - NO_SIGNAL_DBM) * std::exp(-d2 / (2.0 * radius * radius));
+            double &cell = raster.dbm[static_cast<size_t>(y) * raster.side + x];
+            cell = std::max(cell, value);
+        }
+    }
+}
+
+Raster generate_raster(Pattern pattern, int side, std::mt19937 &rng)
+{
+    Raster raster;
+    raster.side = side;
+    raster.dbm.assign(static_cast<size_t>(side) * side, NO_SIGNAL_DBM);
+
+    std::uniform_real_distribution<double> pos(0.0, side);
+
+    switch (pattern) {
+        case Pattern::BLOBS: {
+            // A few wide transmitters covering most of the area
+            const int blobs = std::max(4, side / 60);
+            std::uniform_real_distribution<double> radius(side / 12.0, side / 6.0);
+            for (int i = 0; i < blobs; ++i) {
+                paint_disc(raster, pos(rng), pos(rng), radius(rng), -60.0);
+            }
+            break;
+        }
+        case Pattern::CORRIDORS: {
+            // Straight valleys with coverage only along them
+            const int width = std::max(2, side / 40);
+            const int spacing = width * 4;
+            for (int y = 0; y < side; ++y) {
+                for (int x = 0; x < side; ++x) {
+                    if (y % spacing < width || x % (spacing * 2) < width) {
+                        raster.dbm[static_cast<size_t>(y) * side + x] = -70.0;
+                    }
+                }
+            }
+            break;
+        }
+        case Pattern::ISLANDS: {
+            // Many small disconnected patches
+            const int islands = std::max(8, (side * side) / 400);
+            std::uniform_real_distribution<double> radius(1.5, 4.0);
+            for (int i = 0; i < islands; ++i) {
+                paint_disc(raster, pos(rng), pos(rng), radius(rng), -75.0);
+            }
+            break;
+        }
+        default:
+            break;
+    }
+
+    return raster;
+}
+
+std::vector<Struct_Planner::Coordinate> raster_to_points(const Raster &raster)
+{
+    std::vector<Struct_Planner::Coordinate> points;
+    for (int row = 0; row < raster.side; ++row) {
+        for (int col = 0; col < raster.side; ++col) {
+            if (raster.dbm[static_cast<size_t>(row) * raster.side + col] >= THRESHOLD_DBM) {
+                points.emplace_back(ORIGIN_LON + col * GRID_STEP_DEG, ORIGIN_LAT - row * GRID_STEP_DEG);
+            }
+        }
+    }
+    return points;
+}
+
+// Grows the raster until it holds at least `scale` covered cells, then samples exactly `scale` of them
+std::vector<Struct_Planner::Coordinate> generate_coverage(Pattern pattern, size_t scale, std::mt19937 &rng)
+{
+    int side = std::max(16, static_cast<int>(std::ceil(std::sqrt(static_cast<double>(scale) * 3.0))));
+    std::vector<Struct_Planner::Coordinate> points;
+
+    for (int attempt = 0; attempt < RASTER_GROW_ATTEMPTS; ++attempt) {
+        points = raster_to_points(generate_raster(pattern, side, rng));
+        if (points.size() >= scale) break;
+        side = static_cast<int>(side * 1.4);
+    }
+
+    if (points.size() > scale) {
+        std::shuffle(points.begin(), points.end(), rng);
+        points.resize(scale);
+    }
+    return points;
+}
+
+Struct_Planner::DroneData generate_targets(const std::vector<Struct_Planner::Coordinate> &coverage, int drones, int targets, std::mt19937 &rng)
+{
+    Struct_Planner::DroneData drone_data;
+    drone_data.num_drones = drones;
+
+    std::uniform_int_distribution<size_t> pick(0, coverage.size() - 1);
+    for (int i = 0; i < drones + targets; ++i) {
+        drone_data.pos_targets.push_back(coverage[pick(rng)]);
+    }
+    return drone_data;
+}
+
+std::string to_json(const Solver_Stats &stats)
+{
+    std::ostringstream json;
+    json << "{\"branches\":" << stats.branches << ",\"failures\":" << stats.failures
+         << ",\"solutions\":" << stats.solutions << ",\"wall_ms\":" << stats.wall_ms
+         << ",\"branches_per_s\":" << stats.branches_per_s() << ",\"objective\":" << stats.objective << '}';
+    return json.str();
+}
+
+bool parse_list(const std::string &arg, std::vector<std::string> &out)
+{
+    out.clear();
+    std::stringstream ss(arg);
+    std::string item;
+    while (std::getline(ss, item, ',')) {
+        if (!item.empty()) out.push_back(item);
+    }
+    return !out.empty();
+}
+
+bool parse_options(int argc, char* argv[], Bench_Options &options)
+{
+    try {
+        for (int i = 1; i < argc; ++i) {
+            std::string arg = argv[i];
+            std::vector<std::string> items;
+            if (arg == "--scales" && i + 1 < argc && parse_list(argv[++i], items)) {
+                options.scales.clear();
+                for (const auto &item : items) options.scales.push_back(std::stoul(item));
+            } else if (arg == "--patterns" && i + 1 < argc && parse_list(argv[++i], items)) {
+                options.patterns.clear();
+                for (const auto &item : items) {
+                    if (item == "blobs") options.patterns.push_back(Pattern::BLOBS);
+                    else if (item == "corridors") options.patterns.push_back(Pattern::CORRIDORS);
+                    else if (item == "islands") options.patterns.push_back(Pattern::ISLANDS);
+                    else return false;
+                }
+            } else if (arg == "--max-graph-points" && i + 1 < argc) {
+                options.max_graph_points = std::stoul(argv[++i]);
+            } else if (arg == "--targets" && i + 1 < argc) {
+                options.targets = std::stoi(argv[++i]);
+            } else if (arg == "--drones" && i + 1 < argc) {
+                options.drones = std::stoi(argv[++i]);
+            } else if (arg == "--ortools-seconds" && i + 1 < argc) {
+                options.ortools_seconds = std::stoi(argv[++i]);
+            } else if (arg == "--seed" && i + 1 < argc) {
+                options.seed = static_cast<unsigned int>(std::stoul(argv[++i]));
+            } else if (arg == "--output" && i + 1 < argc) {
+                options.output = argv[++i];
+            } else if (arg == "--work-dir" && i + 1 < argc) {
+                options.work_dir = argv[++i];
+            } else {
+                return false;
+            }
+        }
+    } catch (const std::exception &) {
+        return false;
+    }
+    return options.drones > 0 && options.targets > 0;
+}
+
+}
+
+std::string Planner_Benchmark::time_stages(const std::vector<Struct_Planner::Coordinate> &coverage,
+                                           const Struct_Planner::DroneData &drone_data,
+                                           const std::shared_ptr<Planner_Recorder> &recorder)
+{
+    Phase_Profiler stages;
+
+    // Same graph input calculate_path builds: coverage points followed by the targets
+    std::vector<Struct_Planner::Coordinate> points_cp = coverage;
+    points_cp.insert(points_cp.end(), drone_data.pos_targets.begin(), drone_data.pos_targets.end());
+    stages.set_size("graph_nodes", static_cast<int64_t>(points_cp.size()));
+    stages.set_size("targets", static_cast<int64_t>(drone_data.pos_targets.size()));
+    stages.set_size("drones", drone_data.num_drones);
+
+    std::vector<std::vector<std::pair<int,double>>> adj;
+    {
+        auto phase = stages.scope("build_knn_graph");
+        path_cal_.build_knn_graph(points_cp, cnf_.max_neighbor, cnf_.max_distance_for_neighbor, adj, cancel_token_);
+    }
+
+    DistanceMatrix dist_matrix;
+    {
+        auto phase = stages.scope("compute_target_distance_matrix");
+        path_cal_.compute_target_distance_matrix(points_cp, adj, drone_data.pos_targets, dist_matrix, cancel_token_);
+    }
+
+    Phase_Profiler solver_phases;
+    Solver_Stats flat_stats;
+    {
+        auto phase = stages.scope("solve_vrp");
+        path_cal_.solve_vrp(dist_matrix, drone_data.pos_targets, drone_data.num_drones, points_cp, adj, recorder, cancel_token_, solver_phases, nullptr, &flat_stats);
+    }
+
+    Solver_Stats nested_stats;
+    {
+        auto phase = stages.scope("solve_vrp_nested_reference");
+        nested_stats = solve_nested_reference(dist_matrix, static_cast<int>(drone_data.pos_targets.size()), drone_data.num_drones);
+    }
+
+    std::vector<Struct_Planner::Coordinate> full_points = coverage;
+    Struct_Planner::DroneData full_drone_data = drone_data;
+    std::vector<std::vector<Struct_Planner::Coordinate>> result;
+    Phase_Profiler path_phases;
+    bool path_ok;
+    {
+        auto phase = stages.scope("calculate_path");
+        path_ok = path_cal_.calculate_path(full_drone_data, full_points, result, recorder, cancel_token_, path_phases);
+    }
+
+    std::ostringstream json;
+    json << "\"stages\":" << stages.to_json()
+         << ",\"solve_vrp_phases\":" << solver_phases.to_json()
+         << ",\"solver_throughput\":{\"flat\":" << to_json(flat_stats) << ",\"nested_index_to_node\":" << to_json(nested_stats) << '}'
+         << ",\"calculate_path_ok\":" << (path_ok ? "true" : "false")
+         << ",\"calculate_path_phases\":" << path_phases.to_json();
+    return json.str();
+}
+
+// The arc cost callback solve_vrp used before the flat matrix: nested vectors indexed through IndexToNode
+// on every call. Same model and search parameters, so the branch throughputs compare the callbacks
+Solver_Stats Planner_Benchmark::solve_nested_reference(const DistanceMatrix &dist_matrix, int targets, int drones)
+{
+    using namespace operations_research;
+
+    std::vector<std::vector<int64_t>> nested(targets, std::vector<int64_t>(targets));
+    for (int i = 0; i < targets; ++i) {
+        for (int j = 0; j < targets; ++j) {
+            nested[i][j] = dist_matrix.at(i, j);
+        }
+    }
+
+    const std::unique_ptr<RoutingIndexManager> manager = Path_Cal::make_routing_manager(targets, drones);
+    RoutingModel routing(*manager);
+    const int transit_index = routing.RegisterTransitCallback(
+        [&manager, &nested](int64_t from, int64_t to) -> int64_t {
+            int a = manager->IndexToNode(from).value();
+            int b = manager->IndexToNode(to).value();
+            return nested[a][b];
+        }
+    );
+    routing.SetArcCostEvaluatorOfAllVehicles(transit_index);
+
+    Phase_Profiler ignored;
+    Solver_Stats stats;
+    path_cal_.solve_routing(routing, targets, drones, cancel_token_, ignored, stats);
+    return stats;
+}
+
+std::string Planner_Benchmark::run_case(Pattern pattern, size_t scale, uint64_t case_id)
+{
+    std::mt19937 rng(options_.seed + static_cast<unsigned int>(case_id));
+
+    Phase_Profiler generation;
+    std::vector<Struct_Planner::Coordinate> coverage;
+    {
+        auto phase = generation.scope("generate_coverage");
+        coverage = generate_coverage(pattern, scale, rng);
+    }
+    generation.set_size("coverage_points", static_cast<int64_t>(coverage.size()));
+
+    std::ostringstream json;
+    json << "{\"pattern\":\"" << to_string(pattern) << "\",\"scale\":" << scale
+         << ",\"generation\":" << generation.to_json();
+
+    if (coverage.empty()) {
+        json << ",\"skipped\":\"no coverage generated\"}";
+        return json.str();
+    }
+
+    if (coverage.size() + options_.targets + options_.drones > options_.max_graph_points) {
+        json << ",\"skipped\":\"graph stages are quadratic, above --max-graph-points\"}";
+        return json.str();
+    }
+
+    auto recorder = std::make_shared<Planner_Recorder>(options_.work_dir, case_id);
+    const Struct_Planner::DroneData drone_data = generate_targets(coverage, options_.drones, options_.targets, rng);
+    json << ',' << time_stages(coverage, drone_data, recorder) << '}';
+    recorder->close_all();
+    return json.str();
+}
+
+int main(int argc, char* argv[])
+{
+    Bench_Options options;
+    if (!parse_options(argc, argv, options)) {
+        std::cerr << "Usage: Planner_Benchmark [--scales 1000,10000] [--patterns blobs,corridors,islands]"
+                     " [--max-graph-points N] [--targets N] [--drones N] [--ortools-seconds N]"
+                     " [--seed N] [--output file.json] [--work-dir dir]\n";
+        return EXIT_FAILURE;
+    }
+
+    if (!Logger::initialize(options.work_dir, "planner_benchmark")) {
+        std::cerr << "Error initializing logger in " << options.work_dir << "\n";
+        return EXIT_FAILURE;
+    }
+
+    Struct_Planner::Config_struct cnf;
+    cnf.data_path = options.work_dir;
+    cnf.threshold = THRESHOLD_DBM;
+    cnf.max_neighbor = 8;
+    cnf.max_distance_for_neighbor = 100.0;
+    cnf.max_ortools_time = options.ortools_seconds;
+    cnf.max_queued_requests = 1;
+
+    Planner_Benchmark benchmark(options, cnf);
+
+    std::ostringstream json;
+    json << "{\"benchmark\":\"planner\",\"seed\":" << options.seed
+         << ",\"targets\":" << options.targets << ",\"drones\":" << options.drones
+         << ",\"ortools_seconds\":" << options.ortools_seconds
+         << ",\"max_graph_points\":" << options.max_graph_points << ",\"cases\":[";
+
+    uint64_t case_id = 0;
+    for (Pattern pattern : options.patterns) {
+        for (size_t scale : options.scales) {
+            std::cerr << "Running " << to_string(pattern) << " with " << scale << " points\n";
+            if (case_id > 0) json << ',';
+            json << benchmark.run_case(pattern, scale, ++case_id);
+        }
+    }
+    json << "]}\n";
+
+    // Written to a file because the Logger also echoes to stdout
+    std::ofstream out(options.output);
+    if (!out) {
+        std::cerr << "Unable to write " << options.output << "\n";
+        return EXIT_FAILURE;
+    }
+    out << json.str();
+    std::cerr << "Results written to " << options.output << "\n";
+
+    Logger::close();
+    return EXIT_SUCCESS;
+}
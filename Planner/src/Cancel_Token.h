@@ -0,0 +1,26 @@
+/* ============================================================
+ *  Proyect  : I-Drone                                   
+ *  Filename : Cancel_Token.h                    
+ *  Author   : Iván Gutiérrez                            
+ *  License  : GNU General Public License v3.0           
+ *
+ *  © 2025 Iván Gutiérrez.
+ * ============================================================
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+#pragma once
+#include <atomic>
+
+// Shared flag polled by the planning phases so a running calculation can stop early
+class Cancel_Token {
+
+public:
+    Cancel_Token() = default;
+    Cancel_Token(const Cancel_Token&) = delete;
+    Cancel_Token& operator=(const Cancel_Token&) = delete;
+
+    void cancel() { cancelled_.store(true, std::memory_order_relaxed); }
+    bool is_cancelled() const { return cancelled_.load(std::memory_order_relaxed); }
+
+private:
+    std::atomic<bool> cancelled_{false};
+};
@@ -16,16 +16,18 @@
 #include "common_libs/Enc_Dec_Planner.h"
 #include "common_libs/Enc_Dec_PLD.h"
 
-constexpr int NUMBER_ATTEMPS_MAX = 10;
 constexpr int RATE_STATUS_MESSAGE = 1;
+constexpr int RATE_RECONNECT_MAX = 2;
+constexpr size_t COMPRESSION_THRESHOLD_BYTES = 16 * 1024; // Routes are large and sent once: favour ratio
 
 Communication_Manager::Communication_Manager(boost::asio::io_context& io_context, 
                                              const tcp::endpoint& endpoint,
-                                             std::shared_ptr<Planner_Recorder> rec_mng): io_context_(io_context),
-                                                                                                  server_(io_context),
-                                                                                                  endpoint_(endpoint),
-                                                                                                  recorder_ptr_(std::move(rec_mng)),
-                                                                                                  status_timer(io_context_)
+                                             const Struct_Planner::Config_struct &cnf): io_context_(io_context),
+                                                                                        server_(io_context),
+                                                                                        endpoint_(endpoint),
+                                                                                        data_path_(cnf.data_path),
+                                                                                        max_queued_requests_(static_cast<size_t>(std::max(cnf.max_queued_requests, 1))),
+                                                                                        status_timer(io_context_)
 {
     Server::handlers handler_obj;
 
@@ -35,10 +37,14 @@ Communication_Manager::Communication_Manager(boost::asio::io_context& io_context
     handler_obj.call_connect = [this]() {
         on_connect();
     };
-    handler_obj.call_message = [this](const std::string& msg) {
+    handler_obj.call_message = [this](std::string_view msg) {
         on_message(msg);
     };
+    handler_obj.call_backpressure = [this](bool congested) {
+        on_backpressure(congested);
+    };
     server_.set_handlers(handler_obj);
+    server_.set_compression(Server::Compression::ZSTD, COMPRESSION_THRESHOLD_BYTES);
 
     std::stringstream ss;
     ss << "Start connecting to PLD at " << endpoint_.address().to_string() << ":" << endpoint_.port();
@@ -68,10 +74,23 @@ void Communication_Manager::shutdown()
         retry_timer_->cancel(ec);
     }
     
+    {
+        std::lock_guard<std::mutex> lock(mutex_requests_);
+        for (auto &[id, token] : pending_requests_) {
+            token->cancel();
+        }
+    }
+
     calculation_pool_.stop();
     Logger::log_message(Logger::Type::INFO, "Waiting for calculation threads to finish...");
     calculation_pool_.join();
     Logger::log_message(Logger::Type::INFO, "Calculation threads finished");
+
+    const auto stats = server_.compression_stats();
+    std::stringstream ss;
+    ss << "Frames sent to PLD: " << stats.frames_sent << " (" << stats.compressed_frames_sent << " compressed), "
+       << stats.payload_bytes_sent << " payload bytes in " << stats.wire_bytes_sent << " wire bytes";
+    Logger::log_message(Logger::Type::INFO, ss.str());
     
     server_.server_close();
 }
@@ -96,13 +115,19 @@ void Communication_Manager::send_status_message(const boost::system::error_code&
         return;
     }   
 
-    Logger::log_message(Logger::Type::INFO,"Sending status message");
-
-    std::string message;
-    if (!Enc_Dec_PLD::encode_status_planner(get_status(),message)) {
-        Logger::log_message(Logger::Type::WARNING,"Problems encoding status message");
+    // Periodic status is redundant while a large response is still draining, so skip it instead of queueing more
+    if (link_congested_) {
+        Logger::log_message(Logger::Type::INFO,"Link to PLD congested, skipping status message");
     } else {
-        deliver(message);
+        Logger::log_message(Logger::Type::INFO,"Sending status message");
+
+        auto [status, request_id] = get_status();
+        std::string message;
+        if (!Enc_Dec_PLD::encode_status_planner(status,request_id,"",message)) {
+            Logger::log_message(Logger::Type::WARNING,"Problems encoding status message");
+        } else {
+            deliver(std::move(message));
+        }
     }
     
     if (!shutting_down_) {
@@ -113,10 +138,18 @@ void Communication_Manager::send_status_message(const boost::system::error_code&
     }
 }
 
-void Communication_Manager::set_status(const Struct_Planner::Status &new_status)
+void Communication_Manager::on_backpressure(bool congested)
+{
+    link_congested_ = congested;
+    Logger::log_message(congested ? Logger::Type::WARNING : Logger::Type::INFO,
+                        congested ? "Outbound queue to PLD above high-water mark" : "Outbound queue to PLD drained");
+}
+
+void Communication_Manager::set_status(const Struct_Planner::Status &new_status, uint64_t request_id)
 {
     std::lock_guard<std::mutex> lock(mutex_status_);
     status_ = new_status;
+    active_request_id_ = request_id;
 }
 
 void Communication_Manager::on_error(const boost::system::error_code& ec, const Type_Error &type_error)
@@ -127,11 +160,6 @@ void Communication_Manager::on_error(const boost::system::error_code& ec, const
     boost::system::error_code cancel_ec;
     status_timer.cancel(cancel_ec);
     
-    if (get_status() == Struct_Planner::Status::FINISH) {
-        Logger::log_message(Logger::Type::INFO,"Program task complete, leaving program...");
-        io_context_.stop();
-        return;
-    }
     std::string log;
     switch (type_error){
         case Type_Error::CONNECTING:
@@ -154,20 +182,15 @@ void Communication_Manager::on_error(const boost::system::error_code& ec, const
         return;
     }
     
+    // The Planner is a long-running service: the PLD only listens while a mission is planning,
+    // so keep retrying with a capped backoff and let queued requests finish meanwhile
     attemps_++;
-    if (attemps_ <= NUMBER_ATTEMPS_MAX)
-    {
-        retry_timer_ = std::make_shared<boost::asio::steady_timer>(io_context_, std::chrono::seconds(1));
-        retry_timer_->async_wait([this](const boost::system::error_code& ec) {
-            if (ec || shutting_down_) return;
-            Logger::log_message(Logger::Type::INFO,"Trying to reconnect to PLD");
-            server_.connect(endpoint_);
-        });
-    } else 
-    {
-        Logger::log_message(Logger::Type::ERROR,"Number of allowed attempts exceeded. Exiting program...");
-        io_context_.stop();
-    }
+    retry_timer_ = std::make_shared<boost::asio::steady_timer>(io_context_, std::chrono::seconds(std::min(attemps_, RATE_RECONNECT_MAX)));
+    retry_timer_->async_wait([this](const boost::system::error_code& ec) {
+        if (ec || shutting_down_) return;
+        Logger::log_message(Logger::Type::INFO,"Trying to reconnect to PLD");
+        server_.connect(endpoint_);
+    });
 }
 
 void Communication_Manager::set_calculate_handler(calculate_handler handler)
@@ -175,69 +198,149 @@ void Communication_Manager::set_calculate_handler(calculate_handler handler)
     calculate_handler_ = std::move(handler);
 }
 
-void Communication_Manager::on_message(const std::string& msg)
+void Communication_Manager::on_message(std::string_view msg)
 {    
     if (shutting_down_) return;
     Logger::log_message(Logger::Type::INFO, "Message received from PLD");
 
-    if (status_ != Struct_Planner::Status::EXPECTING_DATA) {
-        Logger::log_message(Logger::Type::WARNING, "Task in progress or done, message ignore");
+    dispatch(Enc_Dec_Planner::decode_to_planner(msg),
+        [this](const PlannerMessage &config) { handle_config_message(config); },
+        [this](const CancelMessage &cancel) { handle_cancel_message(cancel); },
+        [](Decode_Error) { Logger::log_message(Logger::Type::WARNING, "Error decoding message"); },
+        [](Unknown_Message) { Logger::log_message(Logger::Type::WARNING, "Unknown message received"); });
+}
+
+void Communication_Manager::handle_config_message(const PlannerMessage &message)
+{
+    Planner_Request request;
+    request.id = message.request_id();
+    request.compact_response = message.compact_response();
+    request.stream_routes = message.stream_routes();
+
+    std::stringstream log;
+    log << "Configuration message received for request " << request.id;
+    Logger::log_message(Logger::Type::INFO, log.str());
+
+    std::vector<Struct_Planner::SignalServerConfig> signal_servers;
+    if (!Enc_Dec_Planner::decode_signal_server_list(message, signal_servers))
+    {
+        Logger::log_message(Logger::Type::WARNING, "Unabled to decode Signal-Server message");
+        send_request_status(Struct_Planner::Status::ERROR, request.id);
         return;
     }
 
-    std::string data = msg.substr(4);
+    Struct_Planner::DroneData drone_data;
+    if (!Enc_Dec_Planner::decode_drone_data(message.drone_data(), drone_data))
+    {
+        Logger::log_message(Logger::Type::WARNING, "Unabled to decode drone data message");
+        send_request_status(Struct_Planner::Status::ERROR, request.id);
+        return;
+    }
 
-    auto [type, decoded_msg] = Enc_Dec_Planner::decode_to_planner(data);
+    {
+        std::lock_guard<std::mutex> lock(mutex_requests_);
+        if (pending_requests_.count(request.id) > 0) {
+            Logger::log_message(Logger::Type::WARNING, "Request " + std::to_string(request.id) + " already queued, message ignored");
+            return;
+        }
+        if (pending_requests_.size() >= max_queued_requests_) {
+            Logger::log_message(Logger::Type::WARNING, "Job queue full, request " + std::to_string(request.id) + " rejected");
+            send_request_status(Struct_Planner::Status::ERROR, request.id);
+            return;
+        }
+        request.cancel_token = std::make_shared<Cancel_Token>();
+        pending_requests_[request.id] = request.cancel_token;
+    }
 
-    switch (type) {
-        case Enc_Dec_Planner::Planner::UNKNOWN:
-            Logger::log_message(Logger::Type::WARNING, "Unknown message received");
-            break;
-        case Enc_Dec_Planner::Planner::ERROR:
-            Logger::log_message(Logger::Type::WARNING, "Error decoding message");
-            break;
-        case Enc_Dec_Planner::Planner::ConfigMessage: {
-            auto my_msg = dynamic_cast<PlannerMessage*>(decoded_msg.get());
-            if (my_msg) {
-                Logger::log_message(Logger::Type::INFO, "Configuration message received");
-
-                std::vector<Struct_Planner::SignalServerConfig> signal_servers;
-                if (!Enc_Dec_Planner::decode_signal_server_list(*my_msg, signal_servers))
-                {
-                    Logger::log_message(Logger::Type::WARNING, "Unabled to decode Signal-Server message");
-                    return;
-                }
-
-                Struct_Planner::DroneData drone_data;
-                if (!Enc_Dec_Planner::decode_drone_data(my_msg->drone_data(), drone_data))
-                {
-                    Logger::log_message(Logger::Type::WARNING, "Unabled to decode drone data message");
-                    return;
-                }
-                recorder_ptr_->write_message_received(signal_servers,drone_data);
-                
-                boost::asio::post(calculation_pool_, [this, signal_servers, drone_data]() {
-                    if (!shutting_down_) {
-                        calculate_handler_(signal_servers, drone_data);
-                    }
-                });
-            }
-            break;
+    request.recorder = std::make_shared<Planner_Recorder>(data_path_, request.id);
+    request.profiler = std::make_shared<Phase_Profiler>();
+    request.recorder->write_message_received(signal_servers,drone_data);
+
+    boost::asio::post(calculation_pool_, [this, request, signal_servers = std::move(signal_servers), drone_data = std::move(drone_data)]() {
+        run_request(request, signal_servers, drone_data);
+    });
+}
+
+void Communication_Manager::run_request(const Planner_Request &request,
+                                        const std::vector<Struct_Planner::SignalServerConfig> &signal_servers,
+                                        const Struct_Planner::DroneData &drone_data)
+{
+    if (shutting_down_) {
+        return;
+    }
+
+    Struct_Planner::Status outcome = Struct_Planner::Status::CANCELLED;
+    std::string response;
+    if (!request.cancel_token->is_cancelled()) {
+        Logger::log_message(Logger::Type::INFO, "Starting calculation of request " + std::to_string(request.id));
+        set_status(Struct_Planner::Status::CALCULATING, request.id);
+        outcome = calculate_handler_(request, signal_servers, drone_data, response);
+    }
+    finish_request(request, outcome, std::move(response));
+}
+
+void Communication_Manager::finish_request(const Planner_Request &request, const Struct_Planner::Status &outcome, std::string response)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_requests_);
+        pending_requests_.erase(request.id);
+    }
+
+    const std::string profile = request.profiler->to_json();
+    request.recorder->write_profile(profile);
+    request.recorder->close_all();
+
+    Logger::log_message(Logger::Type::INFO, "Request " + std::to_string(request.id) + " finished with status " + to_string(outcome));
+    Logger::log_message(Logger::Type::INFO, "Request " + std::to_string(request.id) + " profile: " + profile);
+
+    // The tagged outcome carries the profile and, for FINISH, announces the response that follows it
+    send_request_status(outcome, request.id, profile);
+    if (outcome == Struct_Planner::Status::FINISH) {
+        deliver(std::move(response));
+    }
+    set_status(Struct_Planner::Status::EXPECTING_DATA, 0);
+}
+
+void Communication_Manager::handle_cancel_message(const CancelMessage &message)
+{
+    // Request id 0 cancels everything queued or running
+    const uint64_t request_id = message.request_id();
+    std::lock_guard<std::mutex> lock(mutex_requests_);
+    if (request_id == 0) {
+        Logger::log_message(Logger::Type::WARNING, "Cancel message received, stopping all requests");
+        for (auto &[id, token] : pending_requests_) {
+            token->cancel();
         }
-        default:
-            Logger::log_message(Logger::Type::WARNING, "Unhandled message type");
-            break;
+        return;
+    }
+
+    auto it = pending_requests_.find(request_id);
+    if (it == pending_requests_.end()) {
+        Logger::log_message(Logger::Type::INFO, "Cancel message received for unknown request " + std::to_string(request_id) + ", ignoring");
+        return;
+    }
+
+    Logger::log_message(Logger::Type::WARNING, "Cancel message received, stopping request " + std::to_string(request_id));
+    it->second->cancel();
+}
+
+void Communication_Manager::send_request_status(const Struct_Planner::Status &status, uint64_t request_id, const std::string &profile)
+{
+    std::string message;
+    if (!Enc_Dec_PLD::encode_status_planner(status, request_id, profile, message)) {
+        Logger::log_message(Logger::Type::WARNING,"Problems encoding request status message");
+        return;
     }
+    deliver(std::move(message));
 }
 
-void Communication_Manager::deliver(const std::string &msg)
+void Communication_Manager::deliver(std::string msg)
 {
-    std::lock_guard<std::mutex> lock(mutex_deliver_);
-    server_.deliver(msg);
+    server_.deliver(std::move(msg));
 }
 
-Struct_Planner::Status Communication_Manager::get_status()
+std::pair<Struct_Planner::Status, uint64_t> Communication_Manager::get_status()
 {
     std::lock_guard<std::mutex> lock(mutex_status_);
-    return status_;
+    return {status_, active_request_id_};
 }
@@ -10,13 +10,16 @@
 #pragma once
 #include <boost/asio.hpp>
 #include <functional>
-#include "Planner_Recorder.h"
+#include <map>
+#include "generated_proto/messages_planner.pb.h"
+#include "Planner_Request.h"
 #include "common_libs/Server.h"
 #include "structs/Structs_Planner.h"
 
 using boost::asio::ip::tcp;
 
-using calculate_handler = std::function<void(const std::vector<Struct_Planner::SignalServerConfig>&, Struct_Planner::DroneData)>;;
+// Runs one plan request and returns its outcome: FINISH with the encoded response filled in, ERROR or CANCELLED otherwise
+using calculate_handler = std::function<Struct_Planner::Status(const Planner_Request&, const std::vector<Struct_Planner::SignalServerConfig>&, Struct_Planner::DroneData, std::string&)>;
 
 class Communication_Manager {
 
@@ -25,28 +28,40 @@ private:
     boost::asio::thread_pool calculation_pool_{1};
     Server server_;
     tcp::endpoint endpoint_;
-    std::shared_ptr<Planner_Recorder> recorder_ptr_;
+    std::filesystem::path data_path_;
+    size_t max_queued_requests_;
     boost::asio::steady_timer status_timer;
     std::shared_ptr<boost::asio::steady_timer> retry_timer_;
     int attemps_ = 0;
     Struct_Planner::Status status_ = Struct_Planner::Status::EXPECTING_DATA;
+    uint64_t active_request_id_ = 0;
     calculate_handler calculate_handler_;
+    std::map<uint64_t, std::shared_ptr<Cancel_Token>> pending_requests_; // Queued or running, keyed by request id
     std::mutex mutex_status_;
-    std::mutex mutex_deliver_;
+    std::mutex mutex_requests_;
     std::atomic<bool> shutting_down_{false};
+    std::atomic<bool> link_congested_{false};
 
     void on_connect();
     void on_error(const boost::system::error_code& ec, const Type_Error &type_error);
-    void on_message(const std::string& msg);
+    void on_message(std::string_view msg);
+    void on_backpressure(bool congested);
+    void handle_config_message(const PlannerMessage &message);
+    void handle_cancel_message(const CancelMessage &message);
+    void run_request(const Planner_Request &request,
+                     const std::vector<Struct_Planner::SignalServerConfig> &signal_servers,
+                     const Struct_Planner::DroneData &drone_data);
+    void finish_request(const Planner_Request &request, const Struct_Planner::Status &outcome, std::string response);
+    void send_request_status(const Struct_Planner::Status &status, uint64_t request_id, const std::string &profile = "");
     void send_status_message(const boost::system::error_code& ec);
-    Struct_Planner::Status get_status();
+    void set_status(const Struct_Planner::Status &new_status, uint64_t request_id);
+    std::pair<Struct_Planner::Status, uint64_t> get_status();
 
 public:
-    Communication_Manager(boost::asio::io_context& io_context, const tcp::endpoint& endpoint, std::shared_ptr<Planner_Recorder> rec_mng);
+    Communication_Manager(boost::asio::io_context& io_context, const tcp::endpoint& endpoint, const Struct_Planner::Config_struct &cnf);
     ~Communication_Manager();
-    void set_status(const Struct_Planner::Status &new_status);
     void set_calculate_handler(calculate_handler handler);
-    void deliver(const std::string &msg);
+    void deliver(std::string msg);
     void shutdown();
 
 };
\ No newline at end of file
@@ -25,6 +25,7 @@ inline Struct_Planner::Config_struct get_config() {
     cnf.max_neighbor = 8;
     cnf.max_distance_for_neighbor = 100.0;
     cnf.max_ortools_time = 600;
+    cnf.max_queued_requests = 4;
 
     return cnf;
 }
@@ -22,6 +22,14 @@
 
 using namespace operations_research;
 
+namespace {
+// Queue pops between cancellation polls inside the Dijkstra loops
+constexpr uint32_t CANCEL_POLL_MASK = 0x3FF;
+// Arc cost (mm) between targets with no path in the graph: far above any real route, yet small
+// enough that OR-Tools can add one per target without overflowing int64
+constexpr int64_t UNREACHABLE_COST_MM = 1'000'000'000'000;
+}
+
 Path_Cal::Path_Cal(const Struct_Planner::Config_struct &cnf): global_cnf_(cnf)
 {
 }
@@ -42,12 +50,14 @@ double Path_Cal::haversine_m(const Struct_Planner::Coordinate& a, const Struct_P
 void Path_Cal::build_knn_graph(const std::vector<Struct_Planner::Coordinate>& points,
                                int k_neighbors,
                                double max_neighbor_dist_m,
-                               std::vector<std::vector<std::pair<int,double>>>& adj) const
+                               std::vector<std::vector<std::pair<int,double>>>& adj,
+                               const Cancel_Token &cancel_token) const
 {
     auto n = static_cast<int>(points.size());
     adj.assign(n, {});
 
     for (int i = 0; i < n; i++) {
+        if (cancel_token.is_cancelled()) return;
 
         std::vector<std::pair<double,int>> dists;
         dists.reserve(n-1);
@@ -86,7 +96,7 @@ void Path_Cal::build_knn_graph(const std::vector<Struct_Planner::Coordinate>& po
     }
 }
 
-std::vector<double> Path_Cal::dijkstra(int src, const std::vector<std::vector<std::pair<int,double>>>& adj) const
+std::vector<double> Path_Cal::dijkstra(int src, const std::vector<std::vector<std::pair<int,double>>>& adj, const Cancel_Token &cancel_token) const
 {
     auto n = static_cast<int>(adj.size());
     const double INF = std::numeric_limits<double>::infinity();
@@ -97,8 +107,10 @@ std::vector<double> Path_Cal::dijkstra(int src, const std::vector<std::vector<st
 
     dist[src] = 0.0;
     pq.push({0.0, src});
+    uint32_t pops = 0;
 
     while (!pq.empty()) {
+        if ((++pops & CANCEL_POLL_MASK) == 0 && cancel_token.is_cancelled()) break;
         auto [d, u] = pq.top();
         pq.pop();
         if (d > dist[u]) continue;
@@ -115,7 +127,7 @@ std::vector<double> Path_Cal::dijkstra(int src, const std::vector<std::vector<st
     return dist;
 }
 
-std::vector<int> Path_Cal::dijkstra_path(int src, int tgt, const std::vector<std::vector<std::pair<int,double>>>& adj) const
+std::vector<int> Path_Cal::dijkstra_path(int src, int tgt, const std::vector<std::vector<std::pair<int,double>>>& adj, const Cancel_Token &cancel_token) const
 {
     auto n = static_cast<int>(adj.size());
     const double INF = std::numeric_limits<double>::infinity();
@@ -127,8 +139,10 @@ std::vector<int> Path_Cal::dijkstra_path(int src, int tgt, const std::vector<std
 
     dist[src] = 0.0;
     pq.push({0.0, src});
+    uint32_t pops = 0;
 
     while (!pq.empty()) {
+        if ((++pops & CANCEL_POLL_MASK) == 0 && cancel_token.is_cancelled()) return {};
         auto [d, u] = pq.top(); pq.pop();
         if (d > dist[u]) continue;
         if (u == tgt) break;
@@ -153,10 +167,11 @@ std::vector<int> Path_Cal::dijkstra_path(int src, int tgt, const std::vector<std
 void Path_Cal::compute_target_distance_matrix(const std::vector<Struct_Planner::Coordinate>& all_points,
                                               const std::vector<std::vector<std::pair<int,double>>>& adj,
                                               const std::vector<Struct_Planner::Coordinate>& pos_targets,
-                                              std::vector<std::vector<int64_t>>& dist_matrix) const
+                                              DistanceMatrix& dist_matrix,
+                                              const Cancel_Token &cancel_token) const
 {
     auto T = static_cast<int>(pos_targets.size());
-    dist_matrix.assign(T, std::vector<int64_t>(T, 0));
+    dist_matrix.assign(T);
 
     std::vector<int> closest_point(T);
 
@@ -175,12 +190,17 @@ void Path_Cal::compute_target_distance_matrix(const std::vector<Struct_Planner::
     }
 
     for (int i = 0; i < T; i++) {
+        if (cancel_token.is_cancelled()) return;
         int src_node = closest_point[i];
-        auto dist = dijkstra(src_node, adj);
+        auto dist = dijkstra(src_node, adj, cancel_token);
+        // A cancelled search leaves nodes at infinity, the matrix is discarded anyway
+        if (cancel_token.is_cancelled()) return;
 
+        int64_t* row = dist_matrix.row(i);
         for (int j = 0; j < T; j++) {
             int tgt_node = closest_point[j];
-            dist_matrix[i][j] = static_cast<int64_t>(dist[tgt_node] * 1000.0);//(int64_t)dist[tgt_node];
+            const double dist_mm = dist[tgt_node] * 1000.0;
+            row[j] = dist_mm < static_cast<double>(UNREACHABLE_COST_MM) ? static_cast<int64_t>(dist_mm) : UNREACHABLE_COST_MM;
         }
     }
 }
@@ -200,6 +220,36 @@ std::vector<int> extract_target_indices_for_vehicle(const RoutingModel& routing,
     return path_target_indices;
 }
 
+std::vector<int> map_indices_to_nodes(const RoutingIndexManager& manager)
+{
+    std::vector<int> node_of(manager.num_indices());
+    for (int idx = 0; idx < manager.num_indices(); ++idx) {
+        node_of[idx] = manager.IndexToNode(idx).value();
+    }
+    return node_of;
+}
+
+Solver_Stats collect_solver_statistics(const Solver& solver)
+{
+    Solver_Stats stats;
+    stats.branches = solver.branches();
+    stats.failures = solver.failures();
+    stats.solutions = solver.solutions();
+    stats.wall_ms = solver.wall_time();
+    return stats;
+}
+
+void log_solver_statistics(const Solver_Stats& stats)
+{
+    std::stringstream log;
+    log << "OR-Tools search: " << stats.branches << " branches, " << stats.failures
+        << " failures, " << stats.solutions << " solutions in " << stats.wall_ms << " ms, objective " << stats.objective;
+    if (stats.wall_ms > 0) {
+        log << " (" << static_cast<int64_t>(stats.branches_per_s()) << " branches/s)";
+    }
+    Logger::log_message(Logger::Type::INFO, log.str());
+}
+
 void append_vehicle_solution_log(std::stringstream& log,
                                  int drone_idx,
                                  const std::vector<int>& path_target_indices,
@@ -241,7 +291,8 @@ std::vector<Struct_Planner::Coordinate> Path_Cal::build_full_path_from_target_in
     const std::vector<int>& path_target_indices,
     const std::vector<int>& closest_point,
     const std::vector<Struct_Planner::Coordinate>& points_cp,
-    const std::vector<std::vector<std::pair<int,double>>>& adj) const
+    const std::vector<std::vector<std::pair<int,double>>>& adj,
+    const Cancel_Token &cancel_token) const
 {
     std::vector<Struct_Planner::Coordinate> path_full;
     if (path_target_indices.empty()) {
@@ -253,7 +304,7 @@ std::vector<Struct_Planner::Coordinate> Path_Cal::build_full_path_from_target_in
         const int src_node = closest_point[path_target_indices[i]];
         const int dst_node = closest_point[path_target_indices[i + 1]];
 
-        const std::vector<int> inter_nodes = dijkstra_path(src_node, dst_node, adj);
+        const std::vector<int> inter_nodes = dijkstra_path(src_node, dst_node, adj, cancel_token);
         for (int n : inter_nodes) {
             if (n != last_node_idx) {
                 path_full.push_back(points_cp[n]);
@@ -272,39 +323,27 @@ std::vector<Struct_Planner::Coordinate> Path_Cal::build_full_path_from_target_in
     return path_full;
 }
 
-std::vector<std::vector<Struct_Planner::Coordinate>> Path_Cal::solve_vrp(const std::vector<std::vector<int64_t>>& dist_matrix,
-                                                                      const std::vector<Struct_Planner::Coordinate>& pos_targets,
-                                                                      int num_drones,
-                                                                      const std::vector<Struct_Planner::Coordinate> &points_cp,
-                                                                      const std::vector<std::vector<std::pair<int,double>>>& adj,
-                                                                      const std::shared_ptr<Planner_Recorder> &rec_mng) const
+std::unique_ptr<RoutingIndexManager> Path_Cal::make_routing_manager(int targets, int num_drones)
 {
-    std::vector<std::vector<Struct_Planner::Coordinate>> result;
-
-    auto T = static_cast<int>(pos_targets.size());
-    if (T == 0 || num_drones <= 0) return result;
-
     std::vector<RoutingIndexManager::NodeIndex> starts;
     std::vector<RoutingIndexManager::NodeIndex> ends;
     for (int d = 0; d < num_drones; d++) {
-        int start_idx = d % T;
+        int start_idx = d % targets;
         starts.push_back(RoutingIndexManager::NodeIndex(start_idx));
         ends.push_back(RoutingIndexManager::NodeIndex(start_idx));
     }
 
-    RoutingIndexManager manager(T, num_drones, starts, ends);
-    RoutingModel routing(manager);
-
-    const int transitIndex = routing.RegisterTransitCallback(
-        [&manager, &dist_matrix](int64_t from, int64_t to) -> int64_t {
-            int a = manager.IndexToNode(from).value();
-            int b = manager.IndexToNode(to).value();
-            return dist_matrix[a][b];
-        }
-    );
-    routing.SetArcCostEvaluatorOfAllVehicles(transitIndex);
+    return std::make_unique<RoutingIndexManager>(targets, num_drones, starts, ends);
+}
 
-    int64_t max_load = static_cast<int64_t>(std::ceil(double(T) / num_drones)) + num_drones;
+const Assignment* Path_Cal::solve_routing(RoutingModel &routing,
+                                          int targets,
+                                          int num_drones,
+                                          const Cancel_Token &cancel_token,
+                                          Phase_Profiler &profiler,
+                                          Solver_Stats &stats) const
+{
+    int64_t max_load = static_cast<int64_t>(std::ceil(double(targets) / num_drones)) + num_drones;
     routing.AddDimension(
         routing.RegisterTransitCallback([](int64_t, int64_t){ return 1; }),
         0,
@@ -322,7 +361,72 @@ std::vector<std::vector<Struct_Planner::Coordinate>> Path_Cal::solve_vrp(const s
     params.set_local_search_metaheuristic(LocalSearchMetaheuristic::GUIDED_LOCAL_SEARCH);
     params.mutable_time_limit()->set_seconds(global_cnf_.max_ortools_time);
 
-    const Assignment* solution = routing.SolveWithParameters(params);
+    // Let a CANCEL from the PLD stop the local search instead of waiting for the time limit
+    routing.AddSearchMonitor(routing.solver()->MakeCustomLimit(
+        [&cancel_token]() { return cancel_token.is_cancelled(); }));
+
+    const Assignment* solution;
+    {
+        auto phase = profiler.scope("ortools");
+        solution = routing.SolveWithParameters(params);
+    }
+    stats = collect_solver_statistics(*routing.solver());
+    if (solution) {
+        stats.objective = solution->ObjectiveValue();
+    }
+    log_solver_statistics(stats);
+
+    profiler.set_size("ortools_branches", stats.branches);
+    profiler.set_size("ortools_solutions", stats.solutions);
+    profiler.set_size("ortools_objective", stats.objective);
+    return solution;
+}
+
+std::vector<std::vector<Struct_Planner::Coordinate>> Path_Cal::solve_vrp(const DistanceMatrix& dist_matrix,
+                                                                      const std::vector<Struct_Planner::Coordinate>& pos_targets,
+                                                                      int num_drones,
+                                                                      const std::vector<Struct_Planner::Coordinate> &points_cp,
+                                                                      const std::vector<std::vector<std::pair<int,double>>>& adj,
+                                                                      const std::shared_ptr<Planner_Recorder> &rec_mng,
+                                                                      const Cancel_Token &cancel_token,
+                                                                      Phase_Profiler &profiler,
+                                                                      const route_handler &on_route,
+                                                                      Solver_Stats *stats) const
+{
+    std::vector<std::vector<Struct_Planner::Coordinate>> result;
+
+    auto T = static_cast<int>(pos_targets.size());
+    if (T == 0 || num_drones <= 0) return result;
+
+    const std::unique_ptr<RoutingIndexManager> manager_ptr = make_routing_manager(T, num_drones);
+    const RoutingIndexManager &manager = *manager_ptr;
+    RoutingModel routing(manager);
+
+    // Resolve every routing index to its row offset once, so the callback OR-Tools
+    // hits during local search is two loads and an add into the flat matrix.
+    const std::vector<int> node_of = map_indices_to_nodes(manager);
+    std::vector<int64_t> row_offset(node_of.size());
+    for (size_t idx = 0; idx < node_of.size(); ++idx) {
+        row_offset[idx] = static_cast<int64_t>(node_of[idx]) * dist_matrix.size;
+    }
+    const int64_t* values = dist_matrix.values.data();
+
+    const int transitIndex = routing.RegisterTransitCallback(
+        [&row_offset, &node_of, values](int64_t from, int64_t to) -> int64_t {
+            return values[row_offset[from] + node_of[to]];
+        }
+    );
+    routing.SetArcCostEvaluatorOfAllVehicles(transitIndex);
+
+    Solver_Stats search_stats;
+    const Assignment* solution = solve_routing(routing, T, num_drones, cancel_token, profiler, search_stats);
+    if (stats) {
+        *stats = search_stats;
+    }
+    if (cancel_token.is_cancelled()) {
+        Logger::log_message(Logger::Type::WARNING, "VRP search cancelled");
+        return result;
+    }
     if (!solution) {
         Logger::log_message(Logger::Type::ERROR, "No solution VRP found");
         return result;
@@ -330,17 +434,22 @@ std::vector<std::vector<Struct_Planner::Coordinate>> Path_Cal::solve_vrp(const s
 
     Logger::log_message(Logger::Type::INFO, "Writting Or Tools result");
 
+    auto phase = profiler.scope("path_expansion");
     std::stringstream log;
     const std::vector<int> closest_point = map_targets_to_closest_points(pos_targets, points_cp);
 
     result.resize(num_drones);
 
     for (int d = 0; d < num_drones; d++) {
+        if (cancel_token.is_cancelled()) return {};
         const std::vector<int> path_target_indices = extract_target_indices_for_vehicle(
             routing, manager, *solution, d);
         append_vehicle_solution_log(log, d, path_target_indices, pos_targets);
         result[d] = build_full_path_from_target_indices(
-            path_target_indices, closest_point, points_cp, adj);
+            path_target_indices, closest_point, points_cp, adj, cancel_token);
+        if (on_route && !cancel_token.is_cancelled()) {
+            on_route(d, result[d]);
+        }
     }
 
     rec_mng->write_or_output(log.str());
@@ -395,11 +504,19 @@ bool Path_Cal::check_targets_signal(Struct_Planner::DroneData &drone_data, const
     return drone_data.pos_targets.size() > static_cast<size_t>(drone_data.num_drones);
 }
 
-bool Path_Cal::calculate_path(Struct_Planner::DroneData &drone_data, std::vector<Struct_Planner::Coordinate> &points_cp, std::vector<std::vector<Struct_Planner::Coordinate>> &result, const std::shared_ptr<Planner_Recorder> &rec_mng) const
+bool Path_Cal::calculate_path(Struct_Planner::DroneData &drone_data, std::vector<Struct_Planner::Coordinate> &points_cp, std::vector<std::vector<Struct_Planner::Coordinate>> &result, const std::shared_ptr<Planner_Recorder> &rec_mng, const Cancel_Token &cancel_token, Phase_Profiler &profiler, const route_handler &on_route) const
 {
     int num_drones = drone_data.num_drones;
 
-    if (!check_targets_signal(drone_data, points_cp)) {
+    bool targets_ok;
+    {
+        auto phase = profiler.scope("target_filter");
+        targets_ok = check_targets_signal(drone_data, points_cp);
+    }
+    profiler.set_size("drones", num_drones);
+    profiler.set_size("targets", static_cast<int64_t>(drone_data.pos_targets.size()));
+
+    if (!targets_ok) {
         Logger::log_message(Logger::Type::ERROR, "No targets with signal above threshold");
         return false;
     }
@@ -409,15 +526,29 @@ bool Path_Cal::calculate_path(Struct_Planner::DroneData &drone_data, std::vector
     }
 
     std::vector<std::vector<std::pair<int,double>>> adj;
-    build_knn_graph(points_cp, 
-                    global_cnf_.max_neighbor,
-                    global_cnf_.max_distance_for_neighbor,
-                    adj);
+    {
+        auto phase = profiler.scope("knn_graph");
+        build_knn_graph(points_cp, 
+                        global_cnf_.max_neighbor,
+                        global_cnf_.max_distance_for_neighbor,
+                        adj,
+                        cancel_token);
+    }
+    if (cancel_token.is_cancelled()) return false;
+
+    size_t directed_edges = 0;
+    for (const auto &neighbors : adj) directed_edges += neighbors.size();
+    profiler.set_size("graph_nodes", static_cast<int64_t>(points_cp.size()));
+    profiler.set_size("graph_edges", static_cast<int64_t>(directed_edges / 2));
 
-    std::vector<std::vector<int64_t>> dist_matrix;
-    compute_target_distance_matrix(points_cp, adj, drone_data.pos_targets, dist_matrix);
+    DistanceMatrix dist_matrix;
+    {
+        auto phase = profiler.scope("distance_matrix");
+        compute_target_distance_matrix(points_cp, adj, drone_data.pos_targets, dist_matrix, cancel_token);
+    }
+    if (cancel_token.is_cancelled()) return false;
     
-    result = solve_vrp(dist_matrix, drone_data.pos_targets, num_drones, points_cp, adj, rec_mng);
+    result = solve_vrp(dist_matrix, drone_data.pos_targets, num_drones, points_cp, adj, rec_mng, cancel_token, profiler, on_route);
 
     return !result.empty();
 }
\ No newline at end of file
@@ -10,18 +10,55 @@
 #pragma once
 #include "structs/Structs_Planner.h"
 #include "Planner_Recorder.h"
+#include "Cancel_Token.h"
+#include "Phase_Profiler.h"
 #include <iostream>
 #include <memory>
+#include <functional>
 #include <map>
 
+// Target-to-target distances (mm) stored row-major in a single contiguous buffer
+struct DistanceMatrix {
+    int size = 0;
+    std::vector<int64_t> values;
+
+    void assign(int n) { size = n; values.assign(static_cast<size_t>(n) * n, 0); }
+    int64_t* row(int i) { return values.data() + static_cast<size_t>(i) * size; }
+    int64_t at(int i, int j) const { return values[static_cast<size_t>(i) * size + j]; }
+};
+
+// Search counters of one OR-Tools solve; the search runs to its time limit, so throughput is the figure to compare
+struct Solver_Stats {
+    int64_t branches = 0;
+    int64_t failures = 0;
+    int64_t solutions = 0;
+    int64_t wall_ms = 0;
+    int64_t objective = -1; // Cost of the best solution, -1 without one
+
+    double branches_per_s() const { return wall_ms > 0 ? static_cast<double>(branches) * 1000.0 / wall_ms : 0.0; }
+};
+
+namespace operations_research {
+class Assignment;
+class RoutingIndexManager;
+class RoutingModel;
+}
+
+// Called with each drone's full route as soon as it is expanded, before the next drone's
+using route_handler = std::function<void(int drone, const std::vector<Struct_Planner::Coordinate> &route)>;
+
 class Path_Cal {
+    friend class Planner_Benchmark;
 
 public:
     explicit Path_Cal(const Struct_Planner::Config_struct &cnf);
     bool calculate_path(Struct_Planner::DroneData &drone_data, 
                         std::vector<Struct_Planner::Coordinate> &points, 
                         std::vector<std::vector<Struct_Planner::Coordinate>> &result,
-                        const std::shared_ptr<Planner_Recorder> &rec_mng) const;
+                        const std::shared_ptr<Planner_Recorder> &rec_mng,
+                        const Cancel_Token &cancel_token,
+                        Phase_Profiler &profiler,
+                        const route_handler &on_route = nullptr) const;
 
 private:
     Struct_Planner::Config_struct global_cnf_;
@@ -32,19 +69,34 @@ private:
     void build_knn_graph(const std::vector<Struct_Planner::Coordinate>& points,
                                int k_neighbors,
                                double max_neighbor_dist_m,
-                               std::vector<std::vector<std::pair<int,double>>>& adj) const;
-    std::vector<double> dijkstra(int src, const std::vector<std::vector<std::pair<int,double>>>& adj) const;
-    std::vector<int> dijkstra_path(int src, int tgt, const std::vector<std::vector<std::pair<int,double>>>& adj) const;
+                               std::vector<std::vector<std::pair<int,double>>>& adj,
+                               const Cancel_Token &cancel_token) const;
+    std::vector<double> dijkstra(int src, const std::vector<std::vector<std::pair<int,double>>>& adj, const Cancel_Token &cancel_token) const;
+    std::vector<int> dijkstra_path(int src, int tgt, const std::vector<std::vector<std::pair<int,double>>>& adj, const Cancel_Token &cancel_token) const;
     void compute_target_distance_matrix(const std::vector<Struct_Planner::Coordinate>& all_points,
                                         const std::vector<std::vector<std::pair<int,double>>>& adj,
                                         const std::vector<Struct_Planner::Coordinate>& pos_targets,
-                                        std::vector<std::vector<int64_t>>& dist_matrix) const;
-    std::vector<std::vector<Struct_Planner::Coordinate>> solve_vrp(const std::vector<std::vector<int64_t>>& dist_matrix,
+                                        DistanceMatrix& dist_matrix,
+                                        const Cancel_Token &cancel_token) const;
+    std::vector<std::vector<Struct_Planner::Coordinate>> solve_vrp(const DistanceMatrix& dist_matrix,
                                                                 const std::vector<Struct_Planner::Coordinate>& pos_targets,
                                                                 int num_drones,
                                                                 const std::vector<Struct_Planner::Coordinate> &points_cp,
                                                                 const std::vector<std::vector<std::pair<int,double>>>& adj,
-                                                                const std::shared_ptr<Planner_Recorder> &rec_mng) const;
+                                                                const std::shared_ptr<Planner_Recorder> &rec_mng,
+                                                                const Cancel_Token &cancel_token,
+                                                                Phase_Profiler &profiler,
+                                                                const route_handler &on_route = nullptr,
+                                                                Solver_Stats *stats = nullptr) const;
+    // Start and end of each drone on the targets, shared with the benchmark's reference cost callback
+    static std::unique_ptr<operations_research::RoutingIndexManager> make_routing_manager(int targets, int num_drones);
+    // Adds the load balancing and search parameters to a model whose arc costs are set, then solves it
+    const operations_research::Assignment* solve_routing(operations_research::RoutingModel &routing,
+                                                         int targets,
+                                                         int num_drones,
+                                                         const Cancel_Token &cancel_token,
+                                                         Phase_Profiler &profiler,
+                                                         Solver_Stats &stats) const;
     std::vector<int> map_targets_to_closest_points(
         const std::vector<Struct_Planner::Coordinate>& pos_targets,
         const std::vector<Struct_Planner::Coordinate>& points_cp) const;
@@ -52,5 +104,6 @@ private:
         const std::vector<int>& path_target_indices,
         const std::vector<int>& closest_point,
         const std::vector<Struct_Planner::Coordinate>& points_cp,
-        const std::vector<std::vector<std::pair<int,double>>>& adj) const;
+        const std::vector<std::vector<std::pair<int,double>>>& adj,
+        const Cancel_Token &cancel_token) const;
 };
\ No newline at end of file
@@ -0,0 +1,159 @@
+/* ============================================================
+ *  Proyect  : I-Drone                                   
+ *  Filename : Phase_Profiler.cpp                    
+ *  Author   : Iván Gutiérrez                            
+ *  License  : GNU General Public License v3.0           
+ *
+ *  © 2025 Iván Gutiérrez.
+ * ============================================================
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+#include "Phase_Profiler.h"
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <sys/resource.h>
+
+namespace {
+double timeval_ms(const timeval &tv)
+{
+    return static_cast<double>(tv.tv_sec) * 1000.0 + static_cast<double>(tv.tv_usec) / 1000.0;
+}
+
+// User plus system time of the calling thread, the Planner's io and status thread is left out
+double thread_cpu_ms()
+{
+    rusage usage {};
+    getrusage(RUSAGE_THREAD, &usage);
+    return timeval_ms(usage.ru_utime) + timeval_ms(usage.ru_stime);
+}
+
+// A field of /proc/self/status in kB, 0 when unavailable
+long status_kb(const std::string &field)
+{
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.compare(0, field.size(), field) == 0 && line.size() > field.size() && line[field.size()] == ':') {
+            return std::strtol(line.c_str() + field.size() + 1, nullptr, 10);
+        }
+    }
+    return 0;
+}
+
+// Brings VmHWM down to the current RSS, false where the kernel does not allow it
+bool reset_peak_rss()
+{
+    std::ofstream clear_refs("/proc/self/clear_refs");
+    clear_refs << "5";
+    clear_refs.flush();
+    return clear_refs.good();
+}
+}
+
+Phase_Profiler::Scoped_Phase::Scoped_Phase(Phase_Profiler &profiler, std::string name): profiler_(profiler),
+                                                                                       name_(std::move(name)),
+                                                                                       wall_start_(std::chrono::steady_clock::now()),
+                                                                                       cpu_start_ms_(thread_cpu_ms())
+{
+    profiler_.open(*this);
+}
+
+Phase_Profiler::Scoped_Phase::~Scoped_Phase()
+{
+    const std::chrono::duration<double, std::milli> wall = std::chrono::steady_clock::now() - wall_start_;
+    profiler_.close(*this, wall.count(), thread_cpu_ms() - cpu_start_ms_);
+}
+
+Phase_Profiler::Phase_Profiler(): created_(std::chrono::steady_clock::now())
+{
+}
+
+Phase_Profiler::Scoped_Phase Phase_Profiler::scope(const std::string &name)
+{
+    return Scoped_Phase(*this, name);
+}
+
+void Phase_Profiler::set_size(const std::string &key, int64_t value)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    sizes_[key] = value;
+}
+
+void Phase_Profiler::add_child_usage(double cpu_ms, long peak_rss_kb)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (Scoped_Phase* phase : open_) {
+        phase->child_cpu_ms_ += cpu_ms;
+        phase->child_peak_rss_kb_ = std::max(phase->child_peak_rss_kb_, peak_rss_kb);
+    }
+}
+
+void Phase_Profiler::checkpoint_rss()
+{
+    // The peak since the last boundary belongs to every stage open during that span
+    long peak = status_kb("VmHWM");
+    if (!reset_peak_rss()) {
+        // Without a reset VmHWM is the lifetime peak, the current RSS is the best per-stage figure left
+        peak = status_kb("VmRSS");
+    }
+    for (Scoped_Phase* phase : open_) {
+        phase->peak_rss_kb_ = std::max(phase->peak_rss_kb_, peak);
+    }
+}
+
+void Phase_Profiler::open(Scoped_Phase &phase)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    checkpoint_rss();
+    open_.push_back(&phase);
+    phase.peak_rss_kb_ = status_kb("VmRSS");
+}
+
+void Phase_Profiler::close(Scoped_Phase &phase, double wall_ms, double cpu_ms)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    checkpoint_rss();
+    open_.erase(std::remove(open_.begin(), open_.end(), &phase), open_.end());
+
+    auto it = std::find_if(phases_.begin(), phases_.end(), [&phase](const Phase &p) { return p.name == phase.name_; });
+    if (it == phases_.end()) {
+        phases_.push_back(Phase{phase.name_});
+        it = std::prev(phases_.end());
+    }
+    it->calls++;
+    it->wall_ms += wall_ms;
+    it->cpu_ms += cpu_ms + phase.child_cpu_ms_;
+    it->peak_rss_kb = std::max(it->peak_rss_kb, phase.peak_rss_kb_);
+    it->child_peak_rss_kb = std::max(it->child_peak_rss_kb, phase.child_peak_rss_kb_);
+}
+
+std::string Phase_Profiler::to_json() const
+{
+    const std::chrono::duration<double, std::milli> total = std::chrono::steady_clock::now() - created_;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::ostringstream json;
+    json << std::fixed << std::setprecision(3);
+    json << "{\"total_wall_ms\":" << total.count() << ",\"phases\":[";
+    for (size_t i = 0; i < phases_.size(); ++i) {
+        const Phase &p = phases_[i];
+        if (i > 0) json << ',';
+        json << "{\"name\":\"" << p.name << "\""
+             << ",\"calls\":" << p.calls
+             << ",\"wall_ms\":" << p.wall_ms
+             << ",\"cpu_ms\":" << p.cpu_ms
+             << ",\"peak_rss_kb\":" << p.peak_rss_kb
+             << ",\"child_peak_rss_kb\":" << p.child_peak_rss_kb << '}';
+    }
+    json << "],\"sizes\":{";
+    bool first = true;
+    for (const auto &[key, value] : sizes_) {
+        if (!first) json << ',';
+        first = false;
+        json << '"' << key << "\":" << value;
+    }
+    json << "}}";
+    return json.str();
+}
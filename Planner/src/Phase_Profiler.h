@@ -0,0 +1,71 @@
+/* ============================================================
+ *  Proyect  : I-Drone                                   
+ *  Filename : Phase_Profiler.h                    
+ *  Author   : Iván Gutiérrez                            
+ *  License  : GNU General Public License v3.0           
+ *
+ *  © 2025 Iván Gutiérrez.
+ * ============================================================
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Wall time, CPU time and peak RSS of each planning stage plus the problem sizes of one request.
+// CPU time is the calling thread's plus the children reported with add_child_usage. The peak RSS is the
+// process high-water mark reset at every stage boundary, so it assumes one request is planned at a time
+class Phase_Profiler {
+
+public:
+    // Measures from construction to destruction and adds the sample to its profiler
+    class Scoped_Phase {
+    public:
+        Scoped_Phase(Phase_Profiler &profiler, std::string name);
+        ~Scoped_Phase();
+        Scoped_Phase(const Scoped_Phase&) = delete;
+        Scoped_Phase& operator=(const Scoped_Phase&) = delete;
+
+    private:
+        friend class Phase_Profiler;
+
+        Phase_Profiler &profiler_;
+        std::string name_;
+        std::chrono::steady_clock::time_point wall_start_;
+        double cpu_start_ms_;
+        long peak_rss_kb_ = 0;
+        double child_cpu_ms_ = 0.0;
+        long child_peak_rss_kb_ = 0;
+    };
+
+    Phase_Profiler();
+
+    Scoped_Phase scope(const std::string &name);
+    void set_size(const std::string &key, int64_t value);
+    // CPU time and peak RSS of a child process that was waited for, added to the open stages
+    void add_child_usage(double cpu_ms, long peak_rss_kb);
+    std::string to_json() const;
+
+private:
+    struct Phase {
+        std::string name;
+        int calls = 0;
+        double wall_ms = 0.0;
+        double cpu_ms = 0.0;
+        long peak_rss_kb = 0;
+        long child_peak_rss_kb = 0;
+    };
+
+    std::chrono::steady_clock::time_point created_;
+    std::vector<Phase> phases_; // In order of first appearance, repeated stages are accumulated
+    std::vector<Scoped_Phase*> open_; // Nested stages, outermost first
+    std::map<std::string, int64_t> sizes_;
+    mutable std::mutex mutex_;
+
+    void open(Scoped_Phase &phase);
+    void close(Scoped_Phase &phase, double wall_ms, double cpu_ms);
+    void checkpoint_rss();
+};
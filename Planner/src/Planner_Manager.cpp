@@ -21,32 +21,37 @@
 #include "common_libs/Enc_Dec_PLD.h"
 
 Planner_Manager::Planner_Manager(std::shared_ptr<Communication_Manager> comm_mng, 
-                                     std::shared_ptr<Planner_Recorder> rec_mng,
                                      std::shared_ptr<Path_Cal> path_cal,
                                      std::shared_ptr<Signal_Cal> signal_cal,
                                      const Struct_Planner::Config_struct &cnf): comm_mng_ptr_(std::move(comm_mng)),
-                                                                            recorder_ptr_(std::move(rec_mng)),
                                                                             path_cal_ptr_(std::move(path_cal)),
                                                                             signal_cal_ptr_(std::move(signal_cal)),
                                                                             global_config_(cnf)
 {
-    comm_mng_ptr_->set_calculate_handler([this](const std::vector<Struct_Planner::SignalServerConfig> &configs, Struct_Planner::DroneData drone_data) {
-        calculate(configs, std::move(drone_data));
+    comm_mng_ptr_->set_calculate_handler([this](const Planner_Request &request, const std::vector<Struct_Planner::SignalServerConfig> &configs, Struct_Planner::DroneData drone_data, std::string &response) {
+        return calculate(request, configs, std::move(drone_data), response);
     });
 }
 
-void Planner_Manager::calculate(const std::vector<Struct_Planner::SignalServerConfig> &configs, Struct_Planner::DroneData drone_data)
+Struct_Planner::Status Planner_Manager::calculate(const Planner_Request &request, const std::vector<Struct_Planner::SignalServerConfig> &configs, Struct_Planner::DroneData drone_data, std::string &response)
 {
-    comm_mng_ptr_->set_status(Struct_Planner::Status::CALCULATING);
-    auto points = signal_cal_ptr_->calculate_signal(global_config_,configs);
+    const Cancel_Token &cancel_token = *request.cancel_token;
+    Phase_Profiler &profiler = *request.profiler;
+    auto points = signal_cal_ptr_->calculate_signal(global_config_,configs,cancel_token,profiler);
+
+    if (cancel_token.is_cancelled()) {
+        return Struct_Planner::Status::CANCELLED;
+    }
 
     if (points.empty()) {
-        comm_mng_ptr_->set_status(Struct_Planner::Status::ERROR);
-        return;
+        return Struct_Planner::Status::ERROR;
     }
 
     Logger::log_message(Logger::Type::INFO, "Writting csv coverage map");
-    recorder_ptr_->write_signal_output(points);
+    {
+        auto phase = profiler.scope("coverage_csv");
+        request.recorder->write_signal_output(points);
+    }
 
     std::stringstream log1;
     log1 << "Executing or tools Planner with " << points.size() << " points";
@@ -54,21 +59,52 @@ void Planner_Manager::calculate(const std::vector<Struct_Planner::SignalServerCo
 
     std::vector<std::vector<Struct_Planner::Coordinate>> result;
 
-    if (!path_cal_ptr_->calculate_path(drone_data,points,result,recorder_ptr_))
+    // Each route goes to the PLD as soon as it is expanded, while the routes of the next drones are expanded
+    route_handler on_route = nullptr;
+    uint32_t streamed_routes = 0;
+    size_t streamed_bytes = 0;
+    if (request.stream_routes) {
+        on_route = [this, &request, &streamed_routes, &streamed_bytes](int drone, const std::vector<Struct_Planner::Coordinate> &route) {
+            std::string message;
+            if (!Enc_Dec_PLD::encode_planner_route(route, static_cast<uint32_t>(drone), request.id, request.compact_response, message)) {
+                Logger::log_message(Logger::Type::ERROR, "Error encoding route of drone " + std::to_string(drone));
+                return;
+            }
+            streamed_bytes += message.size();
+            comm_mng_ptr_->deliver(std::move(message));
+            streamed_routes++;
+        };
+    }
+
+    bool path_ok = path_cal_ptr_->calculate_path(drone_data,points,result,request.recorder,cancel_token,profiler,on_route);
+
+    if (cancel_token.is_cancelled()) {
+        return Struct_Planner::Status::CANCELLED;
+    }
+
+    if (!path_ok)
     {
-        comm_mng_ptr_->set_status(Struct_Planner::Status::ERROR);
-        return;
+        return Struct_Planner::Status::ERROR;
     }
 
-    std::string msg;
-    if (!Enc_Dec_PLD::encode_planner_response(result,msg))
+    bool encoded;
+    if (request.stream_routes) {
+        // The routes are already on their way, the response only tells how many to expect
+        encoded = streamed_routes == result.size() &&
+                  Enc_Dec_PLD::encode_planner_routes_streamed(streamed_routes, request.id, response);
+        profiler.set_size("streamed_routes", streamed_routes);
+        profiler.set_size("streamed_bytes", static_cast<int64_t>(streamed_bytes));
+    } else {
+        auto phase = profiler.scope("encode_response");
+        encoded = Enc_Dec_PLD::encode_planner_response(result,request.id,request.compact_response,response);
+    }
+    if (!encoded)
     {
         Logger::log_message(Logger::Type::ERROR, "Error encoding Planner response");
-        comm_mng_ptr_->set_status(Struct_Planner::Status::ERROR);
-        return;
+        return Struct_Planner::Status::ERROR;
     }
-    comm_mng_ptr_->deliver(msg);
+    profiler.set_size("response_bytes", static_cast<int64_t>(response.size()));
 
     Logger::log_message(Logger::Type::INFO, "Planner_Manager task finish correctly");
-    comm_mng_ptr_->set_status(Struct_Planner::Status::FINISH);
-}
\ No newline at end of file
+    return Struct_Planner::Status::FINISH;
+}
@@ -21,17 +21,15 @@ class Planner_Manager: public Planner_Manager_Interface {
 
 private:
     std::shared_ptr<Communication_Manager> comm_mng_ptr_;
-    std::shared_ptr<Planner_Recorder> recorder_ptr_;
     std::shared_ptr<Path_Cal> path_cal_ptr_;
     std::shared_ptr<Signal_Cal> signal_cal_ptr_;
     Struct_Planner::Config_struct global_config_;
 
 public:
     Planner_Manager(std::shared_ptr<Communication_Manager> comm_mng, 
-                      std::shared_ptr<Planner_Recorder> rec_mng, 
                       std::shared_ptr<Path_Cal> path_cal,
                       std::shared_ptr<Signal_Cal> signal_cal,
                       const Struct_Planner::Config_struct &cnf);
     ~Planner_Manager() override = default;
-    void calculate(const std::vector<Struct_Planner::SignalServerConfig> &configs, Struct_Planner::DroneData drone_data) override;
+    Struct_Planner::Status calculate(const Planner_Request &request, const std::vector<Struct_Planner::SignalServerConfig> &configs, Struct_Planner::DroneData drone_data, std::string &response) override;
 };
\ No newline at end of file
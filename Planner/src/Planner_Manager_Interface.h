@@ -11,12 +11,12 @@
 #include <iostream>
 #include <memory>
 #include "Communication_Manager.h"
-#include "Planner_Recorder.h"
+#include "Planner_Request.h"
 
 // Interface
 class Planner_Manager_Interface {
 
 public:
     virtual ~Planner_Manager_Interface();
-    virtual void calculate(const std::vector<Struct_Planner::SignalServerConfig> &configs, Struct_Planner::DroneData drone_data);
+    virtual Struct_Planner::Status calculate(const Planner_Request &request, const std::vector<Struct_Planner::SignalServerConfig> &configs, Struct_Planner::DroneData drone_data, std::string &response) = 0;
 };
\ No newline at end of file
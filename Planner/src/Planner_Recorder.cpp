@@ -20,6 +20,8 @@ constexpr const char signal_server_output_file_name[] = "output_signal";
 constexpr const char signal_server_output_file_extension[] = "csv";
 constexpr const char ortools_output_file_name[] = "output_ortools";
 constexpr const char ortools_output_file_extension[] = "txt";
+constexpr const char profile_file_name[] = "profile";
+constexpr const char profile_file_extension[] = "json";
 
 static std::string get_session_timestamp() {
     auto now = std::chrono::system_clock::now();
@@ -44,14 +46,15 @@ static std::string get_session_timestamp() {
     return ss.str();
 }
 
-Planner_Recorder::Planner_Recorder(const std::filesystem::path &path)
+Planner_Recorder::Planner_Recorder(const std::filesystem::path &path, uint64_t request_id)
 {
-    std::string session_folder = "planner_" + get_session_timestamp();
+    std::string session_folder = "planner_" + get_session_timestamp() + "_req" + std::to_string(request_id);
     std::filesystem::path session_path = path / session_folder;
     
     recorder_msg = std::make_unique<Recorder>(session_path, message_received_file_name, message_received_file_extension);
     recorder_sgn = std::make_unique<Recorder>(session_path, signal_server_output_file_name, signal_server_output_file_extension);
     recorder_or = std::make_unique<Recorder>(session_path, ortools_output_file_name, ortools_output_file_extension);
+    recorder_profile = std::make_unique<Recorder>(session_path, profile_file_name, profile_file_extension);
     
     Logger::log_message(Logger::Type::INFO, "Planner_Recorder initialized at " + session_path.string());
 }
@@ -93,10 +96,17 @@ bool Planner_Recorder::write_or_output(const std::string &data)
     return recorder_or->write(data);
 }
 
+bool Planner_Recorder::write_profile(const std::string &json)
+{
+    if (!recorder_profile) return false;
+    return recorder_profile->write(json + "\n");
+}
+
 void Planner_Recorder::close_all()
 {
     if (recorder_msg) recorder_msg->close();
     if (recorder_sgn) recorder_sgn->close();
     if (recorder_or) recorder_or->close();
+    if (recorder_profile) recorder_profile->close();
     Logger::log_message(Logger::Type::INFO, "All recorder files closed successfully");
 }
\ No newline at end of file
@@ -16,16 +16,18 @@
 class Planner_Recorder {
 
 public:
-    explicit Planner_Recorder(const std::filesystem::path &path);
+    Planner_Recorder(const std::filesystem::path &path, uint64_t request_id);
 
     bool write_signal_output(const std::vector<Struct_Planner::Coordinate> &points);
     bool write_message_received(const std::vector<Struct_Planner::SignalServerConfig> &sng_data, const Struct_Planner::DroneData &drone_data);
     bool write_or_output(const std::string &data);
+    bool write_profile(const std::string &json);
     void close_all();
 
 private:
     std::unique_ptr<Recorder> recorder_msg;
     std::unique_ptr<Recorder> recorder_sgn;
     std::unique_ptr<Recorder> recorder_or;
+    std::unique_ptr<Recorder> recorder_profile;
 
 };
\ No newline at end of file
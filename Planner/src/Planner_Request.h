@@ -0,0 +1,25 @@
+/* ============================================================
+ *  Proyect  : I-Drone                                   
+ *  Filename : Planner_Request.h                    
+ *  Author   : Iván Gutiérrez                            
+ *  License  : GNU General Public License v3.0           
+ *
+ *  © 2025 Iván Gutiérrez.
+ * ============================================================
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+#pragma once
+#include <cstdint>
+#include <memory>
+#include "Cancel_Token.h"
+#include "Phase_Profiler.h"
+#include "Planner_Recorder.h"
+
+// State owned by a single plan request while it is queued or being calculated
+struct Planner_Request {
+    uint64_t id = 0;
+    bool compact_response = false; // The PLD negotiated fixed-point delta coordinates for the response
+    bool stream_routes = false;    // The PLD takes each drone's route as soon as it is expanded
+    std::shared_ptr<Cancel_Token> cancel_token;
+    std::shared_ptr<Planner_Recorder> recorder;
+    std::shared_ptr<Phase_Profiler> profiler;
+};
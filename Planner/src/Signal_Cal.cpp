@@ -11,7 +11,11 @@
 #include <vector>
 #include <map>
 #include <algorithm>
+#include <cerrno>
 #include <sstream>
+#include <spawn.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
 #if defined(__has_include)
 #if __has_include(<format>)
 #include <format>
@@ -19,7 +23,37 @@
 #endif
 #include "common_libs/Logger.h"
 
+extern char **environ;
+
 namespace {
+// Like std::system, but the shell is waited for with wait4 so the Signal-Server run it waited for is
+// measured on its own: CPU time and peak RSS of this call, not the high-water mark of every earlier one
+int run_shell_command(const std::string &cmd, rusage &usage)
+{
+    std::string shell = "/bin/sh";
+    std::string flag = "-c";
+    std::string command = cmd;
+    char* args[] = {shell.data(), flag.data(), command.data(), nullptr};
+
+    pid_t pid = -1;
+    if (posix_spawn(&pid, args[0], nullptr, nullptr, args, environ) != 0) {
+        return -1;
+    }
+
+    int status = 0;
+    pid_t result;
+    do {
+        result = wait4(pid, &status, 0, &usage);
+    } while (result < 0 && errno == EINTR);
+
+    return (result == pid && WIFEXITED(status)) ? WEXITSTATUS(status) : -1;
+}
+
+double timeval_ms(const timeval &tv)
+{
+    return static_cast<double>(tv.tv_sec) * 1000.0 + static_cast<double>(tv.tv_usec) / 1000.0;
+}
+
 CoverageMatrix merge_max(const CoverageMatrix& a, const CoverageMatrix& b)
 {
     if (a.empty()) return b;
@@ -98,7 +132,7 @@ std::map<RGB, double> Signal_Cal::read_DCF(const std::string& dcf_filename) cons
     return colorToDbm;
 }
 
-CoverageMatrix Signal_Cal::read_Coverage_File(const std::string& ppm_filename, const std::string& dcf_filename) const
+CoverageMatrix Signal_Cal::read_Coverage_File(const std::string& ppm_filename, const std::string& dcf_filename, const Cancel_Token &cancel_token) const
 {
     std::ifstream file(ppm_filename, std::ios::binary);
     if (!file) {
@@ -143,6 +177,9 @@ CoverageMatrix Signal_Cal::read_Coverage_File(const std::string& ppm_filename, c
     CoverageMatrix matrix(rows, std::vector<double>(cols, -120.0));
 
     for (int row = 0; row < rows; ++row) {
+        if (cancel_token.is_cancelled()) {
+            return {};
+        }
         for (int col = 0; col < cols; ++col) {
             unsigned char rgb[3];
             file.read(reinterpret_cast<char*>(rgb), 3);
@@ -205,7 +242,10 @@ std::vector<Struct_Planner::Coordinate> matrixToVector(
     return points;
 }
 
-std::vector<Struct_Planner::Coordinate> Signal_Cal::calculate_signal(const Struct_Planner::Config_struct &global_config, const std::vector<Struct_Planner::SignalServerConfig> &signal_server_confs) const
+std::vector<Struct_Planner::Coordinate> Signal_Cal::calculate_signal(const Struct_Planner::Config_struct &global_config,
+                                                                     const std::vector<Struct_Planner::SignalServerConfig> &signal_server_confs,
+                                                                     const Cancel_Token &cancel_token,
+                                                                     Phase_Profiler &profiler) const
 {
     std::vector<Struct_Planner::Coordinate> points_empty;
     if (signal_server_confs.empty()) {
@@ -217,6 +257,11 @@ std::vector<Struct_Planner::Coordinate> Signal_Cal::calculate_signal(const Struc
     std::vector<double> bounds;
 
     for (size_t i = 0; i < signal_server_confs.size(); ++i) {
+        if (cancel_token.is_cancelled()) {
+            Logger::log_message(Logger::Type::WARNING, "Signal calculation cancelled");
+            return points_empty;
+        }
+
         auto cfg = signal_server_confs[i];
         cfg.filePaths.outputFile = format_cfg_output_file(signal_server_confs[i].filePaths.outputFile, i);
 
@@ -231,7 +276,14 @@ std::vector<Struct_Planner::Coordinate> Signal_Cal::calculate_signal(const Struc
         cmd += " > output.txt 2>&1";
         Logger::log_message(Logger::Type::INFO, "Executing Signal-Server command: " + cmd);
 
-        if (std::system(cmd.c_str()) != 0) {
+        int signal_server_rc;
+        {
+            auto phase = profiler.scope("signal_server");
+            rusage usage {};
+            signal_server_rc = run_shell_command(cmd, usage);
+            profiler.add_child_usage(timeval_ms(usage.ru_utime) + timeval_ms(usage.ru_stime), usage.ru_maxrss);
+        }
+        if (signal_server_rc != 0) {
             Logger::log_message(
                 Logger::Type::ERROR,
                 format_config_indexed_message("Error executing Signal-Server command for config ", i));
@@ -269,7 +321,15 @@ std::vector<Struct_Planner::Coordinate> Signal_Cal::calculate_signal(const Struc
         Logger::log_message(Logger::Type::INFO, "PPM path: " + ppmPath);
         Logger::log_message(Logger::Type::INFO, "DCF path: " + dcfPath);
 
-        auto matrix = read_Coverage_File(ppmPath, dcfPath);
+        CoverageMatrix matrix;
+        {
+            auto phase = profiler.scope("ppm_decode");
+            matrix = read_Coverage_File(ppmPath, dcfPath, cancel_token);
+        }
+        if (cancel_token.is_cancelled()) {
+            Logger::log_message(Logger::Type::WARNING, "Signal calculation cancelled");
+            return points_empty;
+        }
         if (matrix.empty()) {
             Logger::log_message(
                 Logger::Type::ERROR,
@@ -285,7 +345,15 @@ std::vector<Struct_Planner::Coordinate> Signal_Cal::calculate_signal(const Struc
         return points_empty;
     }
 
-    auto vector = matrixToVector(merged_matrix, bounds[0], bounds[2], bounds[3], bounds[1], global_config.threshold);
+    profiler.set_size("signal_configs", static_cast<int64_t>(signal_server_confs.size()));
+    profiler.set_size("coverage_cells", static_cast<int64_t>(merged_matrix.size() * merged_matrix.front().size()));
+
+    std::vector<Struct_Planner::Coordinate> vector;
+    {
+        auto phase = profiler.scope("coverage_to_points");
+        vector = matrixToVector(merged_matrix, bounds[0], bounds[2], bounds[3], bounds[1], global_config.threshold);
+    }
+    profiler.set_size("coverage_points", static_cast<int64_t>(vector.size()));
     
     if (vector.empty())
         Logger::log_message(Logger::Type::ERROR, "Error parsing matrix into a vector");
@@ -9,6 +9,8 @@
  * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 #pragma once
 #include "structs/Structs_Planner.h"
+#include "Cancel_Token.h"
+#include "Phase_Profiler.h"
 #include <iostream>
 #include <memory>
 #include <map>
@@ -30,10 +32,13 @@ class Signal_Cal {
 
 public:
     Signal_Cal() = default;
-    std::vector<Struct_Planner::Coordinate> calculate_signal(const Struct_Planner::Config_struct &global_config,const std::vector<Struct_Planner::SignalServerConfig> &signal_server_confs) const;
+    std::vector<Struct_Planner::Coordinate> calculate_signal(const Struct_Planner::Config_struct &global_config,
+                                                             const std::vector<Struct_Planner::SignalServerConfig> &signal_server_confs,
+                                                             const Cancel_Token &cancel_token,
+                                                             Phase_Profiler &profiler) const;
 
 private:
-    CoverageMatrix read_Coverage_File(const std::string& filename, const std::string& dcfFilename) const;
+    CoverageMatrix read_Coverage_File(const std::string& filename, const std::string& dcfFilename, const Cancel_Token &cancel_token) const;
     std::vector<double> parse_Bounds(const std::string& str) const;
     std::map<RGB, double> read_DCF(const std::string& dcf_filename) const;
 };
\ No newline at end of file
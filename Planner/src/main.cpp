@@ -70,23 +70,19 @@ int main(int argc, char* argv[]) {
         return EXIT_FAILURE;
     }
 
-    auto rec_mng_ptr = std::make_shared<Planner_Recorder>(cnf.data_path);
-
-    auto comm_mng_ptr = std::make_shared<Communication_Manager>(io_context,pld_endpoint,rec_mng_ptr);
+    auto comm_mng_ptr = std::make_shared<Communication_Manager>(io_context,pld_endpoint,cnf);
 
     auto path_cal_ptr = std::make_shared<Path_Cal>(cnf);
 
     auto signal_cal_ptr = std::make_shared<Signal_Cal>();
 
     std::shared_ptr<Planner_Manager_Interface> planner_mng_ptr = std::make_shared<Planner_Manager>(comm_mng_ptr,
-                                                                                                    rec_mng_ptr,
                                                                                                     path_cal_ptr,
                                                                                                     signal_cal_ptr,
                                                                                                     cnf);
     
-    Signal_Handler signal_handler(io_context, [&rec_mng_ptr, &comm_mng_ptr]() {
+    Signal_Handler signal_handler(io_context, [&comm_mng_ptr]() {
         comm_mng_ptr->shutdown();
-        rec_mng_ptr->close_all();
         Logger::log_message(Logger::Type::INFO, "Shutdown complete");
     });
 
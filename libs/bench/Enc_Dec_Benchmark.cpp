@@ -0,0 +1,182 @@
+/* ============================================================
+ *  Proyect  : I-Drone
+ *  Filename : Enc_Dec_Benchmark.cpp
+ *  Author   : Iván Gutiérrez
+ *  License  : GNU General Public License v3.0
+ *
+ *  © 2025 Iván Gutiérrez.
+ * ============================================================
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+#include <chrono>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <google/protobuf/arena.h>
+#include "common_libs/Enc_Dec_PLD.h"
+#include "structs/Structs_Planner.h"
+
+// Random walk around a fixed origin, similar in spread to a real route
+constexpr double ORIGIN_LAT = 40.40;
+constexpr double ORIGIN_LON = -3.70;
+constexpr double STEP_DEG = 0.0003;
+
+struct Bench_Options {
+    size_t points = 10000;
+    int drones = 4;
+    int iterations = 2000;
+    unsigned int seed = 42;
+    std::string output = "enc_dec_benchmark.json";
+};
+
+namespace {
+
+std::vector<std::vector<Struct_Planner::Coordinate>> generate_routes(const Bench_Options &options)
+{
+    std::mt19937 rng(options.seed);
+    std::uniform_real_distribution<double> step(-STEP_DEG, STEP_DEG);
+
+    std::vector<std::vector<Struct_Planner::Coordinate>> routes(static_cast<size_t>(options.drones));
+    const size_t per_drone = options.points / routes.size();
+    for (auto &route : routes) {
+        double lon = ORIGIN_LON;
+        double lat = ORIGIN_LAT;
+        route.reserve(per_drone);
+        for (size_t i = 0; i < per_drone; ++i) {
+            lon += step(rng);
+            lat += step(rng);
+            route.emplace_back(lon, lat);
+        }
+    }
+    return routes;
+}
+
+// Runs `decode` for every iteration and reports throughput over the encoded payload
+std::string time_decode(const std::string &name, const std::string &payload, int iterations, const std::function<bool()> &decode)
+{
+    bool ok = true;
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        ok = decode() && ok;
+    }
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    const double seconds = elapsed.count();
+    const double us_per_decode = seconds * 1e6 / iterations;
+    const double mb_per_s = static_cast<double>(payload.size()) * iterations / seconds / 1e6;
+
+    std::ostringstream json;
+    json << "{\"name\":\"" << name << "\",\"ok\":" << (ok ? "true" : "false")
+         << ",\"us_per_decode\":" << us_per_decode << ",\"mb_per_s\":" << mb_per_s << '}';
+    return json.str();
+}
+
+// Each payload is timed three ways: the former deep copy out of the wrapper, the typed move out of the
+// wrapper done by decode_from_planner, and in-place access to a wrapper parsed on an arena
+std::string run_case(const std::string &encoding, const std::string &payload, const Bench_Options &options)
+{
+    std::vector<std::string> results;
+
+    results.push_back(time_decode("copy", payload, options.iterations, [&payload]() {
+        WrapperPlanner wrapper;
+        if (!wrapper.ParseFromArray(payload.data(), static_cast<int>(payload.size())) || !wrapper.has_planner_response())
+            return false;
+        auto msg = std::make_unique<PlannerResponseList>(wrapper.planner_response());
+        std::vector<std::vector<Struct_Planner::Coordinate>> routes;
+        return Enc_Dec_PLD::decode_planner_response(*msg, routes);
+    }));
+
+    results.push_back(time_decode("move", payload, options.iterations, [&payload]() {
+        const auto decoded = Enc_Dec_PLD::decode_from_planner(payload);
+        const auto response = std::get_if<PlannerResponseList>(&decoded);
+        std::vector<std::vector<Struct_Planner::Coordinate>> routes;
+        return response && Enc_Dec_PLD::decode_planner_response(*response, routes);
+    }));
+
+    results.push_back(time_decode("arena", payload, options.iterations, [&payload]() {
+        google::protobuf::Arena arena;
+        auto wrapper = google::protobuf::Arena::Create<WrapperPlanner>(&arena);
+        if (!wrapper->ParseFromArray(payload.data(), static_cast<int>(payload.size())) || !wrapper->has_planner_response())
+            return false;
+        std::vector<std::vector<Struct_Planner::Coordinate>> routes;
+        return Enc_Dec_PLD::decode_planner_response(wrapper->planner_response(), routes);
+    }));
+
+    std::ostringstream json;
+    json << "{\"encoding\":\"" << encoding << "\",\"payload_bytes\":" << payload.size() << ",\"decoders\":[";
+    for (size_t i = 0; i < results.size(); ++i) {
+        if (i > 0) json << ',';
+        json << results[i];
+    }
+    json << "]}";
+    return json.str();
+}
+
+bool parse_options(int argc, char* argv[], Bench_Options &options)
+{
+    try {
+        for (int i = 1; i < argc; ++i) {
+            std::string arg = argv[i];
+            if (arg == "--points" && i + 1 < argc) {
+                options.points = std::stoul(argv[++i]);
+            } else if (arg == "--drones" && i + 1 < argc) {
+                options.drones = std::stoi(argv[++i]);
+            } else if (arg == "--iterations" && i + 1 < argc) {
+                options.iterations = std::stoi(argv[++i]);
+            } else if (arg == "--seed" && i + 1 < argc) {
+                options.seed = static_cast<unsigned int>(std::stoul(argv[++i]));
+            } else if (arg == "--output" && i + 1 < argc) {
+                options.output = argv[++i];
+            } else {
+                return false;
+            }
+        }
+    } catch (const std::exception &) {
+        return false;
+    }
+    return options.drones > 0 && options.iterations > 0 && options.points >= static_cast<size_t>(options.drones);
+}
+
+}
+
+int main(int argc, char* argv[])
+{
+    Bench_Options options;
+    if (!parse_options(argc, argv, options)) {
+        std::cerr << "Usage: Enc_Dec_Benchmark [--points N] [--drones N] [--iterations N] [--seed N] [--output file.json]\n";
+        return EXIT_FAILURE;
+    }
+
+    const auto routes = generate_routes(options);
+
+    std::ostringstream json;
+    json << "{\"benchmark\":\"planner_response_decode\",\"points\":" << options.points
+         << ",\"drones\":" << options.drones << ",\"iterations\":" << options.iterations << ",\"cases\":[";
+
+    const std::pair<std::string, bool> encodings[] = {{"double", false}, {"compact", true}};
+    bool first = true;
+    for (const auto &[name, compact] : encodings) {
+        std::string payload;
+        if (!Enc_Dec_PLD::encode_planner_response(routes, 1, compact, payload)) {
+            std::cerr << "Unable to encode the " << name << " response\n";
+            return EXIT_FAILURE;
+        }
+        std::cerr << "Decoding " << name << " response of " << payload.size() << " bytes\n";
+        if (!first) json << ',';
+        first = false;
+        json << run_case(name, payload, options);
+    }
+    json << "]}\n";
+
+    std::ofstream out(options.output);
+    if (!out) {
+        std::cerr << "Unable to write " << options.output << "\n";
+        return EXIT_FAILURE;
+    }
+    out << json.str();
+    std::cerr << "Results written to " << options.output << "\n";
+    return EXIT_SUCCESS;
+}
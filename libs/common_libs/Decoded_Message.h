@@ -0,0 +1,39 @@
+/* ============================================================
+ *  Proyect  : I-Drone
+ *  Filename : Decoded_Message.h
+ *  Author   : Iván Gutiérrez
+ *  License  : GNU General Public License v3.0
+ *
+ *  © 2025 Iván Gutiérrez.
+ * ============================================================
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+#pragma once
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+// The payload could not be parsed
+struct Decode_Error {};
+
+// The payload parsed but carried no message this module knows
+struct Unknown_Message {};
+
+// Result of a typed decode: the concrete message is held by value, moved out of the wrapper
+template <typename... Messages>
+using Decoded = std::variant<Decode_Error, Unknown_Message, Messages...>;
+
+template <typename... Handlers>
+struct Overloaded : Handlers... {
+    using Handlers::operator()...;
+};
+
+template <typename... Handlers>
+Overloaded(Handlers...) -> Overloaded<Handlers...>;
+
+// Calls the handler that takes the decoded alternative. Every alternative, including Decode_Error and
+// Unknown_Message, needs a handler (a generic lambda can act as the fallback) or it does not compile
+template <typename Variant, typename... Handlers>
+decltype(auto) dispatch(Variant &&message, Handlers &&...handlers)
+{
+    return std::visit(Overloaded<std::decay_t<Handlers>...>{std::forward<Handlers>(handlers)...}, std::forward<Variant>(message));
+}
@@ -9,31 +9,93 @@
  * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 #include "Enc_Dec_Drone.h"
 #include "generated_proto/messages_pld.pb.h"
-#include <boost/asio/detail/socket_ops.hpp>
+#include "Server.h"
 #include "structs/Structs_Planner.h"
 
 namespace Enc_Dec_Drone {
 
+    namespace {
+        CameraAction to_proto_camera_action(Struct_Drone::CameraAction action)
+        {
+            switch (action) {
+                case Struct_Drone::CameraAction::TakePhoto:
+                    return CAMERA_ACTION_TAKE_PHOTO;
+                case Struct_Drone::CameraAction::StartPhotoInterval:
+                    return CAMERA_ACTION_START_PHOTO_INTERVAL;
+                case Struct_Drone::CameraAction::StopPhotoInterval:
+                    return CAMERA_ACTION_STOP_PHOTO_INTERVAL;
+                case Struct_Drone::CameraAction::StartVideo:
+                    return CAMERA_ACTION_START_VIDEO;
+                case Struct_Drone::CameraAction::StopVideo:
+                    return CAMERA_ACTION_STOP_VIDEO;
+                case Struct_Drone::CameraAction::StartPhotoDistance:
+                    return CAMERA_ACTION_START_PHOTO_DISTANCE;
+                case Struct_Drone::CameraAction::StopPhotoDistance:
+                    return CAMERA_ACTION_STOP_PHOTO_DISTANCE;
+                default:
+                    return CAMERA_ACTION_NONE;
+            }
+        }
+
+        Struct_Drone::CameraAction from_proto_camera_action(CameraAction action)
+        {
+            switch (action) {
+                case CAMERA_ACTION_TAKE_PHOTO:
+                    return Struct_Drone::CameraAction::TakePhoto;
+                case CAMERA_ACTION_START_PHOTO_INTERVAL:
+                    return Struct_Drone::CameraAction::StartPhotoInterval;
+                case CAMERA_ACTION_STOP_PHOTO_INTERVAL:
+                    return Struct_Drone::CameraAction::StopPhotoInterval;
+                case CAMERA_ACTION_START_VIDEO:
+                    return Struct_Drone::CameraAction::StartVideo;
+                case CAMERA_ACTION_STOP_VIDEO:
+                    return Struct_Drone::CameraAction::StopVideo;
+                case CAMERA_ACTION_START_PHOTO_DISTANCE:
+                    return Struct_Drone::CameraAction::StartPhotoDistance;
+                case CAMERA_ACTION_STOP_PHOTO_DISTANCE:
+                    return Struct_Drone::CameraAction::StopPhotoDistance;
+                default:
+                    return Struct_Drone::CameraAction::None;
+            }
+        }
+
+        // Default PX4 waypoint parameters shared by single commands and whole plans
+        Struct_Drone::MissionItem default_px4_item(const Struct_Planner::Coordinate &coord_point)
+        {
+            Struct_Drone::MissionItem mission_msg;
+            mission_msg.latitude_deg = coord_point.lat;
+            mission_msg.longitude_deg = coord_point.lon;
+            mission_msg.relative_altitude_m = 25;
+            mission_msg.speed_m_s = 2.0;
+            mission_msg.is_fly_through = false;
+            mission_msg.gimbal_pitch_deg = 0.0;
+            mission_msg.gimbal_yaw_deg = 0.0;
+            mission_msg.camera_action = Struct_Drone::CameraAction::TakePhoto;
+            return mission_msg;
+        }
+    }
 
-    std::pair<Drone, std::unique_ptr<google::protobuf::Message>> decode_to_drone(const std::string& data)
+    To_Drone decode_to_drone(std::string_view data)
     {
         WrapperDroneCommand wrapper;
-        if (!wrapper.ParseFromString(data)) {
-            return {Drone::UNKNOWN, nullptr};
+        if (!wrapper.ParseFromArray(data.data(), static_cast<int>(data.size()))) {
+            return Decode_Error{};
         }
 
-        if (wrapper.has_command_message_normal()) {
-            auto msg = std::make_unique<DroneCommandString>(wrapper.command_message_normal());
-            return {Drone::COMMAND, std::move(msg)};
+        switch (wrapper.payload_case()) {
+            case WrapperDroneCommand::kCommandMessageNormal:
+                return std::move(*wrapper.mutable_command_message_normal());
+            case WrapperDroneCommand::kMissionPlan:
+                return std::move(*wrapper.mutable_mission_plan());
+            default:
+                return Unknown_Message{};
         }
-
-        return {Drone::UNKNOWN, nullptr};
     }
 
     bool encode_PX4_command(const Struct_Drone::MessagePX4 &command, std::string &response)
     {
         DroneCommandString command_msg;
-        command_msg.set_type_command(command.type);
+        command_msg.set_command_type(static_cast<CommandType>(command.type));
         
         DroneCommandMision* mission_msg = command_msg.mutable_command();
         mission_msg->set_latitude_deg(command.mission_item.latitude_deg);
@@ -44,55 +106,18 @@ namespace Enc_Dec_Drone {
         mission_msg->set_gimbal_pitch_deg(command.mission_item.gimbal_pitch_deg);
         mission_msg->set_gimbal_yaw_deg(command.mission_item.gimbal_yaw_deg);
         
-        switch (command.mission_item.camera_action) {
-            case Struct_Drone::CameraAction::TakePhoto:
-                mission_msg->set_camera_action(CAMERA_ACTION_TAKE_PHOTO);
-                break;
-            case Struct_Drone::CameraAction::StartPhotoInterval:
-                mission_msg->set_camera_action(CAMERA_ACTION_START_PHOTO_INTERVAL);
-                break;
-            case Struct_Drone::CameraAction::StopPhotoInterval:
-                mission_msg->set_camera_action(CAMERA_ACTION_STOP_PHOTO_INTERVAL);
-                break;
-            case Struct_Drone::CameraAction::StartVideo:
-                mission_msg->set_camera_action(CAMERA_ACTION_START_VIDEO);
-                break;
-            case Struct_Drone::CameraAction::StopVideo:
-                mission_msg->set_camera_action(CAMERA_ACTION_STOP_VIDEO);
-                break;
-            case Struct_Drone::CameraAction::StartPhotoDistance:
-                mission_msg->set_camera_action(CAMERA_ACTION_START_PHOTO_DISTANCE);
-                break;
-            case Struct_Drone::CameraAction::StopPhotoDistance:
-                mission_msg->set_camera_action(CAMERA_ACTION_STOP_PHOTO_DISTANCE);
-                break;
-            default:
-                mission_msg->set_camera_action(CAMERA_ACTION_NONE);
-                break;
-        }
+        mission_msg->set_camera_action(to_proto_camera_action(command.mission_item.camera_action));
         
         WrapperDroneCommand wrapper;
         *(wrapper.mutable_command_message_normal()) = command_msg;
 
-        std::string serialized_data;
-        if (!wrapper.SerializeToString(&serialized_data))
-            return false;
-
-        uint32_t size = boost::asio::detail::socket_ops::host_to_network_long(
-            static_cast<uint32_t>(serialized_data.size())
-        );
-
-        response.resize(4);
-        std::memcpy(response.data(), &size, 4);
-        response += serialized_data;
-
-        return true;
+        return Server::serialize_payload(wrapper, response);
     }
 
     bool decode_PX4_command(const DroneCommandString &msg, Struct_Drone::MessagePX4 &command)
     {
         try {
-            command.type = msg.type_command();
+            command.type = decode_command_type(msg);
             
             if (msg.has_command()) {
                 const DroneCommandMision& mission_msg = msg.command();
@@ -105,33 +130,7 @@ namespace Enc_Dec_Drone {
                 command.mission_item.gimbal_pitch_deg = mission_msg.gimbal_pitch_deg();
                 command.mission_item.gimbal_yaw_deg = mission_msg.gimbal_yaw_deg();
                 
-                // Convert CameraAction enum
-                switch (mission_msg.camera_action()) {
-                    case CAMERA_ACTION_TAKE_PHOTO:
-                        command.mission_item.camera_action = Struct_Drone::CameraAction::TakePhoto;
-                        break;
-                    case CAMERA_ACTION_START_PHOTO_INTERVAL:
-                        command.mission_item.camera_action = Struct_Drone::CameraAction::StartPhotoInterval;
-                        break;
-                    case CAMERA_ACTION_STOP_PHOTO_INTERVAL:
-                        command.mission_item.camera_action = Struct_Drone::CameraAction::StopPhotoInterval;
-                        break;
-                    case CAMERA_ACTION_START_VIDEO:
-                        command.mission_item.camera_action = Struct_Drone::CameraAction::StartVideo;
-                        break;
-                    case CAMERA_ACTION_STOP_VIDEO:
-                        command.mission_item.camera_action = Struct_Drone::CameraAction::StopVideo;
-                        break;
-                    case CAMERA_ACTION_START_PHOTO_DISTANCE:
-                        command.mission_item.camera_action = Struct_Drone::CameraAction::StartPhotoDistance;
-                        break;
-                    case CAMERA_ACTION_STOP_PHOTO_DISTANCE:
-                        command.mission_item.camera_action = Struct_Drone::CameraAction::StopPhotoDistance;
-                        break;
-                    default:
-                        command.mission_item.camera_action = Struct_Drone::CameraAction::None;
-                        break;
-                }
+                command.mission_item.camera_action = from_proto_camera_action(mission_msg.camera_action());
             }
             
             return true;
@@ -146,46 +145,64 @@ namespace Enc_Dec_Drone {
 
         Status* status_msg = wrapper.mutable_status();
 
-        std::string state_std = to_string(status);
-        if (state_std.empty())
-            return false;
-
-        status_msg->set_type_status(state_std);
-
-        std::string serialized_data;
-        if (!wrapper.SerializeToString(&serialized_data))
-            return false;
+        status_msg->set_drone_status(static_cast<DroneStatus>(status));
 
-        uint32_t size = boost::asio::detail::socket_ops::host_to_network_long(
-            static_cast<uint32_t>(serialized_data.size())
-        );
+        return Server::serialize_payload(wrapper, message);
+    }
 
-        message.resize(4);
-        std::memcpy(message.data(), &size, 4);
-        message += serialized_data;
+    Struct_Drone::Status decode_status_drone(const Status &msg)
+    {
+        if (msg.has_drone_status()) {
+            return static_cast<Struct_Drone::Status>(msg.drone_status());
+        }
+        return Struct_Drone::to_enum(msg.type_status());
+    }
 
-        return true;
+    Struct_Drone::Command_Type decode_command_type(const DroneCommandString &msg)
+    {
+        if (msg.command_type() != COMMAND_TYPE_WAYPOINT || msg.type_command().empty()) {
+            return static_cast<Struct_Drone::Command_Type>(msg.command_type());
+        }
+        return Struct_Drone::to_command_type(msg.type_command());
     }
 
-    bool encode_px4_message(const Struct_Planner::Coordinate & coord_point, const std::string & type, std::string & msg)
+    bool encode_px4_message(const Struct_Planner::Coordinate & coord_point, Struct_Drone::Command_Type type, std::string & msg)
     {
         Struct_Drone::MessagePX4 px4_msg;
-        Struct_Drone::MissionItem mission_msg;
-        mission_msg.latitude_deg = coord_point.lat;
-        mission_msg.longitude_deg = coord_point.lon;
-        mission_msg.relative_altitude_m = 25;
-        mission_msg.speed_m_s = 2.0;
-        mission_msg.is_fly_through = false;
-        mission_msg.gimbal_pitch_deg = 0.0;
-        mission_msg.gimbal_yaw_deg = 0.0;
-        mission_msg.camera_action = Struct_Drone::CameraAction::TakePhoto;
         px4_msg.type = type;
-        px4_msg.mission_item = mission_msg;
+        px4_msg.mission_item = default_px4_item(coord_point);
         
         return encode_PX4_command(px4_msg, msg);
     }
 
-    bool create_message_to_drone(const std::string &drone_sim, const Struct_Planner::Coordinate &coord_point, const std::string &type, std::string &msg)
+    bool encode_px4_mission_plan(int drone_id, const std::vector<Struct_Planner::Coordinate> &coor_points, std::string &msg)
+    {
+        if (coor_points.empty())
+            return false;
+
+        WrapperDroneCommand wrapper;
+        DroneMissionPlan* plan = wrapper.mutable_mission_plan();
+        plan->set_drone_id(drone_id);
+
+        const Struct_Drone::MissionItem item = default_px4_item(coor_points.front());
+        plan->set_relative_altitude_m(item.relative_altitude_m);
+        plan->set_speed_m_s(item.speed_m_s);
+        plan->set_is_fly_through(item.is_fly_through);
+        plan->set_gimbal_pitch_deg(item.gimbal_pitch_deg);
+        plan->set_gimbal_yaw_deg(item.gimbal_yaw_deg);
+        plan->set_camera_action(to_proto_camera_action(item.camera_action));
+
+        plan->mutable_latitude_deg()->Reserve(static_cast<int>(coor_points.size()));
+        plan->mutable_longitude_deg()->Reserve(static_cast<int>(coor_points.size()));
+        for (const auto &coor : coor_points) {
+            plan->add_latitude_deg(coor.lat);
+            plan->add_longitude_deg(coor.lon);
+        }
+
+        return Server::serialize_payload(wrapper, msg);
+    }
+
+    bool create_message_to_drone(const std::string &drone_sim, const Struct_Planner::Coordinate &coord_point, Struct_Drone::Command_Type type, std::string &msg)
     {
         if (drone_sim == "PX4") {
             return encode_px4_message(coord_point,type,msg);
@@ -193,4 +210,48 @@ namespace Enc_Dec_Drone {
             return false;
         }
     }
+
+    bool create_mission_plan_to_drone(const std::string &drone_sim, int drone_id, const std::vector<Struct_Planner::Coordinate> &coor_points, std::string &msg)
+    {
+        if (drone_sim == "PX4") {
+            return encode_px4_mission_plan(drone_id,coor_points,msg);
+        } else { // Add here the if statement for other sim
+            return false;
+        }
+    }
+
+    bool decode_mission_plan(const DroneMissionPlan &msg, int &drone_id, std::vector<Struct_Drone::MessagePX4> &commands)
+    {
+        commands.clear();
+        if (msg.latitude_deg_size() != msg.longitude_deg_size() || msg.latitude_deg_size() == 0)
+            return false;
+
+        drone_id = msg.drone_id();
+
+        Struct_Drone::MissionItem item;
+        item.relative_altitude_m = msg.relative_altitude_m();
+        item.speed_m_s = msg.speed_m_s();
+        item.is_fly_through = msg.is_fly_through();
+        item.gimbal_pitch_deg = msg.gimbal_pitch_deg();
+        item.gimbal_yaw_deg = msg.gimbal_yaw_deg();
+        item.camera_action = from_proto_camera_action(msg.camera_action());
+
+        // Tag the waypoints the same way the per-waypoint protocol did: START, plain waypoints, FINISH
+        const int last = msg.latitude_deg_size() - 1;
+        commands.reserve(static_cast<size_t>(msg.latitude_deg_size()));
+        for (int i = 0; i <= last; ++i) {
+            Struct_Drone::MessagePX4 command;
+            if (i == 0) {
+                command.type = Struct_Drone::Command_Type::START;
+            } else if (i == last) {
+                command.type = Struct_Drone::Command_Type::FINISH;
+            }
+            command.mission_item = item;
+            command.mission_item.latitude_deg = msg.latitude_deg(i);
+            command.mission_item.longitude_deg = msg.longitude_deg(i);
+            commands.push_back(std::move(command));
+        }
+
+        return true;
+    }
 };
\ No newline at end of file
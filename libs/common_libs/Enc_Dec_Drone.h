@@ -9,23 +9,31 @@
  * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 #pragma once
 #include "generated_proto/messages_drone.pb.h"
+#include "generated_proto/messages_pld.pb.h"
+#include "Decoded_Message.h"
 #include "structs/Structs_Drone.h"
 #include "structs/Structs_Planner.h"
 #include <string>
+#include <string_view>
+#include <vector>
 
 namespace Enc_Dec_Drone {
 
-    enum class Drone {
-        UNKNOWN,
-        ERROR,
-        COMMAND
-    };
+    using To_Drone = Decoded<DroneCommandString, DroneMissionPlan>;
 
-    std::pair<Drone, std::unique_ptr<google::protobuf::Message>> decode_to_drone(const std::string& data);
+    To_Drone decode_to_drone(std::string_view data);
     
     bool decode_PX4_command(const DroneCommandString &msg, Struct_Drone::MessagePX4 &command);
 
+    Struct_Drone::Command_Type decode_command_type(const DroneCommandString &msg);
+
+    bool decode_mission_plan(const DroneMissionPlan &msg, int &drone_id, std::vector<Struct_Drone::MessagePX4> &commands);
+
     bool encode_status_drone(const Struct_Drone::Status &status, std::string &message);
 
-    bool create_message_to_drone(const std::string &drone_sim, const Struct_Planner::Coordinate &coord_point, const std::string &type, std::string &msg);
+    Struct_Drone::Status decode_status_drone(const Status &msg);
+
+    bool create_message_to_drone(const std::string &drone_sim, const Struct_Planner::Coordinate &coord_point, Struct_Drone::Command_Type type, std::string &msg);
+
+    bool create_mission_plan_to_drone(const std::string &drone_sim, int drone_id, const std::vector<Struct_Planner::Coordinate> &coor_points, std::string &msg);
 };
\ No newline at end of file
@@ -8,96 +8,116 @@
  * ============================================================
  * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 #include "Enc_Dec_PLD.h"
-#include <boost/asio/detail/socket_ops.hpp>
+#include "Server.h"
 #include "structs/Structs_Planner.h"
 #include "Enc_Dec_Planner.h"
 
+namespace {
+// Compact fixed-point deltas when asked for and representable, plain doubles otherwise
+void fill_route(const std::vector<Struct_Planner::Coordinate> &path, bool compact, PlannerResponse &drone_msg)
+{
+    if (compact && Enc_Dec_Planner::encode_compact_coordinates(path, *drone_msg.mutable_lon_e7_delta(), *drone_msg.mutable_lat_e7_delta())) {
+        return;
+    }
+
+    drone_msg.mutable_lon()->Reserve(static_cast<int>(path.size()));
+    drone_msg.mutable_lat()->Reserve(static_cast<int>(path.size()));
+
+    for (const auto &coord : path) {
+        drone_msg.add_lon(coord.lon);
+        drone_msg.add_lat(coord.lat);
+    }
+}
+}
+
 namespace Enc_Dec_PLD {
 
-    std::pair<PLD, std::unique_ptr<google::protobuf::Message>> decode_from_planner(const std::string& data)
+    From_Planner decode_from_planner(std::string_view data)
     {
         WrapperPlanner wrapper;
-        if (!wrapper.ParseFromString(data)) {
-            return {PLD::UNKNOWN, nullptr};
-        }
-
-        if (wrapper.has_planner_response()) {
-            auto msg = std::make_unique<PlannerResponseList>(wrapper.planner_response());
-            return {PLD::Planner_RESPONSE, std::move(msg)};
+        if (!wrapper.ParseFromArray(data.data(), static_cast<int>(data.size()))) {
+            return Decode_Error{};
         }
 
-        if (wrapper.has_status()) {
-            auto msg = std::make_unique<Status>(wrapper.status());
-            return {PLD::STATUS_Planner, std::move(msg)};
+        // The wrapper is not arena-allocated, so moving a submessage out of it swaps its fields instead of copying them
+        switch (wrapper.payload_case()) {
+            case WrapperPlanner::kPlannerResponse:
+                return std::move(*wrapper.mutable_planner_response());
+            case WrapperPlanner::kStatus:
+                return std::move(*wrapper.mutable_status());
+            case WrapperPlanner::kPlannerRoute:
+                return std::move(*wrapper.mutable_planner_route());
+            default:
+                return Unknown_Message{};
         }
-
-        return {PLD::UNKNOWN, nullptr};
     }
 
-    std::pair<PLD, std::unique_ptr<google::protobuf::Message>> decode_from_drone(const std::string& data)
+    From_Drone decode_from_drone(std::string_view data)
     {
         WrapperDrone wrapper;
-        if (!wrapper.ParseFromString(data)) {
-            return {PLD::UNKNOWN, nullptr};
+        if (!wrapper.ParseFromArray(data.data(), static_cast<int>(data.size()))) {
+            return Decode_Error{};
         }
 
-        if (wrapper.has_status()) {
-            auto msg = std::make_unique<Status>(wrapper.status());
-            return {PLD::STATUS_DRONE, std::move(msg)};
+        switch (wrapper.payload_case()) {
+            case WrapperDrone::kStatus:
+                return std::move(*wrapper.mutable_status());
+            default:
+                return Unknown_Message{};
         }
-
-        return {PLD::UNKNOWN, nullptr};
     }
 
-    std::pair<PLD, std::unique_ptr<google::protobuf::Message>> decode_from_client(const std::string& data)
+    From_Client decode_from_client(std::string_view data)
     {
         WrapperFromClient wrapper;
-        if (!wrapper.ParseFromString(data)) {
-            return {PLD::UNKNOWN, nullptr};
-        }
-
-        if (wrapper.has_config()) {
-            auto msg = std::make_unique<Config_mission>(wrapper.config());
-            return {PLD::CONFIG_MISSION, std::move(msg)};
+        if (!wrapper.ParseFromArray(data.data(), static_cast<int>(data.size()))) {
+            return Decode_Error{};
         }
 
-        if (wrapper.has_message()) {
-            auto msg = std::make_unique<Command>(wrapper.message());
-            return {PLD::COMMAND, std::move(msg)};
+        switch (wrapper.payload_case()) {
+            case WrapperFromClient::kConfig:
+                return std::move(*wrapper.mutable_config());
+            case WrapperFromClient::kMessage:
+                return std::move(*wrapper.mutable_message());
+            default:
+                return Unknown_Message{};
         }
-
-        return {PLD::UNKNOWN, nullptr};
     }
 
-    bool encode_planner_response(const std::vector<std::vector<Struct_Planner::Coordinate>> &result, std::string &msg)
+    bool encode_planner_response(const std::vector<std::vector<Struct_Planner::Coordinate>> &result, uint64_t request_id, bool compact, std::string &msg)
     {
-        PlannerResponseList dron_proto;
+        // Build the response in place inside the wrapper so it is only serialized once, without copies
+        WrapperPlanner wrapper;
+        PlannerResponseList* dron_proto = wrapper.mutable_planner_response();
+        dron_proto->mutable_items()->Reserve(static_cast<int>(result.size()));
 
         for (const auto &path : result) {
-            PlannerResponse* drone_msg = dron_proto.add_items();
-
-            for (const auto &coord : path) {
-                drone_msg->add_lon(coord.lon);
-                drone_msg->add_lat(coord.lat);
-            }
+            fill_route(path, compact, *dron_proto->add_items());
         }
+        dron_proto->set_request_id(request_id);
 
-        WrapperPlanner wrapper;
-        *(wrapper.mutable_planner_response()) = dron_proto;
+        return Server::serialize_payload(wrapper, msg);
+    }
 
-        std::string serialized_data;
-        if (!wrapper.SerializeToString(&serialized_data))
-            return false;
+    bool encode_planner_route(const std::vector<Struct_Planner::Coordinate> &route, uint32_t drone, uint64_t request_id, bool compact, std::string &msg)
+    {
+        WrapperPlanner wrapper;
+        PlannerRoute* route_proto = wrapper.mutable_planner_route();
+        route_proto->set_request_id(request_id);
+        route_proto->set_drone(drone);
+        fill_route(route, compact, *route_proto->mutable_route());
 
-        uint32_t size = boost::asio::detail::socket_ops::host_to_network_long(
-            static_cast<uint32_t>(serialized_data.size())
-        );
+        return Server::serialize_payload(wrapper, msg);
+    }
 
-        msg.resize(4);
-        std::memcpy(msg.data(), &size, 4);
-        msg += serialized_data;
+    bool encode_planner_routes_streamed(uint32_t routes, uint64_t request_id, std::string &msg)
+    {
+        WrapperPlanner wrapper;
+        PlannerResponseList* dron_proto = wrapper.mutable_planner_response();
+        dron_proto->set_request_id(request_id);
+        dron_proto->set_streamed_routes(routes);
 
-        return true;
+        return Server::serialize_payload(wrapper, msg);
     }
 
     bool decode_planner_response(const PlannerResponseList &proto, std::vector<std::vector<Struct_Planner::Coordinate>> &result)
@@ -107,80 +127,72 @@ namespace Enc_Dec_PLD {
 
         for (int d = 0; d < proto.items().size(); ++d)
         {
-            const PlannerResponse &msg = proto.items(d);
-
-            if (msg.lon_size() != msg.lat_size())
-                return false;
-
             std::vector<Struct_Planner::Coordinate> drone_path;
-            drone_path.reserve(msg.lon_size());
-
-            for (int i = 0; i < msg.lon_size(); ++i)
-            {
-                drone_path.emplace_back(
-                    msg.lon(i),
-                    msg.lat(i)
-                );
-            }
-
+            if (!decode_planner_route(proto.items(d), drone_path))
+                return false;
             result.push_back(std::move(drone_path));
         }
 
         return true;
     }
 
-    bool encode_status_planner(const Struct_Planner::Status &status, std::string &message)
+    bool decode_planner_route(const PlannerResponse &msg, std::vector<Struct_Planner::Coordinate> &route)
     {
-        WrapperPlanner wrapper;
-
-        Status* status_msg = wrapper.mutable_status();
-
-        std::string state_std = to_string(status);
-        if (state_std.empty())
-            return false;
-
-        status_msg->set_type_status(state_std);
+        route.clear();
+        if (msg.lon_e7_delta_size() > 0) {
+            return Enc_Dec_Planner::decode_compact_coordinates(msg.lon_e7_delta(), msg.lat_e7_delta(), route);
+        }
 
-        std::string serialized_data;
-        if (!wrapper.SerializeToString(&serialized_data))
+        if (msg.lon_size() != msg.lat_size())
             return false;
 
-        uint32_t size = boost::asio::detail::socket_ops::host_to_network_long(
-            static_cast<uint32_t>(serialized_data.size())
-        );
-
-        message.resize(4);
-        std::memcpy(message.data(), &size, 4);
-        message += serialized_data;
+        route.reserve(msg.lon_size());
+        for (int i = 0; i < msg.lon_size(); ++i)
+        {
+            route.emplace_back(
+                msg.lon(i),
+                msg.lat(i)
+            );
+        }
 
         return true;
     }
 
-    bool encode_status_pld(const Structs_PLD::Status &status, std::string &message)
+    bool encode_status_planner(const Struct_Planner::Status &status, uint64_t request_id, const std::string &profile, std::string &message)
     {
-        WrapperDrone wrapper;
+        WrapperPlanner wrapper;
 
         Status* status_msg = wrapper.mutable_status();
 
-        std::string state_std = to_string(status);
-        if (state_std.empty())
-            return false;
+        status_msg->set_planner_status(static_cast<PlannerStatus>(status));
+        status_msg->set_request_id(request_id);
+        status_msg->set_profile(profile);
+        status_msg->set_compact_coordinates(true);
 
-        status_msg->set_type_status(state_std);
+        return Server::serialize_payload(wrapper, message);
+    }
 
-        std::string serialized_data;
-        if (!wrapper.SerializeToString(&serialized_data))
-            return false;
+    bool encode_status_pld(const Structs_PLD::Status &status, const Structs_PLD::Queue_status &queue, const std::string &mission_id, std::string &message)
+    {
+        WrapperDrone wrapper;
 
-        uint32_t size = boost::asio::detail::socket_ops::host_to_network_long(
-            static_cast<uint32_t>(serialized_data.size())
-        );
+        Status* status_msg = wrapper.mutable_status();
 
-        message.resize(4);
-        std::memcpy(message.data(), &size, 4);
-        message += serialized_data;
+        status_msg->set_pld_status(static_cast<PldStatus>(status));
+        status_msg->set_queued_missions(queue.queued_missions);
+        status_msg->set_planned_missions(queue.planned_missions);
+        status_msg->set_last_mission_latency_ms(queue.last_mission_latency_ms);
+        status_msg->set_mission_id(mission_id);
 
-        return true;
+        return Server::serialize_payload(wrapper, message);
+    }
+
+    Struct_Planner::Status decode_status_planner(const Status &msg)
+    {
+        if (msg.has_planner_status()) {
+            return static_cast<Struct_Planner::Status>(msg.planner_status());
+        }
+        return Struct_Planner::to_enum(msg.type_status());
     }
 
     bool encode_config_mission(const Structs_PLD::Config_mission &config, std::string &message)
@@ -192,16 +204,18 @@ namespace Enc_Dec_PLD {
         if (!Enc_Dec_Planner::encode_config_message(
             config.planner_info.signal_server_configs,
             config.planner_info.dron_data,
+            0,
+            false,
             planner_msg_str)) {
             return false;
         }
 
-        PlannerMessage planner_msg;
-        if (!planner_msg.ParseFromString(planner_msg_str.substr(4))) {
+        Wrapper planner_wrapper;
+        if (!planner_wrapper.ParseFromString(planner_msg_str) || !planner_wrapper.has_planner_message()) {
             return false;
         }
         
-        config_msg->mutable_planner_config()->CopyFrom(planner_msg);
+        config_msg->mutable_planner_config()->Swap(planner_wrapper.mutable_planner_message());
 
         Info_Module* info_planner = config_msg->mutable_info_planner();
         info_planner->set_docker_name(config.planner_module_data.docker_name);
@@ -222,20 +236,9 @@ namespace Enc_Dec_PLD {
         info_drone->set_key(config.drone_module_data.key);
 
         config_msg->set_drone_sim(config.drone_sim);
+        config_msg->set_mission_id(config.mission_id);
 
-        std::string serialized_data;
-        if (!wrapper.SerializeToString(&serialized_data))
-            return false;
-
-        uint32_t size = boost::asio::detail::socket_ops::host_to_network_long(
-            static_cast<uint32_t>(serialized_data.size())
-        );
-
-        message.resize(4);
-        std::memcpy(message.data(), &size, 4);
-        message += serialized_data;
-
-        return true;
+        return Server::serialize_payload(wrapper, message);
     }
 
     bool decode_config_mission(const Config_mission &proto, Structs_PLD::Config_mission &config)
@@ -271,27 +274,21 @@ namespace Enc_Dec_PLD {
         config.drone_module_data.key = info_drone.key();
 
         config.drone_sim = proto.drone_sim();
+        config.mission_id = proto.mission_id();
 
         return true;
     }
 
-    std::string to_string(PLD state)
+    bool mission_id_of(const From_Client &message, std::string &mission_id)
     {
-        if (state == PLD::Planner_RESPONSE) {
-            return "Planner_RESPONSE";
-        } else if (state == PLD::STATUS_Planner) {
-            return "STATUS_Planner";
-        } else if (state == PLD::STATUS_DRONE) {
-            return "STATUS_DRONE";
-        } else if (state == PLD::CONFIG_MISSION) {
-            return "CONFIG_MISSION";
-        } else if (state == PLD::COMMAND) {
-            return "MESSAGE";
-        } else if (state == PLD::ERROR) {
-            return "ERROR";
-        } else {
-            return "UNKNOWN";
+        if (const auto *config = std::get_if<Config_mission>(&message)) {
+            mission_id = config->mission_id();
+            return true;
+        }
+        if (const auto *command = std::get_if<Command>(&message)) {
+            mission_id = command->mission_id();
+            return true;
         }
+        return false;
     }
-
 };
\ No newline at end of file
@@ -9,33 +9,32 @@
  * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 #pragma once
 #include "generated_proto/messages_pld.pb.h"
+#include "Decoded_Message.h"
 #include "structs/Structs_Planner.h"
 #include "structs/Structs_PLD.h"
 #include <string>
+#include <string_view>
 namespace Enc_Dec_PLD {
 
-    enum class PLD {
-        UNKNOWN,
-        ERROR,
-        Planner_RESPONSE,
-        STATUS_Planner,
-        STATUS_DRONE,
-        CONFIG_MISSION,
-        COMMAND
-    };
+    using From_Planner = Decoded<PlannerResponseList, Status, PlannerRoute>;
+    using From_Drone = Decoded<Status>;
+    using From_Client = Decoded<Config_mission, Command>;
 
-    std::pair<PLD, std::unique_ptr<google::protobuf::Message>> decode_from_planner(const std::string& data);
-    std::pair<PLD, std::unique_ptr<google::protobuf::Message>> decode_from_drone(const std::string& data);
-    std::pair<PLD, std::unique_ptr<google::protobuf::Message>> decode_from_client(const std::string& data);
+    From_Planner decode_from_planner(std::string_view data);
+    From_Drone decode_from_drone(std::string_view data);
+    From_Client decode_from_client(std::string_view data);
 
-    bool encode_planner_response(const std::vector<std::vector<Struct_Planner::Coordinate>> &result, std::string &msg);
+    bool encode_planner_response(const std::vector<std::vector<Struct_Planner::Coordinate>> &result, uint64_t request_id, bool compact, std::string &msg);
     bool decode_planner_response(const PlannerResponseList &msg, std::vector<std::vector<Struct_Planner::Coordinate>> &result);
+    bool encode_planner_route(const std::vector<Struct_Planner::Coordinate> &route, uint32_t drone, uint64_t request_id, bool compact, std::string &msg);
+    bool encode_planner_routes_streamed(uint32_t routes, uint64_t request_id, std::string &msg); // Completion marker after the routes
+    bool decode_planner_route(const PlannerResponse &msg, std::vector<Struct_Planner::Coordinate> &route);
     
-    bool encode_status_planner(const Struct_Planner::Status &status, std::string &message);
-    bool encode_status_pld(const Structs_PLD::Status &status, std::string &message);
+    Struct_Planner::Status decode_status_planner(const Status &msg);
+    bool encode_status_planner(const Struct_Planner::Status &status, uint64_t request_id, const std::string &profile, std::string &message);
+    bool encode_status_pld(const Structs_PLD::Status &status, const Structs_PLD::Queue_status &queue, const std::string &mission_id, std::string &message);
+    bool mission_id_of(const From_Client &message, std::string &mission_id); // Mission a Client message is addressed to
 
     bool encode_config_mission(const Structs_PLD::Config_mission &config, std::string &message);
     bool decode_config_mission(const Config_mission &proto, Structs_PLD::Config_mission &config);
-
-    std::string to_string(PLD state);
 };
\ No newline at end of file
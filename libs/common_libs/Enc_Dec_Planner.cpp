@@ -8,13 +8,31 @@
  * ============================================================
  * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 #include "Enc_Dec_Planner.h"
-#include <boost/asio/detail/socket_ops.hpp>
+#include "Server.h"
 #include "structs/Structs_Planner.h"
+#include <cmath>
+#include <limits>
 
 namespace {
-void fill_drone_data_proto(const Struct_Planner::DroneData& drone_msg, DroneData& dron_proto)
+constexpr double COORDINATE_E7_SCALE = 1e7;
+constexpr double COORDINATE_MAX_DEG = 180.0;
+
+bool to_e7(double degrees, int64_t &e7)
+{
+    if (!std::isfinite(degrees) || std::abs(degrees) > COORDINATE_MAX_DEG)
+        return false;
+    e7 = std::llround(degrees * COORDINATE_E7_SCALE);
+    return true;
+}
+
+void fill_drone_data_proto(const Struct_Planner::DroneData& drone_msg, bool compact_targets, DroneData& dron_proto)
 {
     dron_proto.set_num_drones(drone_msg.num_drones);
+    if (compact_targets &&
+        Enc_Dec_Planner::encode_compact_coordinates(drone_msg.pos_targets, *dron_proto.mutable_lon_e7_delta(), *dron_proto.mutable_lat_e7_delta())) {
+        return;
+    }
+
     for (const auto& each : drone_msg.pos_targets) {
         dron_proto.add_lon(each.lon);
         dron_proto.add_lat(each.lat);
@@ -111,57 +129,52 @@ void decode_signal_options_and_coverage(const SignalServerConfigProto& protoMsg,
 }
 
 namespace Enc_Dec_Planner {
-    std::pair<Planner, std::unique_ptr<google::protobuf::Message>> decode_to_planner(const std::string& data)
+    To_Planner decode_to_planner(std::string_view data)
     {
         Wrapper wrapper;
-        if (!wrapper.ParseFromString(data)) {
-            return {Planner::UNKNOWN, nullptr};
+        if (!wrapper.ParseFromArray(data.data(), static_cast<int>(data.size()))) {
+            return Decode_Error{};
         }
 
-        if (wrapper.has_planner_message()) {
-            auto msg = std::make_unique<PlannerMessage>(wrapper.planner_message());
-            return {Planner::ConfigMessage, std::move(msg)};
+        switch (wrapper.payload_case()) {
+            case Wrapper::kPlannerMessage:
+                return std::move(*wrapper.mutable_planner_message());
+            case Wrapper::kCancelMessage:
+                return std::move(*wrapper.mutable_cancel_message());
+            default:
+                return Unknown_Message{};
         }
-
-        return {Planner::UNKNOWN, nullptr};
     }
         
-    bool encode_config_message(const std::vector<Struct_Planner::SignalServerConfig>& signal_msgs, const Struct_Planner::DroneData& drone_msg, std::string &data) 
+    bool encode_config_message(const std::vector<Struct_Planner::SignalServerConfig>& signal_msgs, const Struct_Planner::DroneData& drone_msg, uint64_t request_id, bool compact_targets, std::string &data) 
     {
         if (signal_msgs.empty()) {
             return false;
         }
 
-        DroneData dron_proto;
-        fill_drone_data_proto(drone_msg, dron_proto);
-
-        PlannerMessage complete_mst;
+        Wrapper wrapper;
+        PlannerMessage* complete_mst = wrapper.mutable_planner_message();
         for (const auto& signal_msg : signal_msgs) {
-            auto* protoMsg = complete_mst.add_signal_server_config();
+            auto* protoMsg = complete_mst->add_signal_server_config();
             fill_signal_server_proto(signal_msg, *protoMsg);
         }
 
-        *(complete_mst.mutable_drone_data()) = dron_proto;
+        fill_drone_data_proto(drone_msg, compact_targets, *complete_mst->mutable_drone_data());
+        complete_mst->set_request_id(request_id);
+        complete_mst->set_compact_response(true);
+        complete_mst->set_stream_routes(true);
 
-        Wrapper wrapper;
-        *(wrapper.mutable_planner_message()) = complete_mst;
-
-        std::string serialized_data;
-        if (!wrapper.SerializeToString(&serialized_data))
-            return false;
-
-        uint32_t size = boost::asio::detail::socket_ops::host_to_network_long(
-            static_cast<uint32_t>(serialized_data.size())
-        );
+        return Server::serialize_payload(wrapper, data);
+    }
 
-        data.resize(4);
-        std::memcpy(data.data(), &size, 4);
-        data += serialized_data;
+    bool encode_cancel_message(uint64_t request_id, std::string &data)
+    {
+        Wrapper wrapper;
+        wrapper.mutable_cancel_message()->set_request_id(request_id);
 
-        return true;
+        return Server::serialize_payload(wrapper, data);
     }
 
-
     bool decode_signal_server(const SignalServerConfigProto& protoMsg, Struct_Planner::SignalServerConfig &msg) 
     {
         try {
@@ -194,6 +207,9 @@ namespace Enc_Dec_Planner {
     {
         msg.num_drones = protoMsg.num_drones();
         msg.pos_targets.clear();
+        if (protoMsg.lon_e7_delta_size() > 0) {
+            return decode_compact_coordinates(protoMsg.lon_e7_delta(), protoMsg.lat_e7_delta(), msg.pos_targets);
+        }
         for (int i = 0; i < protoMsg.lon().size(); ++i) {
             if (i >= protoMsg.lat().size())
                 return false;
@@ -202,4 +218,52 @@ namespace Enc_Dec_Planner {
         }
         return true;
     }
+
+    bool encode_compact_coordinates(const std::vector<Struct_Planner::Coordinate> &coords,
+                                    google::protobuf::RepeatedField<int32_t> &lon_e7_delta,
+                                    google::protobuf::RepeatedField<int32_t> &lat_e7_delta)
+    {
+        lon_e7_delta.Clear();
+        lat_e7_delta.Clear();
+        lon_e7_delta.Reserve(static_cast<int>(coords.size()));
+        lat_e7_delta.Reserve(static_cast<int>(coords.size()));
+
+        int64_t prev_lon = 0;
+        int64_t prev_lat = 0;
+        for (const auto &coord : coords) {
+            int64_t lon = 0;
+            int64_t lat = 0;
+            if (!to_e7(coord.lon, lon) || !to_e7(coord.lat, lat) ||
+                std::abs(lon - prev_lon) > std::numeric_limits<int32_t>::max() ||
+                std::abs(lat - prev_lat) > std::numeric_limits<int32_t>::max()) {
+                lon_e7_delta.Clear();
+                lat_e7_delta.Clear();
+                return false;
+            }
+            lon_e7_delta.AddAlreadyReserved(static_cast<int32_t>(lon - prev_lon));
+            lat_e7_delta.AddAlreadyReserved(static_cast<int32_t>(lat - prev_lat));
+            prev_lon = lon;
+            prev_lat = lat;
+        }
+        return true;
+    }
+
+    bool decode_compact_coordinates(const google::protobuf::RepeatedField<int32_t> &lon_e7_delta,
+                                    const google::protobuf::RepeatedField<int32_t> &lat_e7_delta,
+                                    std::vector<Struct_Planner::Coordinate> &coords)
+    {
+        if (lon_e7_delta.size() != lat_e7_delta.size())
+            return false;
+
+        coords.clear();
+        coords.reserve(static_cast<size_t>(lon_e7_delta.size()));
+        int64_t lon = 0;
+        int64_t lat = 0;
+        for (int i = 0; i < lon_e7_delta.size(); ++i) {
+            lon += lon_e7_delta.Get(i);
+            lat += lat_e7_delta.Get(i);
+            coords.emplace_back(static_cast<double>(lon) / COORDINATE_E7_SCALE, static_cast<double>(lat) / COORDINATE_E7_SCALE);
+        }
+        return true;
+    }
 };
\ No newline at end of file
@@ -9,21 +9,29 @@
  * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 #pragma once
 #include "generated_proto/messages_planner.pb.h"
+#include "Decoded_Message.h"
 #include "structs/Structs_Planner.h"
 #include <string>
+#include <string_view>
 
 namespace Enc_Dec_Planner {
 
-    enum class Planner {
-        UNKNOWN,
-        ERROR,
-        ConfigMessage,
-    };
-    
-    std::pair<Planner, std::unique_ptr<google::protobuf::Message>> decode_to_planner(const std::string& data);
+    using To_Planner = Decoded<PlannerMessage, CancelMessage>;
+
+    To_Planner decode_to_planner(std::string_view data);
     
-    bool encode_config_message(const std::vector<Struct_Planner::SignalServerConfig>& msg, const Struct_Planner::DroneData& drone_msg, std::string &data);
+    bool encode_config_message(const std::vector<Struct_Planner::SignalServerConfig>& msg, const Struct_Planner::DroneData& drone_msg, uint64_t request_id, bool compact_targets, std::string &data);
+    bool encode_cancel_message(uint64_t request_id, std::string &data);
     bool decode_signal_server(const SignalServerConfigProto& protoMsg, Struct_Planner::SignalServerConfig &msg);
     bool decode_signal_server_list(const PlannerMessage& planner_msg, std::vector<Struct_Planner::SignalServerConfig> &msgs);
     bool decode_drone_data(const DroneData& protoMsg, Struct_Planner::DroneData &msg);
+
+    // Compact coordinates: 1e-7 degree fixed point, each point as the delta from the previous one (sint32, zigzag varint).
+    // Encoding fails, leaving the fields empty, when a coordinate or a delta does not fit so callers can fall back to doubles
+    bool encode_compact_coordinates(const std::vector<Struct_Planner::Coordinate> &coords,
+                                    google::protobuf::RepeatedField<int32_t> &lon_e7_delta,
+                                    google::protobuf::RepeatedField<int32_t> &lat_e7_delta);
+    bool decode_compact_coordinates(const google::protobuf::RepeatedField<int32_t> &lon_e7_delta,
+                                    const google::protobuf::RepeatedField<int32_t> &lat_e7_delta,
+                                    std::vector<Struct_Planner::Coordinate> &coords);
 };
\ No newline at end of file
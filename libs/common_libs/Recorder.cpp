@@ -22,7 +22,7 @@ Recorder::~Recorder()
 
 bool Recorder::write(const std::string& text)
 {
-
+    std::lock_guard<std::mutex> lock(mutex_);
     if (!is_open() && !open_file()) {
         return false;
     }
@@ -33,6 +33,7 @@ bool Recorder::write(const std::string& text)
 
 void Recorder::close()
 {
+    std::lock_guard<std::mutex> lock(mutex_);
     if (is_open()) {
         file_.flush();
         file_.close();
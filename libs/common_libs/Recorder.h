@@ -11,6 +11,7 @@
 #include <string>
 #include <filesystem>
 #include <fstream>
+#include <mutex>
 
 class Recorder {
 
@@ -25,6 +26,7 @@ public:
 private:
     std::filesystem::path filename_;
     std::ofstream file_;
+    std::mutex mutex_; // The log is written from every thread running the io_context
 
     bool is_open();
     bool open_file();
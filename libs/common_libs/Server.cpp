@@ -8,15 +8,183 @@
  * ============================================================
  * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 #include "Server.h"
+#include <random>
+
+#ifdef IDRONE_WITH_LZ4
+#include <lz4.h>
+#endif
+#ifdef IDRONE_WITH_ZSTD
+#include <zstd.h>
+#endif
+
+constexpr size_t WRITE_HIGH_WATER_BYTES = 8 * 1024 * 1024;   // Backpressure is notified above this
+constexpr size_t WRITE_LOW_WATER_BYTES = 2 * 1024 * 1024;    // and cleared again below this
+constexpr size_t WRITE_MAX_QUEUED_BYTES = 64 * 1024 * 1024;  // Frames beyond this are rejected
+constexpr size_t WRITE_MAX_FRAMES_PER_GATHER = 64;
+constexpr size_t READ_CHUNK_BYTES = 64 * 1024;
+constexpr size_t DEFAULT_MAX_FRAME_BYTES = 64 * 1024 * 1024; // A corrupt length prefix must not trigger a huge allocation
+constexpr size_t FRAME_HEADER_BYTES = 4;
+constexpr int HELLO_TIMEOUT_MS = 3000; // Reliable delivery holds data frames until the peer's HELLO arrives
+
+// The two high bits of the length prefix carry the frame kind; legacy frames leave them at zero.
+// Compressed payloads start with their 4-byte big-endian uncompressed size
+constexpr uint32_t FRAME_KIND_SHIFT = 30;
+constexpr uint32_t FRAME_SIZE_MASK = (1u << FRAME_KIND_SHIFT) - 1;
+constexpr uint32_t FRAME_KIND_RAW = 0;      // Values 1 and 2 match Server::Compression
+constexpr uint32_t FRAME_KIND_CONTROL = 3;  // Handled by the framing layer, never passed to call_message
+constexpr uint8_t CONTROL_HELLO = 1;        // Followed by one byte with the codecs the sender can decompress
+constexpr uint8_t CONTROL_ACK = 2;          // Followed by the last sequence number delivered to the receiver
+constexpr int ZSTD_LEVEL = 3;
+
+// With reliable delivery on both ends every data frame payload starts with its 8-byte big-endian sequence
+// number. The HELLO then also carries [flags][own session][peer session as last seen][last sequence received
+// from it], so a reconnecting peer learns where to resume
+constexpr size_t SEQ_BYTES = 8;
+constexpr uint8_t HELLO_FLAG_SEQUENCED = 1;
+constexpr size_t HELLO_SEQUENCED_BYTES = 3 + 3 * SEQ_BYTES;
+
+namespace {
+constexpr uint8_t codec_bit(Server::Compression codec)
+{
+    return static_cast<uint8_t>(1u << static_cast<uint8_t>(codec));
+}
+
+constexpr uint8_t SUPPORTED_CODECS = 0
+#ifdef IDRONE_WITH_LZ4
+    | codec_bit(Server::Compression::LZ4)
+#endif
+#ifdef IDRONE_WITH_ZSTD
+    | codec_bit(Server::Compression::ZSTD)
+#endif
+    ;
+
+uint32_t frame_header(uint32_t kind, size_t payload_size)
+{
+    return htonl((kind << FRAME_KIND_SHIFT) | static_cast<uint32_t>(payload_size));
+}
+
+void put_u64(unsigned char *dst, uint64_t value)
+{
+    for (size_t i = 0; i < SEQ_BYTES; ++i) {
+        dst[i] = static_cast<unsigned char>(value >> (8 * (SEQ_BYTES - 1 - i)));
+    }
+}
+
+uint64_t get_u64(const char *src)
+{
+    uint64_t value = 0;
+    for (size_t i = 0; i < SEQ_BYTES; ++i) {
+        value = (value << 8) | static_cast<unsigned char>(src[i]);
+    }
+    return value;
+}
+
+uint64_t new_session_id()
+{
+    std::random_device rd;
+    const uint64_t id = (static_cast<uint64_t>(rd()) << 32) | rd();
+    return id != 0 ? id : 1; // 0 means "no session"
+}
+
+bool compress_payload(Server::Compression codec, const std::string &raw, std::string &out)
+{
+    size_t bound = 0;
+    switch (codec) {
+#ifdef IDRONE_WITH_LZ4
+        case Server::Compression::LZ4:
+            bound = static_cast<size_t>(LZ4_compressBound(static_cast<int>(raw.size())));
+            break;
+#endif
+#ifdef IDRONE_WITH_ZSTD
+        case Server::Compression::ZSTD:
+            bound = ZSTD_compressBound(raw.size());
+            break;
+#endif
+        default:
+            return false;
+    }
+
+    out.resize(FRAME_HEADER_BYTES + bound);
+    const uint32_t raw_size = htonl(static_cast<uint32_t>(raw.size()));
+    std::memcpy(out.data(), &raw_size, FRAME_HEADER_BYTES);
+    [[maybe_unused]] char *dst = out.data() + FRAME_HEADER_BYTES;
+
+    size_t written = 0;
+    switch (codec) {
+#ifdef IDRONE_WITH_LZ4
+        case Server::Compression::LZ4: {
+            const int n = LZ4_compress_default(raw.data(), dst, static_cast<int>(raw.size()), static_cast<int>(bound));
+            if (n <= 0)
+                return false;
+            written = static_cast<size_t>(n);
+            break;
+        }
+#endif
+#ifdef IDRONE_WITH_ZSTD
+        case Server::Compression::ZSTD:
+            written = ZSTD_compress(dst, bound, raw.data(), raw.size(), ZSTD_LEVEL);
+            if (ZSTD_isError(written))
+                return false;
+            break;
+#endif
+        default:
+            return false;
+    }
+
+    out.resize(FRAME_HEADER_BYTES + written);
+    return true;
+}
+
+bool decompress_payload(uint32_t kind, std::string_view wire, size_t max_raw_bytes, std::string &out)
+{
+    if (wire.size() < FRAME_HEADER_BYTES)
+        return false;
+
+    uint32_t raw_size = 0;
+    std::memcpy(&raw_size, wire.data(), FRAME_HEADER_BYTES);
+    raw_size = ntohl(raw_size);
+    if (raw_size > max_raw_bytes)
+        return false;
 
+    out.resize(raw_size);
+    const char *src = wire.data() + FRAME_HEADER_BYTES;
+    const size_t src_size = wire.size() - FRAME_HEADER_BYTES;
+
+    switch (kind) {
+#ifdef IDRONE_WITH_LZ4
+        case static_cast<uint32_t>(Server::Compression::LZ4):
+            return LZ4_decompress_safe(src, out.data(), static_cast<int>(src_size), static_cast<int>(raw_size)) == static_cast<int>(raw_size);
+#endif
+#ifdef IDRONE_WITH_ZSTD
+        case static_cast<uint32_t>(Server::Compression::ZSTD): {
+            const size_t n = ZSTD_decompress(out.data(), raw_size, src, src_size);
+            return !ZSTD_isError(n) && n == raw_size;
+        }
+#endif
+        default:
+            (void)src;
+            (void)src_size;
+            return false;
+    }
+}
+}
 
 Server::Server(boost::asio::io_context& io_context)
-        : io_context_(io_context), acceptor_(io_context)
+        : io_context_(io_context), socket_executor_(io_context.get_executor()), acceptor_(io_context), max_frame_bytes_(DEFAULT_MAX_FRAME_BYTES),
+          session_id_(new_session_id()), write_strand_(boost::asio::make_strand(io_context)), hello_timer_(write_strand_)
 {
 }
 
 Server::Server(boost::asio::io_context& io_context,  const handlers &handlers)
-        : io_context_(io_context), acceptor_(io_context), handlers_(handlers)
+        : io_context_(io_context), socket_executor_(io_context.get_executor()), acceptor_(io_context), handlers_(handlers), max_frame_bytes_(DEFAULT_MAX_FRAME_BYTES),
+          session_id_(new_session_id()), write_strand_(boost::asio::make_strand(io_context)), hello_timer_(write_strand_)
+{
+}
+
+Server::Server(boost::asio::io_context& io_context, const io_strand &strand)
+        : io_context_(io_context), socket_executor_(strand), acceptor_(strand), max_frame_bytes_(DEFAULT_MAX_FRAME_BYTES),
+          session_id_(new_session_id()), write_strand_(strand), // Writes share it too, so no handler runs outside it
+          hello_timer_(strand)
 {
 }
 
@@ -98,11 +266,14 @@ void Server::on_accept(const boost::system::error_code& error, const std::shared
         return;
     }
 
+    peer_codecs_ = 0;
+    peer_sequenced_ = false;
     if (handlers_.call_connect) {
         handlers_.call_connect();
     }
 
     current_client_ = new_socket;
+    start_hello_timer(current_client_);
     start_read(current_client_);
 }
 
@@ -124,7 +295,7 @@ void Server::start_listening(const tcp::endpoint& endpoint)
         is_listening_ = true;
     }
 
-    auto new_socket = std::make_shared<tcp::socket>(io_context_);
+    auto new_socket = std::make_shared<tcp::socket>(socket_executor_);
     start_async_accept(new_socket);
 }
 
@@ -134,84 +305,610 @@ void Server::accept_new_connection()
         return;
     }
 
-    auto new_socket = std::make_shared<tcp::socket>(io_context_);
+    auto new_socket = std::make_shared<tcp::socket>(socket_executor_);
     start_async_accept(new_socket);
 }
 
-void Server::handle_read_message(
+void Server::set_max_frame_size(size_t max_frame_bytes)
+{
+    max_frame_bytes_ = std::min<size_t>(max_frame_bytes, FRAME_SIZE_MASK);
+}
+
+void Server::set_compression(Compression codec, size_t threshold_bytes)
+{
+    compression_ = codec;
+    compression_threshold_ = threshold_bytes;
+    if (codec != Compression::NONE && !(SUPPORTED_CODECS & codec_bit(codec))) {
+        compression_ = Compression::NONE; // Not built in, frames are sent raw
+    }
+}
+
+void Server::set_reliable_delivery(size_t window_frames)
+{
+    reliable_window_ = window_frames;
+}
+
+Server::Compression_Stats Server::compression_stats() const
+{
+    Compression_Stats stats;
+    stats.frames_sent = counters_.frames_sent;
+    stats.compressed_frames_sent = counters_.compressed_frames_sent;
+    stats.payload_bytes_sent = counters_.payload_bytes_sent;
+    stats.wire_bytes_sent = counters_.wire_bytes_sent;
+    stats.frames_received = counters_.frames_received;
+    stats.compressed_frames_received = counters_.compressed_frames_received;
+    stats.payload_bytes_received = counters_.payload_bytes_received;
+    stats.wire_bytes_received = counters_.wire_bytes_received;
+    return stats;
+}
+
+void Server::start_read(std::shared_ptr<tcp::socket> socket)
+{
+    auto buffer = std::make_shared<Read_Buffer>();
+    buffer->data.resize(READ_CHUNK_BYTES);
+    read_some(std::move(socket), std::move(buffer));
+}
+
+void Server::read_some(std::shared_ptr<tcp::socket> socket, std::shared_ptr<Read_Buffer> buffer)
+{
+    auto &buf = *buffer;
+    socket->async_read_some(boost::asio::buffer(buf.data.data() + buf.end, buf.data.size() - buf.end),
+        [this, socket, buffer](const boost::system::error_code& ec, std::size_t bytes_read) {
+            handle_read(socket, buffer, ec, bytes_read);
+        });
+}
+
+void Server::handle_read(
     std::shared_ptr<tcp::socket> socket,
-    std::shared_ptr<std::vector<char>> data_buf,
-    const boost::system::error_code& ec)
+    std::shared_ptr<Read_Buffer> buffer,
+    const boost::system::error_code& ec,
+    std::size_t bytes_read)
 {
     if (ec) {
         if (handlers_.call_error) handlers_.call_error(ec, Type_Error::READING);
         return;
     }
 
-    if (handlers_.call_message) {
-        handlers_.call_message(std::string(data_buf->data(), data_buf->size()));
+    buffer->end += bytes_read;
+    if (!dispatch_frames(socket, *buffer)) {
+        return;
     }
 
-    // Read next message
-    start_read(socket);
+    prepare_read_buffer(*buffer);
+    read_some(std::move(socket), std::move(buffer));
 }
 
-void Server::start_read(std::shared_ptr<tcp::socket> socket)
+bool Server::dispatch_frames(const std::shared_ptr<tcp::socket> &socket, Read_Buffer &buffer)
 {
-    auto length_buf = std::make_shared<std::array<char, 4>>();
+    // A single read may hold several frames; each payload is handed over in place
+    bool ack_pending = false;
+    while (buffer.end - buffer.begin >= FRAME_HEADER_BYTES) {
+        uint32_t header = 0;
+        std::memcpy(&header, buffer.data.data() + buffer.begin, FRAME_HEADER_BYTES);
+        header = ntohl(header);
+        const uint32_t kind = header >> FRAME_KIND_SHIFT;
+        const uint32_t msg_size = header & FRAME_SIZE_MASK;
+
+        if (msg_size > max_frame_bytes_) {
+            close_on_read_error(socket, boost::asio::error::message_size);
+            return false;
+        }
 
-    // Read the first 4 bytes (message length)
-    boost::asio::async_read(*socket, boost::asio::buffer(*length_buf),
-        [this, socket, length_buf](const boost::system::error_code& ec, std::size_t) {
-            if (ec) {
-                if (handlers_.call_error) handlers_.call_error(ec, Type_Error::READING);
-                return;
+        if (buffer.end - buffer.begin < FRAME_HEADER_BYTES + msg_size) {
+            break;
+        }
+
+        std::string_view payload(buffer.data.data() + buffer.begin + FRAME_HEADER_BYTES, msg_size);
+        buffer.begin += FRAME_HEADER_BYTES + msg_size;
+
+        if (kind == FRAME_KIND_CONTROL) {
+            handle_control_frame(socket, payload);
+            continue;
+        }
+
+        counters_.frames_received++;
+        counters_.wire_bytes_received += msg_size;
+
+        if (peer_sequenced_) {
+            if (payload.size() < SEQ_BYTES) {
+                close_on_read_error(socket, boost::asio::error::invalid_argument);
+                return false;
+            }
+            const uint64_t seq = get_u64(payload.data());
+            payload.remove_prefix(SEQ_BYTES);
+            ack_pending = true;
+            if (seq <= recv_seq_) {
+                continue; // Sent again after a reconnect, but already delivered
+            }
+            recv_seq_ = seq;
+        }
+
+        if (kind != FRAME_KIND_RAW) {
+            if (!decompress_payload(kind, payload, max_frame_bytes_, buffer.inflated)) {
+                close_on_read_error(socket, boost::asio::error::invalid_argument);
+                return false;
             }
+            payload = buffer.inflated;
+            counters_.compressed_frames_received++;
+        }
+        counters_.payload_bytes_received += payload.size();
+
+        if (handlers_.call_message) {
+            handlers_.call_message(payload);
+        }
+
+        // The handler may have closed this connection (e.g. on a state transition)
+        if (!socket->is_open()) {
+            return false;
+        }
+    }
+
+    // One cumulative acknowledgement per read
+    if (ack_pending) {
+        send_ack(recv_seq_);
+    }
+    return true;
+}
+
+void Server::close_on_read_error(const std::shared_ptr<tcp::socket> &socket, const boost::system::error_code &ec)
+{
+    boost::system::error_code ignored;
+    socket->shutdown(tcp::socket::shutdown_both, ignored);
+    socket->close(ignored);
+    if (handlers_.call_error) handlers_.call_error(ec, Type_Error::READING);
+}
 
-            // Decode message length
-            uint32_t msg_size = 0;
-            std::memcpy(&msg_size, length_buf->data(), 4);
-            msg_size = ntohl(msg_size);
+void Server::handle_control_frame(const std::shared_ptr<tcp::socket> &socket, std::string_view payload)
+{
+    if (payload.empty()) {
+        return;
+    }
 
-            auto data_buf = std::make_shared<std::vector<char>>(msg_size);
+    const auto type = static_cast<uint8_t>(payload[0]);
+    if (type == CONTROL_ACK && payload.size() >= 1 + SEQ_BYTES) {
+        const uint64_t seq = get_u64(payload.data() + 1);
+        boost::asio::post(write_strand_, [this, seq]() {
+            on_peer_ack(seq);
+        });
+        return;
+    }
 
-            // Read the exact length of the message
-            boost::asio::async_read(*socket, boost::asio::buffer(*data_buf),
-                [this, socket, data_buf](const boost::system::error_code& read_ec, std::size_t) {
-                    handle_read_message(socket, data_buf, read_ec);
-                });
+    if (type != CONTROL_HELLO || payload.size() < 2) {
+        return; // Unknown control frames are ignored so the protocol can grow
+    }
+
+    peer_codecs_ = static_cast<uint8_t>(payload[1]) & SUPPORTED_CODECS;
+
+    // Frames are only sequenced when both ends asked for it; older peers send the codecs byte alone
+    bool sequenced = false;
+    bool knows_session = false;
+    uint64_t received = 0;
+    if (reliable_window_ > 0 && payload.size() >= HELLO_SEQUENCED_BYTES && (static_cast<uint8_t>(payload[2]) & HELLO_FLAG_SEQUENCED)) {
+        sequenced = true;
+        const uint64_t peer_session = get_u64(payload.data() + 3);
+        knows_session = get_u64(payload.data() + 3 + SEQ_BYTES) == session_id_;
+        received = get_u64(payload.data() + 3 + 2 * SEQ_BYTES);
+        if (peer_session != recv_session_) { // A different peer process, its numbering starts over
+            recv_session_ = peer_session;
+            recv_seq_ = 0;
+        }
+    }
+    peer_sequenced_ = sequenced;
+
+    // The connecting side opens the handshake; a listening side only answers peers that ask,
+    // so clients without compression support never see a control frame
+    if (is_listening_) {
+        send_hello();
+    }
+
+    if (reliable_window_ > 0) {
+        boost::asio::post(write_strand_, [this, socket, sequenced, knows_session, received]() {
+            on_peer_hello(socket, sequenced, knows_session, received);
         });
+    }
+}
+
+void Server::prepare_read_buffer(Read_Buffer &buffer) const
+{
+    if (buffer.begin == buffer.end) {
+        buffer.begin = 0;
+        buffer.end = 0;
+        if (buffer.data.size() > READ_CHUNK_BYTES) { // Give back the room taken by a large frame
+            buffer.data.resize(READ_CHUNK_BYTES);
+            buffer.data.shrink_to_fit();
+        }
+        if (buffer.inflated.capacity() > READ_CHUNK_BYTES) {
+            std::string().swap(buffer.inflated);
+        }
+        return;
+    }
+
+    // Move the partial frame to the front and make room for the rest of it
+    if (buffer.begin > 0) {
+        std::memmove(buffer.data.data(), buffer.data.data() + buffer.begin, buffer.end - buffer.begin);
+        buffer.end -= buffer.begin;
+        buffer.begin = 0;
+    }
+
+    if (buffer.end >= FRAME_HEADER_BYTES) {
+        uint32_t msg_size = 0;
+        std::memcpy(&msg_size, buffer.data.data(), FRAME_HEADER_BYTES);
+        const size_t frame_size = FRAME_HEADER_BYTES + (ntohl(msg_size) & FRAME_SIZE_MASK);
+        if (frame_size > buffer.data.size()) {
+            buffer.data.resize(frame_size);
+        }
+    }
 }
 
 void Server::connect(const tcp::endpoint& endpoint)
 {
-    current_client_ = std::make_shared<tcp::socket>(io_context_);
+    current_client_ = std::make_shared<tcp::socket>(socket_executor_);
 
     current_client_->async_connect(endpoint,
         [this](const boost::system::error_code& ec) {
             if (ec) {
                 if (handlers_.call_error) handlers_.call_error(ec, Type_Error::CONNECTING);
             } else {
+                peer_codecs_ = 0;
+                peer_sequenced_ = false;
+                send_hello(); // Queued before anything the connect handler sends
+                start_hello_timer(current_client_);
                 if (handlers_.call_connect) handlers_.call_connect();
                 start_read(current_client_);
             }
         });
 }
 
-void Server::deliver(const std::string &message) const
+void Server::deliver(std::string message)
+{
+    // Safe from any thread: compression runs on the caller's thread, then the frame is queued
+    // on the write strand and written in order
+    boost::asio::post(write_strand_, [this, frame = make_frame(std::move(message))]() mutable {
+        enqueue_frame(std::move(frame));
+    });
+}
+
+Server::Outbound_Frame Server::make_frame(std::string message) const
+{
+    // Single framing layer: 4-byte big-endian header (frame kind and length) followed by the payload.
+    // The queue owns the payload until the write completes, so callers can move temporaries in
+    Outbound_Frame frame;
+    frame.raw_bytes = message.size();
+    uint32_t kind = FRAME_KIND_RAW;
+
+    if (compression_ != Compression::NONE && message.size() >= compression_threshold_ &&
+        (peer_codecs_ & codec_bit(compression_))) {
+        std::string compressed;
+        if (compress_payload(compression_, message, compressed) && compressed.size() < message.size()) {
+            message = std::move(compressed);
+            kind = static_cast<uint32_t>(compression_);
+        }
+    }
+
+    frame.len = frame_header(kind, message.size());
+    frame.payload = std::make_shared<const std::string>(std::move(message));
+    return frame;
+}
+
+void Server::send_hello()
+{
+    std::string payload(HELLO_SEQUENCED_BYTES, '\0');
+    payload[0] = static_cast<char>(CONTROL_HELLO);
+    payload[1] = static_cast<char>(SUPPORTED_CODECS);
+    payload[2] = static_cast<char>(reliable_window_ > 0 ? HELLO_FLAG_SEQUENCED : 0);
+    auto *fields = reinterpret_cast<unsigned char *>(payload.data() + 3);
+    put_u64(fields, session_id_);
+    put_u64(fields + SEQ_BYTES, recv_session_);
+    put_u64(fields + 2 * SEQ_BYTES, recv_seq_);
+
+    Outbound_Frame frame;
+    frame.len = frame_header(FRAME_KIND_CONTROL, payload.size());
+    frame.payload = std::make_shared<const std::string>(std::move(payload));
+    boost::asio::post(write_strand_, [this, frame = std::move(frame)]() mutable {
+        enqueue_frame(std::move(frame));
+    });
+}
+
+void Server::send_ack(uint64_t seq)
+{
+    std::string payload(1 + SEQ_BYTES, '\0');
+    payload[0] = static_cast<char>(CONTROL_ACK);
+    put_u64(reinterpret_cast<unsigned char *>(payload.data() + 1), seq);
+
+    Outbound_Frame frame;
+    frame.len = frame_header(FRAME_KIND_CONTROL, payload.size());
+    frame.payload = std::make_shared<const std::string>(std::move(payload));
+    boost::asio::post(write_strand_, [this, frame = std::move(frame)]() mutable {
+        enqueue_frame(std::move(frame));
+    });
+}
+
+void Server::on_peer_hello(const std::shared_ptr<tcp::socket> &socket, bool sequenced, bool knows_session, uint64_t received)
+{
+    if (socket != current_client_ || !bind_write_socket()) {
+        return; // Handshake of a connection that has already been replaced
+    }
+
+    hello_timer_.cancel();
+    send_session_.peer_ready = true;
+    send_session_.peer_sequenced = sequenced;
+
+    // A peer that does not know this session has received none of the retained frames: all are sent again
+    if (sequenced && knows_session) {
+        on_peer_ack(received);
+    } else {
+        send_window();
+    }
+}
+
+void Server::on_peer_ack(uint64_t seq)
+{
+    auto &session = send_session_;
+    seq = std::min(seq, session.next_seq - 1);
+    const uint64_t previously_acked = session.acked;
+    while (session.acked < seq) {
+        session.retained_bytes -= session.retained.front().payload->size();
+        session.retained.pop_front();
+        session.acked++;
+    }
+    session.sent = std::max(session.sent, session.acked);
+
+    update_backpressure();
+    if (session.acked != previously_acked) {
+        notify_delivered();
+    }
+    send_window();
+}
+
+void Server::start_hello_timer(const std::shared_ptr<tcp::socket> &socket)
+{
+    if (reliable_window_ == 0) {
+        return;
+    }
+
+    boost::asio::post(write_strand_, [this, socket]() {
+        hello_timer_.expires_after(std::chrono::milliseconds(HELLO_TIMEOUT_MS));
+        hello_timer_.async_wait([this, socket](const boost::system::error_code &ec) {
+            if (ec == boost::asio::error::operation_aborted) return;
+            on_hello_timeout(socket);
+        });
+    });
+}
+
+void Server::on_hello_timeout(const std::shared_ptr<tcp::socket> &socket)
+{
+    if (socket != current_client_ || !socket->is_open() || send_session_.peer_ready) {
+        return;
+    }
+
+    if (!is_listening_) {
+        // Our HELLO is already on the wire, plain frames could be misread as sequenced ones
+        if (handlers_.call_error)
+            handlers_.call_error(boost::asio::error::timed_out, Type_Error::SENDING);
+        return;
+    }
+
+    // A peer without the handshake never answers: the held frames go out as plain frames. Our HELLO is only
+    // sent after the peer's, so one arriving late switches the following frames to sequenced ones cleanly
+    if (!bind_write_socket()) {
+        return;
+    }
+    send_session_.peer_ready = true;
+    send_session_.peer_sequenced = false;
+    send_window();
+}
+
+void Server::notify_delivered()
+{
+    if (handlers_.call_delivered) {
+        handlers_.call_delivered(send_session_.acked);
+    }
+}
+
+void Server::enqueue_frame(Outbound_Frame frame)
+{
+    const uint32_t kind = ntohl(frame.len) >> FRAME_KIND_SHIFT;
+    if (reliable_window_ > 0 && kind != FRAME_KIND_CONTROL) {
+        retain_frame(std::move(frame));
+        return;
+    }
+    write_frame(std::move(frame));
+}
+
+void Server::retain_frame(Outbound_Frame frame)
+{
+    auto &session = send_session_;
+    if (session.retained_bytes + frame.payload->size() > WRITE_MAX_QUEUED_BYTES) {
+        if (handlers_.call_error)
+            handlers_.call_error(boost::asio::error::no_buffer_space, Type_Error::SENDING);
+        return;
+    }
+
+    // Numbered as soon as it is accepted, so the order matches deliver() even while disconnected
+    frame.seq = session.next_seq++;
+    session.retained_bytes += frame.payload->size();
+    session.retained.push_back(std::move(frame));
+
+    update_backpressure();
+    send_window();
+}
+
+void Server::send_window()
+{
+    auto &session = send_session_;
+    if (!bind_write_socket() || !session.peer_ready) {
+        return; // Kept until the peer's HELLO says where to resume
+    }
+
+    if (!session.peer_sequenced) {
+        // The peer does not acknowledge frames: hand the retained ones over as plain frames
+        while (!session.retained.empty()) {
+            Outbound_Frame frame = std::move(session.retained.front());
+            session.retained.pop_front();
+            session.retained_bytes -= frame.payload->size();
+            frame.seq = 0;
+            write_frame(std::move(frame));
+        }
+        const bool handed_over = session.acked != session.next_seq - 1;
+        session.acked = session.next_seq - 1;
+        session.sent = session.acked;
+        update_backpressure();
+        if (handed_over) {
+            notify_delivered();
+        }
+        return;
+    }
+
+    // retained.front() holds sequence number acked + 1
+    while (session.sent - session.acked < reliable_window_ && session.sent + 1 < session.next_seq) {
+        write_frame(session.retained[session.sent - session.acked]); // Copies the header, the payload is shared
+        session.sent++;
+    }
+}
+
+bool Server::bind_write_socket()
 {
     auto client = current_client_;
     if (!client || !client->is_open())
+        return false;
+
+    if (client != write_socket_) {
+        reset_write_queue(client);
+    }
+    return true;
+}
+
+void Server::write_frame(Outbound_Frame frame)
+{
+    if (!bind_write_socket())
         return;
 
-    uint32_t len = htonl(static_cast<uint32_t>(message.size()));
+    uint32_t kind = ntohl(frame.len) >> FRAME_KIND_SHIFT;
+    if (kind != FRAME_KIND_RAW && kind != FRAME_KIND_CONTROL && !(peer_codecs_ & (1u << kind))) {
+        // Compressed for a peer that has since been replaced by one that did not negotiate it
+        std::string raw;
+        if (!decompress_payload(kind, *frame.payload, WRITE_MAX_QUEUED_BYTES, raw))
+            return;
+        frame.payload = std::make_shared<const std::string>(std::move(raw));
+        kind = FRAME_KIND_RAW;
+    }
+
+    size_t wire_bytes = frame.payload->size();
+    if (frame.seq != 0) {
+        put_u64(frame.seq_prefix.data(), frame.seq);
+        wire_bytes += SEQ_BYTES;
+    }
+    frame.len = frame_header(kind, wire_bytes);
+
+    if (write_queued_bytes_ + wire_bytes > WRITE_MAX_QUEUED_BYTES) {
+        if (handlers_.call_error)
+            handlers_.call_error(boost::asio::error::no_buffer_space, Type_Error::SENDING);
+        return;
+    }
+
+    if (kind != FRAME_KIND_CONTROL) {
+        counters_.frames_sent++;
+        counters_.payload_bytes_sent += frame.raw_bytes;
+        counters_.wire_bytes_sent += frame.payload->size();
+        if (kind != FRAME_KIND_RAW)
+            counters_.compressed_frames_sent++;
+    }
+
+    write_queued_bytes_ += wire_bytes + sizeof(frame.len);
+    write_queue_.push_back(std::move(frame));
+    update_backpressure();
+
+    if (!write_in_progress_) {
+        start_write();
+    }
+}
+
+void Server::update_backpressure()
+{
+    // Retained frames include the sequenced ones already in the write queue
+    const size_t pending = std::max(write_queued_bytes_, send_session_.retained_bytes);
+    if (!write_congested_ && pending > WRITE_HIGH_WATER_BYTES) {
+        write_congested_ = true;
+        if (handlers_.call_backpressure)
+            handlers_.call_backpressure(true);
+    } else if (write_congested_ && pending < WRITE_LOW_WATER_BYTES) {
+        write_congested_ = false;
+        if (handlers_.call_backpressure)
+            handlers_.call_backpressure(false);
+    }
+}
+
+void Server::start_write()
+{
+    // Coalesce pending frames (up to a bound) into one gather-write. The batch leaves the queue so it
+    // stays alive for the write even if the connection is replaced and the queue is reset meanwhile
+    auto batch = std::make_shared<std::vector<Outbound_Frame>>();
+    const size_t frames = std::min(write_queue_.size(), WRITE_MAX_FRAMES_PER_GATHER);
+    batch->reserve(frames);
+    size_t batch_bytes = 0;
+    for (size_t i = 0; i < frames; ++i) {
+        const auto &frame = write_queue_.front();
+        batch_bytes += frame.payload->size() + (frame.seq != 0 ? SEQ_BYTES : 0) + sizeof(uint32_t);
+        batch->push_back(std::move(write_queue_.front()));
+        write_queue_.pop_front();
+    }
+
     std::vector<boost::asio::const_buffer> buffers;
-    buffers.push_back(boost::asio::buffer(&len, sizeof(len)));
-    buffers.push_back(boost::asio::buffer(message));
+    buffers.reserve(frames * 3);
+    for (const auto &frame : *batch) {
+        buffers.push_back(boost::asio::buffer(&frame.len, sizeof(frame.len)));
+        if (frame.seq != 0) {
+            buffers.push_back(boost::asio::buffer(frame.seq_prefix));
+        }
+        buffers.push_back(boost::asio::buffer(*frame.payload));
+    }
+    write_in_progress_ = true;
 
-    boost::asio::async_write(*client, buffers,
-        [this, client](const boost::system::error_code& ec, std::size_t /*bytes_transferred*/) {
-            if (ec && handlers_.call_error)
-                handlers_.call_error(ec, Type_Error::SENDING);
-        });
-}
\ No newline at end of file
+    auto socket = write_socket_;
+    boost::asio::async_write(*socket, buffers,
+        boost::asio::bind_executor(write_strand_, [this, socket, batch, batch_bytes](const boost::system::error_code& ec, std::size_t /*bytes_transferred*/) {
+            on_write(socket, batch_bytes, ec);
+        }));
+}
+
+void Server::on_write(const std::shared_ptr<tcp::socket> &socket, size_t bytes_written, const boost::system::error_code& ec)
+{
+    if (socket != write_socket_) {
+        return; // Completion of a connection that has already been replaced
+    }
+
+    if (ec) {
+        reset_write_queue(nullptr);
+        if (handlers_.call_error)
+            handlers_.call_error(ec, Type_Error::SENDING);
+        return;
+    }
+
+    write_in_progress_ = false;
+    write_queued_bytes_ -= bytes_written;
+    update_backpressure();
+
+    if (!write_queue_.empty()) {
+        start_write();
+    }
+}
+
+void Server::reset_write_queue(const std::shared_ptr<tcp::socket> &socket)
+{
+    write_socket_ = socket;
+    write_queue_.clear();
+    write_queued_bytes_ = 0;
+    write_in_progress_ = false;
+
+    // Frames in flight on the previous connection count as unsent until the next HELLO
+    send_session_.peer_ready = false;
+    send_session_.sent = send_session_.acked;
+    update_backpressure();
+}
+
+bool Server::serialize_payload(const google::protobuf::MessageLite &message, std::string &payload)
+{
+    const size_t size = message.ByteSizeLong();
+    payload.resize(size);
+    return message.SerializeToArray(payload.data(), static_cast<int>(size));
+}
@@ -9,6 +9,11 @@
  * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 #pragma once
 #include <boost/asio.hpp>
+#include <array>
+#include <atomic>
+#include <deque>
+#include <string_view>
+#include <google/protobuf/message_lite.h>
 
 using boost::asio::ip::tcp;
 
@@ -20,39 +25,157 @@ enum class Type_Error {
 
 using handler_connect = std::function<void()>;
 using handler_error   = std::function<void(const boost::system::error_code&, const Type_Error &)>;  
-using handler_message = std::function<void(const std::string&)>;
+using handler_message = std::function<void(std::string_view)>; // Only valid during the call
+using handler_backpressure = std::function<void(bool congested)>;
+using handler_delivered = std::function<void(uint64_t frames)>;
+using io_strand = boost::asio::strand<boost::asio::io_context::executor_type>;
 
 class Server {
 public:
 
+    // Per-frame payload compression, negotiated with the peer when the connection is set up
+    enum class Compression : uint8_t {
+        NONE = 0,
+        LZ4 = 1,  // Low latency
+        ZSTD = 2  // Better ratio
+    };
+
+    struct Compression_Stats {
+        uint64_t frames_sent = 0;
+        uint64_t compressed_frames_sent = 0;
+        uint64_t payload_bytes_sent = 0;     // Before compression
+        uint64_t wire_bytes_sent = 0;        // After compression
+        uint64_t frames_received = 0;
+        uint64_t compressed_frames_received = 0;
+        uint64_t payload_bytes_received = 0; // After decompression
+        uint64_t wire_bytes_received = 0;    // As received
+    };
+
     struct handlers {
         handler_connect call_connect = nullptr;
         handler_error call_error = nullptr;
         handler_message call_message = nullptr;
+        handler_backpressure call_backpressure = nullptr; // Outbound queue crossed the high-water mark (true) or drained (false)
+        handler_delivered call_delivered = nullptr; // Reliable delivery only: data frames acknowledged by the peer, or written to a peer that does not acknowledge them, since the Server was created
     };
 
 
     explicit Server(boost::asio::io_context& io_context);
     Server(boost::asio::io_context& io_context, const handlers &handlers);
+    // Every handler, and the socket work behind them, runs on `strand`, so an owner that shares it with its
+    // own timers and callbacks needs no locks when the io_context runs on several threads
+    Server(boost::asio::io_context& io_context, const io_strand &strand);
     ~Server();
     void set_handlers(const handlers &handlers);
     void start_listening(const tcp::endpoint& endpoint);
     void accept_new_connection();
     void connect(const tcp::endpoint& endpoint);
-    void deliver(const std::string &message) const;
+    void deliver(std::string message);
     void server_close();
+    void set_max_frame_size(size_t max_frame_bytes);
+    void set_compression(Compression codec, size_t threshold_bytes); // Payloads below the threshold are always sent raw
+    Compression_Stats compression_stats() const;
+    // Numbers every data frame and keeps it until the peer acknowledges it, with at most window_frames
+    // unacknowledged frames on the wire. Frames not acknowledged when a connection drops are sent again on
+    // the next one. Only takes effect when the peer enables it too; 0 (the default) disables it. A listening
+    // side whose peer sends no HELLO in time writes the held frames as plain frames; a connecting side
+    // reports it through call_error
+    void set_reliable_delivery(size_t window_frames);
+
+    // Serializes a message as a frame payload in one pass; the length prefix is only added by deliver()
+    static bool serialize_payload(const google::protobuf::MessageLite &message, std::string &payload);
 private:
 
     boost::asio::io_context& io_context_;
+    boost::asio::any_io_executor socket_executor_; // The io_context, or the owner's strand
     tcp::acceptor acceptor_;
     handlers handlers_;
     std::shared_ptr<tcp::socket> current_client_;
     bool is_listening_ = false;
+    size_t max_frame_bytes_;
+    Compression compression_ = Compression::NONE;
+    size_t compression_threshold_ = 0;
+    std::atomic<uint8_t> peer_codecs_{0}; // Codecs the current peer announced it can decompress
+    size_t reliable_window_ = 0;
+    const uint64_t session_id_;             // Identifies this sender's sequence numbers across reconnections
+    std::atomic<bool> peer_sequenced_{false}; // Data frames from the current peer carry a sequence number
+    std::atomic<uint64_t> recv_session_{0};   // Session of the peer whose frames have been received
+    std::atomic<uint64_t> recv_seq_{0};       // Last sequence number delivered from that session
+
+    struct Frame_Counters {
+        std::atomic<uint64_t> frames_sent{0};
+        std::atomic<uint64_t> compressed_frames_sent{0};
+        std::atomic<uint64_t> payload_bytes_sent{0};
+        std::atomic<uint64_t> wire_bytes_sent{0};
+        std::atomic<uint64_t> frames_received{0};
+        std::atomic<uint64_t> compressed_frames_received{0};
+        std::atomic<uint64_t> payload_bytes_received{0};
+        std::atomic<uint64_t> wire_bytes_received{0};
+    };
+    Frame_Counters counters_;
+
+    // Receive buffer of one connection, reused across reads; frames are parsed in place
+    struct Read_Buffer {
+        std::vector<char> data;
+        size_t begin = 0;
+        size_t end = 0;
+        std::string inflated; // Decompressed payload of the last compressed frame
+    };
+
+    // Outbound queue of the current connection, only touched from write_strand_
+    struct Outbound_Frame {
+        uint32_t len;          // Frame header, network order
+        size_t raw_bytes = 0;  // Payload size before compression
+        std::shared_ptr<const std::string> payload; // Shared with the retransmission buffer
+        uint64_t seq = 0;      // 0 when the frame is not sequenced
+        std::array<unsigned char, 8> seq_prefix{};
+    };
+
+    // Sequenced frames not yet acknowledged by the peer, only touched from write_strand_
+    struct Send_Session {
+        uint64_t next_seq = 1;
+        uint64_t acked = 0;       // Cumulative acknowledgement from the peer
+        uint64_t sent = 0;        // Last sequence number written on the current connection
+        bool peer_ready = false;  // The peer's HELLO has been received on the current connection
+        bool peer_sequenced = false;
+        std::deque<Outbound_Frame> retained; // Sequence numbers acked + 1 onwards, in order
+        size_t retained_bytes = 0;
+    };
+    Send_Session send_session_;
+    boost::asio::strand<boost::asio::io_context::executor_type> write_strand_;
+    boost::asio::steady_timer hello_timer_; // Bounds the wait for the peer's HELLO, runs on write_strand_
+    std::shared_ptr<tcp::socket> write_socket_;
+    std::deque<Outbound_Frame> write_queue_;
+    size_t write_queued_bytes_ = 0;
+    bool write_in_progress_ = false;
+    bool write_congested_ = false;
 
     void notify_connecting_error(const boost::system::error_code &error) const;
     bool prepare_listening(const tcp::endpoint& endpoint);
     void on_accept(const boost::system::error_code& error, const std::shared_ptr<tcp::socket> &new_socket);
     void start_async_accept(const std::shared_ptr<tcp::socket> &new_socket);
     void start_read(std::shared_ptr<tcp::socket> socket);
-    void handle_read_message(std::shared_ptr<tcp::socket> socket, std::shared_ptr<std::vector<char>> data_buf, const boost::system::error_code& ec);
+    Outbound_Frame make_frame(std::string message) const;
+    void send_hello();
+    void send_ack(uint64_t seq);
+    void handle_control_frame(const std::shared_ptr<tcp::socket> &socket, std::string_view payload);
+    void on_peer_hello(const std::shared_ptr<tcp::socket> &socket, bool sequenced, bool knows_session, uint64_t received);
+    void on_peer_ack(uint64_t seq);
+    void start_hello_timer(const std::shared_ptr<tcp::socket> &socket);
+    void on_hello_timeout(const std::shared_ptr<tcp::socket> &socket);
+    void notify_delivered();
+    void enqueue_frame(Outbound_Frame frame);
+    void retain_frame(Outbound_Frame frame);
+    void send_window();
+    void write_frame(Outbound_Frame frame);
+    bool bind_write_socket();
+    void update_backpressure();
+    void start_write();
+    void on_write(const std::shared_ptr<tcp::socket> &socket, size_t bytes_written, const boost::system::error_code& ec);
+    void reset_write_queue(const std::shared_ptr<tcp::socket> &socket);
+    void read_some(std::shared_ptr<tcp::socket> socket, std::shared_ptr<Read_Buffer> buffer);
+    void handle_read(std::shared_ptr<tcp::socket> socket, std::shared_ptr<Read_Buffer> buffer, const boost::system::error_code& ec, std::size_t bytes_read);
+    bool dispatch_frames(const std::shared_ptr<tcp::socket> &socket, Read_Buffer &buffer);
+    void close_on_read_error(const std::shared_ptr<tcp::socket> &socket, const boost::system::error_code &ec);
+    void prepare_read_buffer(Read_Buffer &buffer) const;
 };
\ No newline at end of file
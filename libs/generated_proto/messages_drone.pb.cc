@@ -25,6 +25,39 @@ namespace _pb = ::google::protobuf;
 namespace _pbi = ::google::protobuf::internal;
 namespace _fl = ::google::protobuf::internal::field_layout;
 
+inline constexpr DroneMissionPlan::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        latitude_deg_{},
+        longitude_deg_{},
+        drone_id_{0},
+        relative_altitude_m_{0},
+        speed_m_s_{0},
+        is_fly_through_{false},
+        gimbal_pitch_deg_{0},
+        gimbal_yaw_deg_{0},
+        camera_action_{static_cast< ::CameraAction >(0)} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR DroneMissionPlan::DroneMissionPlan(::_pbi::ConstantInitialized)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(DroneMissionPlan_class_data_.base()),
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(),
+#endif  // PROTOBUF_CUSTOM_VTABLE
+      _impl_(::_pbi::ConstantInitialized()) {
+}
+struct DroneMissionPlanDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DroneMissionPlanDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DroneMissionPlanDefaultTypeInternal() {}
+  union {
+    DroneMissionPlan _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DroneMissionPlanDefaultTypeInternal _DroneMissionPlan_default_instance_;
+
 inline constexpr DroneCommandMision::Impl_::Impl_(
     ::_pbi::ConstantInitialized) noexcept
       : _cached_size_{0},
@@ -63,7 +96,8 @@ inline constexpr DroneCommandString::Impl_::Impl_(
         type_command_(
             &::google::protobuf::internal::fixed_address_empty_string,
             ::_pbi::ConstantInitialized()),
-        command_{nullptr} {}
+        command_{nullptr},
+        command_type_{static_cast< ::CommandType >(0)} {}
 
 template <typename>
 PROTOBUF_CONSTEXPR DroneCommandString::DroneCommandString(::_pbi::ConstantInitialized)
@@ -111,7 +145,7 @@ struct WrapperDroneCommandDefaultTypeInternal {
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
     PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 WrapperDroneCommandDefaultTypeInternal _WrapperDroneCommand_default_instance_;
 static const ::_pb::EnumDescriptor* PROTOBUF_NONNULL
-    file_level_enum_descriptors_messages_5fdrone_2eproto[1];
+    file_level_enum_descriptors_messages_5fdrone_2eproto[2];
 static constexpr const ::_pb::ServiceDescriptor *PROTOBUF_NONNULL *PROTOBUF_NULLABLE
     file_level_service_descriptors_messages_5fdrone_2eproto = nullptr;
 const ::uint32_t
@@ -120,14 +154,17 @@ const ::uint32_t
         0x004, // bitmap
         PROTOBUF_FIELD_OFFSET(::WrapperDroneCommand, _impl_._oneof_case_[0]),
         ::_pbi::kInvalidFieldOffsetTag,
+        ::_pbi::kInvalidFieldOffsetTag,
         PROTOBUF_FIELD_OFFSET(::WrapperDroneCommand, _impl_.payload_),
         0x081, // bitmap
         PROTOBUF_FIELD_OFFSET(::DroneCommandString, _impl_._has_bits_),
-        5, // hasbit index offset
+        6, // hasbit index offset
         PROTOBUF_FIELD_OFFSET(::DroneCommandString, _impl_.type_command_),
         PROTOBUF_FIELD_OFFSET(::DroneCommandString, _impl_.command_),
+        PROTOBUF_FIELD_OFFSET(::DroneCommandString, _impl_.command_type_),
         0,
         1,
+        2,
         0x081, // bitmap
         PROTOBUF_FIELD_OFFSET(::DroneCommandMision, _impl_._has_bits_),
         11, // hasbit index offset
@@ -147,61 +184,102 @@ const ::uint32_t
         5,
         6,
         7,
+        0x081, // bitmap
+        PROTOBUF_FIELD_OFFSET(::DroneMissionPlan, _impl_._has_bits_),
+        12, // hasbit index offset
+        PROTOBUF_FIELD_OFFSET(::DroneMissionPlan, _impl_.drone_id_),
+        PROTOBUF_FIELD_OFFSET(::DroneMissionPlan, _impl_.latitude_deg_),
+        PROTOBUF_FIELD_OFFSET(::DroneMissionPlan, _impl_.longitude_deg_),
+        PROTOBUF_FIELD_OFFSET(::DroneMissionPlan, _impl_.relative_altitude_m_),
+        PROTOBUF_FIELD_OFFSET(::DroneMissionPlan, _impl_.speed_m_s_),
+        PROTOBUF_FIELD_OFFSET(::DroneMissionPlan, _impl_.is_fly_through_),
+        PROTOBUF_FIELD_OFFSET(::DroneMissionPlan, _impl_.gimbal_pitch_deg_),
+        PROTOBUF_FIELD_OFFSET(::DroneMissionPlan, _impl_.gimbal_yaw_deg_),
+        PROTOBUF_FIELD_OFFSET(::DroneMissionPlan, _impl_.camera_action_),
+        0,
+        ~0u,
+        ~0u,
+        1,
+        2,
+        3,
+        4,
+        5,
+        6,
 };
 
 static const ::_pbi::MigrationSchema
     schemas[] ABSL_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
         {0, sizeof(::WrapperDroneCommand)},
-        {4, sizeof(::DroneCommandString)},
-        {11, sizeof(::DroneCommandMision)},
+        {5, sizeof(::DroneCommandString)},
+        {14, sizeof(::DroneCommandMision)},
+        {33, sizeof(::DroneMissionPlan)},
 };
 static const ::_pb::Message* PROTOBUF_NONNULL const file_default_instances[] = {
     &::_WrapperDroneCommand_default_instance_._instance,
     &::_DroneCommandString_default_instance_._instance,
     &::_DroneCommandMision_default_instance_._instance,
+    &::_DroneMissionPlan_default_instance_._instance,
 };
 const char descriptor_table_protodef_messages_5fdrone_2eproto[] ABSL_ATTRIBUTE_SECTION_VARIABLE(
     protodesc_cold) = {
-    "\n\024messages_drone.proto\"W\n\023WrapperDroneCo"
-    "mmand\0225\n\026command_message_normal\030\001 \001(\0132\023."
-    "DroneCommandStringH\000B\t\n\007payload\"P\n\022Drone"
-    "CommandString\022\024\n\014type_command\030\001 \001(\t\022$\n\007c"
-    "ommand\030\002 \001(\0132\023.DroneCommandMision\"\341\001\n\022Dr"
+    "\n\024messages_drone.proto\"\202\001\n\023WrapperDroneC"
+    "ommand\0225\n\026command_message_normal\030\001 \001(\0132\023"
+    ".DroneCommandStringH\000\022)\n\014mission_plan\030\002 "
+    "\001(\0132\021.DroneMissionPlanH\000B\t\n\007payload\"t\n\022D"
+    "roneCommandString\022\024\n\014type_command\030\001 \001(\t\022"
+    "$\n\007command\030\002 \001(\0132\023.DroneCommandMision\022\"\n"
+    "\014command_type\030\003 \001(\0162\014.CommandType\"\341\001\n\022Dr"
     "oneCommandMision\022\024\n\014latitude_deg\030\001 \001(\001\022\025"
     "\n\rlongitude_deg\030\002 \001(\001\022\033\n\023relative_altitu"
     "de_m\030\003 \001(\002\022\021\n\tspeed_m_s\030\004 \001(\002\022\026\n\016is_fly_"
     "through\030\005 \001(\010\022\030\n\020gimbal_pitch_deg\030\006 \001(\002\022"
     "\026\n\016gimbal_yaw_deg\030\007 \001(\002\022$\n\rcamera_action"
-    "\030\010 \001(\0162\r.CameraAction*\237\002\n\014CameraAction\022\026"
-    "\n\022CAMERA_ACTION_NONE\020\000\022\034\n\030CAMERA_ACTION_"
-    "TAKE_PHOTO\020\001\022&\n\"CAMERA_ACTION_START_PHOT"
-    "O_INTERVAL\020\002\022%\n!CAMERA_ACTION_STOP_PHOTO"
-    "_INTERVAL\020\003\022\035\n\031CAMERA_ACTION_START_VIDEO"
-    "\020\004\022\034\n\030CAMERA_ACTION_STOP_VIDEO\020\005\022&\n\"CAME"
-    "RA_ACTION_START_PHOTO_DISTANCE\020\006\022%\n!CAME"
-    "RA_ACTION_STOP_PHOTO_DISTANCE\020\007b\006proto3"
+    "\030\010 \001(\0162\r.CameraAction\"\361\001\n\020DroneMissionPl"
+    "an\022\020\n\010drone_id\030\001 \001(\005\022\024\n\014latitude_deg\030\002 \003"
+    "(\001\022\025\n\rlongitude_deg\030\003 \003(\001\022\033\n\023relative_al"
+    "titude_m\030\004 \001(\002\022\021\n\tspeed_m_s\030\005 \001(\002\022\026\n\016is_"
+    "fly_through\030\006 \001(\010\022\030\n\020gimbal_pitch_deg\030\007 "
+    "\001(\002\022\026\n\016gimbal_yaw_deg\030\010 \001(\002\022$\n\rcamera_ac"
+    "tion\030\t \001(\0162\r.CameraAction*u\n\013CommandType"
+    "\022\031\n\025COMMAND_TYPE_WAYPOINT\020\000\022\026\n\022COMMAND_T"
+    "YPE_START\020\001\022\027\n\023COMMAND_TYPE_FINISH\020\002\022\032\n\026"
+    "COMMAND_TYPE_START_ALL\020\003*\237\002\n\014CameraActio"
+    "n\022\026\n\022CAMERA_ACTION_NONE\020\000\022\034\n\030CAMERA_ACTI"
+    "ON_TAKE_PHOTO\020\001\022&\n\"CAMERA_ACTION_START_P"
+    "HOTO_INTERVAL\020\002\022%\n!CAMERA_ACTION_STOP_PH"
+    "OTO_INTERVAL\020\003\022\035\n\031CAMERA_ACTION_START_VI"
+    "DEO\020\004\022\034\n\030CAMERA_ACTION_STOP_VIDEO\020\005\022&\n\"C"
+    "AMERA_ACTION_START_PHOTO_DISTANCE\020\006\022%\n!C"
+    "AMERA_ACTION_STOP_PHOTO_DISTANCE\020\007b\006prot"
+    "o3"
 };
 static ::absl::once_flag descriptor_table_messages_5fdrone_2eproto_once;
 PROTOBUF_CONSTINIT const ::_pbi::DescriptorTable descriptor_table_messages_5fdrone_2eproto = {
     false,
     false,
-    719,
+    1162,
     descriptor_table_protodef_messages_5fdrone_2eproto,
     "messages_drone.proto",
     &descriptor_table_messages_5fdrone_2eproto_once,
     nullptr,
     0,
-    3,
+    4,
     schemas,
     file_default_instances,
     TableStruct_messages_5fdrone_2eproto::offsets,
     file_level_enum_descriptors_messages_5fdrone_2eproto,
     file_level_service_descriptors_messages_5fdrone_2eproto,
 };
-const ::google::protobuf::EnumDescriptor* PROTOBUF_NONNULL CameraAction_descriptor() {
+const ::google::protobuf::EnumDescriptor* PROTOBUF_NONNULL CommandType_descriptor() {
   ::google::protobuf::internal::AssignDescriptors(&descriptor_table_messages_5fdrone_2eproto);
   return file_level_enum_descriptors_messages_5fdrone_2eproto[0];
 }
+PROTOBUF_CONSTINIT const uint32_t CommandType_internal_data_[] = {
+    262144u, 0u, };
+const ::google::protobuf::EnumDescriptor* PROTOBUF_NONNULL CameraAction_descriptor() {
+  ::google::protobuf::internal::AssignDescriptors(&descriptor_table_messages_5fdrone_2eproto);
+  return file_level_enum_descriptors_messages_5fdrone_2eproto[1];
+}
 PROTOBUF_CONSTINIT const uint32_t CameraAction_internal_data_[] = {
     524288u, 0u, };
 // ===================================================================
@@ -225,6 +303,19 @@ void WrapperDroneCommand::set_allocated_command_message_normal(::DroneCommandStr
   }
   // @@protoc_insertion_point(field_set_allocated:WrapperDroneCommand.command_message_normal)
 }
+void WrapperDroneCommand::set_allocated_mission_plan(::DroneMissionPlan* PROTOBUF_NULLABLE mission_plan) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  clear_payload();
+  if (mission_plan) {
+    ::google::protobuf::Arena* submessage_arena = mission_plan->GetArena();
+    if (message_arena != submessage_arena) {
+      mission_plan = ::google::protobuf::internal::GetOwnedMessage(message_arena, mission_plan, submessage_arena);
+    }
+    set_has_mission_plan();
+    _impl_.payload_.mission_plan_ = mission_plan;
+  }
+  // @@protoc_insertion_point(field_set_allocated:WrapperDroneCommand.mission_plan)
+}
 WrapperDroneCommand::WrapperDroneCommand(::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
 #if defined(PROTOBUF_CUSTOM_VTABLE)
     : ::google::protobuf::Message(arena, WrapperDroneCommand_class_data_.base()) {
@@ -261,6 +352,9 @@ WrapperDroneCommand::WrapperDroneCommand(
       case kCommandMessageNormal:
         _impl_.payload_.command_message_normal_ = ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.payload_.command_message_normal_);
         break;
+      case kMissionPlan:
+        _impl_.payload_.mission_plan_ = ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.payload_.mission_plan_);
+        break;
   }
 
   // @@protoc_insertion_point(copy_constructor:WrapperDroneCommand)
@@ -301,6 +395,14 @@ void WrapperDroneCommand::clear_payload() {
       }
       break;
     }
+    case kMissionPlan: {
+      if (GetArena() == nullptr) {
+        delete _impl_.payload_.mission_plan_;
+      } else if (::google::protobuf::internal::DebugHardenClearOneofMessageOnArena()) {
+        ::google::protobuf::internal::MaybePoisonAfterClear(_impl_.payload_.mission_plan_);
+      }
+      break;
+    }
     case PAYLOAD_NOT_SET: {
       break;
     }
@@ -352,17 +454,17 @@ WrapperDroneCommand::GetClassData() const {
   return WrapperDroneCommand_class_data_.base();
 }
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<0, 1, 1, 0, 2>
+const ::_pbi::TcParseTable<0, 2, 2, 0, 2>
 WrapperDroneCommand::_table_ = {
   {
     0,  // no _has_bits_
     0, // no _extensions_
-    1, 0,  // max_field_number, fast_idx_mask
+    2, 0,  // max_field_number, fast_idx_mask
     offsetof(decltype(_table_), field_lookup_table),
-    4294967294,  // skipmap
+    4294967292,  // skipmap
     offsetof(decltype(_table_), field_entries),
-    1,  // num_field_entries
-    1,  // num_aux_entries
+    2,  // num_field_entries
+    2,  // num_aux_entries
     offsetof(decltype(_table_), aux_entries),
     WrapperDroneCommand_class_data_.base(),
     nullptr,  // post_loop_handler
@@ -378,9 +480,13 @@ WrapperDroneCommand::_table_ = {
     // .DroneCommandString command_message_normal = 1;
     {PROTOBUF_FIELD_OFFSET(WrapperDroneCommand, _impl_.payload_.command_message_normal_), _Internal::kOneofCaseOffset + 0, 0,
     (0 | ::_fl::kFcOneof | ::_fl::kMessage | ::_fl::kTvTable)},
+    // .DroneMissionPlan mission_plan = 2;
+    {PROTOBUF_FIELD_OFFSET(WrapperDroneCommand, _impl_.payload_.mission_plan_), _Internal::kOneofCaseOffset + 0, 1,
+    (0 | ::_fl::kFcOneof | ::_fl::kMessage | ::_fl::kTvTable)},
   }},
   {{
       {::_pbi::TcParser::GetTable<::DroneCommandString>()},
+      {::_pbi::TcParser::GetTable<::DroneMissionPlan>()},
   }},
   {{
   }},
@@ -411,13 +517,22 @@ PROTOBUF_NOINLINE void WrapperDroneCommand::Clear() {
   ::uint32_t cached_has_bits = 0;
   (void)cached_has_bits;
 
-  // .DroneCommandString command_message_normal = 1;
-  if (this_.payload_case() == kCommandMessageNormal) {
-    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-        1, *this_._impl_.payload_.command_message_normal_, this_._impl_.payload_.command_message_normal_->GetCachedSize(), target,
-        stream);
+  switch (this_.payload_case()) {
+    case kCommandMessageNormal: {
+      target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+          1, *this_._impl_.payload_.command_message_normal_, this_._impl_.payload_.command_message_normal_->GetCachedSize(), target,
+          stream);
+      break;
+    }
+    case kMissionPlan: {
+      target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+          2, *this_._impl_.payload_.mission_plan_, this_._impl_.payload_.mission_plan_->GetCachedSize(), target,
+          stream);
+      break;
+    }
+    default:
+      break;
   }
-
   if (ABSL_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
     target =
         ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
@@ -448,6 +563,12 @@ PROTOBUF_NOINLINE void WrapperDroneCommand::Clear() {
                     ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.payload_.command_message_normal_);
       break;
     }
+    // .DroneMissionPlan mission_plan = 2;
+    case kMissionPlan: {
+      total_size += 1 +
+                    ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.payload_.mission_plan_);
+      break;
+    }
     case PAYLOAD_NOT_SET: {
       break;
     }
@@ -484,6 +605,14 @@ void WrapperDroneCommand::MergeImpl(::google::protobuf::MessageLite& to_msg, con
         }
         break;
       }
+      case kMissionPlan: {
+        if (oneof_needs_init) {
+          _this->_impl_.payload_.mission_plan_ = ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.payload_.mission_plan_);
+        } else {
+          _this->_impl_.payload_.mission_plan_->MergeFrom(*from._impl_.payload_.mission_plan_);
+        }
+        break;
+      }
       case PAYLOAD_NOT_SET:
         break;
     }
@@ -553,6 +682,7 @@ DroneCommandString::DroneCommandString(
   _impl_.command_ = ((cached_has_bits & 0x00000002u) != 0)
                 ? ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.command_)
                 : nullptr;
+  _impl_.command_type_ = from._impl_.command_type_;
 
   // @@protoc_insertion_point(copy_constructor:DroneCommandString)
 }
@@ -564,7 +694,12 @@ PROTOBUF_NDEBUG_INLINE DroneCommandString::Impl_::Impl_(
 
 inline void DroneCommandString::SharedCtor(::_pb::Arena* PROTOBUF_NULLABLE arena) {
   new (&_impl_) Impl_(internal_visibility(), arena);
-  _impl_.command_ = {};
+  ::memset(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, command_),
+           0,
+           offsetof(Impl_, command_type_) -
+               offsetof(Impl_, command_) +
+               sizeof(Impl_::command_type_));
 }
 DroneCommandString::~DroneCommandString() {
   // @@protoc_insertion_point(destructor:DroneCommandString)
@@ -622,16 +757,16 @@ DroneCommandString::GetClassData() const {
   return DroneCommandString_class_data_.base();
 }
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<1, 2, 1, 39, 2>
+const ::_pbi::TcParseTable<2, 3, 1, 39, 2>
 DroneCommandString::_table_ = {
   {
     PROTOBUF_FIELD_OFFSET(DroneCommandString, _impl_._has_bits_),
     0, // no _extensions_
-    2, 8,  // max_field_number, fast_idx_mask
+    3, 24,  // max_field_number, fast_idx_mask
     offsetof(decltype(_table_), field_lookup_table),
-    4294967292,  // skipmap
+    4294967288,  // skipmap
     offsetof(decltype(_table_), field_entries),
-    2,  // num_field_entries
+    3,  // num_field_entries
     1,  // num_aux_entries
     offsetof(decltype(_table_), aux_entries),
     DroneCommandString_class_data_.base(),
@@ -641,12 +776,16 @@ DroneCommandString::_table_ = {
     ::_pbi::TcParser::GetTable<::DroneCommandString>(),  // to_prefetch
     #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
   }, {{
-    // .DroneCommandMision command = 2;
-    {::_pbi::TcParser::FastMtS1,
-     {18, 1, 0, PROTOBUF_FIELD_OFFSET(DroneCommandString, _impl_.command_)}},
+    {::_pbi::TcParser::MiniParse, {}},
     // string type_command = 1;
     {::_pbi::TcParser::FastUS1,
      {10, 0, 0, PROTOBUF_FIELD_OFFSET(DroneCommandString, _impl_.type_command_)}},
+    // .DroneCommandMision command = 2;
+    {::_pbi::TcParser::FastMtS1,
+     {18, 1, 0, PROTOBUF_FIELD_OFFSET(DroneCommandString, _impl_.command_)}},
+    // .CommandType command_type = 3;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(DroneCommandString, _impl_.command_type_), 2>(),
+     {24, 2, 0, PROTOBUF_FIELD_OFFSET(DroneCommandString, _impl_.command_type_)}},
   }}, {{
     65535, 65535
   }}, {{
@@ -656,6 +795,9 @@ DroneCommandString::_table_ = {
     // .DroneCommandMision command = 2;
     {PROTOBUF_FIELD_OFFSET(DroneCommandString, _impl_.command_), _Internal::kHasBitsOffset + 1, 0,
     (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+    // .CommandType command_type = 3;
+    {PROTOBUF_FIELD_OFFSET(DroneCommandString, _impl_.command_type_), _Internal::kHasBitsOffset + 2, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kOpenEnum)},
   }},
   {{
       {::_pbi::TcParser::GetTable<::DroneCommandMision>()},
@@ -683,6 +825,7 @@ PROTOBUF_NOINLINE void DroneCommandString::Clear() {
       _impl_.command_->Clear();
     }
   }
+  _impl_.command_type_ = 0;
   _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
 }
@@ -720,6 +863,15 @@ PROTOBUF_NOINLINE void DroneCommandString::Clear() {
         stream);
   }
 
+  // .CommandType command_type = 3;
+  if ((cached_has_bits & 0x00000004u) != 0) {
+    if (this_._internal_command_type() != 0) {
+      target = stream->EnsureSpace(target);
+      target = ::_pbi::WireFormatLite::WriteEnumToArray(
+          3, this_._internal_command_type(), target);
+    }
+  }
+
   if (ABSL_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
     target =
         ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
@@ -745,7 +897,7 @@ PROTOBUF_NOINLINE void DroneCommandString::Clear() {
 
   ::_pbi::Prefetch5LinesFrom7Lines(&this_);
   cached_has_bits = this_._impl_._has_bits_[0];
-  if ((cached_has_bits & 0x00000003u) != 0) {
+  if ((cached_has_bits & 0x00000007u) != 0) {
     // string type_command = 1;
     if ((cached_has_bits & 0x00000001u) != 0) {
       if (!this_._internal_type_command().empty()) {
@@ -758,6 +910,13 @@ PROTOBUF_NOINLINE void DroneCommandString::Clear() {
       total_size += 1 +
                     ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.command_);
     }
+    // .CommandType command_type = 3;
+    if ((cached_has_bits & 0x00000004u) != 0) {
+      if (this_._internal_command_type() != 0) {
+        total_size += 1 +
+                      ::_pbi::WireFormatLite::EnumSize(this_._internal_command_type());
+      }
+    }
   }
   return this_.MaybeComputeUnknownFieldsSize(total_size,
                                              &this_._impl_._cached_size_);
@@ -773,7 +932,7 @@ void DroneCommandString::MergeImpl(::google::protobuf::MessageLite& to_msg, cons
   (void) cached_has_bits;
 
   cached_has_bits = from._impl_._has_bits_[0];
-  if ((cached_has_bits & 0x00000003u) != 0) {
+  if ((cached_has_bits & 0x00000007u) != 0) {
     if ((cached_has_bits & 0x00000001u) != 0) {
       if (!from._internal_type_command().empty()) {
         _this->_internal_set_type_command(from._internal_type_command());
@@ -791,6 +950,11 @@ void DroneCommandString::MergeImpl(::google::protobuf::MessageLite& to_msg, cons
         _this->_impl_.command_->MergeFrom(*from._impl_.command_);
       }
     }
+    if ((cached_has_bits & 0x00000004u) != 0) {
+      if (from._internal_command_type() != 0) {
+        _this->_impl_.command_type_ = from._impl_.command_type_;
+      }
+    }
   }
   _this->_impl_._has_bits_[0] |= cached_has_bits;
   _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
@@ -811,7 +975,12 @@ void DroneCommandString::InternalSwap(DroneCommandString* PROTOBUF_RESTRICT PROT
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
   ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.type_command_, &other->_impl_.type_command_, arena);
-  swap(_impl_.command_, other->_impl_.command_);
+  ::google::protobuf::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(DroneCommandString, _impl_.command_type_)
+      + sizeof(DroneCommandString::_impl_.command_type_)
+      - PROTOBUF_FIELD_OFFSET(DroneCommandString, _impl_.command_)>(
+          reinterpret_cast<char*>(&_impl_.command_),
+          reinterpret_cast<char*>(&other->_impl_.command_));
 }
 
 ::google::protobuf::Metadata DroneCommandString::GetMetadata() const {
@@ -1252,6 +1421,512 @@ void DroneCommandMision::InternalSwap(DroneCommandMision* PROTOBUF_RESTRICT PROT
 ::google::protobuf::Metadata DroneCommandMision::GetMetadata() const {
   return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
 }
+// ===================================================================
+
+class DroneMissionPlan::_Internal {
+ public:
+  using HasBits =
+      decltype(::std::declval<DroneMissionPlan>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+      8 * PROTOBUF_FIELD_OFFSET(DroneMissionPlan, _impl_._has_bits_);
+};
+
+DroneMissionPlan::DroneMissionPlan(::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, DroneMissionPlan_class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:DroneMissionPlan)
+}
+PROTOBUF_NDEBUG_INLINE DroneMissionPlan::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
+    const ::DroneMissionPlan& from_msg)
+      : _has_bits_{from._has_bits_},
+        _cached_size_{0},
+        latitude_deg_{visibility, arena, from.latitude_deg_},
+        longitude_deg_{visibility, arena, from.longitude_deg_} {}
+
+DroneMissionPlan::DroneMissionPlan(
+    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena,
+    const DroneMissionPlan& from)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, DroneMissionPlan_class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  DroneMissionPlan* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
+  ::memcpy(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, drone_id_),
+           reinterpret_cast<const char *>(&from._impl_) +
+               offsetof(Impl_, drone_id_),
+           offsetof(Impl_, camera_action_) -
+               offsetof(Impl_, drone_id_) +
+               sizeof(Impl_::camera_action_));
+
+  // @@protoc_insertion_point(copy_constructor:DroneMissionPlan)
+}
+PROTOBUF_NDEBUG_INLINE DroneMissionPlan::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
+      : _cached_size_{0},
+        latitude_deg_{visibility, arena},
+        longitude_deg_{visibility, arena} {}
+
+inline void DroneMissionPlan::SharedCtor(::_pb::Arena* PROTOBUF_NULLABLE arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  ::memset(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, drone_id_),
+           0,
+           offsetof(Impl_, camera_action_) -
+               offsetof(Impl_, drone_id_) +
+               sizeof(Impl_::camera_action_));
+}
+DroneMissionPlan::~DroneMissionPlan() {
+  // @@protoc_insertion_point(destructor:DroneMissionPlan)
+  SharedDtor(*this);
+}
+inline void DroneMissionPlan::SharedDtor(MessageLite& self) {
+  DroneMissionPlan& this_ = static_cast<DroneMissionPlan&>(self);
+  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  ABSL_DCHECK(this_.GetArena() == nullptr);
+  this_._impl_.~Impl_();
+}
+
+inline void* PROTOBUF_NONNULL DroneMissionPlan::PlacementNew_(
+    const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
+    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena) {
+  return ::new (mem) DroneMissionPlan(arena);
+}
+constexpr auto DroneMissionPlan::InternalNewImpl_() {
+  constexpr auto arena_bits = ::google::protobuf::internal::EncodePlacementArenaOffsets({
+      PROTOBUF_FIELD_OFFSET(DroneMissionPlan, _impl_.latitude_deg_) +
+          decltype(DroneMissionPlan::_impl_.latitude_deg_)::
+              InternalGetArenaOffset(
+                  ::google::protobuf::Message::internal_visibility()),
+      PROTOBUF_FIELD_OFFSET(DroneMissionPlan, _impl_.longitude_deg_) +
+          decltype(DroneMissionPlan::_impl_.longitude_deg_)::
+              InternalGetArenaOffset(
+                  ::google::protobuf::Message::internal_visibility()),
+  });
+  if (arena_bits.has_value()) {
+    return ::google::protobuf::internal::MessageCreator::ZeroInit(
+        sizeof(DroneMissionPlan), alignof(DroneMissionPlan), *arena_bits);
+  } else {
+    return ::google::protobuf::internal::MessageCreator(&DroneMissionPlan::PlacementNew_,
+                                 sizeof(DroneMissionPlan),
+                                 alignof(DroneMissionPlan));
+  }
+}
+constexpr auto DroneMissionPlan::InternalGenerateClassData_() {
+  return ::google::protobuf::internal::ClassDataFull{
+      ::google::protobuf::internal::ClassData{
+          &_DroneMissionPlan_default_instance_._instance,
+          &_table_.header,
+          nullptr,  // OnDemandRegisterArenaDtor
+          nullptr,  // IsInitialized
+          &DroneMissionPlan::MergeImpl,
+          ::google::protobuf::Message::GetNewImpl<DroneMissionPlan>(),
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+          &DroneMissionPlan::SharedDtor,
+          ::google::protobuf::Message::GetClearImpl<DroneMissionPlan>(), &DroneMissionPlan::ByteSizeLong,
+              &DroneMissionPlan::_InternalSerialize,
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          PROTOBUF_FIELD_OFFSET(DroneMissionPlan, _impl_._cached_size_),
+          false,
+      },
+      &DroneMissionPlan::kDescriptorMethods,
+      &descriptor_table_messages_5fdrone_2eproto,
+      nullptr,  // tracker
+  };
+}
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 const
+    ::google::protobuf::internal::ClassDataFull DroneMissionPlan_class_data_ =
+        DroneMissionPlan::InternalGenerateClassData_();
+
+PROTOBUF_ATTRIBUTE_WEAK const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL
+DroneMissionPlan::GetClassData() const {
+  ::google::protobuf::internal::PrefetchToLocalCache(&DroneMissionPlan_class_data_);
+  ::google::protobuf::internal::PrefetchToLocalCache(DroneMissionPlan_class_data_.tc_table);
+  return DroneMissionPlan_class_data_.base();
+}
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<4, 9, 0, 0, 2>
+DroneMissionPlan::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(DroneMissionPlan, _impl_._has_bits_),
+    0, // no _extensions_
+    9, 120,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294966784,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    9,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    DroneMissionPlan_class_data_.base(),
+    nullptr,  // post_loop_handler
+    ::_pbi::TcParser::GenericFallback,  // fallback
+    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
+    ::_pbi::TcParser::GetTable<::DroneMissionPlan>(),  // to_prefetch
+    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
+  }, {{
+    {::_pbi::TcParser::MiniParse, {}},
+    // int32 drone_id = 1;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(DroneMissionPlan, _impl_.drone_id_), 0>(),
+     {8, 0, 0, PROTOBUF_FIELD_OFFSET(DroneMissionPlan, _impl_.drone_id_)}},
+    // repeated double latitude_deg = 2;
+    {::_pbi::TcParser::FastF64P1,
+     {18, 63, 0, PROTOBUF_FIELD_OFFSET(DroneMissionPlan, _impl_.latitude_deg_)}},
+    // repeated double longitude_deg = 3;
+    {::_pbi::TcParser::FastF64P1,
+     {26, 63, 0, PROTOBUF_FIELD_OFFSET(DroneMissionPlan, _impl_.longitude_deg_)}},
+    // float relative_altitude_m = 4;
+    {::_pbi::TcParser::FastF32S1,
+     {37, 1, 0, PROTOBUF_FIELD_OFFSET(DroneMissionPlan, _impl_.relative_altitude_m_)}},
+    // float speed_m_s = 5;
+    {::_pbi::TcParser::FastF32S1,
+     {45, 2, 0, PROTOBUF_FIELD_OFFSET(DroneMissionPlan, _impl_.speed_m_s_)}},
+    // bool is_fly_through = 6;
+    {::_pbi::TcParser::SingularVarintNoZag1<bool, offsetof(DroneMissionPlan, _impl_.is_fly_through_), 3>(),
+     {48, 3, 0, PROTOBUF_FIELD_OFFSET(DroneMissionPlan, _impl_.is_fly_through_)}},
+    // float gimbal_pitch_deg = 7;
+    {::_pbi::TcParser::FastF32S1,
+     {61, 4, 0, PROTOBUF_FIELD_OFFSET(DroneMissionPlan, _impl_.gimbal_pitch_deg_)}},
+    // float gimbal_yaw_deg = 8;
+    {::_pbi::TcParser::FastF32S1,
+     {69, 5, 0, PROTOBUF_FIELD_OFFSET(DroneMissionPlan, _impl_.gimbal_yaw_deg_)}},
+    // .CameraAction camera_action = 9;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(DroneMissionPlan, _impl_.camera_action_), 6>(),
+     {72, 6, 0, PROTOBUF_FIELD_OFFSET(DroneMissionPlan, _impl_.camera_action_)}},
+    {::_pbi::TcParser::MiniParse, {}},
+    {::_pbi::TcParser::MiniParse, {}},
+    {::_pbi::TcParser::MiniParse, {}},
+    {::_pbi::TcParser::MiniParse, {}},
+    {::_pbi::TcParser::MiniParse, {}},
+    {::_pbi::TcParser::MiniParse, {}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // int32 drone_id = 1;
+    {PROTOBUF_FIELD_OFFSET(DroneMissionPlan, _impl_.drone_id_), _Internal::kHasBitsOffset + 0, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kInt32)},
+    // repeated double latitude_deg = 2;
+    {PROTOBUF_FIELD_OFFSET(DroneMissionPlan, _impl_.latitude_deg_), -1, 0,
+    (0 | ::_fl::kFcRepeated | ::_fl::kPackedDouble)},
+    // repeated double longitude_deg = 3;
+    {PROTOBUF_FIELD_OFFSET(DroneMissionPlan, _impl_.longitude_deg_), -1, 0,
+    (0 | ::_fl::kFcRepeated | ::_fl::kPackedDouble)},
+    // float relative_altitude_m = 4;
+    {PROTOBUF_FIELD_OFFSET(DroneMissionPlan, _impl_.relative_altitude_m_), _Internal::kHasBitsOffset + 1, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kFloat)},
+    // float speed_m_s = 5;
+    {PROTOBUF_FIELD_OFFSET(DroneMissionPlan, _impl_.speed_m_s_), _Internal::kHasBitsOffset + 2, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kFloat)},
+    // bool is_fly_through = 6;
+    {PROTOBUF_FIELD_OFFSET(DroneMissionPlan, _impl_.is_fly_through_), _Internal::kHasBitsOffset + 3, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kBool)},
+    // float gimbal_pitch_deg = 7;
+    {PROTOBUF_FIELD_OFFSET(DroneMissionPlan, _impl_.gimbal_pitch_deg_), _Internal::kHasBitsOffset + 4, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kFloat)},
+    // float gimbal_yaw_deg = 8;
+    {PROTOBUF_FIELD_OFFSET(DroneMissionPlan, _impl_.gimbal_yaw_deg_), _Internal::kHasBitsOffset + 5, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kFloat)},
+    // .CameraAction camera_action = 9;
+    {PROTOBUF_FIELD_OFFSET(DroneMissionPlan, _impl_.camera_action_), _Internal::kHasBitsOffset + 6, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kOpenEnum)},
+  }},
+  // no aux_entries
+  {{
+  }},
+};
+PROTOBUF_NOINLINE void DroneMissionPlan::Clear() {
+// @@protoc_insertion_point(message_clear_start:DroneMissionPlan)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.latitude_deg_.Clear();
+  _impl_.longitude_deg_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if ((cached_has_bits & 0x0000007fu) != 0) {
+    ::memset(&_impl_.drone_id_, 0, static_cast<::size_t>(
+        reinterpret_cast<char*>(&_impl_.camera_action_) -
+        reinterpret_cast<char*>(&_impl_.drone_id_)) + sizeof(_impl_.camera_action_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+::uint8_t* PROTOBUF_NONNULL DroneMissionPlan::_InternalSerialize(
+    const ::google::protobuf::MessageLite& base, ::uint8_t* PROTOBUF_NONNULL target,
+    ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) {
+  const DroneMissionPlan& this_ = static_cast<const DroneMissionPlan&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+::uint8_t* PROTOBUF_NONNULL DroneMissionPlan::_InternalSerialize(
+    ::uint8_t* PROTOBUF_NONNULL target,
+    ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const {
+  const DroneMissionPlan& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  // @@protoc_insertion_point(serialize_to_array_start:DroneMissionPlan)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  // int32 drone_id = 1;
+  if ((this_._impl_._has_bits_[0] & 0x00000001u) != 0) {
+    if (this_._internal_drone_id() != 0) {
+      target =
+          ::google::protobuf::internal::WireFormatLite::WriteInt32ToArrayWithField<1>(
+              stream, this_._internal_drone_id(), target);
+    }
+  }
+
+  // repeated double latitude_deg = 2;
+  if (this_._internal_latitude_deg_size() > 0) {
+    target = stream->WriteFixedPacked(2, this_._internal_latitude_deg(), target);
+  }
+
+  // repeated double longitude_deg = 3;
+  if (this_._internal_longitude_deg_size() > 0) {
+    target = stream->WriteFixedPacked(3, this_._internal_longitude_deg(), target);
+  }
+
+  // float relative_altitude_m = 4;
+  if ((this_._impl_._has_bits_[0] & 0x00000002u) != 0) {
+    if (::absl::bit_cast<::uint32_t>(this_._internal_relative_altitude_m()) != 0) {
+      target = stream->EnsureSpace(target);
+      target = ::_pbi::WireFormatLite::WriteFloatToArray(
+          4, this_._internal_relative_altitude_m(), target);
+    }
+  }
+
+  // float speed_m_s = 5;
+  if ((this_._impl_._has_bits_[0] & 0x00000004u) != 0) {
+    if (::absl::bit_cast<::uint32_t>(this_._internal_speed_m_s()) != 0) {
+      target = stream->EnsureSpace(target);
+      target = ::_pbi::WireFormatLite::WriteFloatToArray(
+          5, this_._internal_speed_m_s(), target);
+    }
+  }
+
+  // bool is_fly_through = 6;
+  if ((this_._impl_._has_bits_[0] & 0x00000008u) != 0) {
+    if (this_._internal_is_fly_through() != 0) {
+      target = stream->EnsureSpace(target);
+      target = ::_pbi::WireFormatLite::WriteBoolToArray(
+          6, this_._internal_is_fly_through(), target);
+    }
+  }
+
+  // float gimbal_pitch_deg = 7;
+  if ((this_._impl_._has_bits_[0] & 0x00000010u) != 0) {
+    if (::absl::bit_cast<::uint32_t>(this_._internal_gimbal_pitch_deg()) != 0) {
+      target = stream->EnsureSpace(target);
+      target = ::_pbi::WireFormatLite::WriteFloatToArray(
+          7, this_._internal_gimbal_pitch_deg(), target);
+    }
+  }
+
+  // float gimbal_yaw_deg = 8;
+  if ((this_._impl_._has_bits_[0] & 0x00000020u) != 0) {
+    if (::absl::bit_cast<::uint32_t>(this_._internal_gimbal_yaw_deg()) != 0) {
+      target = stream->EnsureSpace(target);
+      target = ::_pbi::WireFormatLite::WriteFloatToArray(
+          8, this_._internal_gimbal_yaw_deg(), target);
+    }
+  }
+
+  // .CameraAction camera_action = 9;
+  if ((this_._impl_._has_bits_[0] & 0x00000040u) != 0) {
+    if (this_._internal_camera_action() != 0) {
+      target = stream->EnsureSpace(target);
+      target = ::_pbi::WireFormatLite::WriteEnumToArray(
+          9, this_._internal_camera_action(), target);
+    }
+  }
+
+  if (ABSL_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:DroneMissionPlan)
+  return target;
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+::size_t DroneMissionPlan::ByteSizeLong(const MessageLite& base) {
+  const DroneMissionPlan& this_ = static_cast<const DroneMissionPlan&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+::size_t DroneMissionPlan::ByteSizeLong() const {
+  const DroneMissionPlan& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  // @@protoc_insertion_point(message_byte_size_start:DroneMissionPlan)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void)cached_has_bits;
+
+  ::_pbi::Prefetch5LinesFrom7Lines(&this_);
+   {
+    // repeated double latitude_deg = 2;
+    {
+      ::size_t data_size = ::size_t{8} *
+          ::_pbi::FromIntSize(this_._internal_latitude_deg_size());
+      ::size_t tag_size = data_size == 0
+          ? 0
+          : 1 + ::_pbi::WireFormatLite::Int32Size(
+                              static_cast<::int32_t>(data_size));
+      total_size += tag_size + data_size;
+    }
+    // repeated double longitude_deg = 3;
+    {
+      ::size_t data_size = ::size_t{8} *
+          ::_pbi::FromIntSize(this_._internal_longitude_deg_size());
+      ::size_t tag_size = data_size == 0
+          ? 0
+          : 1 + ::_pbi::WireFormatLite::Int32Size(
+                              static_cast<::int32_t>(data_size));
+      total_size += tag_size + data_size;
+    }
+  }
+  cached_has_bits = this_._impl_._has_bits_[0];
+  if ((cached_has_bits & 0x0000007fu) != 0) {
+    // int32 drone_id = 1;
+    if ((cached_has_bits & 0x00000001u) != 0) {
+      if (this_._internal_drone_id() != 0) {
+        total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
+            this_._internal_drone_id());
+      }
+    }
+    // float relative_altitude_m = 4;
+    if ((cached_has_bits & 0x00000002u) != 0) {
+      if (::absl::bit_cast<::uint32_t>(this_._internal_relative_altitude_m()) != 0) {
+        total_size += 5;
+      }
+    }
+    // float speed_m_s = 5;
+    if ((cached_has_bits & 0x00000004u) != 0) {
+      if (::absl::bit_cast<::uint32_t>(this_._internal_speed_m_s()) != 0) {
+        total_size += 5;
+      }
+    }
+    // bool is_fly_through = 6;
+    if ((cached_has_bits & 0x00000008u) != 0) {
+      if (this_._internal_is_fly_through() != 0) {
+        total_size += 2;
+      }
+    }
+    // float gimbal_pitch_deg = 7;
+    if ((cached_has_bits & 0x00000010u) != 0) {
+      if (::absl::bit_cast<::uint32_t>(this_._internal_gimbal_pitch_deg()) != 0) {
+        total_size += 5;
+      }
+    }
+    // float gimbal_yaw_deg = 8;
+    if ((cached_has_bits & 0x00000020u) != 0) {
+      if (::absl::bit_cast<::uint32_t>(this_._internal_gimbal_yaw_deg()) != 0) {
+        total_size += 5;
+      }
+    }
+    // .CameraAction camera_action = 9;
+    if ((cached_has_bits & 0x00000040u) != 0) {
+      if (this_._internal_camera_action() != 0) {
+        total_size += 1 +
+                      ::_pbi::WireFormatLite::EnumSize(this_._internal_camera_action());
+      }
+    }
+  }
+  return this_.MaybeComputeUnknownFieldsSize(total_size,
+                                             &this_._impl_._cached_size_);
+}
+
+void DroneMissionPlan::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
+  auto* const _this = static_cast<DroneMissionPlan*>(&to_msg);
+  auto& from = static_cast<const DroneMissionPlan&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:DroneMissionPlan)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_internal_mutable_latitude_deg()->MergeFrom(from._internal_latitude_deg());
+  _this->_internal_mutable_longitude_deg()->MergeFrom(from._internal_longitude_deg());
+  cached_has_bits = from._impl_._has_bits_[0];
+  if ((cached_has_bits & 0x0000007fu) != 0) {
+    if ((cached_has_bits & 0x00000001u) != 0) {
+      if (from._internal_drone_id() != 0) {
+        _this->_impl_.drone_id_ = from._impl_.drone_id_;
+      }
+    }
+    if ((cached_has_bits & 0x00000002u) != 0) {
+      if (::absl::bit_cast<::uint32_t>(from._internal_relative_altitude_m()) != 0) {
+        _this->_impl_.relative_altitude_m_ = from._impl_.relative_altitude_m_;
+      }
+    }
+    if ((cached_has_bits & 0x00000004u) != 0) {
+      if (::absl::bit_cast<::uint32_t>(from._internal_speed_m_s()) != 0) {
+        _this->_impl_.speed_m_s_ = from._impl_.speed_m_s_;
+      }
+    }
+    if ((cached_has_bits & 0x00000008u) != 0) {
+      if (from._internal_is_fly_through() != 0) {
+        _this->_impl_.is_fly_through_ = from._impl_.is_fly_through_;
+      }
+    }
+    if ((cached_has_bits & 0x00000010u) != 0) {
+      if (::absl::bit_cast<::uint32_t>(from._internal_gimbal_pitch_deg()) != 0) {
+        _this->_impl_.gimbal_pitch_deg_ = from._impl_.gimbal_pitch_deg_;
+      }
+    }
+    if ((cached_has_bits & 0x00000020u) != 0) {
+      if (::absl::bit_cast<::uint32_t>(from._internal_gimbal_yaw_deg()) != 0) {
+        _this->_impl_.gimbal_yaw_deg_ = from._impl_.gimbal_yaw_deg_;
+      }
+    }
+    if ((cached_has_bits & 0x00000040u) != 0) {
+      if (from._internal_camera_action() != 0) {
+        _this->_impl_.camera_action_ = from._impl_.camera_action_;
+      }
+    }
+  }
+  _this->_impl_._has_bits_[0] |= cached_has_bits;
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void DroneMissionPlan::CopyFrom(const DroneMissionPlan& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:DroneMissionPlan)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+
+void DroneMissionPlan::InternalSwap(DroneMissionPlan* PROTOBUF_RESTRICT PROTOBUF_NONNULL other) {
+  using ::std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.latitude_deg_.InternalSwap(&other->_impl_.latitude_deg_);
+  _impl_.longitude_deg_.InternalSwap(&other->_impl_.longitude_deg_);
+  ::google::protobuf::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(DroneMissionPlan, _impl_.camera_action_)
+      + sizeof(DroneMissionPlan::_impl_.camera_action_)
+      - PROTOBUF_FIELD_OFFSET(DroneMissionPlan, _impl_.drone_id_)>(
+          reinterpret_cast<char*>(&_impl_.drone_id_),
+          reinterpret_cast<char*>(&other->_impl_.drone_id_));
+}
+
+::google::protobuf::Metadata DroneMissionPlan::GetMetadata() const {
+  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
+}
 // @@protoc_insertion_point(namespace_scope)
 namespace google {
 namespace protobuf {
@@ -55,6 +55,8 @@ extern const ::google::protobuf::internal::DescriptorTable descriptor_table_mess
 }  // extern "C"
 enum CameraAction : int;
 extern const uint32_t CameraAction_internal_data_[];
+enum CommandType : int;
+extern const uint32_t CommandType_internal_data_[];
 class DroneCommandMision;
 struct DroneCommandMisionDefaultTypeInternal;
 extern DroneCommandMisionDefaultTypeInternal _DroneCommandMision_default_instance_;
@@ -63,6 +65,10 @@ class DroneCommandString;
 struct DroneCommandStringDefaultTypeInternal;
 extern DroneCommandStringDefaultTypeInternal _DroneCommandString_default_instance_;
 extern const ::google::protobuf::internal::ClassDataFull DroneCommandString_class_data_;
+class DroneMissionPlan;
+struct DroneMissionPlanDefaultTypeInternal;
+extern DroneMissionPlanDefaultTypeInternal _DroneMissionPlan_default_instance_;
+extern const ::google::protobuf::internal::ClassDataFull DroneMissionPlan_class_data_;
 class WrapperDroneCommand;
 struct WrapperDroneCommandDefaultTypeInternal;
 extern WrapperDroneCommandDefaultTypeInternal _WrapperDroneCommand_default_instance_;
@@ -72,9 +78,50 @@ namespace protobuf {
 template <>
 internal::EnumTraitsT<::CameraAction_internal_data_>
     internal::EnumTraitsImpl::value<::CameraAction>;
+template <>
+internal::EnumTraitsT<::CommandType_internal_data_>
+    internal::EnumTraitsImpl::value<::CommandType>;
 }  // namespace protobuf
 }  // namespace google
 
+enum CommandType : int {
+  COMMAND_TYPE_WAYPOINT = 0,
+  COMMAND_TYPE_START = 1,
+  COMMAND_TYPE_FINISH = 2,
+  COMMAND_TYPE_START_ALL = 3,
+  CommandType_INT_MIN_SENTINEL_DO_NOT_USE_ =
+      ::std::numeric_limits<::int32_t>::min(),
+  CommandType_INT_MAX_SENTINEL_DO_NOT_USE_ =
+      ::std::numeric_limits<::int32_t>::max(),
+};
+
+extern const uint32_t CommandType_internal_data_[];
+inline constexpr CommandType CommandType_MIN =
+    static_cast<CommandType>(0);
+inline constexpr CommandType CommandType_MAX =
+    static_cast<CommandType>(3);
+inline bool CommandType_IsValid(int value) {
+  return 0 <= value && value <= 3;
+}
+inline constexpr int CommandType_ARRAYSIZE = 3 + 1;
+const ::google::protobuf::EnumDescriptor* PROTOBUF_NONNULL CommandType_descriptor();
+template <typename T>
+const ::std::string& CommandType_Name(T value) {
+  static_assert(::std::is_same<T, CommandType>::value ||
+                    ::std::is_integral<T>::value,
+                "Incorrect type passed to CommandType_Name().");
+  return CommandType_Name(static_cast<CommandType>(value));
+}
+template <>
+inline const ::std::string& CommandType_Name(CommandType value) {
+  return ::google::protobuf::internal::NameOfDenseEnum<CommandType_descriptor, 0, 3>(
+      static_cast<int>(value));
+}
+inline bool CommandType_Parse(
+    ::absl::string_view name, CommandType* PROTOBUF_NONNULL value) {
+  return ::google::protobuf::internal::ParseNamedEnum<CommandType>(CommandType_descriptor(), name,
+                                           value);
+}
 enum CameraAction : int {
   CAMERA_ACTION_NONE = 0,
   CAMERA_ACTION_TAKE_PHOTO = 1,
@@ -123,6 +170,309 @@ inline bool CameraAction_Parse(
 
 // -------------------------------------------------------------------
 
+class DroneMissionPlan final : public ::google::protobuf::Message
+/* @@protoc_insertion_point(class_definition:DroneMissionPlan) */ {
+ public:
+  inline DroneMissionPlan() : DroneMissionPlan(nullptr) {}
+  ~DroneMissionPlan() PROTOBUF_FINAL;
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+  void operator delete(DroneMissionPlan* PROTOBUF_NONNULL msg, std::destroying_delete_t) {
+    SharedDtor(*msg);
+    ::google::protobuf::internal::SizedDelete(msg, sizeof(DroneMissionPlan));
+  }
+#endif
+
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR DroneMissionPlan(::google::protobuf::internal::ConstantInitialized);
+
+  inline DroneMissionPlan(const DroneMissionPlan& from) : DroneMissionPlan(nullptr, from) {}
+  inline DroneMissionPlan(DroneMissionPlan&& from) noexcept
+      : DroneMissionPlan(nullptr, ::std::move(from)) {}
+  inline DroneMissionPlan& operator=(const DroneMissionPlan& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline DroneMissionPlan& operator=(DroneMissionPlan&& from) noexcept {
+    if (this == &from) return *this;
+    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* PROTOBUF_NONNULL mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* PROTOBUF_NONNULL descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* PROTOBUF_NONNULL GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* PROTOBUF_NONNULL GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const DroneMissionPlan& default_instance() {
+    return *reinterpret_cast<const DroneMissionPlan*>(
+        &_DroneMissionPlan_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages = 3;
+  friend void swap(DroneMissionPlan& a, DroneMissionPlan& b) { a.Swap(&b); }
+  inline void Swap(DroneMissionPlan* PROTOBUF_NONNULL other) {
+    if (other == this) return;
+    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(DroneMissionPlan* PROTOBUF_NONNULL other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  DroneMissionPlan* PROTOBUF_NONNULL New(::google::protobuf::Arena* PROTOBUF_NULLABLE arena = nullptr) const {
+    return ::google::protobuf::Message::DefaultConstruct<DroneMissionPlan>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const DroneMissionPlan& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom(const DroneMissionPlan& from) { DroneMissionPlan::MergeImpl(*this, from); }
+
+  private:
+  static void MergeImpl(::google::protobuf::MessageLite& to_msg,
+                        const ::google::protobuf::MessageLite& from_msg);
+
+  public:
+  bool IsInitialized() const {
+    return true;
+  }
+  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
+  #if defined(PROTOBUF_CUSTOM_VTABLE)
+  private:
+  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
+  static ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
+      const ::google::protobuf::MessageLite& msg, ::uint8_t* PROTOBUF_NONNULL target,
+      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream);
+
+  public:
+  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
+  ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
+      ::uint8_t* PROTOBUF_NONNULL target,
+      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const {
+    return _InternalSerialize(*this, target, stream);
+  }
+  #else   // PROTOBUF_CUSTOM_VTABLE
+  ::size_t ByteSizeLong() const final;
+  ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
+      ::uint8_t* PROTOBUF_NONNULL target,
+      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const final;
+  #endif  // PROTOBUF_CUSTOM_VTABLE
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  static void SharedDtor(MessageLite& self);
+  void InternalSwap(DroneMissionPlan* PROTOBUF_NONNULL other);
+ private:
+  template <typename T>
+  friend ::absl::string_view(::google::protobuf::internal::GetAnyMessageName)();
+  static ::absl::string_view FullMessageName() { return "DroneMissionPlan"; }
+
+ protected:
+  explicit DroneMissionPlan(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  DroneMissionPlan(::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const DroneMissionPlan& from);
+  DroneMissionPlan(
+      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, DroneMissionPlan&& from) noexcept
+      : DroneMissionPlan(arena) {
+    *this = ::std::move(from);
+  }
+  const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL GetClassData() const PROTOBUF_FINAL;
+  static void* PROTOBUF_NONNULL PlacementNew_(
+      const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
+      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  static constexpr auto InternalNewImpl_();
+
+ public:
+  static constexpr auto InternalGenerateClassData_();
+
+  ::google::protobuf::Metadata GetMetadata() const;
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+  enum : int {
+    kLatitudeDegFieldNumber = 2,
+    kLongitudeDegFieldNumber = 3,
+    kDroneIdFieldNumber = 1,
+    kRelativeAltitudeMFieldNumber = 4,
+    kSpeedMSFieldNumber = 5,
+    kIsFlyThroughFieldNumber = 6,
+    kGimbalPitchDegFieldNumber = 7,
+    kGimbalYawDegFieldNumber = 8,
+    kCameraActionFieldNumber = 9,
+  };
+  // repeated double latitude_deg = 2;
+  int latitude_deg_size() const;
+  private:
+  int _internal_latitude_deg_size() const;
+
+  public:
+  void clear_latitude_deg() ;
+  double latitude_deg(int index) const;
+  void set_latitude_deg(int index, double value);
+  void add_latitude_deg(double value);
+  const ::google::protobuf::RepeatedField<double>& latitude_deg() const;
+  ::google::protobuf::RepeatedField<double>* PROTOBUF_NONNULL mutable_latitude_deg();
+
+  private:
+  const ::google::protobuf::RepeatedField<double>& _internal_latitude_deg() const;
+  ::google::protobuf::RepeatedField<double>* PROTOBUF_NONNULL _internal_mutable_latitude_deg();
+
+  public:
+  // repeated double longitude_deg = 3;
+  int longitude_deg_size() const;
+  private:
+  int _internal_longitude_deg_size() const;
+
+  public:
+  void clear_longitude_deg() ;
+  double longitude_deg(int index) const;
+  void set_longitude_deg(int index, double value);
+  void add_longitude_deg(double value);
+  const ::google::protobuf::RepeatedField<double>& longitude_deg() const;
+  ::google::protobuf::RepeatedField<double>* PROTOBUF_NONNULL mutable_longitude_deg();
+
+  private:
+  const ::google::protobuf::RepeatedField<double>& _internal_longitude_deg() const;
+  ::google::protobuf::RepeatedField<double>* PROTOBUF_NONNULL _internal_mutable_longitude_deg();
+
+  public:
+  // int32 drone_id = 1;
+  void clear_drone_id() ;
+  ::int32_t drone_id() const;
+  void set_drone_id(::int32_t value);
+
+  private:
+  ::int32_t _internal_drone_id() const;
+  void _internal_set_drone_id(::int32_t value);
+
+  public:
+  // float relative_altitude_m = 4;
+  void clear_relative_altitude_m() ;
+  float relative_altitude_m() const;
+  void set_relative_altitude_m(float value);
+
+  private:
+  float _internal_relative_altitude_m() const;
+  void _internal_set_relative_altitude_m(float value);
+
+  public:
+  // float speed_m_s = 5;
+  void clear_speed_m_s() ;
+  float speed_m_s() const;
+  void set_speed_m_s(float value);
+
+  private:
+  float _internal_speed_m_s() const;
+  void _internal_set_speed_m_s(float value);
+
+  public:
+  // bool is_fly_through = 6;
+  void clear_is_fly_through() ;
+  bool is_fly_through() const;
+  void set_is_fly_through(bool value);
+
+  private:
+  bool _internal_is_fly_through() const;
+  void _internal_set_is_fly_through(bool value);
+
+  public:
+  // float gimbal_pitch_deg = 7;
+  void clear_gimbal_pitch_deg() ;
+  float gimbal_pitch_deg() const;
+  void set_gimbal_pitch_deg(float value);
+
+  private:
+  float _internal_gimbal_pitch_deg() const;
+  void _internal_set_gimbal_pitch_deg(float value);
+
+  public:
+  // float gimbal_yaw_deg = 8;
+  void clear_gimbal_yaw_deg() ;
+  float gimbal_yaw_deg() const;
+  void set_gimbal_yaw_deg(float value);
+
+  private:
+  float _internal_gimbal_yaw_deg() const;
+  void _internal_set_gimbal_yaw_deg(float value);
+
+  public:
+  // .CameraAction camera_action = 9;
+  void clear_camera_action() ;
+  ::CameraAction camera_action() const;
+  void set_camera_action(::CameraAction value);
+
+  private:
+  ::CameraAction _internal_camera_action() const;
+  void _internal_set_camera_action(::CameraAction value);
+
+  public:
+  // @@protoc_insertion_point(class_scope:DroneMissionPlan)
+ private:
+  class _Internal;
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<4, 9,
+                                   0, 0,
+                                   2>
+      _table_;
+
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+    inline explicit constexpr Impl_(::google::protobuf::internal::ConstantInitialized) noexcept;
+    inline explicit Impl_(
+        ::google::protobuf::internal::InternalVisibility visibility,
+        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+    inline explicit Impl_(
+        ::google::protobuf::internal::InternalVisibility visibility,
+        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
+        const DroneMissionPlan& from_msg);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    ::google::protobuf::internal::CachedSize _cached_size_;
+    ::google::protobuf::RepeatedField<double> latitude_deg_;
+    ::google::protobuf::RepeatedField<double> longitude_deg_;
+    ::int32_t drone_id_;
+    float relative_altitude_m_;
+    float speed_m_s_;
+    bool is_fly_through_;
+    float gimbal_pitch_deg_;
+    float gimbal_yaw_deg_;
+    int camera_action_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_5fdrone_2eproto;
+};
+
+extern const ::google::protobuf::internal::ClassDataFull DroneMissionPlan_class_data_;
+// -------------------------------------------------------------------
+
 class DroneCommandMision final : public ::google::protobuf::Message
 /* @@protoc_insertion_point(class_definition:DroneCommandMision) */ {
  public:
@@ -543,6 +893,7 @@ class DroneCommandString final : public ::google::protobuf::Message
   enum : int {
     kTypeCommandFieldNumber = 1,
     kCommandFieldNumber = 2,
+    kCommandTypeFieldNumber = 3,
   };
   // string type_command = 1;
   void clear_type_command() ;
@@ -573,12 +924,22 @@ class DroneCommandString final : public ::google::protobuf::Message
   const ::DroneCommandMision& _internal_command() const;
   ::DroneCommandMision* PROTOBUF_NONNULL _internal_mutable_command();
 
+  public:
+  // .CommandType command_type = 3;
+  void clear_command_type() ;
+  ::CommandType command_type() const;
+  void set_command_type(::CommandType value);
+
+  private:
+  ::CommandType _internal_command_type() const;
+  void _internal_set_command_type(::CommandType value);
+
   public:
   // @@protoc_insertion_point(class_scope:DroneCommandString)
  private:
   class _Internal;
   friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<1, 2,
+  static const ::google::protobuf::internal::TcParseTable<2, 3,
                                    1, 39,
                                    2>
       _table_;
@@ -602,6 +963,7 @@ class DroneCommandString final : public ::google::protobuf::Message
     ::google::protobuf::internal::CachedSize _cached_size_;
     ::google::protobuf::internal::ArenaStringPtr type_command_;
     ::DroneCommandMision* PROTOBUF_NULLABLE command_;
+    int command_type_;
     PROTOBUF_TSAN_DECLARE_MEMBER
   };
   union { Impl_ _impl_; };
@@ -668,6 +1030,7 @@ class WrapperDroneCommand final : public ::google::protobuf::Message
   }
   enum PayloadCase {
     kCommandMessageNormal = 1,
+    kMissionPlan = 2,
     PAYLOAD_NOT_SET = 0,
   };
   static constexpr int kIndexInFileMessages = 0;
@@ -759,6 +1122,7 @@ class WrapperDroneCommand final : public ::google::protobuf::Message
   // accessors -------------------------------------------------------
   enum : int {
     kCommandMessageNormalFieldNumber = 1,
+    kMissionPlanFieldNumber = 2,
   };
   // .DroneCommandString command_message_normal = 1;
   bool has_command_message_normal() const;
@@ -778,6 +1142,25 @@ class WrapperDroneCommand final : public ::google::protobuf::Message
   const ::DroneCommandString& _internal_command_message_normal() const;
   ::DroneCommandString* PROTOBUF_NONNULL _internal_mutable_command_message_normal();
 
+  public:
+  // .DroneMissionPlan mission_plan = 2;
+  bool has_mission_plan() const;
+  private:
+  bool _internal_has_mission_plan() const;
+
+  public:
+  void clear_mission_plan() ;
+  const ::DroneMissionPlan& mission_plan() const;
+  [[nodiscard]] ::DroneMissionPlan* PROTOBUF_NULLABLE release_mission_plan();
+  ::DroneMissionPlan* PROTOBUF_NONNULL mutable_mission_plan();
+  void set_allocated_mission_plan(::DroneMissionPlan* PROTOBUF_NULLABLE value);
+  void unsafe_arena_set_allocated_mission_plan(::DroneMissionPlan* PROTOBUF_NULLABLE value);
+  ::DroneMissionPlan* PROTOBUF_NULLABLE unsafe_arena_release_mission_plan();
+
+  private:
+  const ::DroneMissionPlan& _internal_mission_plan() const;
+  ::DroneMissionPlan* PROTOBUF_NONNULL _internal_mutable_mission_plan();
+
   public:
   void clear_payload();
   PayloadCase payload_case() const;
@@ -785,11 +1168,12 @@ class WrapperDroneCommand final : public ::google::protobuf::Message
  private:
   class _Internal;
   void set_has_command_message_normal();
+  void set_has_mission_plan();
   inline bool has_payload() const;
   inline void clear_has_payload();
   friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<0, 1,
-                                   1, 0,
+  static const ::google::protobuf::internal::TcParseTable<0, 2,
+                                   2, 0,
                                    2>
       _table_;
 
@@ -812,6 +1196,7 @@ class WrapperDroneCommand final : public ::google::protobuf::Message
       constexpr PayloadUnion() : _constinit_{} {}
       ::google::protobuf::internal::ConstantInitialized _constinit_;
       ::DroneCommandString* PROTOBUF_NULLABLE command_message_normal_;
+      ::DroneMissionPlan* PROTOBUF_NULLABLE mission_plan_;
     } payload_;
     ::google::protobuf::internal::CachedSize _cached_size_;
     ::uint32_t _oneof_case_[1];
@@ -920,6 +1305,87 @@ inline ::DroneCommandString* PROTOBUF_NONNULL WrapperDroneCommand::mutable_comma
   return _msg;
 }
 
+// .DroneMissionPlan mission_plan = 2;
+inline bool WrapperDroneCommand::has_mission_plan() const {
+  return payload_case() == kMissionPlan;
+}
+inline bool WrapperDroneCommand::_internal_has_mission_plan() const {
+  return payload_case() == kMissionPlan;
+}
+inline void WrapperDroneCommand::set_has_mission_plan() {
+  _impl_._oneof_case_[0] = kMissionPlan;
+}
+inline void WrapperDroneCommand::clear_mission_plan() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  if (payload_case() == kMissionPlan) {
+    if (GetArena() == nullptr) {
+      delete _impl_.payload_.mission_plan_;
+    } else if (::google::protobuf::internal::DebugHardenClearOneofMessageOnArena()) {
+      ::google::protobuf::internal::MaybePoisonAfterClear(_impl_.payload_.mission_plan_);
+    }
+    clear_has_payload();
+  }
+}
+inline ::DroneMissionPlan* PROTOBUF_NULLABLE WrapperDroneCommand::release_mission_plan() {
+  // @@protoc_insertion_point(field_release:WrapperDroneCommand.mission_plan)
+  if (payload_case() == kMissionPlan) {
+    clear_has_payload();
+    auto* temp = _impl_.payload_.mission_plan_;
+    if (GetArena() != nullptr) {
+      temp = ::google::protobuf::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.payload_.mission_plan_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::DroneMissionPlan& WrapperDroneCommand::_internal_mission_plan() const {
+  return payload_case() == kMissionPlan ? *_impl_.payload_.mission_plan_ : reinterpret_cast<::DroneMissionPlan&>(::_DroneMissionPlan_default_instance_);
+}
+inline const ::DroneMissionPlan& WrapperDroneCommand::mission_plan() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:WrapperDroneCommand.mission_plan)
+  return _internal_mission_plan();
+}
+inline ::DroneMissionPlan* PROTOBUF_NULLABLE WrapperDroneCommand::unsafe_arena_release_mission_plan() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:WrapperDroneCommand.mission_plan)
+  if (payload_case() == kMissionPlan) {
+    clear_has_payload();
+    auto* temp = _impl_.payload_.mission_plan_;
+    _impl_.payload_.mission_plan_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void WrapperDroneCommand::unsafe_arena_set_allocated_mission_plan(
+    ::DroneMissionPlan* PROTOBUF_NULLABLE value) {
+  // We rely on the oneof clear method to free the earlier contents
+  // of this oneof. We can directly use the pointer we're given to
+  // set the new value.
+  clear_payload();
+  if (value) {
+    set_has_mission_plan();
+    _impl_.payload_.mission_plan_ = value;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:WrapperDroneCommand.mission_plan)
+}
+inline ::DroneMissionPlan* PROTOBUF_NONNULL WrapperDroneCommand::_internal_mutable_mission_plan() {
+  if (payload_case() != kMissionPlan) {
+    clear_payload();
+    set_has_mission_plan();
+    _impl_.payload_.mission_plan_ = 
+        ::google::protobuf::Message::DefaultConstruct<::DroneMissionPlan>(GetArena());
+  }
+  return _impl_.payload_.mission_plan_;
+}
+inline ::DroneMissionPlan* PROTOBUF_NONNULL WrapperDroneCommand::mutable_mission_plan()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::DroneMissionPlan* _msg = _internal_mutable_mission_plan();
+  // @@protoc_insertion_point(field_mutable:WrapperDroneCommand.mission_plan)
+  return _msg;
+}
+
 inline bool WrapperDroneCommand::has_payload() const {
   return payload_case() != PAYLOAD_NOT_SET;
 }
@@ -1096,6 +1562,30 @@ inline void DroneCommandString::set_allocated_command(::DroneCommandMision* PROT
   // @@protoc_insertion_point(field_set_allocated:DroneCommandString.command)
 }
 
+// .CommandType command_type = 3;
+inline void DroneCommandString::clear_command_type() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.command_type_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline ::CommandType DroneCommandString::command_type() const {
+  // @@protoc_insertion_point(field_get:DroneCommandString.command_type)
+  return _internal_command_type();
+}
+inline void DroneCommandString::set_command_type(::CommandType value) {
+  _internal_set_command_type(value);
+  _impl_._has_bits_[0] |= 0x00000004u;
+  // @@protoc_insertion_point(field_set:DroneCommandString.command_type)
+}
+inline ::CommandType DroneCommandString::_internal_command_type() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return static_cast<::CommandType>(_impl_.command_type_);
+}
+inline void DroneCommandString::_internal_set_command_type(::CommandType value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.command_type_ = value;
+}
+
 // -------------------------------------------------------------------
 
 // DroneCommandMision
@@ -1292,6 +1782,270 @@ inline void DroneCommandMision::_internal_set_camera_action(::CameraAction value
   _impl_.camera_action_ = value;
 }
 
+// -------------------------------------------------------------------
+
+// DroneMissionPlan
+
+// int32 drone_id = 1;
+inline void DroneMissionPlan::clear_drone_id() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.drone_id_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline ::int32_t DroneMissionPlan::drone_id() const {
+  // @@protoc_insertion_point(field_get:DroneMissionPlan.drone_id)
+  return _internal_drone_id();
+}
+inline void DroneMissionPlan::set_drone_id(::int32_t value) {
+  _internal_set_drone_id(value);
+  _impl_._has_bits_[0] |= 0x00000001u;
+  // @@protoc_insertion_point(field_set:DroneMissionPlan.drone_id)
+}
+inline ::int32_t DroneMissionPlan::_internal_drone_id() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.drone_id_;
+}
+inline void DroneMissionPlan::_internal_set_drone_id(::int32_t value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.drone_id_ = value;
+}
+
+// repeated double latitude_deg = 2;
+inline int DroneMissionPlan::_internal_latitude_deg_size() const {
+  return _internal_latitude_deg().size();
+}
+inline int DroneMissionPlan::latitude_deg_size() const {
+  return _internal_latitude_deg_size();
+}
+inline void DroneMissionPlan::clear_latitude_deg() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.latitude_deg_.Clear();
+}
+inline double DroneMissionPlan::latitude_deg(int index) const {
+  // @@protoc_insertion_point(field_get:DroneMissionPlan.latitude_deg)
+  return _internal_latitude_deg().Get(index);
+}
+inline void DroneMissionPlan::set_latitude_deg(int index, double value) {
+  _internal_mutable_latitude_deg()->Set(index, value);
+  // @@protoc_insertion_point(field_set:DroneMissionPlan.latitude_deg)
+}
+inline void DroneMissionPlan::add_latitude_deg(double value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _internal_mutable_latitude_deg()->Add(value);
+  // @@protoc_insertion_point(field_add:DroneMissionPlan.latitude_deg)
+}
+inline const ::google::protobuf::RepeatedField<double>& DroneMissionPlan::latitude_deg() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:DroneMissionPlan.latitude_deg)
+  return _internal_latitude_deg();
+}
+inline ::google::protobuf::RepeatedField<double>* PROTOBUF_NONNULL DroneMissionPlan::mutable_latitude_deg()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:DroneMissionPlan.latitude_deg)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  return _internal_mutable_latitude_deg();
+}
+inline const ::google::protobuf::RepeatedField<double>&
+DroneMissionPlan::_internal_latitude_deg() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.latitude_deg_;
+}
+inline ::google::protobuf::RepeatedField<double>* PROTOBUF_NONNULL
+DroneMissionPlan::_internal_mutable_latitude_deg() {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return &_impl_.latitude_deg_;
+}
+
+// repeated double longitude_deg = 3;
+inline int DroneMissionPlan::_internal_longitude_deg_size() const {
+  return _internal_longitude_deg().size();
+}
+inline int DroneMissionPlan::longitude_deg_size() const {
+  return _internal_longitude_deg_size();
+}
+inline void DroneMissionPlan::clear_longitude_deg() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.longitude_deg_.Clear();
+}
+inline double DroneMissionPlan::longitude_deg(int index) const {
+  // @@protoc_insertion_point(field_get:DroneMissionPlan.longitude_deg)
+  return _internal_longitude_deg().Get(index);
+}
+inline void DroneMissionPlan::set_longitude_deg(int index, double value) {
+  _internal_mutable_longitude_deg()->Set(index, value);
+  // @@protoc_insertion_point(field_set:DroneMissionPlan.longitude_deg)
+}
+inline void DroneMissionPlan::add_longitude_deg(double value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _internal_mutable_longitude_deg()->Add(value);
+  // @@protoc_insertion_point(field_add:DroneMissionPlan.longitude_deg)
+}
+inline const ::google::protobuf::RepeatedField<double>& DroneMissionPlan::longitude_deg() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:DroneMissionPlan.longitude_deg)
+  return _internal_longitude_deg();
+}
+inline ::google::protobuf::RepeatedField<double>* PROTOBUF_NONNULL DroneMissionPlan::mutable_longitude_deg()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:DroneMissionPlan.longitude_deg)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  return _internal_mutable_longitude_deg();
+}
+inline const ::google::protobuf::RepeatedField<double>&
+DroneMissionPlan::_internal_longitude_deg() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.longitude_deg_;
+}
+inline ::google::protobuf::RepeatedField<double>* PROTOBUF_NONNULL
+DroneMissionPlan::_internal_mutable_longitude_deg() {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return &_impl_.longitude_deg_;
+}
+
+// float relative_altitude_m = 4;
+inline void DroneMissionPlan::clear_relative_altitude_m() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.relative_altitude_m_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline float DroneMissionPlan::relative_altitude_m() const {
+  // @@protoc_insertion_point(field_get:DroneMissionPlan.relative_altitude_m)
+  return _internal_relative_altitude_m();
+}
+inline void DroneMissionPlan::set_relative_altitude_m(float value) {
+  _internal_set_relative_altitude_m(value);
+  _impl_._has_bits_[0] |= 0x00000002u;
+  // @@protoc_insertion_point(field_set:DroneMissionPlan.relative_altitude_m)
+}
+inline float DroneMissionPlan::_internal_relative_altitude_m() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.relative_altitude_m_;
+}
+inline void DroneMissionPlan::_internal_set_relative_altitude_m(float value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.relative_altitude_m_ = value;
+}
+
+// float speed_m_s = 5;
+inline void DroneMissionPlan::clear_speed_m_s() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.speed_m_s_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline float DroneMissionPlan::speed_m_s() const {
+  // @@protoc_insertion_point(field_get:DroneMissionPlan.speed_m_s)
+  return _internal_speed_m_s();
+}
+inline void DroneMissionPlan::set_speed_m_s(float value) {
+  _internal_set_speed_m_s(value);
+  _impl_._has_bits_[0] |= 0x00000004u;
+  // @@protoc_insertion_point(field_set:DroneMissionPlan.speed_m_s)
+}
+inline float DroneMissionPlan::_internal_speed_m_s() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.speed_m_s_;
+}
+inline void DroneMissionPlan::_internal_set_speed_m_s(float value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.speed_m_s_ = value;
+}
+
+// bool is_fly_through = 6;
+inline void DroneMissionPlan::clear_is_fly_through() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.is_fly_through_ = false;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline bool DroneMissionPlan::is_fly_through() const {
+  // @@protoc_insertion_point(field_get:DroneMissionPlan.is_fly_through)
+  return _internal_is_fly_through();
+}
+inline void DroneMissionPlan::set_is_fly_through(bool value) {
+  _internal_set_is_fly_through(value);
+  _impl_._has_bits_[0] |= 0x00000008u;
+  // @@protoc_insertion_point(field_set:DroneMissionPlan.is_fly_through)
+}
+inline bool DroneMissionPlan::_internal_is_fly_through() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.is_fly_through_;
+}
+inline void DroneMissionPlan::_internal_set_is_fly_through(bool value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.is_fly_through_ = value;
+}
+
+// float gimbal_pitch_deg = 7;
+inline void DroneMissionPlan::clear_gimbal_pitch_deg() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.gimbal_pitch_deg_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline float DroneMissionPlan::gimbal_pitch_deg() const {
+  // @@protoc_insertion_point(field_get:DroneMissionPlan.gimbal_pitch_deg)
+  return _internal_gimbal_pitch_deg();
+}
+inline void DroneMissionPlan::set_gimbal_pitch_deg(float value) {
+  _internal_set_gimbal_pitch_deg(value);
+  _impl_._has_bits_[0] |= 0x00000010u;
+  // @@protoc_insertion_point(field_set:DroneMissionPlan.gimbal_pitch_deg)
+}
+inline float DroneMissionPlan::_internal_gimbal_pitch_deg() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.gimbal_pitch_deg_;
+}
+inline void DroneMissionPlan::_internal_set_gimbal_pitch_deg(float value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.gimbal_pitch_deg_ = value;
+}
+
+// float gimbal_yaw_deg = 8;
+inline void DroneMissionPlan::clear_gimbal_yaw_deg() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.gimbal_yaw_deg_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline float DroneMissionPlan::gimbal_yaw_deg() const {
+  // @@protoc_insertion_point(field_get:DroneMissionPlan.gimbal_yaw_deg)
+  return _internal_gimbal_yaw_deg();
+}
+inline void DroneMissionPlan::set_gimbal_yaw_deg(float value) {
+  _internal_set_gimbal_yaw_deg(value);
+  _impl_._has_bits_[0] |= 0x00000020u;
+  // @@protoc_insertion_point(field_set:DroneMissionPlan.gimbal_yaw_deg)
+}
+inline float DroneMissionPlan::_internal_gimbal_yaw_deg() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.gimbal_yaw_deg_;
+}
+inline void DroneMissionPlan::_internal_set_gimbal_yaw_deg(float value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.gimbal_yaw_deg_ = value;
+}
+
+// .CameraAction camera_action = 9;
+inline void DroneMissionPlan::clear_camera_action() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.camera_action_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline ::CameraAction DroneMissionPlan::camera_action() const {
+  // @@protoc_insertion_point(field_get:DroneMissionPlan.camera_action)
+  return _internal_camera_action();
+}
+inline void DroneMissionPlan::set_camera_action(::CameraAction value) {
+  _internal_set_camera_action(value);
+  _impl_._has_bits_[0] |= 0x00000040u;
+  // @@protoc_insertion_point(field_set:DroneMissionPlan.camera_action)
+}
+inline ::CameraAction DroneMissionPlan::_internal_camera_action() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return static_cast<::CameraAction>(_impl_.camera_action_);
+}
+inline void DroneMissionPlan::_internal_set_camera_action(::CameraAction value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.camera_action_ = value;
+}
+
 #ifdef __GNUC__
 #pragma GCC diagnostic pop
 #endif  // __GNUC__
@@ -1302,6 +2056,12 @@ inline void DroneCommandMision::_internal_set_camera_action(::CameraAction value
 namespace google {
 namespace protobuf {
 
+template <>
+struct is_proto_enum<::CommandType> : std::true_type {};
+template <>
+inline const EnumDescriptor* PROTOBUF_NONNULL GetEnumDescriptor<::CommandType>() {
+  return ::CommandType_descriptor();
+}
 template <>
 struct is_proto_enum<::CameraAction> : std::true_type {};
 template <>
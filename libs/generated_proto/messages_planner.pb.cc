@@ -87,6 +87,10 @@ inline constexpr DroneData::Impl_::Impl_(
       : _cached_size_{0},
         lon_{},
         lat_{},
+        lon_e7_delta_{},
+        _lon_e7_delta_cached_byte_size_{0},
+        lat_e7_delta_{},
+        _lat_e7_delta_cached_byte_size_{0},
         num_drones_{0} {}
 
 template <typename>
@@ -109,11 +113,39 @@ struct DroneDataDefaultTypeInternal {
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
     PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DroneDataDefaultTypeInternal _DroneData_default_instance_;
 
+inline constexpr CancelMessage::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        request_id_{::uint64_t{0u}} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR CancelMessage::CancelMessage(::_pbi::ConstantInitialized)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(CancelMessage_class_data_.base()),
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(),
+#endif  // PROTOBUF_CUSTOM_VTABLE
+      _impl_(::_pbi::ConstantInitialized()) {
+}
+struct CancelMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CancelMessageDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CancelMessageDefaultTypeInternal() {}
+  union {
+    CancelMessage _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CancelMessageDefaultTypeInternal _CancelMessage_default_instance_;
+
 inline constexpr PlannerMessage::Impl_::Impl_(
     ::_pbi::ConstantInitialized) noexcept
       : _cached_size_{0},
         signal_server_config_{},
-        drone_data_{nullptr} {}
+        drone_data_{nullptr},
+        request_id_{::uint64_t{0u}},
+        compact_response_{false},
+        stream_routes_{false} {}
 
 template <typename>
 PROTOBUF_CONSTEXPR PlannerMessage::PlannerMessage(::_pbi::ConstantInitialized)
@@ -170,14 +202,26 @@ const ::uint32_t
         0x004, // bitmap
         PROTOBUF_FIELD_OFFSET(::Wrapper, _impl_._oneof_case_[0]),
         ::_pbi::kInvalidFieldOffsetTag,
+        ::_pbi::kInvalidFieldOffsetTag,
         PROTOBUF_FIELD_OFFSET(::Wrapper, _impl_.payload_),
         0x081, // bitmap
+        PROTOBUF_FIELD_OFFSET(::CancelMessage, _impl_._has_bits_),
+        4, // hasbit index offset
+        PROTOBUF_FIELD_OFFSET(::CancelMessage, _impl_.request_id_),
+        0,
+        0x081, // bitmap
         PROTOBUF_FIELD_OFFSET(::PlannerMessage, _impl_._has_bits_),
-        5, // hasbit index offset
+        8, // hasbit index offset
         PROTOBUF_FIELD_OFFSET(::PlannerMessage, _impl_.signal_server_config_),
         PROTOBUF_FIELD_OFFSET(::PlannerMessage, _impl_.drone_data_),
+        PROTOBUF_FIELD_OFFSET(::PlannerMessage, _impl_.request_id_),
+        PROTOBUF_FIELD_OFFSET(::PlannerMessage, _impl_.compact_response_),
+        PROTOBUF_FIELD_OFFSET(::PlannerMessage, _impl_.stream_routes_),
         ~0u,
         0,
+        1,
+        2,
+        3,
         0x081, // bitmap
         PROTOBUF_FIELD_OFFSET(::SignalServerConfigProto, _impl_._has_bits_),
         28, // hasbit index offset
@@ -233,72 +277,83 @@ const ::uint32_t
         22,
         0x081, // bitmap
         PROTOBUF_FIELD_OFFSET(::DroneData, _impl_._has_bits_),
-        6, // hasbit index offset
+        8, // hasbit index offset
         PROTOBUF_FIELD_OFFSET(::DroneData, _impl_.num_drones_),
         PROTOBUF_FIELD_OFFSET(::DroneData, _impl_.lon_),
         PROTOBUF_FIELD_OFFSET(::DroneData, _impl_.lat_),
+        PROTOBUF_FIELD_OFFSET(::DroneData, _impl_.lon_e7_delta_),
+        PROTOBUF_FIELD_OFFSET(::DroneData, _impl_.lat_e7_delta_),
         0,
         ~0u,
         ~0u,
+        ~0u,
+        ~0u,
 };
 
 static const ::_pbi::MigrationSchema
     schemas[] ABSL_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
         {0, sizeof(::Wrapper)},
-        {4, sizeof(::PlannerMessage)},
-        {11, sizeof(::SignalServerConfigProto)},
-        {64, sizeof(::DroneData)},
+        {5, sizeof(::CancelMessage)},
+        {10, sizeof(::PlannerMessage)},
+        {23, sizeof(::SignalServerConfigProto)},
+        {76, sizeof(::DroneData)},
 };
 static const ::_pb::Message* PROTOBUF_NONNULL const file_default_instances[] = {
     &::_Wrapper_default_instance_._instance,
+    &::_CancelMessage_default_instance_._instance,
     &::_PlannerMessage_default_instance_._instance,
     &::_SignalServerConfigProto_default_instance_._instance,
     &::_DroneData_default_instance_._instance,
 };
 const char descriptor_table_protodef_messages_5fplanner_2eproto[] ABSL_ATTRIBUTE_SECTION_VARIABLE(
     protodesc_cold) = {
-    "\n\026messages_planner.proto\"@\n\007Wrapper\022*\n\017p"
-    "lanner_message\030\001 \001(\0132\017.PlannerMessageH\000B"
-    "\t\n\007payload\"h\n\016PlannerMessage\0226\n\024signal_s"
+    "\n\026messages_planner.proto\"j\n\007Wrapper\022*\n\017p"
+    "lanner_message\030\001 \001(\0132\017.PlannerMessageH\000\022"
+    "(\n\016cancel_message\030\002 \001(\0132\016.CancelMessageH"
+    "\000B\t\n\007payload\"#\n\rCancelMessage\022\022\n\nrequest"
+    "_id\030\001 \001(\004\"\255\001\n\016PlannerMessage\0226\n\024signal_s"
     "erver_config\030\001 \003(\0132\030.SignalServerConfigP"
-    "roto\022\036\n\ndrone_data\030\002 \001(\0132\n.DroneData\"\236\007\n"
-    "\027SignalServerConfigProto\022\025\n\rsdf_director"
-    "y\030\001 \001(\t\022\023\n\013output_file\030\002 \001(\t\022\036\n\021user_ter"
-    "rain_file\030\003 \001(\tH\000\210\001\001\022\037\n\022terrain_backgrou"
-    "nd\030\004 \001(\tH\001\210\001\001\022\020\n\010latitude\030\005 \001(\001\022\021\n\tlongi"
-    "tude\030\006 \001(\001\022\021\n\ttx_height\030\007 \001(\001\022\022\n\nrx_heig"
-    "hts\030\010 \003(\001\022\025\n\rfrequency_mhz\030\t \001(\001\022\021\n\terp_"
-    "watts\030\n \001(\001\022\031\n\014rx_threshold\030\013 \001(\001H\002\210\001\001\022\033"
-    "\n\016horizontal_pol\030\014 \001(\010H\003\210\001\001\022\033\n\016ground_cl"
-    "utter\030\r \001(\001H\004\210\001\001\022\031\n\014terrain_code\030\016 \001(\005H\005"
-    "\210\001\001\022\037\n\022terrain_dielectric\030\017 \001(\001H\006\210\001\001\022!\n\024"
-    "terrain_conductivity\030\020 \001(\001H\007\210\001\001\022\031\n\014clima"
-    "te_code\030\021 \001(\005H\010\210\001\001\022\031\n\021propagation_model\030"
-    "\022 \001(\005\022\034\n\017knife_edge_diff\030\023 \001(\010H\t\210\001\001\022\035\n\020w"
-    "in32_tile_names\030\024 \001(\010H\n\210\001\001\022\027\n\ndebug_mode"
-    "\030\025 \001(\010H\013\210\001\001\022\031\n\014metric_units\030\026 \001(\010H\014\210\001\001\022\025"
-    "\n\010plot_dbm\030\027 \001(\010H\r\210\001\001\022\016\n\006radius\030\030 \001(\001\022\022\n"
-    "\nresolution\030\031 \001(\005B\024\n\022_user_terrain_fileB"
-    "\025\n\023_terrain_backgroundB\017\n\r_rx_thresholdB"
-    "\021\n\017_horizontal_polB\021\n\017_ground_clutterB\017\n"
-    "\r_terrain_codeB\025\n\023_terrain_dielectricB\027\n"
-    "\025_terrain_conductivityB\017\n\r_climate_codeB"
-    "\022\n\020_knife_edge_diffB\023\n\021_win32_tile_names"
-    "B\r\n\013_debug_modeB\017\n\r_metric_unitsB\013\n\t_plo"
-    "t_dbm\"9\n\tDroneData\022\022\n\nnum_drones\030\001 \001(\005\022\013"
-    "\n\003lon\030\002 \003(\001\022\013\n\003lat\030\003 \003(\001b\006proto3"
+    "roto\022\036\n\ndrone_data\030\002 \001(\0132\n.DroneData\022\022\n\n"
+    "request_id\030\003 \001(\004\022\030\n\020compact_response\030\004 \001"
+    "(\010\022\025\n\rstream_routes\030\005 \001(\010\"\236\007\n\027SignalServ"
+    "erConfigProto\022\025\n\rsdf_directory\030\001 \001(\t\022\023\n\013"
+    "output_file\030\002 \001(\t\022\036\n\021user_terrain_file\030\003"
+    " \001(\tH\000\210\001\001\022\037\n\022terrain_background\030\004 \001(\tH\001\210"
+    "\001\001\022\020\n\010latitude\030\005 \001(\001\022\021\n\tlongitude\030\006 \001(\001\022"
+    "\021\n\ttx_height\030\007 \001(\001\022\022\n\nrx_heights\030\010 \003(\001\022\025"
+    "\n\rfrequency_mhz\030\t \001(\001\022\021\n\terp_watts\030\n \001(\001"
+    "\022\031\n\014rx_threshold\030\013 \001(\001H\002\210\001\001\022\033\n\016horizonta"
+    "l_pol\030\014 \001(\010H\003\210\001\001\022\033\n\016ground_clutter\030\r \001(\001"
+    "H\004\210\001\001\022\031\n\014terrain_code\030\016 \001(\005H\005\210\001\001\022\037\n\022terr"
+    "ain_dielectric\030\017 \001(\001H\006\210\001\001\022!\n\024terrain_con"
+    "ductivity\030\020 \001(\001H\007\210\001\001\022\031\n\014climate_code\030\021 \001"
+    "(\005H\010\210\001\001\022\031\n\021propagation_model\030\022 \001(\005\022\034\n\017kn"
+    "ife_edge_diff\030\023 \001(\010H\t\210\001\001\022\035\n\020win32_tile_n"
+    "ames\030\024 \001(\010H\n\210\001\001\022\027\n\ndebug_mode\030\025 \001(\010H\013\210\001\001"
+    "\022\031\n\014metric_units\030\026 \001(\010H\014\210\001\001\022\025\n\010plot_dbm\030"
+    "\027 \001(\010H\r\210\001\001\022\016\n\006radius\030\030 \001(\001\022\022\n\nresolution"
+    "\030\031 \001(\005B\024\n\022_user_terrain_fileB\025\n\023_terrain"
+    "_backgroundB\017\n\r_rx_thresholdB\021\n\017_horizon"
+    "tal_polB\021\n\017_ground_clutterB\017\n\r_terrain_c"
+    "odeB\025\n\023_terrain_dielectricB\027\n\025_terrain_c"
+    "onductivityB\017\n\r_climate_codeB\022\n\020_knife_e"
+    "dge_diffB\023\n\021_win32_tile_namesB\r\n\013_debug_"
+    "modeB\017\n\r_metric_unitsB\013\n\t_plot_dbm\"e\n\tDr"
+    "oneData\022\022\n\nnum_drones\030\001 \001(\005\022\013\n\003lon\030\002 \003(\001"
+    "\022\013\n\003lat\030\003 \003(\001\022\024\n\014lon_e7_delta\030\004 \003(\021\022\024\n\014l"
+    "at_e7_delta\030\005 \003(\021b\006proto3"
 };
 static ::absl::once_flag descriptor_table_messages_5fplanner_2eproto_once;
 PROTOBUF_CONSTINIT const ::_pbi::DescriptorTable descriptor_table_messages_5fplanner_2eproto = {
     false,
     false,
-    1192,
+    1385,
     descriptor_table_protodef_messages_5fplanner_2eproto,
     "messages_planner.proto",
     &descriptor_table_messages_5fplanner_2eproto_once,
     nullptr,
     0,
-    4,
+    5,
     schemas,
     file_default_instances,
     TableStruct_messages_5fplanner_2eproto::offsets,
@@ -326,6 +381,19 @@ void Wrapper::set_allocated_planner_message(::PlannerMessage* PROTOBUF_NULLABLE
   }
   // @@protoc_insertion_point(field_set_allocated:Wrapper.planner_message)
 }
+void Wrapper::set_allocated_cancel_message(::CancelMessage* PROTOBUF_NULLABLE cancel_message) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  clear_payload();
+  if (cancel_message) {
+    ::google::protobuf::Arena* submessage_arena = cancel_message->GetArena();
+    if (message_arena != submessage_arena) {
+      cancel_message = ::google::protobuf::internal::GetOwnedMessage(message_arena, cancel_message, submessage_arena);
+    }
+    set_has_cancel_message();
+    _impl_.payload_.cancel_message_ = cancel_message;
+  }
+  // @@protoc_insertion_point(field_set_allocated:Wrapper.cancel_message)
+}
 Wrapper::Wrapper(::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
 #if defined(PROTOBUF_CUSTOM_VTABLE)
     : ::google::protobuf::Message(arena, Wrapper_class_data_.base()) {
@@ -362,6 +430,9 @@ Wrapper::Wrapper(
       case kPlannerMessage:
         _impl_.payload_.planner_message_ = ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.payload_.planner_message_);
         break;
+      case kCancelMessage:
+        _impl_.payload_.cancel_message_ = ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.payload_.cancel_message_);
+        break;
   }
 
   // @@protoc_insertion_point(copy_constructor:Wrapper)
@@ -402,6 +473,14 @@ void Wrapper::clear_payload() {
       }
       break;
     }
+    case kCancelMessage: {
+      if (GetArena() == nullptr) {
+        delete _impl_.payload_.cancel_message_;
+      } else if (::google::protobuf::internal::DebugHardenClearOneofMessageOnArena()) {
+        ::google::protobuf::internal::MaybePoisonAfterClear(_impl_.payload_.cancel_message_);
+      }
+      break;
+    }
     case PAYLOAD_NOT_SET: {
       break;
     }
@@ -453,17 +532,17 @@ Wrapper::GetClassData() const {
   return Wrapper_class_data_.base();
 }
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<0, 1, 1, 0, 2>
+const ::_pbi::TcParseTable<0, 2, 2, 0, 2>
 Wrapper::_table_ = {
   {
     0,  // no _has_bits_
     0, // no _extensions_
-    1, 0,  // max_field_number, fast_idx_mask
+    2, 0,  // max_field_number, fast_idx_mask
     offsetof(decltype(_table_), field_lookup_table),
-    4294967294,  // skipmap
+    4294967292,  // skipmap
     offsetof(decltype(_table_), field_entries),
-    1,  // num_field_entries
-    1,  // num_aux_entries
+    2,  // num_field_entries
+    2,  // num_aux_entries
     offsetof(decltype(_table_), aux_entries),
     Wrapper_class_data_.base(),
     nullptr,  // post_loop_handler
@@ -479,9 +558,13 @@ Wrapper::_table_ = {
     // .PlannerMessage planner_message = 1;
     {PROTOBUF_FIELD_OFFSET(Wrapper, _impl_.payload_.planner_message_), _Internal::kOneofCaseOffset + 0, 0,
     (0 | ::_fl::kFcOneof | ::_fl::kMessage | ::_fl::kTvTable)},
+    // .CancelMessage cancel_message = 2;
+    {PROTOBUF_FIELD_OFFSET(Wrapper, _impl_.payload_.cancel_message_), _Internal::kOneofCaseOffset + 0, 1,
+    (0 | ::_fl::kFcOneof | ::_fl::kMessage | ::_fl::kTvTable)},
   }},
   {{
       {::_pbi::TcParser::GetTable<::PlannerMessage>()},
+      {::_pbi::TcParser::GetTable<::CancelMessage>()},
   }},
   {{
   }},
@@ -512,13 +595,22 @@ PROTOBUF_NOINLINE void Wrapper::Clear() {
   ::uint32_t cached_has_bits = 0;
   (void)cached_has_bits;
 
-  // .PlannerMessage planner_message = 1;
-  if (this_.payload_case() == kPlannerMessage) {
-    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-        1, *this_._impl_.payload_.planner_message_, this_._impl_.payload_.planner_message_->GetCachedSize(), target,
-        stream);
+  switch (this_.payload_case()) {
+    case kPlannerMessage: {
+      target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+          1, *this_._impl_.payload_.planner_message_, this_._impl_.payload_.planner_message_->GetCachedSize(), target,
+          stream);
+      break;
+    }
+    case kCancelMessage: {
+      target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+          2, *this_._impl_.payload_.cancel_message_, this_._impl_.payload_.cancel_message_->GetCachedSize(), target,
+          stream);
+      break;
+    }
+    default:
+      break;
   }
-
   if (ABSL_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
     target =
         ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
@@ -549,6 +641,12 @@ PROTOBUF_NOINLINE void Wrapper::Clear() {
                     ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.payload_.planner_message_);
       break;
     }
+    // .CancelMessage cancel_message = 2;
+    case kCancelMessage: {
+      total_size += 1 +
+                    ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.payload_.cancel_message_);
+      break;
+    }
     case PAYLOAD_NOT_SET: {
       break;
     }
@@ -585,6 +683,14 @@ void Wrapper::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google:
         }
         break;
       }
+      case kCancelMessage: {
+        if (oneof_needs_init) {
+          _this->_impl_.payload_.cancel_message_ = ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.payload_.cancel_message_);
+        } else {
+          _this->_impl_.payload_.cancel_message_->MergeFrom(*from._impl_.payload_.cancel_message_);
+        }
+        break;
+      }
       case PAYLOAD_NOT_SET:
         break;
     }
@@ -612,6 +718,241 @@ void Wrapper::InternalSwap(Wrapper* PROTOBUF_RESTRICT PROTOBUF_NONNULL other) {
 }
 // ===================================================================
 
+class CancelMessage::_Internal {
+ public:
+  using HasBits =
+      decltype(::std::declval<CancelMessage>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+      8 * PROTOBUF_FIELD_OFFSET(CancelMessage, _impl_._has_bits_);
+};
+
+CancelMessage::CancelMessage(::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, CancelMessage_class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:CancelMessage)
+}
+CancelMessage::CancelMessage(
+    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const CancelMessage& from)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, CancelMessage_class_data_.base()),
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena),
+#endif  // PROTOBUF_CUSTOM_VTABLE
+      _impl_(from._impl_) {
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+}
+PROTOBUF_NDEBUG_INLINE CancelMessage::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
+      : _cached_size_{0} {}
+
+inline void CancelMessage::SharedCtor(::_pb::Arena* PROTOBUF_NULLABLE arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  _impl_.request_id_ = {};
+}
+CancelMessage::~CancelMessage() {
+  // @@protoc_insertion_point(destructor:CancelMessage)
+  SharedDtor(*this);
+}
+inline void CancelMessage::SharedDtor(MessageLite& self) {
+  CancelMessage& this_ = static_cast<CancelMessage&>(self);
+  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  ABSL_DCHECK(this_.GetArena() == nullptr);
+  this_._impl_.~Impl_();
+}
+
+inline void* PROTOBUF_NONNULL CancelMessage::PlacementNew_(
+    const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
+    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena) {
+  return ::new (mem) CancelMessage(arena);
+}
+constexpr auto CancelMessage::InternalNewImpl_() {
+  return ::google::protobuf::internal::MessageCreator::ZeroInit(sizeof(CancelMessage),
+                                            alignof(CancelMessage));
+}
+constexpr auto CancelMessage::InternalGenerateClassData_() {
+  return ::google::protobuf::internal::ClassDataFull{
+      ::google::protobuf::internal::ClassData{
+          &_CancelMessage_default_instance_._instance,
+          &_table_.header,
+          nullptr,  // OnDemandRegisterArenaDtor
+          nullptr,  // IsInitialized
+          &CancelMessage::MergeImpl,
+          ::google::protobuf::Message::GetNewImpl<CancelMessage>(),
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+          &CancelMessage::SharedDtor,
+          ::google::protobuf::Message::GetClearImpl<CancelMessage>(), &CancelMessage::ByteSizeLong,
+              &CancelMessage::_InternalSerialize,
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          PROTOBUF_FIELD_OFFSET(CancelMessage, _impl_._cached_size_),
+          false,
+      },
+      &CancelMessage::kDescriptorMethods,
+      &descriptor_table_messages_5fplanner_2eproto,
+      nullptr,  // tracker
+  };
+}
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 const
+    ::google::protobuf::internal::ClassDataFull CancelMessage_class_data_ =
+        CancelMessage::InternalGenerateClassData_();
+
+PROTOBUF_ATTRIBUTE_WEAK const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL
+CancelMessage::GetClassData() const {
+  ::google::protobuf::internal::PrefetchToLocalCache(&CancelMessage_class_data_);
+  ::google::protobuf::internal::PrefetchToLocalCache(CancelMessage_class_data_.tc_table);
+  return CancelMessage_class_data_.base();
+}
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<0, 1, 0, 0, 2>
+CancelMessage::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(CancelMessage, _impl_._has_bits_),
+    0, // no _extensions_
+    1, 0,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967294,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    1,  // num_field_entries
+    0,  // num_aux_entries
+    offsetof(decltype(_table_), field_names),  // no aux_entries
+    CancelMessage_class_data_.base(),
+    nullptr,  // post_loop_handler
+    ::_pbi::TcParser::GenericFallback,  // fallback
+    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
+    ::_pbi::TcParser::GetTable<::CancelMessage>(),  // to_prefetch
+    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
+  }, {{
+    // uint64 request_id = 1;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(CancelMessage, _impl_.request_id_), 0>(),
+     {8, 0, 0, PROTOBUF_FIELD_OFFSET(CancelMessage, _impl_.request_id_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // uint64 request_id = 1;
+    {PROTOBUF_FIELD_OFFSET(CancelMessage, _impl_.request_id_), _Internal::kHasBitsOffset + 0, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kUInt64)},
+  }},
+  // no aux_entries
+  {{
+  }},
+};
+PROTOBUF_NOINLINE void CancelMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:CancelMessage)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.request_id_ = ::uint64_t{0u};
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+::uint8_t* PROTOBUF_NONNULL CancelMessage::_InternalSerialize(
+    const ::google::protobuf::MessageLite& base, ::uint8_t* PROTOBUF_NONNULL target,
+    ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) {
+  const CancelMessage& this_ = static_cast<const CancelMessage&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+::uint8_t* PROTOBUF_NONNULL CancelMessage::_InternalSerialize(
+    ::uint8_t* PROTOBUF_NONNULL target,
+    ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const {
+  const CancelMessage& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  // @@protoc_insertion_point(serialize_to_array_start:CancelMessage)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  // uint64 request_id = 1;
+  if ((this_._impl_._has_bits_[0] & 0x00000001u) != 0) {
+    if (this_._internal_request_id() != 0) {
+      target = stream->EnsureSpace(target);
+      target = ::_pbi::WireFormatLite::WriteUInt64ToArray(
+          1, this_._internal_request_id(), target);
+    }
+  }
+
+  if (ABSL_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:CancelMessage)
+  return target;
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+::size_t CancelMessage::ByteSizeLong(const MessageLite& base) {
+  const CancelMessage& this_ = static_cast<const CancelMessage&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+::size_t CancelMessage::ByteSizeLong() const {
+  const CancelMessage& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  // @@protoc_insertion_point(message_byte_size_start:CancelMessage)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void)cached_has_bits;
+
+   {
+    // uint64 request_id = 1;
+    cached_has_bits = this_._impl_._has_bits_[0];
+    if ((cached_has_bits & 0x00000001u) != 0) {
+      if (this_._internal_request_id() != 0) {
+        total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(
+            this_._internal_request_id());
+      }
+    }
+  }
+  return this_.MaybeComputeUnknownFieldsSize(total_size,
+                                             &this_._impl_._cached_size_);
+}
+
+void CancelMessage::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
+  auto* const _this = static_cast<CancelMessage*>(&to_msg);
+  auto& from = static_cast<const CancelMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:CancelMessage)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if ((cached_has_bits & 0x00000001u) != 0) {
+    if (from._internal_request_id() != 0) {
+      _this->_impl_.request_id_ = from._impl_.request_id_;
+    }
+  }
+  _this->_impl_._has_bits_[0] |= cached_has_bits;
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CancelMessage::CopyFrom(const CancelMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:CancelMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+
+void CancelMessage::InternalSwap(CancelMessage* PROTOBUF_RESTRICT PROTOBUF_NONNULL other) {
+  using ::std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.request_id_, other->_impl_.request_id_);
+}
+
+::google::protobuf::Metadata CancelMessage::GetMetadata() const {
+  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
+}
+// ===================================================================
+
 class PlannerMessage::_Internal {
  public:
   using HasBits =
@@ -654,6 +995,13 @@ PlannerMessage::PlannerMessage(
   _impl_.drone_data_ = ((cached_has_bits & 0x00000001u) != 0)
                 ? ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.drone_data_)
                 : nullptr;
+  ::memcpy(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, request_id_),
+           reinterpret_cast<const char *>(&from._impl_) +
+               offsetof(Impl_, request_id_),
+           offsetof(Impl_, stream_routes_) -
+               offsetof(Impl_, request_id_) +
+               sizeof(Impl_::stream_routes_));
 
   // @@protoc_insertion_point(copy_constructor:PlannerMessage)
 }
@@ -665,7 +1013,12 @@ PROTOBUF_NDEBUG_INLINE PlannerMessage::Impl_::Impl_(
 
 inline void PlannerMessage::SharedCtor(::_pb::Arena* PROTOBUF_NULLABLE arena) {
   new (&_impl_) Impl_(internal_visibility(), arena);
-  _impl_.drone_data_ = {};
+  ::memset(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, drone_data_),
+           0,
+           offsetof(Impl_, stream_routes_) -
+               offsetof(Impl_, drone_data_) +
+               sizeof(Impl_::stream_routes_));
 }
 PlannerMessage::~PlannerMessage() {
   // @@protoc_insertion_point(destructor:PlannerMessage)
@@ -734,16 +1087,16 @@ PlannerMessage::GetClassData() const {
   return PlannerMessage_class_data_.base();
 }
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<1, 2, 2, 0, 2>
+const ::_pbi::TcParseTable<3, 5, 2, 0, 2>
 PlannerMessage::_table_ = {
   {
     PROTOBUF_FIELD_OFFSET(PlannerMessage, _impl_._has_bits_),
     0, // no _extensions_
-    2, 8,  // max_field_number, fast_idx_mask
+    5, 56,  // max_field_number, fast_idx_mask
     offsetof(decltype(_table_), field_lookup_table),
-    4294967292,  // skipmap
+    4294967264,  // skipmap
     offsetof(decltype(_table_), field_entries),
-    2,  // num_field_entries
+    5,  // num_field_entries
     2,  // num_aux_entries
     offsetof(decltype(_table_), aux_entries),
     PlannerMessage_class_data_.base(),
@@ -753,12 +1106,24 @@ PlannerMessage::_table_ = {
     ::_pbi::TcParser::GetTable<::PlannerMessage>(),  // to_prefetch
     #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
   }, {{
-    // .DroneData drone_data = 2;
-    {::_pbi::TcParser::FastMtS1,
-     {18, 0, 1, PROTOBUF_FIELD_OFFSET(PlannerMessage, _impl_.drone_data_)}},
+    {::_pbi::TcParser::MiniParse, {}},
     // repeated .SignalServerConfigProto signal_server_config = 1;
     {::_pbi::TcParser::FastMtR1,
      {10, 63, 0, PROTOBUF_FIELD_OFFSET(PlannerMessage, _impl_.signal_server_config_)}},
+    // .DroneData drone_data = 2;
+    {::_pbi::TcParser::FastMtS1,
+     {18, 0, 1, PROTOBUF_FIELD_OFFSET(PlannerMessage, _impl_.drone_data_)}},
+    // uint64 request_id = 3;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(PlannerMessage, _impl_.request_id_), 1>(),
+     {24, 1, 0, PROTOBUF_FIELD_OFFSET(PlannerMessage, _impl_.request_id_)}},
+    // bool compact_response = 4;
+    {::_pbi::TcParser::SingularVarintNoZag1<bool, offsetof(PlannerMessage, _impl_.compact_response_), 2>(),
+     {32, 2, 0, PROTOBUF_FIELD_OFFSET(PlannerMessage, _impl_.compact_response_)}},
+    // bool stream_routes = 5;
+    {::_pbi::TcParser::SingularVarintNoZag1<bool, offsetof(PlannerMessage, _impl_.stream_routes_), 3>(),
+     {40, 3, 0, PROTOBUF_FIELD_OFFSET(PlannerMessage, _impl_.stream_routes_)}},
+    {::_pbi::TcParser::MiniParse, {}},
+    {::_pbi::TcParser::MiniParse, {}},
   }}, {{
     65535, 65535
   }}, {{
@@ -768,6 +1133,15 @@ PlannerMessage::_table_ = {
     // .DroneData drone_data = 2;
     {PROTOBUF_FIELD_OFFSET(PlannerMessage, _impl_.drone_data_), _Internal::kHasBitsOffset + 0, 1,
     (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+    // uint64 request_id = 3;
+    {PROTOBUF_FIELD_OFFSET(PlannerMessage, _impl_.request_id_), _Internal::kHasBitsOffset + 1, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kUInt64)},
+    // bool compact_response = 4;
+    {PROTOBUF_FIELD_OFFSET(PlannerMessage, _impl_.compact_response_), _Internal::kHasBitsOffset + 2, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kBool)},
+    // bool stream_routes = 5;
+    {PROTOBUF_FIELD_OFFSET(PlannerMessage, _impl_.stream_routes_), _Internal::kHasBitsOffset + 3, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kBool)},
   }},
   {{
       {::_pbi::TcParser::GetTable<::SignalServerConfigProto>()},
@@ -789,6 +1163,11 @@ PROTOBUF_NOINLINE void PlannerMessage::Clear() {
     ABSL_DCHECK(_impl_.drone_data_ != nullptr);
     _impl_.drone_data_->Clear();
   }
+  if ((cached_has_bits & 0x0000000eu) != 0) {
+    ::memset(&_impl_.request_id_, 0, static_cast<::size_t>(
+        reinterpret_cast<char*>(&_impl_.stream_routes_) -
+        reinterpret_cast<char*>(&_impl_.request_id_)) + sizeof(_impl_.stream_routes_));
+  }
   _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
 }
@@ -827,6 +1206,33 @@ PROTOBUF_NOINLINE void PlannerMessage::Clear() {
         stream);
   }
 
+  // uint64 request_id = 3;
+  if ((cached_has_bits & 0x00000002u) != 0) {
+    if (this_._internal_request_id() != 0) {
+      target = stream->EnsureSpace(target);
+      target = ::_pbi::WireFormatLite::WriteUInt64ToArray(
+          3, this_._internal_request_id(), target);
+    }
+  }
+
+  // bool compact_response = 4;
+  if ((cached_has_bits & 0x00000004u) != 0) {
+    if (this_._internal_compact_response() != 0) {
+      target = stream->EnsureSpace(target);
+      target = ::_pbi::WireFormatLite::WriteBoolToArray(
+          4, this_._internal_compact_response(), target);
+    }
+  }
+
+  // bool stream_routes = 5;
+  if ((cached_has_bits & 0x00000008u) != 0) {
+    if (this_._internal_stream_routes() != 0) {
+      target = stream->EnsureSpace(target);
+      target = ::_pbi::WireFormatLite::WriteBoolToArray(
+          5, this_._internal_stream_routes(), target);
+    }
+  }
+
   if (ABSL_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
     target =
         ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
@@ -860,13 +1266,32 @@ PROTOBUF_NOINLINE void PlannerMessage::Clear() {
       }
     }
   }
-   {
+  cached_has_bits = this_._impl_._has_bits_[0];
+  if ((cached_has_bits & 0x0000000fu) != 0) {
     // .DroneData drone_data = 2;
-    cached_has_bits = this_._impl_._has_bits_[0];
     if ((cached_has_bits & 0x00000001u) != 0) {
       total_size += 1 +
                     ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.drone_data_);
     }
+    // uint64 request_id = 3;
+    if ((cached_has_bits & 0x00000002u) != 0) {
+      if (this_._internal_request_id() != 0) {
+        total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(
+            this_._internal_request_id());
+      }
+    }
+    // bool compact_response = 4;
+    if ((cached_has_bits & 0x00000004u) != 0) {
+      if (this_._internal_compact_response() != 0) {
+        total_size += 2;
+      }
+    }
+    // bool stream_routes = 5;
+    if ((cached_has_bits & 0x00000008u) != 0) {
+      if (this_._internal_stream_routes() != 0) {
+        total_size += 2;
+      }
+    }
   }
   return this_.MaybeComputeUnknownFieldsSize(total_size,
                                              &this_._impl_._cached_size_);
@@ -884,12 +1309,29 @@ void PlannerMessage::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::
   _this->_internal_mutable_signal_server_config()->MergeFrom(
       from._internal_signal_server_config());
   cached_has_bits = from._impl_._has_bits_[0];
-  if ((cached_has_bits & 0x00000001u) != 0) {
-    ABSL_DCHECK(from._impl_.drone_data_ != nullptr);
-    if (_this->_impl_.drone_data_ == nullptr) {
-      _this->_impl_.drone_data_ = ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.drone_data_);
-    } else {
-      _this->_impl_.drone_data_->MergeFrom(*from._impl_.drone_data_);
+  if ((cached_has_bits & 0x0000000fu) != 0) {
+    if ((cached_has_bits & 0x00000001u) != 0) {
+      ABSL_DCHECK(from._impl_.drone_data_ != nullptr);
+      if (_this->_impl_.drone_data_ == nullptr) {
+        _this->_impl_.drone_data_ = ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.drone_data_);
+      } else {
+        _this->_impl_.drone_data_->MergeFrom(*from._impl_.drone_data_);
+      }
+    }
+    if ((cached_has_bits & 0x00000002u) != 0) {
+      if (from._internal_request_id() != 0) {
+        _this->_impl_.request_id_ = from._impl_.request_id_;
+      }
+    }
+    if ((cached_has_bits & 0x00000004u) != 0) {
+      if (from._internal_compact_response() != 0) {
+        _this->_impl_.compact_response_ = from._impl_.compact_response_;
+      }
+    }
+    if ((cached_has_bits & 0x00000008u) != 0) {
+      if (from._internal_stream_routes() != 0) {
+        _this->_impl_.stream_routes_ = from._impl_.stream_routes_;
+      }
     }
   }
   _this->_impl_._has_bits_[0] |= cached_has_bits;
@@ -909,7 +1351,12 @@ void PlannerMessage::InternalSwap(PlannerMessage* PROTOBUF_RESTRICT PROTOBUF_NON
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
   _impl_.signal_server_config_.InternalSwap(&other->_impl_.signal_server_config_);
-  swap(_impl_.drone_data_, other->_impl_.drone_data_);
+  ::google::protobuf::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PlannerMessage, _impl_.stream_routes_)
+      + sizeof(PlannerMessage::_impl_.stream_routes_)
+      - PROTOBUF_FIELD_OFFSET(PlannerMessage, _impl_.drone_data_)>(
+          reinterpret_cast<char*>(&_impl_.drone_data_),
+          reinterpret_cast<char*>(&other->_impl_.drone_data_));
 }
 
 ::google::protobuf::Metadata PlannerMessage::GetMetadata() const {
@@ -1814,7 +2261,11 @@ PROTOBUF_NDEBUG_INLINE DroneData::Impl_::Impl_(
       : _has_bits_{from._has_bits_},
         _cached_size_{0},
         lon_{visibility, arena, from.lon_},
-        lat_{visibility, arena, from.lat_} {}
+        lat_{visibility, arena, from.lat_},
+        lon_e7_delta_{visibility, arena, from.lon_e7_delta_},
+        _lon_e7_delta_cached_byte_size_{0},
+        lat_e7_delta_{visibility, arena, from.lat_e7_delta_},
+        _lat_e7_delta_cached_byte_size_{0} {}
 
 DroneData::DroneData(
     ::google::protobuf::Arena* PROTOBUF_NULLABLE arena,
@@ -1838,7 +2289,11 @@ PROTOBUF_NDEBUG_INLINE DroneData::Impl_::Impl_(
     ::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
       : _cached_size_{0},
         lon_{visibility, arena},
-        lat_{visibility, arena} {}
+        lat_{visibility, arena},
+        lon_e7_delta_{visibility, arena},
+        _lon_e7_delta_cached_byte_size_{0},
+        lat_e7_delta_{visibility, arena},
+        _lat_e7_delta_cached_byte_size_{0} {}
 
 inline void DroneData::SharedCtor(::_pb::Arena* PROTOBUF_NULLABLE arena) {
   new (&_impl_) Impl_(internal_visibility(), arena);
@@ -1870,6 +2325,14 @@ constexpr auto DroneData::InternalNewImpl_() {
           decltype(DroneData::_impl_.lat_)::
               InternalGetArenaOffset(
                   ::google::protobuf::Message::internal_visibility()),
+      PROTOBUF_FIELD_OFFSET(DroneData, _impl_.lon_e7_delta_) +
+          decltype(DroneData::_impl_.lon_e7_delta_)::
+              InternalGetArenaOffset(
+                  ::google::protobuf::Message::internal_visibility()),
+      PROTOBUF_FIELD_OFFSET(DroneData, _impl_.lat_e7_delta_) +
+          decltype(DroneData::_impl_.lat_e7_delta_)::
+              InternalGetArenaOffset(
+                  ::google::protobuf::Message::internal_visibility()),
   });
   if (arena_bits.has_value()) {
     return ::google::protobuf::internal::MessageCreator::ZeroInit(
@@ -1914,16 +2377,16 @@ DroneData::GetClassData() const {
   return DroneData_class_data_.base();
 }
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<2, 3, 0, 0, 2>
+const ::_pbi::TcParseTable<3, 5, 0, 0, 2>
 DroneData::_table_ = {
   {
     PROTOBUF_FIELD_OFFSET(DroneData, _impl_._has_bits_),
     0, // no _extensions_
-    3, 24,  // max_field_number, fast_idx_mask
+    5, 56,  // max_field_number, fast_idx_mask
     offsetof(decltype(_table_), field_lookup_table),
-    4294967288,  // skipmap
+    4294967264,  // skipmap
     offsetof(decltype(_table_), field_entries),
-    3,  // num_field_entries
+    5,  // num_field_entries
     0,  // num_aux_entries
     offsetof(decltype(_table_), field_names),  // no aux_entries
     DroneData_class_data_.base(),
@@ -1943,6 +2406,14 @@ DroneData::_table_ = {
     // repeated double lat = 3;
     {::_pbi::TcParser::FastF64P1,
      {26, 63, 0, PROTOBUF_FIELD_OFFSET(DroneData, _impl_.lat_)}},
+    // repeated sint32 lon_e7_delta = 4;
+    {::_pbi::TcParser::FastZ32P1,
+     {34, 63, 0, PROTOBUF_FIELD_OFFSET(DroneData, _impl_.lon_e7_delta_)}},
+    // repeated sint32 lat_e7_delta = 5;
+    {::_pbi::TcParser::FastZ32P1,
+     {42, 63, 0, PROTOBUF_FIELD_OFFSET(DroneData, _impl_.lat_e7_delta_)}},
+    {::_pbi::TcParser::MiniParse, {}},
+    {::_pbi::TcParser::MiniParse, {}},
   }}, {{
     65535, 65535
   }}, {{
@@ -1955,6 +2426,12 @@ DroneData::_table_ = {
     // repeated double lat = 3;
     {PROTOBUF_FIELD_OFFSET(DroneData, _impl_.lat_), -1, 0,
     (0 | ::_fl::kFcRepeated | ::_fl::kPackedDouble)},
+    // repeated sint32 lon_e7_delta = 4;
+    {PROTOBUF_FIELD_OFFSET(DroneData, _impl_.lon_e7_delta_), -1, 0,
+    (0 | ::_fl::kFcRepeated | ::_fl::kPackedSInt32)},
+    // repeated sint32 lat_e7_delta = 5;
+    {PROTOBUF_FIELD_OFFSET(DroneData, _impl_.lat_e7_delta_), -1, 0,
+    (0 | ::_fl::kFcRepeated | ::_fl::kPackedSInt32)},
   }},
   // no aux_entries
   {{
@@ -1969,6 +2446,8 @@ PROTOBUF_NOINLINE void DroneData::Clear() {
 
   _impl_.lon_.Clear();
   _impl_.lat_.Clear();
+  _impl_.lon_e7_delta_.Clear();
+  _impl_.lat_e7_delta_.Clear();
   _impl_.num_drones_ = 0;
   _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
@@ -2008,6 +2487,24 @@ PROTOBUF_NOINLINE void DroneData::Clear() {
     target = stream->WriteFixedPacked(3, this_._internal_lat(), target);
   }
 
+  // repeated sint32 lon_e7_delta = 4;
+  {
+    int byte_size = this_._impl_._lon_e7_delta_cached_byte_size_.Get();
+    if (byte_size > 0) {
+      target = stream->WriteSInt32Packed(
+          4, this_._internal_lon_e7_delta(), byte_size, target);
+    }
+  }
+
+  // repeated sint32 lat_e7_delta = 5;
+  {
+    int byte_size = this_._impl_._lat_e7_delta_cached_byte_size_.Get();
+    if (byte_size > 0) {
+      target = stream->WriteSInt32Packed(
+          5, this_._internal_lat_e7_delta(), byte_size, target);
+    }
+  }
+
   if (ABSL_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
     target =
         ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
@@ -2053,6 +2550,20 @@ PROTOBUF_NOINLINE void DroneData::Clear() {
                               static_cast<::int32_t>(data_size));
       total_size += tag_size + data_size;
     }
+    // repeated sint32 lon_e7_delta = 4;
+    {
+      total_size +=
+          ::_pbi::WireFormatLite::SInt32SizeWithPackedTagSize(
+              this_._internal_lon_e7_delta(), 1,
+              this_._impl_._lon_e7_delta_cached_byte_size_);
+    }
+    // repeated sint32 lat_e7_delta = 5;
+    {
+      total_size +=
+          ::_pbi::WireFormatLite::SInt32SizeWithPackedTagSize(
+              this_._internal_lat_e7_delta(), 1,
+              this_._impl_._lat_e7_delta_cached_byte_size_);
+    }
   }
    {
     // int32 num_drones = 1;
@@ -2078,6 +2589,8 @@ void DroneData::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::googl
 
   _this->_internal_mutable_lon()->MergeFrom(from._internal_lon());
   _this->_internal_mutable_lat()->MergeFrom(from._internal_lat());
+  _this->_internal_mutable_lon_e7_delta()->MergeFrom(from._internal_lon_e7_delta());
+  _this->_internal_mutable_lat_e7_delta()->MergeFrom(from._internal_lat_e7_delta());
   cached_has_bits = from._impl_._has_bits_[0];
   if ((cached_has_bits & 0x00000001u) != 0) {
     if (from._internal_num_drones() != 0) {
@@ -2102,6 +2615,8 @@ void DroneData::InternalSwap(DroneData* PROTOBUF_RESTRICT PROTOBUF_NONNULL other
   swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
   _impl_.lon_.InternalSwap(&other->_impl_.lon_);
   _impl_.lat_.InternalSwap(&other->_impl_.lat_);
+  _impl_.lon_e7_delta_.InternalSwap(&other->_impl_.lon_e7_delta_);
+  _impl_.lat_e7_delta_.InternalSwap(&other->_impl_.lat_e7_delta_);
   swap(_impl_.num_drones_, other->_impl_.num_drones_);
 }
 
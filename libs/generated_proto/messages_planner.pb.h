@@ -52,6 +52,10 @@ struct TableStruct_messages_5fplanner_2eproto {
 extern "C" {
 extern const ::google::protobuf::internal::DescriptorTable descriptor_table_messages_5fplanner_2eproto;
 }  // extern "C"
+class CancelMessage;
+struct CancelMessageDefaultTypeInternal;
+extern CancelMessageDefaultTypeInternal _CancelMessage_default_instance_;
+extern const ::google::protobuf::internal::ClassDataFull CancelMessage_class_data_;
 class DroneData;
 struct DroneDataDefaultTypeInternal;
 extern DroneDataDefaultTypeInternal _DroneData_default_instance_;
@@ -134,7 +138,7 @@ class SignalServerConfigProto final : public ::google::protobuf::Message
     return *reinterpret_cast<const SignalServerConfigProto*>(
         &_SignalServerConfigProto_default_instance_);
   }
-  static constexpr int kIndexInFileMessages = 2;
+  static constexpr int kIndexInFileMessages = 3;
   friend void swap(SignalServerConfigProto& a, SignalServerConfigProto& b) { a.Swap(&b); }
   inline void Swap(SignalServerConfigProto* PROTOBUF_NONNULL other) {
     if (other == this) return;
@@ -655,7 +659,7 @@ class DroneData final : public ::google::protobuf::Message
     return *reinterpret_cast<const DroneData*>(
         &_DroneData_default_instance_);
   }
-  static constexpr int kIndexInFileMessages = 3;
+  static constexpr int kIndexInFileMessages = 4;
   friend void swap(DroneData& a, DroneData& b) { a.Swap(&b); }
   inline void Swap(DroneData* PROTOBUF_NONNULL other) {
     if (other == this) return;
@@ -745,6 +749,8 @@ class DroneData final : public ::google::protobuf::Message
   enum : int {
     kLonFieldNumber = 2,
     kLatFieldNumber = 3,
+    kLonE7DeltaFieldNumber = 4,
+    kLatE7DeltaFieldNumber = 5,
     kNumDronesFieldNumber = 1,
   };
   // repeated double lon = 2;
@@ -782,6 +788,42 @@ class DroneData final : public ::google::protobuf::Message
   const ::google::protobuf::RepeatedField<double>& _internal_lat() const;
   ::google::protobuf::RepeatedField<double>* PROTOBUF_NONNULL _internal_mutable_lat();
 
+  public:
+  // repeated sint32 lon_e7_delta = 4;
+  int lon_e7_delta_size() const;
+  private:
+  int _internal_lon_e7_delta_size() const;
+
+  public:
+  void clear_lon_e7_delta() ;
+  ::int32_t lon_e7_delta(int index) const;
+  void set_lon_e7_delta(int index, ::int32_t value);
+  void add_lon_e7_delta(::int32_t value);
+  const ::google::protobuf::RepeatedField<::int32_t>& lon_e7_delta() const;
+  ::google::protobuf::RepeatedField<::int32_t>* PROTOBUF_NONNULL mutable_lon_e7_delta();
+
+  private:
+  const ::google::protobuf::RepeatedField<::int32_t>& _internal_lon_e7_delta() const;
+  ::google::protobuf::RepeatedField<::int32_t>* PROTOBUF_NONNULL _internal_mutable_lon_e7_delta();
+
+  public:
+  // repeated sint32 lat_e7_delta = 5;
+  int lat_e7_delta_size() const;
+  private:
+  int _internal_lat_e7_delta_size() const;
+
+  public:
+  void clear_lat_e7_delta() ;
+  ::int32_t lat_e7_delta(int index) const;
+  void set_lat_e7_delta(int index, ::int32_t value);
+  void add_lat_e7_delta(::int32_t value);
+  const ::google::protobuf::RepeatedField<::int32_t>& lat_e7_delta() const;
+  ::google::protobuf::RepeatedField<::int32_t>* PROTOBUF_NONNULL mutable_lat_e7_delta();
+
+  private:
+  const ::google::protobuf::RepeatedField<::int32_t>& _internal_lat_e7_delta() const;
+  ::google::protobuf::RepeatedField<::int32_t>* PROTOBUF_NONNULL _internal_mutable_lat_e7_delta();
+
   public:
   // int32 num_drones = 1;
   void clear_num_drones() ;
@@ -797,7 +839,7 @@ class DroneData final : public ::google::protobuf::Message
  private:
   class _Internal;
   friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<2, 3,
+  static const ::google::protobuf::internal::TcParseTable<3, 5,
                                    0, 0,
                                    2>
       _table_;
@@ -821,6 +863,10 @@ class DroneData final : public ::google::protobuf::Message
     ::google::protobuf::internal::CachedSize _cached_size_;
     ::google::protobuf::RepeatedField<double> lon_;
     ::google::protobuf::RepeatedField<double> lat_;
+    ::google::protobuf::RepeatedField<::int32_t> lon_e7_delta_;
+    ::google::protobuf::internal::CachedSize _lon_e7_delta_cached_byte_size_;
+    ::google::protobuf::RepeatedField<::int32_t> lat_e7_delta_;
+    ::google::protobuf::internal::CachedSize _lat_e7_delta_cached_byte_size_;
     ::int32_t num_drones_;
     PROTOBUF_TSAN_DECLARE_MEMBER
   };
@@ -831,6 +877,197 @@ class DroneData final : public ::google::protobuf::Message
 extern const ::google::protobuf::internal::ClassDataFull DroneData_class_data_;
 // -------------------------------------------------------------------
 
+class CancelMessage final : public ::google::protobuf::Message
+/* @@protoc_insertion_point(class_definition:CancelMessage) */ {
+ public:
+  inline CancelMessage() : CancelMessage(nullptr) {}
+  ~CancelMessage() PROTOBUF_FINAL;
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+  void operator delete(CancelMessage* PROTOBUF_NONNULL msg, std::destroying_delete_t) {
+    SharedDtor(*msg);
+    ::google::protobuf::internal::SizedDelete(msg, sizeof(CancelMessage));
+  }
+#endif
+
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR CancelMessage(::google::protobuf::internal::ConstantInitialized);
+
+  inline CancelMessage(const CancelMessage& from) : CancelMessage(nullptr, from) {}
+  inline CancelMessage(CancelMessage&& from) noexcept
+      : CancelMessage(nullptr, ::std::move(from)) {}
+  inline CancelMessage& operator=(const CancelMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CancelMessage& operator=(CancelMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* PROTOBUF_NONNULL mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* PROTOBUF_NONNULL descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* PROTOBUF_NONNULL GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* PROTOBUF_NONNULL GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CancelMessage& default_instance() {
+    return *reinterpret_cast<const CancelMessage*>(
+        &_CancelMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages = 1;
+  friend void swap(CancelMessage& a, CancelMessage& b) { a.Swap(&b); }
+  inline void Swap(CancelMessage* PROTOBUF_NONNULL other) {
+    if (other == this) return;
+    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CancelMessage* PROTOBUF_NONNULL other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CancelMessage* PROTOBUF_NONNULL New(::google::protobuf::Arena* PROTOBUF_NULLABLE arena = nullptr) const {
+    return ::google::protobuf::Message::DefaultConstruct<CancelMessage>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const CancelMessage& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom(const CancelMessage& from) { CancelMessage::MergeImpl(*this, from); }
+
+  private:
+  static void MergeImpl(::google::protobuf::MessageLite& to_msg,
+                        const ::google::protobuf::MessageLite& from_msg);
+
+  public:
+  bool IsInitialized() const {
+    return true;
+  }
+  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
+  #if defined(PROTOBUF_CUSTOM_VTABLE)
+  private:
+  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
+  static ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
+      const ::google::protobuf::MessageLite& msg, ::uint8_t* PROTOBUF_NONNULL target,
+      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream);
+
+  public:
+  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
+  ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
+      ::uint8_t* PROTOBUF_NONNULL target,
+      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const {
+    return _InternalSerialize(*this, target, stream);
+  }
+  #else   // PROTOBUF_CUSTOM_VTABLE
+  ::size_t ByteSizeLong() const final;
+  ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
+      ::uint8_t* PROTOBUF_NONNULL target,
+      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const final;
+  #endif  // PROTOBUF_CUSTOM_VTABLE
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  static void SharedDtor(MessageLite& self);
+  void InternalSwap(CancelMessage* PROTOBUF_NONNULL other);
+ private:
+  template <typename T>
+  friend ::absl::string_view(::google::protobuf::internal::GetAnyMessageName)();
+  static ::absl::string_view FullMessageName() { return "CancelMessage"; }
+
+ protected:
+  explicit CancelMessage(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  CancelMessage(::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const CancelMessage& from);
+  CancelMessage(
+      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, CancelMessage&& from) noexcept
+      : CancelMessage(arena) {
+    *this = ::std::move(from);
+  }
+  const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL GetClassData() const PROTOBUF_FINAL;
+  static void* PROTOBUF_NONNULL PlacementNew_(
+      const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
+      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  static constexpr auto InternalNewImpl_();
+
+ public:
+  static constexpr auto InternalGenerateClassData_();
+
+  ::google::protobuf::Metadata GetMetadata() const;
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+  enum : int {
+    kRequestIdFieldNumber = 1,
+  };
+  // uint64 request_id = 1;
+  void clear_request_id() ;
+  ::uint64_t request_id() const;
+  void set_request_id(::uint64_t value);
+
+  private:
+  ::uint64_t _internal_request_id() const;
+  void _internal_set_request_id(::uint64_t value);
+
+  public:
+  // @@protoc_insertion_point(class_scope:CancelMessage)
+ private:
+  class _Internal;
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<0, 1,
+                                   0, 0,
+                                   2>
+      _table_;
+
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+    inline explicit constexpr Impl_(::google::protobuf::internal::ConstantInitialized) noexcept;
+    inline explicit Impl_(
+        ::google::protobuf::internal::InternalVisibility visibility,
+        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+    inline explicit Impl_(
+        ::google::protobuf::internal::InternalVisibility visibility,
+        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
+        const CancelMessage& from_msg);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    ::google::protobuf::internal::CachedSize _cached_size_;
+    ::uint64_t request_id_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_5fplanner_2eproto;
+};
+
+extern const ::google::protobuf::internal::ClassDataFull CancelMessage_class_data_;
+// -------------------------------------------------------------------
+
 class PlannerMessage final : public ::google::protobuf::Message
 /* @@protoc_insertion_point(class_definition:PlannerMessage) */ {
  public:
@@ -886,7 +1123,7 @@ class PlannerMessage final : public ::google::protobuf::Message
     return *reinterpret_cast<const PlannerMessage*>(
         &_PlannerMessage_default_instance_);
   }
-  static constexpr int kIndexInFileMessages = 1;
+  static constexpr int kIndexInFileMessages = 2;
   friend void swap(PlannerMessage& a, PlannerMessage& b) { a.Swap(&b); }
   inline void Swap(PlannerMessage* PROTOBUF_NONNULL other) {
     if (other == this) return;
@@ -976,6 +1213,9 @@ class PlannerMessage final : public ::google::protobuf::Message
   enum : int {
     kSignalServerConfigFieldNumber = 1,
     kDroneDataFieldNumber = 2,
+    kRequestIdFieldNumber = 3,
+    kCompactResponseFieldNumber = 4,
+    kStreamRoutesFieldNumber = 5,
   };
   // repeated .SignalServerConfigProto signal_server_config = 1;
   int signal_server_config_size() const;
@@ -1008,12 +1248,42 @@ class PlannerMessage final : public ::google::protobuf::Message
   const ::DroneData& _internal_drone_data() const;
   ::DroneData* PROTOBUF_NONNULL _internal_mutable_drone_data();
 
+  public:
+  // uint64 request_id = 3;
+  void clear_request_id() ;
+  ::uint64_t request_id() const;
+  void set_request_id(::uint64_t value);
+
+  private:
+  ::uint64_t _internal_request_id() const;
+  void _internal_set_request_id(::uint64_t value);
+
+  public:
+  // bool compact_response = 4;
+  void clear_compact_response() ;
+  bool compact_response() const;
+  void set_compact_response(bool value);
+
+  private:
+  bool _internal_compact_response() const;
+  void _internal_set_compact_response(bool value);
+
+  public:
+  // bool stream_routes = 5;
+  void clear_stream_routes() ;
+  bool stream_routes() const;
+  void set_stream_routes(bool value);
+
+  private:
+  bool _internal_stream_routes() const;
+  void _internal_set_stream_routes(bool value);
+
   public:
   // @@protoc_insertion_point(class_scope:PlannerMessage)
  private:
   class _Internal;
   friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<1, 2,
+  static const ::google::protobuf::internal::TcParseTable<3, 5,
                                    2, 0,
                                    2>
       _table_;
@@ -1037,6 +1307,9 @@ class PlannerMessage final : public ::google::protobuf::Message
     ::google::protobuf::internal::CachedSize _cached_size_;
     ::google::protobuf::RepeatedPtrField< ::SignalServerConfigProto > signal_server_config_;
     ::DroneData* PROTOBUF_NULLABLE drone_data_;
+    ::uint64_t request_id_;
+    bool compact_response_;
+    bool stream_routes_;
     PROTOBUF_TSAN_DECLARE_MEMBER
   };
   union { Impl_ _impl_; };
@@ -1103,6 +1376,7 @@ class Wrapper final : public ::google::protobuf::Message
   }
   enum PayloadCase {
     kPlannerMessage = 1,
+    kCancelMessage = 2,
     PAYLOAD_NOT_SET = 0,
   };
   static constexpr int kIndexInFileMessages = 0;
@@ -1194,6 +1468,7 @@ class Wrapper final : public ::google::protobuf::Message
   // accessors -------------------------------------------------------
   enum : int {
     kPlannerMessageFieldNumber = 1,
+    kCancelMessageFieldNumber = 2,
   };
   // .PlannerMessage planner_message = 1;
   bool has_planner_message() const;
@@ -1213,6 +1488,25 @@ class Wrapper final : public ::google::protobuf::Message
   const ::PlannerMessage& _internal_planner_message() const;
   ::PlannerMessage* PROTOBUF_NONNULL _internal_mutable_planner_message();
 
+  public:
+  // .CancelMessage cancel_message = 2;
+  bool has_cancel_message() const;
+  private:
+  bool _internal_has_cancel_message() const;
+
+  public:
+  void clear_cancel_message() ;
+  const ::CancelMessage& cancel_message() const;
+  [[nodiscard]] ::CancelMessage* PROTOBUF_NULLABLE release_cancel_message();
+  ::CancelMessage* PROTOBUF_NONNULL mutable_cancel_message();
+  void set_allocated_cancel_message(::CancelMessage* PROTOBUF_NULLABLE value);
+  void unsafe_arena_set_allocated_cancel_message(::CancelMessage* PROTOBUF_NULLABLE value);
+  ::CancelMessage* PROTOBUF_NULLABLE unsafe_arena_release_cancel_message();
+
+  private:
+  const ::CancelMessage& _internal_cancel_message() const;
+  ::CancelMessage* PROTOBUF_NONNULL _internal_mutable_cancel_message();
+
   public:
   void clear_payload();
   PayloadCase payload_case() const;
@@ -1220,11 +1514,12 @@ class Wrapper final : public ::google::protobuf::Message
  private:
   class _Internal;
   void set_has_planner_message();
+  void set_has_cancel_message();
   inline bool has_payload() const;
   inline void clear_has_payload();
   friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<0, 1,
-                                   1, 0,
+  static const ::google::protobuf::internal::TcParseTable<0, 2,
+                                   2, 0,
                                    2>
       _table_;
 
@@ -1247,6 +1542,7 @@ class Wrapper final : public ::google::protobuf::Message
       constexpr PayloadUnion() : _constinit_{} {}
       ::google::protobuf::internal::ConstantInitialized _constinit_;
       ::PlannerMessage* PROTOBUF_NULLABLE planner_message_;
+      ::CancelMessage* PROTOBUF_NULLABLE cancel_message_;
     } payload_;
     ::google::protobuf::internal::CachedSize _cached_size_;
     ::uint32_t _oneof_case_[1];
@@ -1355,6 +1651,87 @@ inline ::PlannerMessage* PROTOBUF_NONNULL Wrapper::mutable_planner_message()
   return _msg;
 }
 
+// .CancelMessage cancel_message = 2;
+inline bool Wrapper::has_cancel_message() const {
+  return payload_case() == kCancelMessage;
+}
+inline bool Wrapper::_internal_has_cancel_message() const {
+  return payload_case() == kCancelMessage;
+}
+inline void Wrapper::set_has_cancel_message() {
+  _impl_._oneof_case_[0] = kCancelMessage;
+}
+inline void Wrapper::clear_cancel_message() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  if (payload_case() == kCancelMessage) {
+    if (GetArena() == nullptr) {
+      delete _impl_.payload_.cancel_message_;
+    } else if (::google::protobuf::internal::DebugHardenClearOneofMessageOnArena()) {
+      ::google::protobuf::internal::MaybePoisonAfterClear(_impl_.payload_.cancel_message_);
+    }
+    clear_has_payload();
+  }
+}
+inline ::CancelMessage* PROTOBUF_NULLABLE Wrapper::release_cancel_message() {
+  // @@protoc_insertion_point(field_release:Wrapper.cancel_message)
+  if (payload_case() == kCancelMessage) {
+    clear_has_payload();
+    auto* temp = _impl_.payload_.cancel_message_;
+    if (GetArena() != nullptr) {
+      temp = ::google::protobuf::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.payload_.cancel_message_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::CancelMessage& Wrapper::_internal_cancel_message() const {
+  return payload_case() == kCancelMessage ? *_impl_.payload_.cancel_message_ : reinterpret_cast<::CancelMessage&>(::_CancelMessage_default_instance_);
+}
+inline const ::CancelMessage& Wrapper::cancel_message() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:Wrapper.cancel_message)
+  return _internal_cancel_message();
+}
+inline ::CancelMessage* PROTOBUF_NULLABLE Wrapper::unsafe_arena_release_cancel_message() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:Wrapper.cancel_message)
+  if (payload_case() == kCancelMessage) {
+    clear_has_payload();
+    auto* temp = _impl_.payload_.cancel_message_;
+    _impl_.payload_.cancel_message_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Wrapper::unsafe_arena_set_allocated_cancel_message(
+    ::CancelMessage* PROTOBUF_NULLABLE value) {
+  // We rely on the oneof clear method to free the earlier contents
+  // of this oneof. We can directly use the pointer we're given to
+  // set the new value.
+  clear_payload();
+  if (value) {
+    set_has_cancel_message();
+    _impl_.payload_.cancel_message_ = value;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Wrapper.cancel_message)
+}
+inline ::CancelMessage* PROTOBUF_NONNULL Wrapper::_internal_mutable_cancel_message() {
+  if (payload_case() != kCancelMessage) {
+    clear_payload();
+    set_has_cancel_message();
+    _impl_.payload_.cancel_message_ = 
+        ::google::protobuf::Message::DefaultConstruct<::CancelMessage>(GetArena());
+  }
+  return _impl_.payload_.cancel_message_;
+}
+inline ::CancelMessage* PROTOBUF_NONNULL Wrapper::mutable_cancel_message()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::CancelMessage* _msg = _internal_mutable_cancel_message();
+  // @@protoc_insertion_point(field_mutable:Wrapper.cancel_message)
+  return _msg;
+}
+
 inline bool Wrapper::has_payload() const {
   return payload_case() != PAYLOAD_NOT_SET;
 }
@@ -1366,6 +1743,34 @@ inline Wrapper::PayloadCase Wrapper::payload_case() const {
 }
 // -------------------------------------------------------------------
 
+// CancelMessage
+
+// uint64 request_id = 1;
+inline void CancelMessage::clear_request_id() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.request_id_ = ::uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline ::uint64_t CancelMessage::request_id() const {
+  // @@protoc_insertion_point(field_get:CancelMessage.request_id)
+  return _internal_request_id();
+}
+inline void CancelMessage::set_request_id(::uint64_t value) {
+  _internal_set_request_id(value);
+  _impl_._has_bits_[0] |= 0x00000001u;
+  // @@protoc_insertion_point(field_set:CancelMessage.request_id)
+}
+inline ::uint64_t CancelMessage::_internal_request_id() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.request_id_;
+}
+inline void CancelMessage::_internal_set_request_id(::uint64_t value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.request_id_ = value;
+}
+
+// -------------------------------------------------------------------
+
 // PlannerMessage
 
 // repeated .SignalServerConfigProto signal_server_config = 1;
@@ -1516,6 +1921,78 @@ inline void PlannerMessage::set_allocated_drone_data(::DroneData* PROTOBUF_NULLA
   // @@protoc_insertion_point(field_set_allocated:PlannerMessage.drone_data)
 }
 
+// uint64 request_id = 3;
+inline void PlannerMessage::clear_request_id() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.request_id_ = ::uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline ::uint64_t PlannerMessage::request_id() const {
+  // @@protoc_insertion_point(field_get:PlannerMessage.request_id)
+  return _internal_request_id();
+}
+inline void PlannerMessage::set_request_id(::uint64_t value) {
+  _internal_set_request_id(value);
+  _impl_._has_bits_[0] |= 0x00000002u;
+  // @@protoc_insertion_point(field_set:PlannerMessage.request_id)
+}
+inline ::uint64_t PlannerMessage::_internal_request_id() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.request_id_;
+}
+inline void PlannerMessage::_internal_set_request_id(::uint64_t value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.request_id_ = value;
+}
+
+// bool compact_response = 4;
+inline void PlannerMessage::clear_compact_response() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.compact_response_ = false;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline bool PlannerMessage::compact_response() const {
+  // @@protoc_insertion_point(field_get:PlannerMessage.compact_response)
+  return _internal_compact_response();
+}
+inline void PlannerMessage::set_compact_response(bool value) {
+  _internal_set_compact_response(value);
+  _impl_._has_bits_[0] |= 0x00000004u;
+  // @@protoc_insertion_point(field_set:PlannerMessage.compact_response)
+}
+inline bool PlannerMessage::_internal_compact_response() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.compact_response_;
+}
+inline void PlannerMessage::_internal_set_compact_response(bool value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.compact_response_ = value;
+}
+
+// bool stream_routes = 5;
+inline void PlannerMessage::clear_stream_routes() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.stream_routes_ = false;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline bool PlannerMessage::stream_routes() const {
+  // @@protoc_insertion_point(field_get:PlannerMessage.stream_routes)
+  return _internal_stream_routes();
+}
+inline void PlannerMessage::set_stream_routes(bool value) {
+  _internal_set_stream_routes(value);
+  _impl_._has_bits_[0] |= 0x00000008u;
+  // @@protoc_insertion_point(field_set:PlannerMessage.stream_routes)
+}
+inline bool PlannerMessage::_internal_stream_routes() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.stream_routes_;
+}
+inline void PlannerMessage::_internal_set_stream_routes(bool value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.stream_routes_ = value;
+}
+
 // -------------------------------------------------------------------
 
 // SignalServerConfigProto
@@ -2482,6 +2959,98 @@ DroneData::_internal_mutable_lat() {
   return &_impl_.lat_;
 }
 
+// repeated sint32 lon_e7_delta = 4;
+inline int DroneData::_internal_lon_e7_delta_size() const {
+  return _internal_lon_e7_delta().size();
+}
+inline int DroneData::lon_e7_delta_size() const {
+  return _internal_lon_e7_delta_size();
+}
+inline void DroneData::clear_lon_e7_delta() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.lon_e7_delta_.Clear();
+}
+inline ::int32_t DroneData::lon_e7_delta(int index) const {
+  // @@protoc_insertion_point(field_get:DroneData.lon_e7_delta)
+  return _internal_lon_e7_delta().Get(index);
+}
+inline void DroneData::set_lon_e7_delta(int index, ::int32_t value) {
+  _internal_mutable_lon_e7_delta()->Set(index, value);
+  // @@protoc_insertion_point(field_set:DroneData.lon_e7_delta)
+}
+inline void DroneData::add_lon_e7_delta(::int32_t value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _internal_mutable_lon_e7_delta()->Add(value);
+  // @@protoc_insertion_point(field_add:DroneData.lon_e7_delta)
+}
+inline const ::google::protobuf::RepeatedField<::int32_t>& DroneData::lon_e7_delta() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:DroneData.lon_e7_delta)
+  return _internal_lon_e7_delta();
+}
+inline ::google::protobuf::RepeatedField<::int32_t>* PROTOBUF_NONNULL DroneData::mutable_lon_e7_delta()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:DroneData.lon_e7_delta)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  return _internal_mutable_lon_e7_delta();
+}
+inline const ::google::protobuf::RepeatedField<::int32_t>&
+DroneData::_internal_lon_e7_delta() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.lon_e7_delta_;
+}
+inline ::google::protobuf::RepeatedField<::int32_t>* PROTOBUF_NONNULL
+DroneData::_internal_mutable_lon_e7_delta() {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return &_impl_.lon_e7_delta_;
+}
+
+// repeated sint32 lat_e7_delta = 5;
+inline int DroneData::_internal_lat_e7_delta_size() const {
+  return _internal_lat_e7_delta().size();
+}
+inline int DroneData::lat_e7_delta_size() const {
+  return _internal_lat_e7_delta_size();
+}
+inline void DroneData::clear_lat_e7_delta() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.lat_e7_delta_.Clear();
+}
+inline ::int32_t DroneData::lat_e7_delta(int index) const {
+  // @@protoc_insertion_point(field_get:DroneData.lat_e7_delta)
+  return _internal_lat_e7_delta().Get(index);
+}
+inline void DroneData::set_lat_e7_delta(int index, ::int32_t value) {
+  _internal_mutable_lat_e7_delta()->Set(index, value);
+  // @@protoc_insertion_point(field_set:DroneData.lat_e7_delta)
+}
+inline void DroneData::add_lat_e7_delta(::int32_t value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _internal_mutable_lat_e7_delta()->Add(value);
+  // @@protoc_insertion_point(field_add:DroneData.lat_e7_delta)
+}
+inline const ::google::protobuf::RepeatedField<::int32_t>& DroneData::lat_e7_delta() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:DroneData.lat_e7_delta)
+  return _internal_lat_e7_delta();
+}
+inline ::google::protobuf::RepeatedField<::int32_t>* PROTOBUF_NONNULL DroneData::mutable_lat_e7_delta()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:DroneData.lat_e7_delta)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  return _internal_mutable_lat_e7_delta();
+}
+inline const ::google::protobuf::RepeatedField<::int32_t>&
+DroneData::_internal_lat_e7_delta() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.lat_e7_delta_;
+}
+inline ::google::protobuf::RepeatedField<::int32_t>* PROTOBUF_NONNULL
+DroneData::_internal_mutable_lat_e7_delta() {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return &_impl_.lat_e7_delta_;
+}
+
 #ifdef __GNUC__
 #pragma GCC diagnostic pop
 #endif  // __GNUC__
@@ -30,7 +30,20 @@ inline constexpr Status::Impl_::Impl_(
       : _cached_size_{0},
         type_status_(
             &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()) {}
+            ::_pbi::ConstantInitialized()),
+        profile_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        mission_id_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        request_id_{::uint64_t{0u}},
+        compact_coordinates_{false},
+        queued_missions_{0u},
+        planned_missions_{0u},
+        last_mission_latency_ms_{::uint64_t{0u}},
+        typed_status_{},
+        _oneof_case_{} {}
 
 template <typename>
 PROTOBUF_CONSTEXPR Status::Status(::_pbi::ConstantInitialized)
@@ -56,6 +69,10 @@ inline constexpr PlannerResponse::Impl_::Impl_(
     ::_pbi::ConstantInitialized) noexcept
       : lon_{},
         lat_{},
+        lon_e7_delta_{},
+        _lon_e7_delta_cached_byte_size_{0},
+        lat_e7_delta_{},
+        _lat_e7_delta_cached_byte_size_{0},
         _cached_size_{0} {}
 
 template <typename>
@@ -127,6 +144,9 @@ inline constexpr Command::Impl_::Impl_(
     ::_pbi::ConstantInitialized) noexcept
       : _cached_size_{0},
         command_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
+        mission_id_(
             &::google::protobuf::internal::fixed_address_empty_string,
             ::_pbi::ConstantInitialized()) {}
 
@@ -202,10 +222,39 @@ struct WrapperDroneDefaultTypeInternal {
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
     PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 WrapperDroneDefaultTypeInternal _WrapperDrone_default_instance_;
 
+inline constexpr PlannerRoute::Impl_::Impl_(
+    ::_pbi::ConstantInitialized) noexcept
+      : _cached_size_{0},
+        route_{nullptr},
+        request_id_{::uint64_t{0u}},
+        drone_{0u} {}
+
+template <typename>
+PROTOBUF_CONSTEXPR PlannerRoute::PlannerRoute(::_pbi::ConstantInitialized)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(PlannerRoute_class_data_.base()),
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(),
+#endif  // PROTOBUF_CUSTOM_VTABLE
+      _impl_(::_pbi::ConstantInitialized()) {
+}
+struct PlannerRouteDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PlannerRouteDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PlannerRouteDefaultTypeInternal() {}
+  union {
+    PlannerRoute _instance;
+  };
+};
+
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
+    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PlannerRouteDefaultTypeInternal _PlannerRoute_default_instance_;
+
 inline constexpr PlannerResponseList::Impl_::Impl_(
     ::_pbi::ConstantInitialized) noexcept
-      : items_{},
-        _cached_size_{0} {}
+      : _cached_size_{0},
+        items_{},
+        request_id_{::uint64_t{0u}},
+        streamed_routes_{0u} {}
 
 template <typename>
 PROTOBUF_CONSTEXPR PlannerResponseList::PlannerResponseList(::_pbi::ConstantInitialized)
@@ -259,6 +308,9 @@ inline constexpr Config_mission::Impl_::Impl_(
         drone_sim_(
             &::google::protobuf::internal::fixed_address_empty_string,
             ::_pbi::ConstantInitialized()),
+        mission_id_(
+            &::google::protobuf::internal::fixed_address_empty_string,
+            ::_pbi::ConstantInitialized()),
         planner_config_{nullptr},
         info_planner_{nullptr},
         info_drone_{nullptr} {}
@@ -308,8 +360,8 @@ struct WrapperFromClientDefaultTypeInternal {
 
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
     PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 WrapperFromClientDefaultTypeInternal _WrapperFromClient_default_instance_;
-static constexpr const ::_pb::EnumDescriptor *PROTOBUF_NONNULL *PROTOBUF_NULLABLE
-    file_level_enum_descriptors_messages_5fpld_2eproto = nullptr;
+static const ::_pb::EnumDescriptor* PROTOBUF_NONNULL
+    file_level_enum_descriptors_messages_5fpld_2eproto[3];
 static constexpr const ::_pb::ServiceDescriptor *PROTOBUF_NONNULL *PROTOBUF_NULLABLE
     file_level_service_descriptors_messages_5fpld_2eproto = nullptr;
 const ::uint32_t
@@ -319,21 +371,62 @@ const ::uint32_t
         PROTOBUF_FIELD_OFFSET(::WrapperPlanner, _impl_._oneof_case_[0]),
         ::_pbi::kInvalidFieldOffsetTag,
         ::_pbi::kInvalidFieldOffsetTag,
+        ::_pbi::kInvalidFieldOffsetTag,
         PROTOBUF_FIELD_OFFSET(::WrapperPlanner, _impl_.payload_),
         0x004, // bitmap
         PROTOBUF_FIELD_OFFSET(::WrapperDrone, _impl_._oneof_case_[0]),
         ::_pbi::kInvalidFieldOffsetTag,
         PROTOBUF_FIELD_OFFSET(::WrapperDrone, _impl_.payload_),
-        0x000, // bitmap
+        0x081, // bitmap
+        PROTOBUF_FIELD_OFFSET(::PlannerResponseList, _impl_._has_bits_),
+        6, // hasbit index offset
         PROTOBUF_FIELD_OFFSET(::PlannerResponseList, _impl_.items_),
+        PROTOBUF_FIELD_OFFSET(::PlannerResponseList, _impl_.request_id_),
+        PROTOBUF_FIELD_OFFSET(::PlannerResponseList, _impl_.streamed_routes_),
+        ~0u,
+        0,
+        1,
+        0x081, // bitmap
+        PROTOBUF_FIELD_OFFSET(::PlannerRoute, _impl_._has_bits_),
+        6, // hasbit index offset
+        PROTOBUF_FIELD_OFFSET(::PlannerRoute, _impl_.request_id_),
+        PROTOBUF_FIELD_OFFSET(::PlannerRoute, _impl_.drone_),
+        PROTOBUF_FIELD_OFFSET(::PlannerRoute, _impl_.route_),
+        1,
+        2,
+        0,
         0x000, // bitmap
         PROTOBUF_FIELD_OFFSET(::PlannerResponse, _impl_.lon_),
         PROTOBUF_FIELD_OFFSET(::PlannerResponse, _impl_.lat_),
-        0x081, // bitmap
+        PROTOBUF_FIELD_OFFSET(::PlannerResponse, _impl_.lon_e7_delta_),
+        PROTOBUF_FIELD_OFFSET(::PlannerResponse, _impl_.lat_e7_delta_),
+        0x085, // bitmap
         PROTOBUF_FIELD_OFFSET(::Status, _impl_._has_bits_),
-        4, // hasbit index offset
+        PROTOBUF_FIELD_OFFSET(::Status, _impl_._oneof_case_[0]),
+        16, // hasbit index offset
         PROTOBUF_FIELD_OFFSET(::Status, _impl_.type_status_),
+        PROTOBUF_FIELD_OFFSET(::Status, _impl_.request_id_),
+        PROTOBUF_FIELD_OFFSET(::Status, _impl_.profile_),
+        PROTOBUF_FIELD_OFFSET(::Status, _impl_.compact_coordinates_),
+        ::_pbi::kInvalidFieldOffsetTag,
+        ::_pbi::kInvalidFieldOffsetTag,
+        ::_pbi::kInvalidFieldOffsetTag,
+        PROTOBUF_FIELD_OFFSET(::Status, _impl_.queued_missions_),
+        PROTOBUF_FIELD_OFFSET(::Status, _impl_.planned_missions_),
+        PROTOBUF_FIELD_OFFSET(::Status, _impl_.last_mission_latency_ms_),
+        PROTOBUF_FIELD_OFFSET(::Status, _impl_.mission_id_),
+        PROTOBUF_FIELD_OFFSET(::Status, _impl_.typed_status_),
         0,
+        3,
+        1,
+        4,
+        ~0u,
+        ~0u,
+        ~0u,
+        5,
+        6,
+        7,
+        2,
         0x004, // bitmap
         PROTOBUF_FIELD_OFFSET(::WrapperFromClient, _impl_._oneof_case_[0]),
         ::_pbi::kInvalidFieldOffsetTag,
@@ -341,24 +434,28 @@ const ::uint32_t
         PROTOBUF_FIELD_OFFSET(::WrapperFromClient, _impl_.payload_),
         0x081, // bitmap
         PROTOBUF_FIELD_OFFSET(::Command, _impl_._has_bits_),
-        4, // hasbit index offset
+        5, // hasbit index offset
         PROTOBUF_FIELD_OFFSET(::Command, _impl_.command_),
+        PROTOBUF_FIELD_OFFSET(::Command, _impl_.mission_id_),
         0,
+        1,
         0x004, // bitmap
         PROTOBUF_FIELD_OFFSET(::WrapperPLD, _impl_._oneof_case_[0]),
         ::_pbi::kInvalidFieldOffsetTag,
         PROTOBUF_FIELD_OFFSET(::WrapperPLD, _impl_.payload_),
         0x081, // bitmap
         PROTOBUF_FIELD_OFFSET(::Config_mission, _impl_._has_bits_),
-        7, // hasbit index offset
+        8, // hasbit index offset
         PROTOBUF_FIELD_OFFSET(::Config_mission, _impl_.planner_config_),
         PROTOBUF_FIELD_OFFSET(::Config_mission, _impl_.info_planner_),
         PROTOBUF_FIELD_OFFSET(::Config_mission, _impl_.info_drone_),
         PROTOBUF_FIELD_OFFSET(::Config_mission, _impl_.drone_sim_),
-        1,
+        PROTOBUF_FIELD_OFFSET(::Config_mission, _impl_.mission_id_),
         2,
         3,
+        4,
         0,
+        1,
         0x081, // bitmap
         PROTOBUF_FIELD_OFFSET(::Info_Module, _impl_._has_bits_),
         10, // hasbit index offset
@@ -381,20 +478,22 @@ const ::uint32_t
 static const ::_pbi::MigrationSchema
     schemas[] ABSL_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
         {0, sizeof(::WrapperPlanner)},
-        {5, sizeof(::WrapperDrone)},
-        {9, sizeof(::PlannerResponseList)},
-        {11, sizeof(::PlannerResponse)},
-        {14, sizeof(::Status)},
-        {19, sizeof(::WrapperFromClient)},
-        {24, sizeof(::Command)},
-        {29, sizeof(::WrapperPLD)},
-        {33, sizeof(::Config_mission)},
-        {44, sizeof(::Info_Module)},
+        {6, sizeof(::WrapperDrone)},
+        {10, sizeof(::PlannerResponseList)},
+        {19, sizeof(::PlannerRoute)},
+        {28, sizeof(::PlannerResponse)},
+        {33, sizeof(::Status)},
+        {60, sizeof(::WrapperFromClient)},
+        {65, sizeof(::Command)},
+        {72, sizeof(::WrapperPLD)},
+        {76, sizeof(::Config_mission)},
+        {89, sizeof(::Info_Module)},
 };
 static const ::_pb::Message* PROTOBUF_NONNULL const file_default_instances[] = {
     &::_WrapperPlanner_default_instance_._instance,
     &::_WrapperDrone_default_instance_._instance,
     &::_PlannerResponseList_default_instance_._instance,
+    &::_PlannerRoute_default_instance_._instance,
     &::_PlannerResponse_default_instance_._instance,
     &::_Status_default_instance_._instance,
     &::_WrapperFromClient_default_instance_._instance,
@@ -406,26 +505,53 @@ static const ::_pb::Message* PROTOBUF_NONNULL const file_default_instances[] = {
 const char descriptor_table_protodef_messages_5fpld_2eproto[] ABSL_ATTRIBUTE_SECTION_VARIABLE(
     protodesc_cold) = {
     "\n\022messages_pld.proto\032\026messages_planner.p"
-    "roto\"h\n\016WrapperPlanner\0220\n\020planner_respon"
-    "se\030\001 \001(\0132\024.PlannerResponseListH\000\022\031\n\006stat"
-    "us\030\002 \001(\0132\007.StatusH\000B\t\n\007payload\"4\n\014Wrappe"
-    "rDrone\022\031\n\006status\030\001 \001(\0132\007.StatusH\000B\t\n\007pay"
-    "load\"6\n\023PlannerResponseList\022\037\n\005items\030\001 \003"
-    "(\0132\020.PlannerResponse\"+\n\017PlannerResponse\022"
-    "\013\n\003lon\030\001 \003(\001\022\013\n\003lat\030\002 \003(\001\"\035\n\006Status\022\023\n\013t"
-    "ype_status\030\001 \001(\t\"^\n\021WrapperFromClient\022!\n"
-    "\006config\030\001 \001(\0132\017.Config_missionH\000\022\033\n\007mess"
-    "age\030\002 \001(\0132\010.CommandH\000B\t\n\007payload\"\032\n\007Comm"
-    "and\022\017\n\007command\030\001 \001(\t\"2\n\nWrapperPLD\022\031\n\006st"
-    "atus\030\001 \001(\0132\007.StatusH\000B\t\n\007payload\"\222\001\n\016Con"
-    "fig_mission\022\'\n\016planner_config\030\001 \001(\0132\017.Pl"
-    "annerMessage\022\"\n\014info_planner\030\002 \001(\0132\014.Inf"
-    "o_Module\022 \n\ninfo_drone\030\003 \001(\0132\014.Info_Modu"
-    "le\022\021\n\tdrone_sim\030\004 \001(\t\"\203\001\n\013Info_Module\022\023\n"
-    "\013docker_name\030\001 \001(\t\022\023\n\013docker_file\030\002 \001(\t\022"
-    "\021\n\tmodule_ip\030\003 \001(\t\022\016\n\006ssh_ip\030\004 \001(\t\022\014\n\004po"
-    "rt\030\005 \001(\t\022\014\n\004user\030\006 \001(\t\022\013\n\003key\030\007 \001(\tb\006pro"
-    "to3"
+    "roto\"\220\001\n\016WrapperPlanner\0220\n\020planner_respo"
+    "nse\030\001 \001(\0132\024.PlannerResponseListH\000\022\031\n\006sta"
+    "tus\030\002 \001(\0132\007.StatusH\000\022&\n\rplanner_route\030\003 "
+    "\001(\0132\r.PlannerRouteH\000B\t\n\007payload\"4\n\014Wrapp"
+    "erDrone\022\031\n\006status\030\001 \001(\0132\007.StatusH\000B\t\n\007pa"
+    "yload\"c\n\023PlannerResponseList\022\037\n\005items\030\001 "
+    "\003(\0132\020.PlannerResponse\022\022\n\nrequest_id\030\002 \001("
+    "\004\022\027\n\017streamed_routes\030\003 \001(\r\"R\n\014PlannerRou"
+    "te\022\022\n\nrequest_id\030\001 \001(\004\022\r\n\005drone\030\002 \001(\r\022\037\n"
+    "\005route\030\003 \001(\0132\020.PlannerResponse\"W\n\017Planne"
+    "rResponse\022\013\n\003lon\030\001 \003(\001\022\013\n\003lat\030\002 \003(\001\022\024\n\014l"
+    "on_e7_delta\030\003 \003(\021\022\024\n\014lat_e7_delta\030\004 \003(\021\""
+    "\311\002\n\006Status\022\023\n\013type_status\030\001 \001(\t\022\022\n\nreque"
+    "st_id\030\002 \001(\004\022\017\n\007profile\030\003 \001(\t\022\033\n\023compact_"
+    "coordinates\030\004 \001(\010\022(\n\016planner_status\030\005 \001("
+    "\0162\016.PlannerStatusH\000\022$\n\014drone_status\030\006 \001("
+    "\0162\014.DroneStatusH\000\022 \n\npld_status\030\007 \001(\0162\n."
+    "PldStatusH\000\022\027\n\017queued_missions\030\010 \001(\r\022\030\n\020"
+    "planned_missions\030\t \001(\r\022\037\n\027last_mission_l"
+    "atency_ms\030\n \001(\004\022\022\n\nmission_id\030\013 \001(\tB\016\n\014t"
+    "yped_status\"^\n\021WrapperFromClient\022!\n\006conf"
+    "ig\030\001 \001(\0132\017.Config_missionH\000\022\033\n\007message\030\002"
+    " \001(\0132\010.CommandH\000B\t\n\007payload\".\n\007Command\022\017"
+    "\n\007command\030\001 \001(\t\022\022\n\nmission_id\030\002 \001(\t\"2\n\nW"
+    "rapperPLD\022\031\n\006status\030\001 \001(\0132\007.StatusH\000B\t\n\007"
+    "payload\"\246\001\n\016Config_mission\022\'\n\016planner_co"
+    "nfig\030\001 \001(\0132\017.PlannerMessage\022\"\n\014info_plan"
+    "ner\030\002 \001(\0132\014.Info_Module\022 \n\ninfo_drone\030\003 "
+    "\001(\0132\014.Info_Module\022\021\n\tdrone_sim\030\004 \001(\t\022\022\n\n"
+    "mission_id\030\005 \001(\t\"\203\001\n\013Info_Module\022\023\n\013dock"
+    "er_name\030\001 \001(\t\022\023\n\013docker_file\030\002 \001(\t\022\021\n\tmo"
+    "dule_ip\030\003 \001(\t\022\016\n\006ssh_ip\030\004 \001(\t\022\014\n\004port\030\005 "
+    "\001(\t\022\014\n\004user\030\006 \001(\t\022\013\n\003key\030\007 \001(\t*\301\001\n\rPlann"
+    "erStatus\022\032\n\026PLANNER_STATUS_UNKNOWN\020\000\022!\n\035"
+    "PLANNER_STATUS_EXPECTING_DATA\020\001\022\030\n\024PLANN"
+    "ER_STATUS_ERROR\020\002\022\036\n\032PLANNER_STATUS_CALC"
+    "ULATING\020\003\022\031\n\025PLANNER_STATUS_FINISH\020\004\022\034\n\030"
+    "PLANNER_STATUS_CANCELLED\020\005*\233\001\n\013DroneStat"
+    "us\022\030\n\024DRONE_STATUS_UNKNOWN\020\000\022\035\n\031DRONE_ST"
+    "ATUS_STARTING_SIM\020\001\022\026\n\022DRONE_STATUS_ERRO"
+    "R\020\002\022\"\n\036DRONE_STATUS_EXECUTING_MISSION\020\003\022"
+    "\027\n\023DRONE_STATUS_FINISH\020\004*\260\001\n\tPldStatus\022\026"
+    "\n\022PLD_STATUS_UNKNOWN\020\000\022\024\n\020PLD_STATUS_ERR"
+    "OR\020\001\022\033\n\027PLD_STATUS_WAITING_INFO\020\002\022\037\n\033PLD"
+    "_STATUS_PLANNING_MISSION\020\003\022 \n\034PLD_STATUS"
+    "_EXECUTING_MISSION\020\004\022\025\n\021PLD_STATUS_FINIS"
+    "H\020\005b\006proto3"
 };
 static const ::_pbi::DescriptorTable* PROTOBUF_NONNULL const
     descriptor_table_messages_5fpld_2eproto_deps[1] = {
@@ -435,19 +561,37 @@ static ::absl::once_flag descriptor_table_messages_5fpld_2eproto_once;
 PROTOBUF_CONSTINIT const ::_pbi::DescriptorTable descriptor_table_messages_5fpld_2eproto = {
     false,
     false,
-    803,
+    1891,
     descriptor_table_protodef_messages_5fpld_2eproto,
     "messages_pld.proto",
     &descriptor_table_messages_5fpld_2eproto_once,
     descriptor_table_messages_5fpld_2eproto_deps,
     1,
-    10,
+    11,
     schemas,
     file_default_instances,
     TableStruct_messages_5fpld_2eproto::offsets,
     file_level_enum_descriptors_messages_5fpld_2eproto,
     file_level_service_descriptors_messages_5fpld_2eproto,
 };
+const ::google::protobuf::EnumDescriptor* PROTOBUF_NONNULL PlannerStatus_descriptor() {
+  ::google::protobuf::internal::AssignDescriptors(&descriptor_table_messages_5fpld_2eproto);
+  return file_level_enum_descriptors_messages_5fpld_2eproto[0];
+}
+PROTOBUF_CONSTINIT const uint32_t PlannerStatus_internal_data_[] = {
+    393216u, 0u, };
+const ::google::protobuf::EnumDescriptor* PROTOBUF_NONNULL DroneStatus_descriptor() {
+  ::google::protobuf::internal::AssignDescriptors(&descriptor_table_messages_5fpld_2eproto);
+  return file_level_enum_descriptors_messages_5fpld_2eproto[1];
+}
+PROTOBUF_CONSTINIT const uint32_t DroneStatus_internal_data_[] = {
+    327680u, 0u, };
+const ::google::protobuf::EnumDescriptor* PROTOBUF_NONNULL PldStatus_descriptor() {
+  ::google::protobuf::internal::AssignDescriptors(&descriptor_table_messages_5fpld_2eproto);
+  return file_level_enum_descriptors_messages_5fpld_2eproto[2];
+}
+PROTOBUF_CONSTINIT const uint32_t PldStatus_internal_data_[] = {
+    393216u, 0u, };
 // ===================================================================
 
 class WrapperPlanner::_Internal {
@@ -482,6 +626,19 @@ void WrapperPlanner::set_allocated_status(::Status* PROTOBUF_NULLABLE status) {
   }
   // @@protoc_insertion_point(field_set_allocated:WrapperPlanner.status)
 }
+void WrapperPlanner::set_allocated_planner_route(::PlannerRoute* PROTOBUF_NULLABLE planner_route) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  clear_payload();
+  if (planner_route) {
+    ::google::protobuf::Arena* submessage_arena = planner_route->GetArena();
+    if (message_arena != submessage_arena) {
+      planner_route = ::google::protobuf::internal::GetOwnedMessage(message_arena, planner_route, submessage_arena);
+    }
+    set_has_planner_route();
+    _impl_.payload_.planner_route_ = planner_route;
+  }
+  // @@protoc_insertion_point(field_set_allocated:WrapperPlanner.planner_route)
+}
 WrapperPlanner::WrapperPlanner(::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
 #if defined(PROTOBUF_CUSTOM_VTABLE)
     : ::google::protobuf::Message(arena, WrapperPlanner_class_data_.base()) {
@@ -521,6 +678,9 @@ WrapperPlanner::WrapperPlanner(
       case kStatus:
         _impl_.payload_.status_ = ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.payload_.status_);
         break;
+      case kPlannerRoute:
+        _impl_.payload_.planner_route_ = ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.payload_.planner_route_);
+        break;
   }
 
   // @@protoc_insertion_point(copy_constructor:WrapperPlanner)
@@ -569,6 +729,14 @@ void WrapperPlanner::clear_payload() {
       }
       break;
     }
+    case kPlannerRoute: {
+      if (GetArena() == nullptr) {
+        delete _impl_.payload_.planner_route_;
+      } else if (::google::protobuf::internal::DebugHardenClearOneofMessageOnArena()) {
+        ::google::protobuf::internal::MaybePoisonAfterClear(_impl_.payload_.planner_route_);
+      }
+      break;
+    }
     case PAYLOAD_NOT_SET: {
       break;
     }
@@ -620,17 +788,17 @@ WrapperPlanner::GetClassData() const {
   return WrapperPlanner_class_data_.base();
 }
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<0, 2, 2, 0, 2>
+const ::_pbi::TcParseTable<0, 3, 3, 0, 2>
 WrapperPlanner::_table_ = {
   {
     0,  // no _has_bits_
     0, // no _extensions_
-    2, 0,  // max_field_number, fast_idx_mask
+    3, 0,  // max_field_number, fast_idx_mask
     offsetof(decltype(_table_), field_lookup_table),
-    4294967292,  // skipmap
+    4294967288,  // skipmap
     offsetof(decltype(_table_), field_entries),
-    2,  // num_field_entries
-    2,  // num_aux_entries
+    3,  // num_field_entries
+    3,  // num_aux_entries
     offsetof(decltype(_table_), aux_entries),
     WrapperPlanner_class_data_.base(),
     nullptr,  // post_loop_handler
@@ -649,10 +817,14 @@ WrapperPlanner::_table_ = {
     // .Status status = 2;
     {PROTOBUF_FIELD_OFFSET(WrapperPlanner, _impl_.payload_.status_), _Internal::kOneofCaseOffset + 0, 1,
     (0 | ::_fl::kFcOneof | ::_fl::kMessage | ::_fl::kTvTable)},
+    // .PlannerRoute planner_route = 3;
+    {PROTOBUF_FIELD_OFFSET(WrapperPlanner, _impl_.payload_.planner_route_), _Internal::kOneofCaseOffset + 0, 2,
+    (0 | ::_fl::kFcOneof | ::_fl::kMessage | ::_fl::kTvTable)},
   }},
   {{
       {::_pbi::TcParser::GetTable<::PlannerResponseList>()},
       {::_pbi::TcParser::GetTable<::Status>()},
+      {::_pbi::TcParser::GetTable<::PlannerRoute>()},
   }},
   {{
   }},
@@ -696,6 +868,12 @@ PROTOBUF_NOINLINE void WrapperPlanner::Clear() {
           stream);
       break;
     }
+    case kPlannerRoute: {
+      target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+          3, *this_._impl_.payload_.planner_route_, this_._impl_.payload_.planner_route_->GetCachedSize(), target,
+          stream);
+      break;
+    }
     default:
       break;
   }
@@ -735,6 +913,12 @@ PROTOBUF_NOINLINE void WrapperPlanner::Clear() {
                     ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.payload_.status_);
       break;
     }
+    // .PlannerRoute planner_route = 3;
+    case kPlannerRoute: {
+      total_size += 1 +
+                    ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.payload_.planner_route_);
+      break;
+    }
     case PAYLOAD_NOT_SET: {
       break;
     }
@@ -779,6 +963,14 @@ void WrapperPlanner::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::
         }
         break;
       }
+      case kPlannerRoute: {
+        if (oneof_needs_init) {
+          _this->_impl_.payload_.planner_route_ = ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.payload_.planner_route_);
+        } else {
+          _this->_impl_.payload_.planner_route_->MergeFrom(*from._impl_.payload_.planner_route_);
+        }
+        break;
+      }
       case PAYLOAD_NOT_SET:
         break;
     }
@@ -1113,6 +1305,10 @@ void WrapperDrone::InternalSwap(WrapperDrone* PROTOBUF_RESTRICT PROTOBUF_NONNULL
 
 class PlannerResponseList::_Internal {
  public:
+  using HasBits =
+      decltype(::std::declval<PlannerResponseList>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+      8 * PROTOBUF_FIELD_OFFSET(PlannerResponseList, _impl_._has_bits_);
 };
 
 PlannerResponseList::PlannerResponseList(::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
@@ -1128,8 +1324,9 @@ PROTOBUF_NDEBUG_INLINE PlannerResponseList::Impl_::Impl_(
     ::google::protobuf::internal::InternalVisibility visibility,
     ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
     const ::PlannerResponseList& from_msg)
-      : items_{visibility, arena, from.items_},
-        _cached_size_{0} {}
+      : _has_bits_{from._has_bits_},
+        _cached_size_{0},
+        items_{visibility, arena, from.items_} {}
 
 PlannerResponseList::PlannerResponseList(
     ::google::protobuf::Arena* PROTOBUF_NULLABLE arena,
@@ -1144,17 +1341,30 @@ PlannerResponseList::PlannerResponseList(
   _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
       from._internal_metadata_);
   new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
+  ::memcpy(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, request_id_),
+           reinterpret_cast<const char *>(&from._impl_) +
+               offsetof(Impl_, request_id_),
+           offsetof(Impl_, streamed_routes_) -
+               offsetof(Impl_, request_id_) +
+               sizeof(Impl_::streamed_routes_));
 
   // @@protoc_insertion_point(copy_constructor:PlannerResponseList)
 }
 PROTOBUF_NDEBUG_INLINE PlannerResponseList::Impl_::Impl_(
     ::google::protobuf::internal::InternalVisibility visibility,
     ::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
-      : items_{visibility, arena},
-        _cached_size_{0} {}
+      : _cached_size_{0},
+        items_{visibility, arena} {}
 
 inline void PlannerResponseList::SharedCtor(::_pb::Arena* PROTOBUF_NULLABLE arena) {
   new (&_impl_) Impl_(internal_visibility(), arena);
+  ::memset(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, request_id_),
+           0,
+           offsetof(Impl_, streamed_routes_) -
+               offsetof(Impl_, request_id_) +
+               sizeof(Impl_::streamed_routes_));
 }
 PlannerResponseList::~PlannerResponseList() {
   // @@protoc_insertion_point(destructor:PlannerResponseList)
@@ -1222,16 +1432,16 @@ PlannerResponseList::GetClassData() const {
   return PlannerResponseList_class_data_.base();
 }
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<0, 1, 1, 0, 2>
+const ::_pbi::TcParseTable<2, 3, 1, 0, 2>
 PlannerResponseList::_table_ = {
   {
-    0,  // no _has_bits_
+    PROTOBUF_FIELD_OFFSET(PlannerResponseList, _impl_._has_bits_),
     0, // no _extensions_
-    1, 0,  // max_field_number, fast_idx_mask
+    3, 24,  // max_field_number, fast_idx_mask
     offsetof(decltype(_table_), field_lookup_table),
-    4294967294,  // skipmap
+    4294967288,  // skipmap
     offsetof(decltype(_table_), field_entries),
-    1,  // num_field_entries
+    3,  // num_field_entries
     1,  // num_aux_entries
     offsetof(decltype(_table_), aux_entries),
     PlannerResponseList_class_data_.base(),
@@ -1241,15 +1451,28 @@ PlannerResponseList::_table_ = {
     ::_pbi::TcParser::GetTable<::PlannerResponseList>(),  // to_prefetch
     #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
   }, {{
+    {::_pbi::TcParser::MiniParse, {}},
     // repeated .PlannerResponse items = 1;
     {::_pbi::TcParser::FastMtR1,
      {10, 63, 0, PROTOBUF_FIELD_OFFSET(PlannerResponseList, _impl_.items_)}},
+    // uint64 request_id = 2;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(PlannerResponseList, _impl_.request_id_), 0>(),
+     {16, 0, 0, PROTOBUF_FIELD_OFFSET(PlannerResponseList, _impl_.request_id_)}},
+    // uint32 streamed_routes = 3;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(PlannerResponseList, _impl_.streamed_routes_), 1>(),
+     {24, 1, 0, PROTOBUF_FIELD_OFFSET(PlannerResponseList, _impl_.streamed_routes_)}},
   }}, {{
     65535, 65535
   }}, {{
     // repeated .PlannerResponse items = 1;
-    {PROTOBUF_FIELD_OFFSET(PlannerResponseList, _impl_.items_), 0, 0,
+    {PROTOBUF_FIELD_OFFSET(PlannerResponseList, _impl_.items_), -1, 0,
     (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
+    // uint64 request_id = 2;
+    {PROTOBUF_FIELD_OFFSET(PlannerResponseList, _impl_.request_id_), _Internal::kHasBitsOffset + 0, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kUInt64)},
+    // uint32 streamed_routes = 3;
+    {PROTOBUF_FIELD_OFFSET(PlannerResponseList, _impl_.streamed_routes_), _Internal::kHasBitsOffset + 1, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kUInt32)},
   }},
   {{
       {::_pbi::TcParser::GetTable<::PlannerResponse>()},
@@ -1265,6 +1488,13 @@ PROTOBUF_NOINLINE void PlannerResponseList::Clear() {
   (void) cached_has_bits;
 
   _impl_.items_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if ((cached_has_bits & 0x00000003u) != 0) {
+    ::memset(&_impl_.request_id_, 0, static_cast<::size_t>(
+        reinterpret_cast<char*>(&_impl_.streamed_routes_) -
+        reinterpret_cast<char*>(&_impl_.request_id_)) + sizeof(_impl_.streamed_routes_));
+  }
+  _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
 }
 
@@ -1294,6 +1524,24 @@ PROTOBUF_NOINLINE void PlannerResponseList::Clear() {
             target, stream);
   }
 
+  // uint64 request_id = 2;
+  if ((this_._impl_._has_bits_[0] & 0x00000001u) != 0) {
+    if (this_._internal_request_id() != 0) {
+      target = stream->EnsureSpace(target);
+      target = ::_pbi::WireFormatLite::WriteUInt64ToArray(
+          2, this_._internal_request_id(), target);
+    }
+  }
+
+  // uint32 streamed_routes = 3;
+  if ((this_._impl_._has_bits_[0] & 0x00000002u) != 0) {
+    if (this_._internal_streamed_routes() != 0) {
+      target = stream->EnsureSpace(target);
+      target = ::_pbi::WireFormatLite::WriteUInt32ToArray(
+          3, this_._internal_streamed_routes(), target);
+    }
+  }
+
   if (ABSL_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
     target =
         ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
@@ -1327,6 +1575,23 @@ PROTOBUF_NOINLINE void PlannerResponseList::Clear() {
       }
     }
   }
+  cached_has_bits = this_._impl_._has_bits_[0];
+  if ((cached_has_bits & 0x00000003u) != 0) {
+    // uint64 request_id = 2;
+    if ((cached_has_bits & 0x00000001u) != 0) {
+      if (this_._internal_request_id() != 0) {
+        total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(
+            this_._internal_request_id());
+      }
+    }
+    // uint32 streamed_routes = 3;
+    if ((cached_has_bits & 0x00000002u) != 0) {
+      if (this_._internal_streamed_routes() != 0) {
+        total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(
+            this_._internal_streamed_routes());
+      }
+    }
+  }
   return this_.MaybeComputeUnknownFieldsSize(total_size,
                                              &this_._impl_._cached_size_);
 }
@@ -1341,6 +1606,20 @@ void PlannerResponseList::MergeImpl(::google::protobuf::MessageLite& to_msg, con
 
   _this->_internal_mutable_items()->MergeFrom(
       from._internal_items());
+  cached_has_bits = from._impl_._has_bits_[0];
+  if ((cached_has_bits & 0x00000003u) != 0) {
+    if ((cached_has_bits & 0x00000001u) != 0) {
+      if (from._internal_request_id() != 0) {
+        _this->_impl_.request_id_ = from._impl_.request_id_;
+      }
+    }
+    if ((cached_has_bits & 0x00000002u) != 0) {
+      if (from._internal_streamed_routes() != 0) {
+        _this->_impl_.streamed_routes_ = from._impl_.streamed_routes_;
+      }
+    }
+  }
+  _this->_impl_._has_bits_[0] |= cached_has_bits;
   _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
 }
 
@@ -1355,7 +1634,14 @@ void PlannerResponseList::CopyFrom(const PlannerResponseList& from) {
 void PlannerResponseList::InternalSwap(PlannerResponseList* PROTOBUF_RESTRICT PROTOBUF_NONNULL other) {
   using ::std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
   _impl_.items_.InternalSwap(&other->_impl_.items_);
+  ::google::protobuf::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PlannerResponseList, _impl_.streamed_routes_)
+      + sizeof(PlannerResponseList::_impl_.streamed_routes_)
+      - PROTOBUF_FIELD_OFFSET(PlannerResponseList, _impl_.request_id_)>(
+          reinterpret_cast<char*>(&_impl_.request_id_),
+          reinterpret_cast<char*>(&other->_impl_.request_id_));
 }
 
 ::google::protobuf::Metadata PlannerResponseList::GetMetadata() const {
@@ -1363,6 +1649,345 @@ void PlannerResponseList::InternalSwap(PlannerResponseList* PROTOBUF_RESTRICT PR
 }
 // ===================================================================
 
+class PlannerRoute::_Internal {
+ public:
+  using HasBits =
+      decltype(::std::declval<PlannerRoute>()._impl_._has_bits_);
+  static constexpr ::int32_t kHasBitsOffset =
+      8 * PROTOBUF_FIELD_OFFSET(PlannerRoute, _impl_._has_bits_);
+};
+
+PlannerRoute::PlannerRoute(::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, PlannerRoute_class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  SharedCtor(arena);
+  // @@protoc_insertion_point(arena_constructor:PlannerRoute)
+}
+PROTOBUF_NDEBUG_INLINE PlannerRoute::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
+    const ::PlannerRoute& from_msg)
+      : _has_bits_{from._has_bits_},
+        _cached_size_{0} {}
+
+PlannerRoute::PlannerRoute(
+    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena,
+    const PlannerRoute& from)
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+    : ::google::protobuf::Message(arena, PlannerRoute_class_data_.base()) {
+#else   // PROTOBUF_CUSTOM_VTABLE
+    : ::google::protobuf::Message(arena) {
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  PlannerRoute* const _this = this;
+  (void)_this;
+  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
+      from._internal_metadata_);
+  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
+  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
+  _impl_.route_ = ((cached_has_bits & 0x00000001u) != 0)
+                ? ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.route_)
+                : nullptr;
+  ::memcpy(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, request_id_),
+           reinterpret_cast<const char *>(&from._impl_) +
+               offsetof(Impl_, request_id_),
+           offsetof(Impl_, drone_) -
+               offsetof(Impl_, request_id_) +
+               sizeof(Impl_::drone_));
+
+  // @@protoc_insertion_point(copy_constructor:PlannerRoute)
+}
+PROTOBUF_NDEBUG_INLINE PlannerRoute::Impl_::Impl_(
+    ::google::protobuf::internal::InternalVisibility visibility,
+    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
+      : _cached_size_{0} {}
+
+inline void PlannerRoute::SharedCtor(::_pb::Arena* PROTOBUF_NULLABLE arena) {
+  new (&_impl_) Impl_(internal_visibility(), arena);
+  ::memset(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, route_),
+           0,
+           offsetof(Impl_, drone_) -
+               offsetof(Impl_, route_) +
+               sizeof(Impl_::drone_));
+}
+PlannerRoute::~PlannerRoute() {
+  // @@protoc_insertion_point(destructor:PlannerRoute)
+  SharedDtor(*this);
+}
+inline void PlannerRoute::SharedDtor(MessageLite& self) {
+  PlannerRoute& this_ = static_cast<PlannerRoute&>(self);
+  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
+  ABSL_DCHECK(this_.GetArena() == nullptr);
+  delete this_._impl_.route_;
+  this_._impl_.~Impl_();
+}
+
+inline void* PROTOBUF_NONNULL PlannerRoute::PlacementNew_(
+    const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
+    ::google::protobuf::Arena* PROTOBUF_NULLABLE arena) {
+  return ::new (mem) PlannerRoute(arena);
+}
+constexpr auto PlannerRoute::InternalNewImpl_() {
+  return ::google::protobuf::internal::MessageCreator::ZeroInit(sizeof(PlannerRoute),
+                                            alignof(PlannerRoute));
+}
+constexpr auto PlannerRoute::InternalGenerateClassData_() {
+  return ::google::protobuf::internal::ClassDataFull{
+      ::google::protobuf::internal::ClassData{
+          &_PlannerRoute_default_instance_._instance,
+          &_table_.header,
+          nullptr,  // OnDemandRegisterArenaDtor
+          nullptr,  // IsInitialized
+          &PlannerRoute::MergeImpl,
+          ::google::protobuf::Message::GetNewImpl<PlannerRoute>(),
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+          &PlannerRoute::SharedDtor,
+          ::google::protobuf::Message::GetClearImpl<PlannerRoute>(), &PlannerRoute::ByteSizeLong,
+              &PlannerRoute::_InternalSerialize,
+#endif  // PROTOBUF_CUSTOM_VTABLE
+          PROTOBUF_FIELD_OFFSET(PlannerRoute, _impl_._cached_size_),
+          false,
+      },
+      &PlannerRoute::kDescriptorMethods,
+      &descriptor_table_messages_5fpld_2eproto,
+      nullptr,  // tracker
+  };
+}
+
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 const
+    ::google::protobuf::internal::ClassDataFull PlannerRoute_class_data_ =
+        PlannerRoute::InternalGenerateClassData_();
+
+PROTOBUF_ATTRIBUTE_WEAK const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL
+PlannerRoute::GetClassData() const {
+  ::google::protobuf::internal::PrefetchToLocalCache(&PlannerRoute_class_data_);
+  ::google::protobuf::internal::PrefetchToLocalCache(PlannerRoute_class_data_.tc_table);
+  return PlannerRoute_class_data_.base();
+}
+PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
+const ::_pbi::TcParseTable<2, 3, 1, 0, 2>
+PlannerRoute::_table_ = {
+  {
+    PROTOBUF_FIELD_OFFSET(PlannerRoute, _impl_._has_bits_),
+    0, // no _extensions_
+    3, 24,  // max_field_number, fast_idx_mask
+    offsetof(decltype(_table_), field_lookup_table),
+    4294967288,  // skipmap
+    offsetof(decltype(_table_), field_entries),
+    3,  // num_field_entries
+    1,  // num_aux_entries
+    offsetof(decltype(_table_), aux_entries),
+    PlannerRoute_class_data_.base(),
+    nullptr,  // post_loop_handler
+    ::_pbi::TcParser::GenericFallback,  // fallback
+    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
+    ::_pbi::TcParser::GetTable<::PlannerRoute>(),  // to_prefetch
+    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
+  }, {{
+    {::_pbi::TcParser::MiniParse, {}},
+    // uint64 request_id = 1;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(PlannerRoute, _impl_.request_id_), 1>(),
+     {8, 1, 0, PROTOBUF_FIELD_OFFSET(PlannerRoute, _impl_.request_id_)}},
+    // uint32 drone = 2;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(PlannerRoute, _impl_.drone_), 2>(),
+     {16, 2, 0, PROTOBUF_FIELD_OFFSET(PlannerRoute, _impl_.drone_)}},
+    // .PlannerResponse route = 3;
+    {::_pbi::TcParser::FastMtS1,
+     {26, 0, 0, PROTOBUF_FIELD_OFFSET(PlannerRoute, _impl_.route_)}},
+  }}, {{
+    65535, 65535
+  }}, {{
+    // uint64 request_id = 1;
+    {PROTOBUF_FIELD_OFFSET(PlannerRoute, _impl_.request_id_), _Internal::kHasBitsOffset + 1, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kUInt64)},
+    // uint32 drone = 2;
+    {PROTOBUF_FIELD_OFFSET(PlannerRoute, _impl_.drone_), _Internal::kHasBitsOffset + 2, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kUInt32)},
+    // .PlannerResponse route = 3;
+    {PROTOBUF_FIELD_OFFSET(PlannerRoute, _impl_.route_), _Internal::kHasBitsOffset + 0, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
+  }},
+  {{
+      {::_pbi::TcParser::GetTable<::PlannerResponse>()},
+  }},
+  {{
+  }},
+};
+PROTOBUF_NOINLINE void PlannerRoute::Clear() {
+// @@protoc_insertion_point(message_clear_start:PlannerRoute)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if ((cached_has_bits & 0x00000001u) != 0) {
+    ABSL_DCHECK(_impl_.route_ != nullptr);
+    _impl_.route_->Clear();
+  }
+  if ((cached_has_bits & 0x00000006u) != 0) {
+    ::memset(&_impl_.request_id_, 0, static_cast<::size_t>(
+        reinterpret_cast<char*>(&_impl_.drone_) -
+        reinterpret_cast<char*>(&_impl_.request_id_)) + sizeof(_impl_.drone_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+::uint8_t* PROTOBUF_NONNULL PlannerRoute::_InternalSerialize(
+    const ::google::protobuf::MessageLite& base, ::uint8_t* PROTOBUF_NONNULL target,
+    ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) {
+  const PlannerRoute& this_ = static_cast<const PlannerRoute&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+::uint8_t* PROTOBUF_NONNULL PlannerRoute::_InternalSerialize(
+    ::uint8_t* PROTOBUF_NONNULL target,
+    ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const {
+  const PlannerRoute& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  // @@protoc_insertion_point(serialize_to_array_start:PlannerRoute)
+  ::uint32_t cached_has_bits = 0;
+  (void)cached_has_bits;
+
+  // uint64 request_id = 1;
+  if ((this_._impl_._has_bits_[0] & 0x00000002u) != 0) {
+    if (this_._internal_request_id() != 0) {
+      target = stream->EnsureSpace(target);
+      target = ::_pbi::WireFormatLite::WriteUInt64ToArray(
+          1, this_._internal_request_id(), target);
+    }
+  }
+
+  // uint32 drone = 2;
+  if ((this_._impl_._has_bits_[0] & 0x00000004u) != 0) {
+    if (this_._internal_drone() != 0) {
+      target = stream->EnsureSpace(target);
+      target = ::_pbi::WireFormatLite::WriteUInt32ToArray(
+          2, this_._internal_drone(), target);
+    }
+  }
+
+  cached_has_bits = this_._impl_._has_bits_[0];
+  // .PlannerResponse route = 3;
+  if ((cached_has_bits & 0x00000001u) != 0) {
+    target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
+        3, *this_._impl_.route_, this_._impl_.route_->GetCachedSize(), target,
+        stream);
+  }
+
+  if (ABSL_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
+    target =
+        ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+            this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:PlannerRoute)
+  return target;
+}
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+::size_t PlannerRoute::ByteSizeLong(const MessageLite& base) {
+  const PlannerRoute& this_ = static_cast<const PlannerRoute&>(base);
+#else   // PROTOBUF_CUSTOM_VTABLE
+::size_t PlannerRoute::ByteSizeLong() const {
+  const PlannerRoute& this_ = *this;
+#endif  // PROTOBUF_CUSTOM_VTABLE
+  // @@protoc_insertion_point(message_byte_size_start:PlannerRoute)
+  ::size_t total_size = 0;
+
+  ::uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void)cached_has_bits;
+
+  ::_pbi::Prefetch5LinesFrom7Lines(&this_);
+  cached_has_bits = this_._impl_._has_bits_[0];
+  if ((cached_has_bits & 0x00000007u) != 0) {
+    // .PlannerResponse route = 3;
+    if ((cached_has_bits & 0x00000001u) != 0) {
+      total_size += 1 +
+                    ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.route_);
+    }
+    // uint64 request_id = 1;
+    if ((cached_has_bits & 0x00000002u) != 0) {
+      if (this_._internal_request_id() != 0) {
+        total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(
+            this_._internal_request_id());
+      }
+    }
+    // uint32 drone = 2;
+    if ((cached_has_bits & 0x00000004u) != 0) {
+      if (this_._internal_drone() != 0) {
+        total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(
+            this_._internal_drone());
+      }
+    }
+  }
+  return this_.MaybeComputeUnknownFieldsSize(total_size,
+                                             &this_._impl_._cached_size_);
+}
+
+void PlannerRoute::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
+  auto* const _this = static_cast<PlannerRoute*>(&to_msg);
+  auto& from = static_cast<const PlannerRoute&>(from_msg);
+  ::google::protobuf::Arena* arena = _this->GetArena();
+  // @@protoc_insertion_point(class_specific_merge_from_start:PlannerRoute)
+  ABSL_DCHECK_NE(&from, _this);
+  ::uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if ((cached_has_bits & 0x00000007u) != 0) {
+    if ((cached_has_bits & 0x00000001u) != 0) {
+      ABSL_DCHECK(from._impl_.route_ != nullptr);
+      if (_this->_impl_.route_ == nullptr) {
+        _this->_impl_.route_ = ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.route_);
+      } else {
+        _this->_impl_.route_->MergeFrom(*from._impl_.route_);
+      }
+    }
+    if ((cached_has_bits & 0x00000002u) != 0) {
+      if (from._internal_request_id() != 0) {
+        _this->_impl_.request_id_ = from._impl_.request_id_;
+      }
+    }
+    if ((cached_has_bits & 0x00000004u) != 0) {
+      if (from._internal_drone() != 0) {
+        _this->_impl_.drone_ = from._impl_.drone_;
+      }
+    }
+  }
+  _this->_impl_._has_bits_[0] |= cached_has_bits;
+  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PlannerRoute::CopyFrom(const PlannerRoute& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:PlannerRoute)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+
+void PlannerRoute::InternalSwap(PlannerRoute* PROTOBUF_RESTRICT PROTOBUF_NONNULL other) {
+  using ::std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::google::protobuf::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PlannerRoute, _impl_.drone_)
+      + sizeof(PlannerRoute::_impl_.drone_)
+      - PROTOBUF_FIELD_OFFSET(PlannerRoute, _impl_.route_)>(
+          reinterpret_cast<char*>(&_impl_.route_),
+          reinterpret_cast<char*>(&other->_impl_.route_));
+}
+
+::google::protobuf::Metadata PlannerRoute::GetMetadata() const {
+  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
+}
+// ===================================================================
+
 class PlannerResponse::_Internal {
  public:
 };
@@ -1382,6 +2007,10 @@ PROTOBUF_NDEBUG_INLINE PlannerResponse::Impl_::Impl_(
     const ::PlannerResponse& from_msg)
       : lon_{visibility, arena, from.lon_},
         lat_{visibility, arena, from.lat_},
+        lon_e7_delta_{visibility, arena, from.lon_e7_delta_},
+        _lon_e7_delta_cached_byte_size_{0},
+        lat_e7_delta_{visibility, arena, from.lat_e7_delta_},
+        _lat_e7_delta_cached_byte_size_{0},
         _cached_size_{0} {}
 
 PlannerResponse::PlannerResponse(
@@ -1405,6 +2034,10 @@ PROTOBUF_NDEBUG_INLINE PlannerResponse::Impl_::Impl_(
     ::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
       : lon_{visibility, arena},
         lat_{visibility, arena},
+        lon_e7_delta_{visibility, arena},
+        _lon_e7_delta_cached_byte_size_{0},
+        lat_e7_delta_{visibility, arena},
+        _lat_e7_delta_cached_byte_size_{0},
         _cached_size_{0} {}
 
 inline void PlannerResponse::SharedCtor(::_pb::Arena* PROTOBUF_NULLABLE arena) {
@@ -1436,6 +2069,14 @@ constexpr auto PlannerResponse::InternalNewImpl_() {
           decltype(PlannerResponse::_impl_.lat_)::
               InternalGetArenaOffset(
                   ::google::protobuf::Message::internal_visibility()),
+      PROTOBUF_FIELD_OFFSET(PlannerResponse, _impl_.lon_e7_delta_) +
+          decltype(PlannerResponse::_impl_.lon_e7_delta_)::
+              InternalGetArenaOffset(
+                  ::google::protobuf::Message::internal_visibility()),
+      PROTOBUF_FIELD_OFFSET(PlannerResponse, _impl_.lat_e7_delta_) +
+          decltype(PlannerResponse::_impl_.lat_e7_delta_)::
+              InternalGetArenaOffset(
+                  ::google::protobuf::Message::internal_visibility()),
   });
   if (arena_bits.has_value()) {
     return ::google::protobuf::internal::MessageCreator::ZeroInit(
@@ -1480,16 +2121,16 @@ PlannerResponse::GetClassData() const {
   return PlannerResponse_class_data_.base();
 }
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<1, 2, 0, 0, 2>
+const ::_pbi::TcParseTable<2, 4, 0, 0, 2>
 PlannerResponse::_table_ = {
   {
     0,  // no _has_bits_
     0, // no _extensions_
-    2, 8,  // max_field_number, fast_idx_mask
+    4, 24,  // max_field_number, fast_idx_mask
     offsetof(decltype(_table_), field_lookup_table),
-    4294967292,  // skipmap
+    4294967280,  // skipmap
     offsetof(decltype(_table_), field_entries),
-    2,  // num_field_entries
+    4,  // num_field_entries
     0,  // num_aux_entries
     offsetof(decltype(_table_), field_names),  // no aux_entries
     PlannerResponse_class_data_.base(),
@@ -1499,12 +2140,18 @@ PlannerResponse::_table_ = {
     ::_pbi::TcParser::GetTable<::PlannerResponse>(),  // to_prefetch
     #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
   }, {{
-    // repeated double lat = 2;
-    {::_pbi::TcParser::FastF64P1,
-     {18, 63, 0, PROTOBUF_FIELD_OFFSET(PlannerResponse, _impl_.lat_)}},
+    // repeated sint32 lat_e7_delta = 4;
+    {::_pbi::TcParser::FastZ32P1,
+     {34, 63, 0, PROTOBUF_FIELD_OFFSET(PlannerResponse, _impl_.lat_e7_delta_)}},
     // repeated double lon = 1;
     {::_pbi::TcParser::FastF64P1,
      {10, 63, 0, PROTOBUF_FIELD_OFFSET(PlannerResponse, _impl_.lon_)}},
+    // repeated double lat = 2;
+    {::_pbi::TcParser::FastF64P1,
+     {18, 63, 0, PROTOBUF_FIELD_OFFSET(PlannerResponse, _impl_.lat_)}},
+    // repeated sint32 lon_e7_delta = 3;
+    {::_pbi::TcParser::FastZ32P1,
+     {26, 63, 0, PROTOBUF_FIELD_OFFSET(PlannerResponse, _impl_.lon_e7_delta_)}},
   }}, {{
     65535, 65535
   }}, {{
@@ -1514,6 +2161,12 @@ PlannerResponse::_table_ = {
     // repeated double lat = 2;
     {PROTOBUF_FIELD_OFFSET(PlannerResponse, _impl_.lat_), 0, 0,
     (0 | ::_fl::kFcRepeated | ::_fl::kPackedDouble)},
+    // repeated sint32 lon_e7_delta = 3;
+    {PROTOBUF_FIELD_OFFSET(PlannerResponse, _impl_.lon_e7_delta_), 0, 0,
+    (0 | ::_fl::kFcRepeated | ::_fl::kPackedSInt32)},
+    // repeated sint32 lat_e7_delta = 4;
+    {PROTOBUF_FIELD_OFFSET(PlannerResponse, _impl_.lat_e7_delta_), 0, 0,
+    (0 | ::_fl::kFcRepeated | ::_fl::kPackedSInt32)},
   }},
   // no aux_entries
   {{
@@ -1528,6 +2181,8 @@ PROTOBUF_NOINLINE void PlannerResponse::Clear() {
 
   _impl_.lon_.Clear();
   _impl_.lat_.Clear();
+  _impl_.lon_e7_delta_.Clear();
+  _impl_.lat_e7_delta_.Clear();
   _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
 }
 
@@ -1556,6 +2211,24 @@ PROTOBUF_NOINLINE void PlannerResponse::Clear() {
     target = stream->WriteFixedPacked(2, this_._internal_lat(), target);
   }
 
+  // repeated sint32 lon_e7_delta = 3;
+  {
+    int byte_size = this_._impl_._lon_e7_delta_cached_byte_size_.Get();
+    if (byte_size > 0) {
+      target = stream->WriteSInt32Packed(
+          3, this_._internal_lon_e7_delta(), byte_size, target);
+    }
+  }
+
+  // repeated sint32 lat_e7_delta = 4;
+  {
+    int byte_size = this_._impl_._lat_e7_delta_cached_byte_size_.Get();
+    if (byte_size > 0) {
+      target = stream->WriteSInt32Packed(
+          4, this_._internal_lat_e7_delta(), byte_size, target);
+    }
+  }
+
   if (ABSL_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
     target =
         ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
@@ -1601,6 +2274,20 @@ PROTOBUF_NOINLINE void PlannerResponse::Clear() {
                               static_cast<::int32_t>(data_size));
       total_size += tag_size + data_size;
     }
+    // repeated sint32 lon_e7_delta = 3;
+    {
+      total_size +=
+          ::_pbi::WireFormatLite::SInt32SizeWithPackedTagSize(
+              this_._internal_lon_e7_delta(), 1,
+              this_._impl_._lon_e7_delta_cached_byte_size_);
+    }
+    // repeated sint32 lat_e7_delta = 4;
+    {
+      total_size +=
+          ::_pbi::WireFormatLite::SInt32SizeWithPackedTagSize(
+              this_._internal_lat_e7_delta(), 1,
+              this_._impl_._lat_e7_delta_cached_byte_size_);
+    }
   }
   return this_.MaybeComputeUnknownFieldsSize(total_size,
                                              &this_._impl_._cached_size_);
@@ -1616,6 +2303,8 @@ void PlannerResponse::MergeImpl(::google::protobuf::MessageLite& to_msg, const :
 
   _this->_internal_mutable_lon()->MergeFrom(from._internal_lon());
   _this->_internal_mutable_lat()->MergeFrom(from._internal_lat());
+  _this->_internal_mutable_lon_e7_delta()->MergeFrom(from._internal_lon_e7_delta());
+  _this->_internal_mutable_lat_e7_delta()->MergeFrom(from._internal_lat_e7_delta());
   _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
 }
 
@@ -1632,6 +2321,8 @@ void PlannerResponse::InternalSwap(PlannerResponse* PROTOBUF_RESTRICT PROTOBUF_N
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   _impl_.lon_.InternalSwap(&other->_impl_.lon_);
   _impl_.lat_.InternalSwap(&other->_impl_.lat_);
+  _impl_.lon_e7_delta_.InternalSwap(&other->_impl_.lon_e7_delta_);
+  _impl_.lat_e7_delta_.InternalSwap(&other->_impl_.lat_e7_delta_);
 }
 
 ::google::protobuf::Metadata PlannerResponse::GetMetadata() const {
@@ -1645,6 +2336,8 @@ class Status::_Internal {
       decltype(::std::declval<Status>()._impl_._has_bits_);
   static constexpr ::int32_t kHasBitsOffset =
       8 * PROTOBUF_FIELD_OFFSET(Status, _impl_._has_bits_);
+  static constexpr ::int32_t kOneofCaseOffset =
+      PROTOBUF_FIELD_OFFSET(::Status, _impl_._oneof_case_);
 };
 
 Status::Status(::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
@@ -1662,7 +2355,11 @@ PROTOBUF_NDEBUG_INLINE Status::Impl_::Impl_(
     const ::Status& from_msg)
       : _has_bits_{from._has_bits_},
         _cached_size_{0},
-        type_status_(arena, from.type_status_) {}
+        type_status_(arena, from.type_status_),
+        profile_(arena, from.profile_),
+        mission_id_(arena, from.mission_id_),
+        typed_status_{},
+        _oneof_case_{from._oneof_case_[0]} {}
 
 Status::Status(
     ::google::protobuf::Arena* PROTOBUF_NULLABLE arena,
@@ -1677,6 +2374,26 @@ Status::Status(
   _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
       from._internal_metadata_);
   new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
+  ::memcpy(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, request_id_),
+           reinterpret_cast<const char *>(&from._impl_) +
+               offsetof(Impl_, request_id_),
+           offsetof(Impl_, last_mission_latency_ms_) -
+               offsetof(Impl_, request_id_) +
+               sizeof(Impl_::last_mission_latency_ms_));
+  switch (typed_status_case()) {
+    case TYPED_STATUS_NOT_SET:
+      break;
+      case kPlannerStatus:
+        _impl_.typed_status_.planner_status_ = from._impl_.typed_status_.planner_status_;
+        break;
+      case kDroneStatus:
+        _impl_.typed_status_.drone_status_ = from._impl_.typed_status_.drone_status_;
+        break;
+      case kPldStatus:
+        _impl_.typed_status_.pld_status_ = from._impl_.typed_status_.pld_status_;
+        break;
+  }
 
   // @@protoc_insertion_point(copy_constructor:Status)
 }
@@ -1684,10 +2401,20 @@ PROTOBUF_NDEBUG_INLINE Status::Impl_::Impl_(
     ::google::protobuf::internal::InternalVisibility visibility,
     ::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
       : _cached_size_{0},
-        type_status_(arena) {}
+        type_status_(arena),
+        profile_(arena),
+        mission_id_(arena),
+        typed_status_{},
+        _oneof_case_{} {}
 
 inline void Status::SharedCtor(::_pb::Arena* PROTOBUF_NULLABLE arena) {
   new (&_impl_) Impl_(internal_visibility(), arena);
+  ::memset(reinterpret_cast<char *>(&_impl_) +
+               offsetof(Impl_, request_id_),
+           0,
+           offsetof(Impl_, last_mission_latency_ms_) -
+               offsetof(Impl_, request_id_) +
+               sizeof(Impl_::last_mission_latency_ms_));
 }
 Status::~Status() {
   // @@protoc_insertion_point(destructor:Status)
@@ -1698,9 +2425,38 @@ inline void Status::SharedDtor(MessageLite& self) {
   this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
   ABSL_DCHECK(this_.GetArena() == nullptr);
   this_._impl_.type_status_.Destroy();
+  this_._impl_.profile_.Destroy();
+  this_._impl_.mission_id_.Destroy();
+  if (this_.has_typed_status()) {
+    this_.clear_typed_status();
+  }
   this_._impl_.~Impl_();
 }
 
+void Status::clear_typed_status() {
+// @@protoc_insertion_point(one_of_clear_start:Status)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  switch (typed_status_case()) {
+    case kPlannerStatus: {
+      // No need to clear
+      break;
+    }
+    case kDroneStatus: {
+      // No need to clear
+      break;
+    }
+    case kPldStatus: {
+      // No need to clear
+      break;
+    }
+    case TYPED_STATUS_NOT_SET: {
+      break;
+    }
+  }
+  _impl_._oneof_case_[0] = TYPED_STATUS_NOT_SET;
+}
+
+
 inline void* PROTOBUF_NONNULL Status::PlacementNew_(
     const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
     ::google::protobuf::Arena* PROTOBUF_NULLABLE arena) {
@@ -1744,16 +2500,16 @@ Status::GetClassData() const {
   return Status_class_data_.base();
 }
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<0, 1, 0, 26, 2>
+const ::_pbi::TcParseTable<4, 11, 0, 51, 2>
 Status::_table_ = {
   {
     PROTOBUF_FIELD_OFFSET(Status, _impl_._has_bits_),
     0, // no _extensions_
-    1, 0,  // max_field_number, fast_idx_mask
+    11, 120,  // max_field_number, fast_idx_mask
     offsetof(decltype(_table_), field_lookup_table),
-    4294967294,  // skipmap
+    4294965248,  // skipmap
     offsetof(decltype(_table_), field_entries),
-    1,  // num_field_entries
+    11,  // num_field_entries
     0,  // num_aux_entries
     offsetof(decltype(_table_), field_names),  // no aux_entries
     Status_class_data_.base(),
@@ -1763,21 +2519,82 @@ Status::_table_ = {
     ::_pbi::TcParser::GetTable<::Status>(),  // to_prefetch
     #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
   }, {{
+    {::_pbi::TcParser::MiniParse, {}},
     // string type_status = 1;
     {::_pbi::TcParser::FastUS1,
      {10, 0, 0, PROTOBUF_FIELD_OFFSET(Status, _impl_.type_status_)}},
+    // uint64 request_id = 2;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(Status, _impl_.request_id_), 3>(),
+     {16, 3, 0, PROTOBUF_FIELD_OFFSET(Status, _impl_.request_id_)}},
+    // string profile = 3;
+    {::_pbi::TcParser::FastUS1,
+     {26, 1, 0, PROTOBUF_FIELD_OFFSET(Status, _impl_.profile_)}},
+    // bool compact_coordinates = 4;
+    {::_pbi::TcParser::SingularVarintNoZag1<bool, offsetof(Status, _impl_.compact_coordinates_), 4>(),
+     {32, 4, 0, PROTOBUF_FIELD_OFFSET(Status, _impl_.compact_coordinates_)}},
+    {::_pbi::TcParser::MiniParse, {}},
+    {::_pbi::TcParser::MiniParse, {}},
+    {::_pbi::TcParser::MiniParse, {}},
+    // uint32 queued_missions = 8;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(Status, _impl_.queued_missions_), 5>(),
+     {64, 5, 0, PROTOBUF_FIELD_OFFSET(Status, _impl_.queued_missions_)}},
+    // uint32 planned_missions = 9;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(Status, _impl_.planned_missions_), 6>(),
+     {72, 6, 0, PROTOBUF_FIELD_OFFSET(Status, _impl_.planned_missions_)}},
+    // uint64 last_mission_latency_ms = 10;
+    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(Status, _impl_.last_mission_latency_ms_), 7>(),
+     {80, 7, 0, PROTOBUF_FIELD_OFFSET(Status, _impl_.last_mission_latency_ms_)}},
+    // string mission_id = 11;
+    {::_pbi::TcParser::FastUS1,
+     {90, 2, 0, PROTOBUF_FIELD_OFFSET(Status, _impl_.mission_id_)}},
+    {::_pbi::TcParser::MiniParse, {}},
+    {::_pbi::TcParser::MiniParse, {}},
+    {::_pbi::TcParser::MiniParse, {}},
+    {::_pbi::TcParser::MiniParse, {}},
   }}, {{
     65535, 65535
   }}, {{
     // string type_status = 1;
     {PROTOBUF_FIELD_OFFSET(Status, _impl_.type_status_), _Internal::kHasBitsOffset + 0, 0,
     (0 | ::_fl::kFcOptional | ::_fl::kUtf8String | ::_fl::kRepAString)},
+    // uint64 request_id = 2;
+    {PROTOBUF_FIELD_OFFSET(Status, _impl_.request_id_), _Internal::kHasBitsOffset + 3, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kUInt64)},
+    // string profile = 3;
+    {PROTOBUF_FIELD_OFFSET(Status, _impl_.profile_), _Internal::kHasBitsOffset + 1, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kUtf8String | ::_fl::kRepAString)},
+    // bool compact_coordinates = 4;
+    {PROTOBUF_FIELD_OFFSET(Status, _impl_.compact_coordinates_), _Internal::kHasBitsOffset + 4, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kBool)},
+    // .PlannerStatus planner_status = 5;
+    {PROTOBUF_FIELD_OFFSET(Status, _impl_.typed_status_.planner_status_), _Internal::kOneofCaseOffset + 0, 0,
+    (0 | ::_fl::kFcOneof | ::_fl::kOpenEnum)},
+    // .DroneStatus drone_status = 6;
+    {PROTOBUF_FIELD_OFFSET(Status, _impl_.typed_status_.drone_status_), _Internal::kOneofCaseOffset + 0, 0,
+    (0 | ::_fl::kFcOneof | ::_fl::kOpenEnum)},
+    // .PldStatus pld_status = 7;
+    {PROTOBUF_FIELD_OFFSET(Status, _impl_.typed_status_.pld_status_), _Internal::kOneofCaseOffset + 0, 0,
+    (0 | ::_fl::kFcOneof | ::_fl::kOpenEnum)},
+    // uint32 queued_missions = 8;
+    {PROTOBUF_FIELD_OFFSET(Status, _impl_.queued_missions_), _Internal::kHasBitsOffset + 5, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kUInt32)},
+    // uint32 planned_missions = 9;
+    {PROTOBUF_FIELD_OFFSET(Status, _impl_.planned_missions_), _Internal::kHasBitsOffset + 6, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kUInt32)},
+    // uint64 last_mission_latency_ms = 10;
+    {PROTOBUF_FIELD_OFFSET(Status, _impl_.last_mission_latency_ms_), _Internal::kHasBitsOffset + 7, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kUInt64)},
+    // string mission_id = 11;
+    {PROTOBUF_FIELD_OFFSET(Status, _impl_.mission_id_), _Internal::kHasBitsOffset + 2, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kUtf8String | ::_fl::kRepAString)},
   }},
   // no aux_entries
   {{
-    "\6\13\0\0\0\0\0\0"
+    "\6\13\0\7\0\0\0\0\0\0\0\12\0\0\0\0"
     "Status"
     "type_status"
+    "profile"
+    "mission_id"
   }},
 };
 PROTOBUF_NOINLINE void Status::Clear() {
@@ -1788,9 +2605,23 @@ PROTOBUF_NOINLINE void Status::Clear() {
   (void) cached_has_bits;
 
   cached_has_bits = _impl_._has_bits_[0];
-  if ((cached_has_bits & 0x00000001u) != 0) {
-    _impl_.type_status_.ClearNonDefaultToEmpty();
+  if ((cached_has_bits & 0x00000007u) != 0) {
+    if ((cached_has_bits & 0x00000001u) != 0) {
+      _impl_.type_status_.ClearNonDefaultToEmpty();
+    }
+    if ((cached_has_bits & 0x00000002u) != 0) {
+      _impl_.profile_.ClearNonDefaultToEmpty();
+    }
+    if ((cached_has_bits & 0x00000004u) != 0) {
+      _impl_.mission_id_.ClearNonDefaultToEmpty();
+    }
+  }
+  if ((cached_has_bits & 0x000000f8u) != 0) {
+    ::memset(&_impl_.request_id_, 0, static_cast<::size_t>(
+        reinterpret_cast<char*>(&_impl_.last_mission_latency_ms_) -
+        reinterpret_cast<char*>(&_impl_.request_id_)) + sizeof(_impl_.last_mission_latency_ms_));
   }
+  clear_typed_status();
   _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
 }
@@ -1820,6 +2651,93 @@ PROTOBUF_NOINLINE void Status::Clear() {
     }
   }
 
+  // uint64 request_id = 2;
+  if ((this_._impl_._has_bits_[0] & 0x00000008u) != 0) {
+    if (this_._internal_request_id() != 0) {
+      target = stream->EnsureSpace(target);
+      target = ::_pbi::WireFormatLite::WriteUInt64ToArray(
+          2, this_._internal_request_id(), target);
+    }
+  }
+
+  // string profile = 3;
+  if ((this_._impl_._has_bits_[0] & 0x00000002u) != 0) {
+    if (!this_._internal_profile().empty()) {
+      const ::std::string& _s = this_._internal_profile();
+      ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+          _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "Status.profile");
+      target = stream->WriteStringMaybeAliased(3, _s, target);
+    }
+  }
+
+  // bool compact_coordinates = 4;
+  if ((this_._impl_._has_bits_[0] & 0x00000010u) != 0) {
+    if (this_._internal_compact_coordinates() != 0) {
+      target = stream->EnsureSpace(target);
+      target = ::_pbi::WireFormatLite::WriteBoolToArray(
+          4, this_._internal_compact_coordinates(), target);
+    }
+  }
+
+  switch (this_.typed_status_case()) {
+    case kPlannerStatus: {
+      target = stream->EnsureSpace(target);
+      target = ::_pbi::WireFormatLite::WriteEnumToArray(
+          5, this_._internal_planner_status(), target);
+      break;
+    }
+    case kDroneStatus: {
+      target = stream->EnsureSpace(target);
+      target = ::_pbi::WireFormatLite::WriteEnumToArray(
+          6, this_._internal_drone_status(), target);
+      break;
+    }
+    case kPldStatus: {
+      target = stream->EnsureSpace(target);
+      target = ::_pbi::WireFormatLite::WriteEnumToArray(
+          7, this_._internal_pld_status(), target);
+      break;
+    }
+    default:
+      break;
+  }
+  // uint32 queued_missions = 8;
+  if ((this_._impl_._has_bits_[0] & 0x00000020u) != 0) {
+    if (this_._internal_queued_missions() != 0) {
+      target = stream->EnsureSpace(target);
+      target = ::_pbi::WireFormatLite::WriteUInt32ToArray(
+          8, this_._internal_queued_missions(), target);
+    }
+  }
+
+  // uint32 planned_missions = 9;
+  if ((this_._impl_._has_bits_[0] & 0x00000040u) != 0) {
+    if (this_._internal_planned_missions() != 0) {
+      target = stream->EnsureSpace(target);
+      target = ::_pbi::WireFormatLite::WriteUInt32ToArray(
+          9, this_._internal_planned_missions(), target);
+    }
+  }
+
+  // uint64 last_mission_latency_ms = 10;
+  if ((this_._impl_._has_bits_[0] & 0x00000080u) != 0) {
+    if (this_._internal_last_mission_latency_ms() != 0) {
+      target = stream->EnsureSpace(target);
+      target = ::_pbi::WireFormatLite::WriteUInt64ToArray(
+          10, this_._internal_last_mission_latency_ms(), target);
+    }
+  }
+
+  // string mission_id = 11;
+  if ((this_._impl_._has_bits_[0] & 0x00000004u) != 0) {
+    if (!this_._internal_mission_id().empty()) {
+      const ::std::string& _s = this_._internal_mission_id();
+      ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+          _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "Status.mission_id");
+      target = stream->WriteStringMaybeAliased(11, _s, target);
+    }
+  }
+
   if (ABSL_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
     target =
         ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
@@ -1843,15 +2761,87 @@ PROTOBUF_NOINLINE void Status::Clear() {
   // Prevent compiler warnings about cached_has_bits being unused
   (void)cached_has_bits;
 
-   {
+  ::_pbi::Prefetch5LinesFrom7Lines(&this_);
+  cached_has_bits = this_._impl_._has_bits_[0];
+  if ((cached_has_bits & 0x000000ffu) != 0) {
     // string type_status = 1;
-    cached_has_bits = this_._impl_._has_bits_[0];
     if ((cached_has_bits & 0x00000001u) != 0) {
       if (!this_._internal_type_status().empty()) {
         total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
                                         this_._internal_type_status());
       }
     }
+    // string profile = 3;
+    if ((cached_has_bits & 0x00000002u) != 0) {
+      if (!this_._internal_profile().empty()) {
+        total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                        this_._internal_profile());
+      }
+    }
+    // string mission_id = 11;
+    if ((cached_has_bits & 0x00000004u) != 0) {
+      if (!this_._internal_mission_id().empty()) {
+        total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                        this_._internal_mission_id());
+      }
+    }
+    // uint64 request_id = 2;
+    if ((cached_has_bits & 0x00000008u) != 0) {
+      if (this_._internal_request_id() != 0) {
+        total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(
+            this_._internal_request_id());
+      }
+    }
+    // bool compact_coordinates = 4;
+    if ((cached_has_bits & 0x00000010u) != 0) {
+      if (this_._internal_compact_coordinates() != 0) {
+        total_size += 2;
+      }
+    }
+    // uint32 queued_missions = 8;
+    if ((cached_has_bits & 0x00000020u) != 0) {
+      if (this_._internal_queued_missions() != 0) {
+        total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(
+            this_._internal_queued_missions());
+      }
+    }
+    // uint32 planned_missions = 9;
+    if ((cached_has_bits & 0x00000040u) != 0) {
+      if (this_._internal_planned_missions() != 0) {
+        total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(
+            this_._internal_planned_missions());
+      }
+    }
+    // uint64 last_mission_latency_ms = 10;
+    if ((cached_has_bits & 0x00000080u) != 0) {
+      if (this_._internal_last_mission_latency_ms() != 0) {
+        total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(
+            this_._internal_last_mission_latency_ms());
+      }
+    }
+  }
+  switch (this_.typed_status_case()) {
+    // .PlannerStatus planner_status = 5;
+    case kPlannerStatus: {
+      total_size += 1 +
+                    ::_pbi::WireFormatLite::EnumSize(this_._internal_planner_status());
+      break;
+    }
+    // .DroneStatus drone_status = 6;
+    case kDroneStatus: {
+      total_size += 1 +
+                    ::_pbi::WireFormatLite::EnumSize(this_._internal_drone_status());
+      break;
+    }
+    // .PldStatus pld_status = 7;
+    case kPldStatus: {
+      total_size += 1 +
+                    ::_pbi::WireFormatLite::EnumSize(this_._internal_pld_status());
+      break;
+    }
+    case TYPED_STATUS_NOT_SET: {
+      break;
+    }
   }
   return this_.MaybeComputeUnknownFieldsSize(total_size,
                                              &this_._impl_._cached_size_);
@@ -1866,16 +2856,88 @@ void Status::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::
   (void) cached_has_bits;
 
   cached_has_bits = from._impl_._has_bits_[0];
-  if ((cached_has_bits & 0x00000001u) != 0) {
-    if (!from._internal_type_status().empty()) {
-      _this->_internal_set_type_status(from._internal_type_status());
-    } else {
-      if (_this->_impl_.type_status_.IsDefault()) {
-        _this->_internal_set_type_status("");
+  if ((cached_has_bits & 0x000000ffu) != 0) {
+    if ((cached_has_bits & 0x00000001u) != 0) {
+      if (!from._internal_type_status().empty()) {
+        _this->_internal_set_type_status(from._internal_type_status());
+      } else {
+        if (_this->_impl_.type_status_.IsDefault()) {
+          _this->_internal_set_type_status("");
+        }
+      }
+    }
+    if ((cached_has_bits & 0x00000002u) != 0) {
+      if (!from._internal_profile().empty()) {
+        _this->_internal_set_profile(from._internal_profile());
+      } else {
+        if (_this->_impl_.profile_.IsDefault()) {
+          _this->_internal_set_profile("");
+        }
+      }
+    }
+    if ((cached_has_bits & 0x00000004u) != 0) {
+      if (!from._internal_mission_id().empty()) {
+        _this->_internal_set_mission_id(from._internal_mission_id());
+      } else {
+        if (_this->_impl_.mission_id_.IsDefault()) {
+          _this->_internal_set_mission_id("");
+        }
+      }
+    }
+    if ((cached_has_bits & 0x00000008u) != 0) {
+      if (from._internal_request_id() != 0) {
+        _this->_impl_.request_id_ = from._impl_.request_id_;
+      }
+    }
+    if ((cached_has_bits & 0x00000010u) != 0) {
+      if (from._internal_compact_coordinates() != 0) {
+        _this->_impl_.compact_coordinates_ = from._impl_.compact_coordinates_;
+      }
+    }
+    if ((cached_has_bits & 0x00000020u) != 0) {
+      if (from._internal_queued_missions() != 0) {
+        _this->_impl_.queued_missions_ = from._impl_.queued_missions_;
+      }
+    }
+    if ((cached_has_bits & 0x00000040u) != 0) {
+      if (from._internal_planned_missions() != 0) {
+        _this->_impl_.planned_missions_ = from._impl_.planned_missions_;
+      }
+    }
+    if ((cached_has_bits & 0x00000080u) != 0) {
+      if (from._internal_last_mission_latency_ms() != 0) {
+        _this->_impl_.last_mission_latency_ms_ = from._impl_.last_mission_latency_ms_;
       }
     }
   }
   _this->_impl_._has_bits_[0] |= cached_has_bits;
+  if (const uint32_t oneof_from_case = from._impl_._oneof_case_[0]) {
+    const uint32_t oneof_to_case = _this->_impl_._oneof_case_[0];
+    const bool oneof_needs_init = oneof_to_case != oneof_from_case;
+    if (oneof_needs_init) {
+      if (oneof_to_case != 0) {
+        _this->clear_typed_status();
+      }
+      _this->_impl_._oneof_case_[0] = oneof_from_case;
+    }
+
+    switch (oneof_from_case) {
+      case kPlannerStatus: {
+        _this->_impl_.typed_status_.planner_status_ = from._impl_.typed_status_.planner_status_;
+        break;
+      }
+      case kDroneStatus: {
+        _this->_impl_.typed_status_.drone_status_ = from._impl_.typed_status_.drone_status_;
+        break;
+      }
+      case kPldStatus: {
+        _this->_impl_.typed_status_.pld_status_ = from._impl_.typed_status_.pld_status_;
+        break;
+      }
+      case TYPED_STATUS_NOT_SET:
+        break;
+    }
+  }
   _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
 }
 
@@ -1894,6 +2956,16 @@ void Status::InternalSwap(Status* PROTOBUF_RESTRICT PROTOBUF_NONNULL other) {
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
   ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.type_status_, &other->_impl_.type_status_, arena);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.profile_, &other->_impl_.profile_, arena);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.mission_id_, &other->_impl_.mission_id_, arena);
+  ::google::protobuf::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Status, _impl_.last_mission_latency_ms_)
+      + sizeof(Status::_impl_.last_mission_latency_ms_)
+      - PROTOBUF_FIELD_OFFSET(Status, _impl_.request_id_)>(
+          reinterpret_cast<char*>(&_impl_.request_id_),
+          reinterpret_cast<char*>(&other->_impl_.request_id_));
+  swap(_impl_.typed_status_, other->_impl_.typed_status_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
 }
 
 ::google::protobuf::Metadata Status::GetMetadata() const {
@@ -2280,7 +3352,8 @@ PROTOBUF_NDEBUG_INLINE Command::Impl_::Impl_(
     const ::Command& from_msg)
       : _has_bits_{from._has_bits_},
         _cached_size_{0},
-        command_(arena, from.command_) {}
+        command_(arena, from.command_),
+        mission_id_(arena, from.mission_id_) {}
 
 Command::Command(
     ::google::protobuf::Arena* PROTOBUF_NULLABLE arena,
@@ -2302,7 +3375,8 @@ PROTOBUF_NDEBUG_INLINE Command::Impl_::Impl_(
     ::google::protobuf::internal::InternalVisibility visibility,
     ::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
       : _cached_size_{0},
-        command_(arena) {}
+        command_(arena),
+        mission_id_(arena) {}
 
 inline void Command::SharedCtor(::_pb::Arena* PROTOBUF_NULLABLE arena) {
   new (&_impl_) Impl_(internal_visibility(), arena);
@@ -2316,6 +3390,7 @@ inline void Command::SharedDtor(MessageLite& self) {
   this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
   ABSL_DCHECK(this_.GetArena() == nullptr);
   this_._impl_.command_.Destroy();
+  this_._impl_.mission_id_.Destroy();
   this_._impl_.~Impl_();
 }
 
@@ -2362,16 +3437,16 @@ Command::GetClassData() const {
   return Command_class_data_.base();
 }
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<0, 1, 0, 23, 2>
+const ::_pbi::TcParseTable<1, 2, 0, 33, 2>
 Command::_table_ = {
   {
     PROTOBUF_FIELD_OFFSET(Command, _impl_._has_bits_),
     0, // no _extensions_
-    1, 0,  // max_field_number, fast_idx_mask
+    2, 8,  // max_field_number, fast_idx_mask
     offsetof(decltype(_table_), field_lookup_table),
-    4294967294,  // skipmap
+    4294967292,  // skipmap
     offsetof(decltype(_table_), field_entries),
-    1,  // num_field_entries
+    2,  // num_field_entries
     0,  // num_aux_entries
     offsetof(decltype(_table_), field_names),  // no aux_entries
     Command_class_data_.base(),
@@ -2381,6 +3456,9 @@ Command::_table_ = {
     ::_pbi::TcParser::GetTable<::Command>(),  // to_prefetch
     #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
   }, {{
+    // string mission_id = 2;
+    {::_pbi::TcParser::FastUS1,
+     {18, 1, 0, PROTOBUF_FIELD_OFFSET(Command, _impl_.mission_id_)}},
     // string command = 1;
     {::_pbi::TcParser::FastUS1,
      {10, 0, 0, PROTOBUF_FIELD_OFFSET(Command, _impl_.command_)}},
@@ -2390,12 +3468,16 @@ Command::_table_ = {
     // string command = 1;
     {PROTOBUF_FIELD_OFFSET(Command, _impl_.command_), _Internal::kHasBitsOffset + 0, 0,
     (0 | ::_fl::kFcOptional | ::_fl::kUtf8String | ::_fl::kRepAString)},
+    // string mission_id = 2;
+    {PROTOBUF_FIELD_OFFSET(Command, _impl_.mission_id_), _Internal::kHasBitsOffset + 1, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kUtf8String | ::_fl::kRepAString)},
   }},
   // no aux_entries
   {{
-    "\7\7\0\0\0\0\0\0"
+    "\7\7\12\0\0\0\0\0"
     "Command"
     "command"
+    "mission_id"
   }},
 };
 PROTOBUF_NOINLINE void Command::Clear() {
@@ -2406,8 +3488,13 @@ PROTOBUF_NOINLINE void Command::Clear() {
   (void) cached_has_bits;
 
   cached_has_bits = _impl_._has_bits_[0];
-  if ((cached_has_bits & 0x00000001u) != 0) {
-    _impl_.command_.ClearNonDefaultToEmpty();
+  if ((cached_has_bits & 0x00000003u) != 0) {
+    if ((cached_has_bits & 0x00000001u) != 0) {
+      _impl_.command_.ClearNonDefaultToEmpty();
+    }
+    if ((cached_has_bits & 0x00000002u) != 0) {
+      _impl_.mission_id_.ClearNonDefaultToEmpty();
+    }
   }
   _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
@@ -2438,6 +3525,16 @@ PROTOBUF_NOINLINE void Command::Clear() {
     }
   }
 
+  // string mission_id = 2;
+  if ((this_._impl_._has_bits_[0] & 0x00000002u) != 0) {
+    if (!this_._internal_mission_id().empty()) {
+      const ::std::string& _s = this_._internal_mission_id();
+      ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+          _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "Command.mission_id");
+      target = stream->WriteStringMaybeAliased(2, _s, target);
+    }
+  }
+
   if (ABSL_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
     target =
         ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
@@ -2461,15 +3558,23 @@ PROTOBUF_NOINLINE void Command::Clear() {
   // Prevent compiler warnings about cached_has_bits being unused
   (void)cached_has_bits;
 
-   {
+  ::_pbi::Prefetch5LinesFrom7Lines(&this_);
+  cached_has_bits = this_._impl_._has_bits_[0];
+  if ((cached_has_bits & 0x00000003u) != 0) {
     // string command = 1;
-    cached_has_bits = this_._impl_._has_bits_[0];
     if ((cached_has_bits & 0x00000001u) != 0) {
       if (!this_._internal_command().empty()) {
         total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
                                         this_._internal_command());
       }
     }
+    // string mission_id = 2;
+    if ((cached_has_bits & 0x00000002u) != 0) {
+      if (!this_._internal_mission_id().empty()) {
+        total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                        this_._internal_mission_id());
+      }
+    }
   }
   return this_.MaybeComputeUnknownFieldsSize(total_size,
                                              &this_._impl_._cached_size_);
@@ -2484,12 +3589,23 @@ void Command::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google:
   (void) cached_has_bits;
 
   cached_has_bits = from._impl_._has_bits_[0];
-  if ((cached_has_bits & 0x00000001u) != 0) {
-    if (!from._internal_command().empty()) {
-      _this->_internal_set_command(from._internal_command());
-    } else {
-      if (_this->_impl_.command_.IsDefault()) {
-        _this->_internal_set_command("");
+  if ((cached_has_bits & 0x00000003u) != 0) {
+    if ((cached_has_bits & 0x00000001u) != 0) {
+      if (!from._internal_command().empty()) {
+        _this->_internal_set_command(from._internal_command());
+      } else {
+        if (_this->_impl_.command_.IsDefault()) {
+          _this->_internal_set_command("");
+        }
+      }
+    }
+    if ((cached_has_bits & 0x00000002u) != 0) {
+      if (!from._internal_mission_id().empty()) {
+        _this->_internal_set_mission_id(from._internal_mission_id());
+      } else {
+        if (_this->_impl_.mission_id_.IsDefault()) {
+          _this->_internal_set_mission_id("");
+        }
       }
     }
   }
@@ -2512,6 +3628,7 @@ void Command::InternalSwap(Command* PROTOBUF_RESTRICT PROTOBUF_NONNULL other) {
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
   ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.command_, &other->_impl_.command_, arena);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.mission_id_, &other->_impl_.mission_id_, arena);
 }
 
 ::google::protobuf::Metadata Command::GetMetadata() const {
@@ -2835,7 +3952,7 @@ class Config_mission::_Internal {
 void Config_mission::clear_planner_config() {
   ::google::protobuf::internal::TSanWrite(&_impl_);
   if (_impl_.planner_config_ != nullptr) _impl_.planner_config_->Clear();
-  _impl_._has_bits_[0] &= ~0x00000002u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
 }
 Config_mission::Config_mission(::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
 #if defined(PROTOBUF_CUSTOM_VTABLE)
@@ -2852,7 +3969,8 @@ PROTOBUF_NDEBUG_INLINE Config_mission::Impl_::Impl_(
     const ::Config_mission& from_msg)
       : _has_bits_{from._has_bits_},
         _cached_size_{0},
-        drone_sim_(arena, from.drone_sim_) {}
+        drone_sim_(arena, from.drone_sim_),
+        mission_id_(arena, from.mission_id_) {}
 
 Config_mission::Config_mission(
     ::google::protobuf::Arena* PROTOBUF_NULLABLE arena,
@@ -2868,13 +3986,13 @@ Config_mission::Config_mission(
       from._internal_metadata_);
   new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
   ::uint32_t cached_has_bits = _impl_._has_bits_[0];
-  _impl_.planner_config_ = ((cached_has_bits & 0x00000002u) != 0)
+  _impl_.planner_config_ = ((cached_has_bits & 0x00000004u) != 0)
                 ? ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.planner_config_)
                 : nullptr;
-  _impl_.info_planner_ = ((cached_has_bits & 0x00000004u) != 0)
+  _impl_.info_planner_ = ((cached_has_bits & 0x00000008u) != 0)
                 ? ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.info_planner_)
                 : nullptr;
-  _impl_.info_drone_ = ((cached_has_bits & 0x00000008u) != 0)
+  _impl_.info_drone_ = ((cached_has_bits & 0x00000010u) != 0)
                 ? ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.info_drone_)
                 : nullptr;
 
@@ -2884,7 +4002,8 @@ PROTOBUF_NDEBUG_INLINE Config_mission::Impl_::Impl_(
     ::google::protobuf::internal::InternalVisibility visibility,
     ::google::protobuf::Arena* PROTOBUF_NULLABLE arena)
       : _cached_size_{0},
-        drone_sim_(arena) {}
+        drone_sim_(arena),
+        mission_id_(arena) {}
 
 inline void Config_mission::SharedCtor(::_pb::Arena* PROTOBUF_NULLABLE arena) {
   new (&_impl_) Impl_(internal_visibility(), arena);
@@ -2904,6 +4023,7 @@ inline void Config_mission::SharedDtor(MessageLite& self) {
   this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
   ABSL_DCHECK(this_.GetArena() == nullptr);
   this_._impl_.drone_sim_.Destroy();
+  this_._impl_.mission_id_.Destroy();
   delete this_._impl_.planner_config_;
   delete this_._impl_.info_planner_;
   delete this_._impl_.info_drone_;
@@ -2953,16 +4073,16 @@ Config_mission::GetClassData() const {
   return Config_mission_class_data_.base();
 }
 PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<2, 4, 3, 32, 2>
+const ::_pbi::TcParseTable<3, 5, 3, 42, 2>
 Config_mission::_table_ = {
   {
     PROTOBUF_FIELD_OFFSET(Config_mission, _impl_._has_bits_),
     0, // no _extensions_
-    4, 24,  // max_field_number, fast_idx_mask
+    5, 56,  // max_field_number, fast_idx_mask
     offsetof(decltype(_table_), field_lookup_table),
-    4294967280,  // skipmap
+    4294967264,  // skipmap
     offsetof(decltype(_table_), field_entries),
-    4,  // num_field_entries
+    5,  // num_field_entries
     3,  // num_aux_entries
     offsetof(decltype(_table_), aux_entries),
     Config_mission_class_data_.base(),
@@ -2972,33 +4092,42 @@ Config_mission::_table_ = {
     ::_pbi::TcParser::GetTable<::Config_mission>(),  // to_prefetch
     #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
   }, {{
-    // string drone_sim = 4;
-    {::_pbi::TcParser::FastUS1,
-     {34, 0, 0, PROTOBUF_FIELD_OFFSET(Config_mission, _impl_.drone_sim_)}},
+    {::_pbi::TcParser::MiniParse, {}},
     // .PlannerMessage planner_config = 1;
     {::_pbi::TcParser::FastMtS1,
-     {10, 1, 0, PROTOBUF_FIELD_OFFSET(Config_mission, _impl_.planner_config_)}},
+     {10, 2, 0, PROTOBUF_FIELD_OFFSET(Config_mission, _impl_.planner_config_)}},
     // .Info_Module info_planner = 2;
     {::_pbi::TcParser::FastMtS1,
-     {18, 2, 1, PROTOBUF_FIELD_OFFSET(Config_mission, _impl_.info_planner_)}},
+     {18, 3, 1, PROTOBUF_FIELD_OFFSET(Config_mission, _impl_.info_planner_)}},
     // .Info_Module info_drone = 3;
     {::_pbi::TcParser::FastMtS1,
-     {26, 3, 2, PROTOBUF_FIELD_OFFSET(Config_mission, _impl_.info_drone_)}},
+     {26, 4, 2, PROTOBUF_FIELD_OFFSET(Config_mission, _impl_.info_drone_)}},
+    // string drone_sim = 4;
+    {::_pbi::TcParser::FastUS1,
+     {34, 0, 0, PROTOBUF_FIELD_OFFSET(Config_mission, _impl_.drone_sim_)}},
+    // string mission_id = 5;
+    {::_pbi::TcParser::FastUS1,
+     {42, 1, 0, PROTOBUF_FIELD_OFFSET(Config_mission, _impl_.mission_id_)}},
+    {::_pbi::TcParser::MiniParse, {}},
+    {::_pbi::TcParser::MiniParse, {}},
   }}, {{
     65535, 65535
   }}, {{
     // .PlannerMessage planner_config = 1;
-    {PROTOBUF_FIELD_OFFSET(Config_mission, _impl_.planner_config_), _Internal::kHasBitsOffset + 1, 0,
+    {PROTOBUF_FIELD_OFFSET(Config_mission, _impl_.planner_config_), _Internal::kHasBitsOffset + 2, 0,
     (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
     // .Info_Module info_planner = 2;
-    {PROTOBUF_FIELD_OFFSET(Config_mission, _impl_.info_planner_), _Internal::kHasBitsOffset + 2, 1,
+    {PROTOBUF_FIELD_OFFSET(Config_mission, _impl_.info_planner_), _Internal::kHasBitsOffset + 3, 1,
     (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
     // .Info_Module info_drone = 3;
-    {PROTOBUF_FIELD_OFFSET(Config_mission, _impl_.info_drone_), _Internal::kHasBitsOffset + 3, 2,
+    {PROTOBUF_FIELD_OFFSET(Config_mission, _impl_.info_drone_), _Internal::kHasBitsOffset + 4, 2,
     (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
     // string drone_sim = 4;
     {PROTOBUF_FIELD_OFFSET(Config_mission, _impl_.drone_sim_), _Internal::kHasBitsOffset + 0, 0,
     (0 | ::_fl::kFcOptional | ::_fl::kUtf8String | ::_fl::kRepAString)},
+    // string mission_id = 5;
+    {PROTOBUF_FIELD_OFFSET(Config_mission, _impl_.mission_id_), _Internal::kHasBitsOffset + 1, 0,
+    (0 | ::_fl::kFcOptional | ::_fl::kUtf8String | ::_fl::kRepAString)},
   }},
   {{
       {::_pbi::TcParser::GetTable<::PlannerMessage>()},
@@ -3006,9 +4135,10 @@ Config_mission::_table_ = {
       {::_pbi::TcParser::GetTable<::Info_Module>()},
   }},
   {{
-    "\16\0\0\0\11\0\0\0"
+    "\16\0\0\0\11\12\0\0"
     "Config_mission"
     "drone_sim"
+    "mission_id"
   }},
 };
 PROTOBUF_NOINLINE void Config_mission::Clear() {
@@ -3019,19 +4149,22 @@ PROTOBUF_NOINLINE void Config_mission::Clear() {
   (void) cached_has_bits;
 
   cached_has_bits = _impl_._has_bits_[0];
-  if ((cached_has_bits & 0x0000000fu) != 0) {
+  if ((cached_has_bits & 0x0000001fu) != 0) {
     if ((cached_has_bits & 0x00000001u) != 0) {
       _impl_.drone_sim_.ClearNonDefaultToEmpty();
     }
     if ((cached_has_bits & 0x00000002u) != 0) {
+      _impl_.mission_id_.ClearNonDefaultToEmpty();
+    }
+    if ((cached_has_bits & 0x00000004u) != 0) {
       ABSL_DCHECK(_impl_.planner_config_ != nullptr);
       _impl_.planner_config_->Clear();
     }
-    if ((cached_has_bits & 0x00000004u) != 0) {
+    if ((cached_has_bits & 0x00000008u) != 0) {
       ABSL_DCHECK(_impl_.info_planner_ != nullptr);
       _impl_.info_planner_->Clear();
     }
-    if ((cached_has_bits & 0x00000008u) != 0) {
+    if ((cached_has_bits & 0x00000010u) != 0) {
       ABSL_DCHECK(_impl_.info_drone_ != nullptr);
       _impl_.info_drone_->Clear();
     }
@@ -3057,21 +4190,21 @@ PROTOBUF_NOINLINE void Config_mission::Clear() {
 
   cached_has_bits = this_._impl_._has_bits_[0];
   // .PlannerMessage planner_config = 1;
-  if ((cached_has_bits & 0x00000002u) != 0) {
+  if ((cached_has_bits & 0x00000004u) != 0) {
     target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
         1, *this_._impl_.planner_config_, this_._impl_.planner_config_->GetCachedSize(), target,
         stream);
   }
 
   // .Info_Module info_planner = 2;
-  if ((cached_has_bits & 0x00000004u) != 0) {
+  if ((cached_has_bits & 0x00000008u) != 0) {
     target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
         2, *this_._impl_.info_planner_, this_._impl_.info_planner_->GetCachedSize(), target,
         stream);
   }
 
   // .Info_Module info_drone = 3;
-  if ((cached_has_bits & 0x00000008u) != 0) {
+  if ((cached_has_bits & 0x00000010u) != 0) {
     target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
         3, *this_._impl_.info_drone_, this_._impl_.info_drone_->GetCachedSize(), target,
         stream);
@@ -3087,6 +4220,16 @@ PROTOBUF_NOINLINE void Config_mission::Clear() {
     }
   }
 
+  // string mission_id = 5;
+  if ((cached_has_bits & 0x00000002u) != 0) {
+    if (!this_._internal_mission_id().empty()) {
+      const ::std::string& _s = this_._internal_mission_id();
+      ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
+          _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "Config_mission.mission_id");
+      target = stream->WriteStringMaybeAliased(5, _s, target);
+    }
+  }
+
   if (ABSL_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
     target =
         ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
@@ -3112,7 +4255,7 @@ PROTOBUF_NOINLINE void Config_mission::Clear() {
 
   ::_pbi::Prefetch5LinesFrom7Lines(&this_);
   cached_has_bits = this_._impl_._has_bits_[0];
-  if ((cached_has_bits & 0x0000000fu) != 0) {
+  if ((cached_has_bits & 0x0000001fu) != 0) {
     // string drone_sim = 4;
     if ((cached_has_bits & 0x00000001u) != 0) {
       if (!this_._internal_drone_sim().empty()) {
@@ -3120,18 +4263,25 @@ PROTOBUF_NOINLINE void Config_mission::Clear() {
                                         this_._internal_drone_sim());
       }
     }
-    // .PlannerMessage planner_config = 1;
+    // string mission_id = 5;
     if ((cached_has_bits & 0x00000002u) != 0) {
+      if (!this_._internal_mission_id().empty()) {
+        total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
+                                        this_._internal_mission_id());
+      }
+    }
+    // .PlannerMessage planner_config = 1;
+    if ((cached_has_bits & 0x00000004u) != 0) {
       total_size += 1 +
                     ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.planner_config_);
     }
     // .Info_Module info_planner = 2;
-    if ((cached_has_bits & 0x00000004u) != 0) {
+    if ((cached_has_bits & 0x00000008u) != 0) {
       total_size += 1 +
                     ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.info_planner_);
     }
     // .Info_Module info_drone = 3;
-    if ((cached_has_bits & 0x00000008u) != 0) {
+    if ((cached_has_bits & 0x00000010u) != 0) {
       total_size += 1 +
                     ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.info_drone_);
     }
@@ -3150,7 +4300,7 @@ void Config_mission::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::
   (void) cached_has_bits;
 
   cached_has_bits = from._impl_._has_bits_[0];
-  if ((cached_has_bits & 0x0000000fu) != 0) {
+  if ((cached_has_bits & 0x0000001fu) != 0) {
     if ((cached_has_bits & 0x00000001u) != 0) {
       if (!from._internal_drone_sim().empty()) {
         _this->_internal_set_drone_sim(from._internal_drone_sim());
@@ -3161,6 +4311,15 @@ void Config_mission::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::
       }
     }
     if ((cached_has_bits & 0x00000002u) != 0) {
+      if (!from._internal_mission_id().empty()) {
+        _this->_internal_set_mission_id(from._internal_mission_id());
+      } else {
+        if (_this->_impl_.mission_id_.IsDefault()) {
+          _this->_internal_set_mission_id("");
+        }
+      }
+    }
+    if ((cached_has_bits & 0x00000004u) != 0) {
       ABSL_DCHECK(from._impl_.planner_config_ != nullptr);
       if (_this->_impl_.planner_config_ == nullptr) {
         _this->_impl_.planner_config_ = ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.planner_config_);
@@ -3168,7 +4327,7 @@ void Config_mission::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::
         _this->_impl_.planner_config_->MergeFrom(*from._impl_.planner_config_);
       }
     }
-    if ((cached_has_bits & 0x00000004u) != 0) {
+    if ((cached_has_bits & 0x00000008u) != 0) {
       ABSL_DCHECK(from._impl_.info_planner_ != nullptr);
       if (_this->_impl_.info_planner_ == nullptr) {
         _this->_impl_.info_planner_ = ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.info_planner_);
@@ -3176,7 +4335,7 @@ void Config_mission::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::
         _this->_impl_.info_planner_->MergeFrom(*from._impl_.info_planner_);
       }
     }
-    if ((cached_has_bits & 0x00000008u) != 0) {
+    if ((cached_has_bits & 0x00000010u) != 0) {
       ABSL_DCHECK(from._impl_.info_drone_ != nullptr);
       if (_this->_impl_.info_drone_ == nullptr) {
         _this->_impl_.info_drone_ = ::google::protobuf::Message::CopyConstruct(arena, *from._impl_.info_drone_);
@@ -3204,6 +4363,7 @@ void Config_mission::InternalSwap(Config_mission* PROTOBUF_RESTRICT PROTOBUF_NON
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
   ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.drone_sim_, &other->_impl_.drone_sim_, arena);
+  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.mission_id_, &other->_impl_.mission_id_, arena);
   ::google::protobuf::internal::memswap<
       PROTOBUF_FIELD_OFFSET(Config_mission, _impl_.info_drone_)
       + sizeof(Config_mission::_impl_.info_drone_)
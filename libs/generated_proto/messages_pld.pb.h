@@ -28,6 +28,7 @@
 #include "google/protobuf/message_lite.h"
 #include "google/protobuf/repeated_field.h"  // IWYU pragma: export
 #include "google/protobuf/extension_set.h"  // IWYU pragma: export
+#include "google/protobuf/generated_enum_reflection.h"
 #include "google/protobuf/unknown_field_set.h"
 #include "messages_planner.pb.h"
 // @@protoc_insertion_point(includes)
@@ -53,6 +54,12 @@ struct TableStruct_messages_5fpld_2eproto {
 extern "C" {
 extern const ::google::protobuf::internal::DescriptorTable descriptor_table_messages_5fpld_2eproto;
 }  // extern "C"
+enum DroneStatus : int;
+extern const uint32_t DroneStatus_internal_data_[];
+enum PlannerStatus : int;
+extern const uint32_t PlannerStatus_internal_data_[];
+enum PldStatus : int;
+extern const uint32_t PldStatus_internal_data_[];
 class Command;
 struct CommandDefaultTypeInternal;
 extern CommandDefaultTypeInternal _Command_default_instance_;
@@ -73,6 +80,10 @@ class PlannerResponseList;
 struct PlannerResponseListDefaultTypeInternal;
 extern PlannerResponseListDefaultTypeInternal _PlannerResponseList_default_instance_;
 extern const ::google::protobuf::internal::ClassDataFull PlannerResponseList_class_data_;
+class PlannerRoute;
+struct PlannerRouteDefaultTypeInternal;
+extern PlannerRouteDefaultTypeInternal _PlannerRoute_default_instance_;
+extern const ::google::protobuf::internal::ClassDataFull PlannerRoute_class_data_;
 class Status;
 struct StatusDefaultTypeInternal;
 extern StatusDefaultTypeInternal _Status_default_instance_;
@@ -95,9 +106,137 @@ extern WrapperPlannerDefaultTypeInternal _WrapperPlanner_default_instance_;
 extern const ::google::protobuf::internal::ClassDataFull WrapperPlanner_class_data_;
 namespace google {
 namespace protobuf {
+template <>
+internal::EnumTraitsT<::DroneStatus_internal_data_>
+    internal::EnumTraitsImpl::value<::DroneStatus>;
+template <>
+internal::EnumTraitsT<::PlannerStatus_internal_data_>
+    internal::EnumTraitsImpl::value<::PlannerStatus>;
+template <>
+internal::EnumTraitsT<::PldStatus_internal_data_>
+    internal::EnumTraitsImpl::value<::PldStatus>;
 }  // namespace protobuf
 }  // namespace google
 
+enum PlannerStatus : int {
+  PLANNER_STATUS_UNKNOWN = 0,
+  PLANNER_STATUS_EXPECTING_DATA = 1,
+  PLANNER_STATUS_ERROR = 2,
+  PLANNER_STATUS_CALCULATING = 3,
+  PLANNER_STATUS_FINISH = 4,
+  PLANNER_STATUS_CANCELLED = 5,
+  PlannerStatus_INT_MIN_SENTINEL_DO_NOT_USE_ =
+      ::std::numeric_limits<::int32_t>::min(),
+  PlannerStatus_INT_MAX_SENTINEL_DO_NOT_USE_ =
+      ::std::numeric_limits<::int32_t>::max(),
+};
+
+extern const uint32_t PlannerStatus_internal_data_[];
+inline constexpr PlannerStatus PlannerStatus_MIN =
+    static_cast<PlannerStatus>(0);
+inline constexpr PlannerStatus PlannerStatus_MAX =
+    static_cast<PlannerStatus>(5);
+inline bool PlannerStatus_IsValid(int value) {
+  return 0 <= value && value <= 5;
+}
+inline constexpr int PlannerStatus_ARRAYSIZE = 5 + 1;
+const ::google::protobuf::EnumDescriptor* PROTOBUF_NONNULL PlannerStatus_descriptor();
+template <typename T>
+const ::std::string& PlannerStatus_Name(T value) {
+  static_assert(::std::is_same<T, PlannerStatus>::value ||
+                    ::std::is_integral<T>::value,
+                "Incorrect type passed to PlannerStatus_Name().");
+  return PlannerStatus_Name(static_cast<PlannerStatus>(value));
+}
+template <>
+inline const ::std::string& PlannerStatus_Name(PlannerStatus value) {
+  return ::google::protobuf::internal::NameOfDenseEnum<PlannerStatus_descriptor, 0, 5>(
+      static_cast<int>(value));
+}
+inline bool PlannerStatus_Parse(
+    ::absl::string_view name, PlannerStatus* PROTOBUF_NONNULL value) {
+  return ::google::protobuf::internal::ParseNamedEnum<PlannerStatus>(PlannerStatus_descriptor(), name,
+                                           value);
+}
+enum DroneStatus : int {
+  DRONE_STATUS_UNKNOWN = 0,
+  DRONE_STATUS_STARTING_SIM = 1,
+  DRONE_STATUS_ERROR = 2,
+  DRONE_STATUS_EXECUTING_MISSION = 3,
+  DRONE_STATUS_FINISH = 4,
+  DroneStatus_INT_MIN_SENTINEL_DO_NOT_USE_ =
+      ::std::numeric_limits<::int32_t>::min(),
+  DroneStatus_INT_MAX_SENTINEL_DO_NOT_USE_ =
+      ::std::numeric_limits<::int32_t>::max(),
+};
+
+extern const uint32_t DroneStatus_internal_data_[];
+inline constexpr DroneStatus DroneStatus_MIN =
+    static_cast<DroneStatus>(0);
+inline constexpr DroneStatus DroneStatus_MAX =
+    static_cast<DroneStatus>(4);
+inline bool DroneStatus_IsValid(int value) {
+  return 0 <= value && value <= 4;
+}
+inline constexpr int DroneStatus_ARRAYSIZE = 4 + 1;
+const ::google::protobuf::EnumDescriptor* PROTOBUF_NONNULL DroneStatus_descriptor();
+template <typename T>
+const ::std::string& DroneStatus_Name(T value) {
+  static_assert(::std::is_same<T, DroneStatus>::value ||
+                    ::std::is_integral<T>::value,
+                "Incorrect type passed to DroneStatus_Name().");
+  return DroneStatus_Name(static_cast<DroneStatus>(value));
+}
+template <>
+inline const ::std::string& DroneStatus_Name(DroneStatus value) {
+  return ::google::protobuf::internal::NameOfDenseEnum<DroneStatus_descriptor, 0, 4>(
+      static_cast<int>(value));
+}
+inline bool DroneStatus_Parse(
+    ::absl::string_view name, DroneStatus* PROTOBUF_NONNULL value) {
+  return ::google::protobuf::internal::ParseNamedEnum<DroneStatus>(DroneStatus_descriptor(), name,
+                                           value);
+}
+enum PldStatus : int {
+  PLD_STATUS_UNKNOWN = 0,
+  PLD_STATUS_ERROR = 1,
+  PLD_STATUS_WAITING_INFO = 2,
+  PLD_STATUS_PLANNING_MISSION = 3,
+  PLD_STATUS_EXECUTING_MISSION = 4,
+  PLD_STATUS_FINISH = 5,
+  PldStatus_INT_MIN_SENTINEL_DO_NOT_USE_ =
+      ::std::numeric_limits<::int32_t>::min(),
+  PldStatus_INT_MAX_SENTINEL_DO_NOT_USE_ =
+      ::std::numeric_limits<::int32_t>::max(),
+};
+
+extern const uint32_t PldStatus_internal_data_[];
+inline constexpr PldStatus PldStatus_MIN =
+    static_cast<PldStatus>(0);
+inline constexpr PldStatus PldStatus_MAX =
+    static_cast<PldStatus>(5);
+inline bool PldStatus_IsValid(int value) {
+  return 0 <= value && value <= 5;
+}
+inline constexpr int PldStatus_ARRAYSIZE = 5 + 1;
+const ::google::protobuf::EnumDescriptor* PROTOBUF_NONNULL PldStatus_descriptor();
+template <typename T>
+const ::std::string& PldStatus_Name(T value) {
+  static_assert(::std::is_same<T, PldStatus>::value ||
+                    ::std::is_integral<T>::value,
+                "Incorrect type passed to PldStatus_Name().");
+  return PldStatus_Name(static_cast<PldStatus>(value));
+}
+template <>
+inline const ::std::string& PldStatus_Name(PldStatus value) {
+  return ::google::protobuf::internal::NameOfDenseEnum<PldStatus_descriptor, 0, 5>(
+      static_cast<int>(value));
+}
+inline bool PldStatus_Parse(
+    ::absl::string_view name, PldStatus* PROTOBUF_NONNULL value) {
+  return ::google::protobuf::internal::ParseNamedEnum<PldStatus>(PldStatus_descriptor(), name,
+                                           value);
+}
 
 // ===================================================================
 
@@ -159,7 +298,13 @@ class Status final : public ::google::protobuf::Message
     return *reinterpret_cast<const Status*>(
         &_Status_default_instance_);
   }
-  static constexpr int kIndexInFileMessages = 4;
+  enum TypedStatusCase {
+    kPlannerStatus = 5,
+    kDroneStatus = 6,
+    kPldStatus = 7,
+    TYPED_STATUS_NOT_SET = 0,
+  };
+  static constexpr int kIndexInFileMessages = 5;
   friend void swap(Status& a, Status& b) { a.Swap(&b); }
   inline void Swap(Status* PROTOBUF_NONNULL other) {
     if (other == this) return;
@@ -248,6 +393,16 @@ class Status final : public ::google::protobuf::Message
   // accessors -------------------------------------------------------
   enum : int {
     kTypeStatusFieldNumber = 1,
+    kProfileFieldNumber = 3,
+    kMissionIdFieldNumber = 11,
+    kRequestIdFieldNumber = 2,
+    kCompactCoordinatesFieldNumber = 4,
+    kQueuedMissionsFieldNumber = 8,
+    kPlannedMissionsFieldNumber = 9,
+    kLastMissionLatencyMsFieldNumber = 10,
+    kPlannerStatusFieldNumber = 5,
+    kDroneStatusFieldNumber = 6,
+    kPldStatusFieldNumber = 7,
   };
   // string type_status = 1;
   void clear_type_status() ;
@@ -264,12 +419,132 @@ class Status final : public ::google::protobuf::Message
   ::std::string* PROTOBUF_NONNULL _internal_mutable_type_status();
 
   public:
+  // string profile = 3;
+  void clear_profile() ;
+  const ::std::string& profile() const;
+  template <typename Arg_ = const ::std::string&, typename... Args_>
+  void set_profile(Arg_&& arg, Args_... args);
+  ::std::string* PROTOBUF_NONNULL mutable_profile();
+  [[nodiscard]] ::std::string* PROTOBUF_NULLABLE release_profile();
+  void set_allocated_profile(::std::string* PROTOBUF_NULLABLE value);
+
+  private:
+  const ::std::string& _internal_profile() const;
+  PROTOBUF_ALWAYS_INLINE void _internal_set_profile(const ::std::string& value);
+  ::std::string* PROTOBUF_NONNULL _internal_mutable_profile();
+
+  public:
+  // string mission_id = 11;
+  void clear_mission_id() ;
+  const ::std::string& mission_id() const;
+  template <typename Arg_ = const ::std::string&, typename... Args_>
+  void set_mission_id(Arg_&& arg, Args_... args);
+  ::std::string* PROTOBUF_NONNULL mutable_mission_id();
+  [[nodiscard]] ::std::string* PROTOBUF_NULLABLE release_mission_id();
+  void set_allocated_mission_id(::std::string* PROTOBUF_NULLABLE value);
+
+  private:
+  const ::std::string& _internal_mission_id() const;
+  PROTOBUF_ALWAYS_INLINE void _internal_set_mission_id(const ::std::string& value);
+  ::std::string* PROTOBUF_NONNULL _internal_mutable_mission_id();
+
+  public:
+  // uint64 request_id = 2;
+  void clear_request_id() ;
+  ::uint64_t request_id() const;
+  void set_request_id(::uint64_t value);
+
+  private:
+  ::uint64_t _internal_request_id() const;
+  void _internal_set_request_id(::uint64_t value);
+
+  public:
+  // bool compact_coordinates = 4;
+  void clear_compact_coordinates() ;
+  bool compact_coordinates() const;
+  void set_compact_coordinates(bool value);
+
+  private:
+  bool _internal_compact_coordinates() const;
+  void _internal_set_compact_coordinates(bool value);
+
+  public:
+  // uint32 queued_missions = 8;
+  void clear_queued_missions() ;
+  ::uint32_t queued_missions() const;
+  void set_queued_missions(::uint32_t value);
+
+  private:
+  ::uint32_t _internal_queued_missions() const;
+  void _internal_set_queued_missions(::uint32_t value);
+
+  public:
+  // uint32 planned_missions = 9;
+  void clear_planned_missions() ;
+  ::uint32_t planned_missions() const;
+  void set_planned_missions(::uint32_t value);
+
+  private:
+  ::uint32_t _internal_planned_missions() const;
+  void _internal_set_planned_missions(::uint32_t value);
+
+  public:
+  // uint64 last_mission_latency_ms = 10;
+  void clear_last_mission_latency_ms() ;
+  ::uint64_t last_mission_latency_ms() const;
+  void set_last_mission_latency_ms(::uint64_t value);
+
+  private:
+  ::uint64_t _internal_last_mission_latency_ms() const;
+  void _internal_set_last_mission_latency_ms(::uint64_t value);
+
+  public:
+  // .PlannerStatus planner_status = 5;
+  bool has_planner_status() const;
+  void clear_planner_status() ;
+  ::PlannerStatus planner_status() const;
+  void set_planner_status(::PlannerStatus value);
+
+  private:
+  ::PlannerStatus _internal_planner_status() const;
+  void _internal_set_planner_status(::PlannerStatus value);
+
+  public:
+  // .DroneStatus drone_status = 6;
+  bool has_drone_status() const;
+  void clear_drone_status() ;
+  ::DroneStatus drone_status() const;
+  void set_drone_status(::DroneStatus value);
+
+  private:
+  ::DroneStatus _internal_drone_status() const;
+  void _internal_set_drone_status(::DroneStatus value);
+
+  public:
+  // .PldStatus pld_status = 7;
+  bool has_pld_status() const;
+  void clear_pld_status() ;
+  ::PldStatus pld_status() const;
+  void set_pld_status(::PldStatus value);
+
+  private:
+  ::PldStatus _internal_pld_status() const;
+  void _internal_set_pld_status(::PldStatus value);
+
+  public:
+  void clear_typed_status();
+  TypedStatusCase typed_status_case() const;
   // @@protoc_insertion_point(class_scope:Status)
  private:
   class _Internal;
+  void set_has_planner_status();
+  void set_has_drone_status();
+  void set_has_pld_status();
+  inline bool has_typed_status() const;
+  inline void clear_has_typed_status();
   friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<0, 1,
-                                   0, 26,
+  static const ::google::protobuf::internal::TcParseTable<4, 11,
+                                   0, 51,
                                    2>
       _table_;
 
@@ -291,6 +566,21 @@ class Status final : public ::google::protobuf::Message
     ::google::protobuf::internal::HasBits<1> _has_bits_;
     ::google::protobuf::internal::CachedSize _cached_size_;
     ::google::protobuf::internal::ArenaStringPtr type_status_;
+    ::google::protobuf::internal::ArenaStringPtr profile_;
+    ::google::protobuf::internal::ArenaStringPtr mission_id_;
+    ::uint64_t request_id_;
+    bool compact_coordinates_;
+    ::uint32_t queued_missions_;
+    ::uint32_t planned_missions_;
+    ::uint64_t last_mission_latency_ms_;
+    union TypedStatusUnion {
+      constexpr TypedStatusUnion() : _constinit_{} {}
+      ::google::protobuf::internal::ConstantInitialized _constinit_;
+      int planner_status_;
+      int drone_status_;
+      int pld_status_;
+    } typed_status_;
+    ::uint32_t _oneof_case_[1];
     PROTOBUF_TSAN_DECLARE_MEMBER
   };
   union { Impl_ _impl_; };
@@ -355,7 +645,7 @@ class PlannerResponse final : public ::google::protobuf::Message
     return *reinterpret_cast<const PlannerResponse*>(
         &_PlannerResponse_default_instance_);
   }
-  static constexpr int kIndexInFileMessages = 3;
+  static constexpr int kIndexInFileMessages = 4;
   friend void swap(PlannerResponse& a, PlannerResponse& b) { a.Swap(&b); }
   inline void Swap(PlannerResponse* PROTOBUF_NONNULL other) {
     if (other == this) return;
@@ -445,6 +735,8 @@ class PlannerResponse final : public ::google::protobuf::Message
   enum : int {
     kLonFieldNumber = 1,
     kLatFieldNumber = 2,
+    kLonE7DeltaFieldNumber = 3,
+    kLatE7DeltaFieldNumber = 4,
   };
   // repeated double lon = 1;
   int lon_size() const;
@@ -481,12 +773,48 @@ class PlannerResponse final : public ::google::protobuf::Message
   const ::google::protobuf::RepeatedField<double>& _internal_lat() const;
   ::google::protobuf::RepeatedField<double>* PROTOBUF_NONNULL _internal_mutable_lat();
 
+  public:
+  // repeated sint32 lon_e7_delta = 3;
+  int lon_e7_delta_size() const;
+  private:
+  int _internal_lon_e7_delta_size() const;
+
+  public:
+  void clear_lon_e7_delta() ;
+  ::int32_t lon_e7_delta(int index) const;
+  void set_lon_e7_delta(int index, ::int32_t value);
+  void add_lon_e7_delta(::int32_t value);
+  const ::google::protobuf::RepeatedField<::int32_t>& lon_e7_delta() const;
+  ::google::protobuf::RepeatedField<::int32_t>* PROTOBUF_NONNULL mutable_lon_e7_delta();
+
+  private:
+  const ::google::protobuf::RepeatedField<::int32_t>& _internal_lon_e7_delta() const;
+  ::google::protobuf::RepeatedField<::int32_t>* PROTOBUF_NONNULL _internal_mutable_lon_e7_delta();
+
+  public:
+  // repeated sint32 lat_e7_delta = 4;
+  int lat_e7_delta_size() const;
+  private:
+  int _internal_lat_e7_delta_size() const;
+
+  public:
+  void clear_lat_e7_delta() ;
+  ::int32_t lat_e7_delta(int index) const;
+  void set_lat_e7_delta(int index, ::int32_t value);
+  void add_lat_e7_delta(::int32_t value);
+  const ::google::protobuf::RepeatedField<::int32_t>& lat_e7_delta() const;
+  ::google::protobuf::RepeatedField<::int32_t>* PROTOBUF_NONNULL mutable_lat_e7_delta();
+
+  private:
+  const ::google::protobuf::RepeatedField<::int32_t>& _internal_lat_e7_delta() const;
+  ::google::protobuf::RepeatedField<::int32_t>* PROTOBUF_NONNULL _internal_mutable_lat_e7_delta();
+
   public:
   // @@protoc_insertion_point(class_scope:PlannerResponse)
  private:
   class _Internal;
   friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<1, 2,
+  static const ::google::protobuf::internal::TcParseTable<2, 4,
                                    0, 0,
                                    2>
       _table_;
@@ -508,6 +836,10 @@ class PlannerResponse final : public ::google::protobuf::Message
         const PlannerResponse& from_msg);
     ::google::protobuf::RepeatedField<double> lon_;
     ::google::protobuf::RepeatedField<double> lat_;
+    ::google::protobuf::RepeatedField<::int32_t> lon_e7_delta_;
+    ::google::protobuf::internal::CachedSize _lon_e7_delta_cached_byte_size_;
+    ::google::protobuf::RepeatedField<::int32_t> lat_e7_delta_;
+    ::google::protobuf::internal::CachedSize _lat_e7_delta_cached_byte_size_;
     ::google::protobuf::internal::CachedSize _cached_size_;
     PROTOBUF_TSAN_DECLARE_MEMBER
   };
@@ -573,7 +905,7 @@ class Info_Module final : public ::google::protobuf::Message
     return *reinterpret_cast<const Info_Module*>(
         &_Info_Module_default_instance_);
   }
-  static constexpr int kIndexInFileMessages = 9;
+  static constexpr int kIndexInFileMessages = 10;
   friend void swap(Info_Module& a, Info_Module& b) { a.Swap(&b); }
   inline void Swap(Info_Module* PROTOBUF_NONNULL other) {
     if (other == this) return;
@@ -871,7 +1203,7 @@ class Command final : public ::google::protobuf::Message
     return *reinterpret_cast<const Command*>(
         &_Command_default_instance_);
   }
-  static constexpr int kIndexInFileMessages = 6;
+  static constexpr int kIndexInFileMessages = 7;
   friend void swap(Command& a, Command& b) { a.Swap(&b); }
   inline void Swap(Command* PROTOBUF_NONNULL other) {
     if (other == this) return;
@@ -960,6 +1292,7 @@ class Command final : public ::google::protobuf::Message
   // accessors -------------------------------------------------------
   enum : int {
     kCommandFieldNumber = 1,
+    kMissionIdFieldNumber = 2,
   };
   // string command = 1;
   void clear_command() ;
@@ -975,13 +1308,28 @@ class Command final : public ::google::protobuf::Message
   PROTOBUF_ALWAYS_INLINE void _internal_set_command(const ::std::string& value);
   ::std::string* PROTOBUF_NONNULL _internal_mutable_command();
 
+  public:
+  // string mission_id = 2;
+  void clear_mission_id() ;
+  const ::std::string& mission_id() const;
+  template <typename Arg_ = const ::std::string&, typename... Args_>
+  void set_mission_id(Arg_&& arg, Args_... args);
+  ::std::string* PROTOBUF_NONNULL mutable_mission_id();
+  [[nodiscard]] ::std::string* PROTOBUF_NULLABLE release_mission_id();
+  void set_allocated_mission_id(::std::string* PROTOBUF_NULLABLE value);
+
+  private:
+  const ::std::string& _internal_mission_id() const;
+  PROTOBUF_ALWAYS_INLINE void _internal_set_mission_id(const ::std::string& value);
+  ::std::string* PROTOBUF_NONNULL _internal_mutable_mission_id();
+
   public:
   // @@protoc_insertion_point(class_scope:Command)
  private:
   class _Internal;
   friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<0, 1,
-                                   0, 23,
+  static const ::google::protobuf::internal::TcParseTable<1, 2,
+                                   0, 33,
                                    2>
       _table_;
 
@@ -1003,6 +1351,7 @@ class Command final : public ::google::protobuf::Message
     ::google::protobuf::internal::HasBits<1> _has_bits_;
     ::google::protobuf::internal::CachedSize _cached_size_;
     ::google::protobuf::internal::ArenaStringPtr command_;
+    ::google::protobuf::internal::ArenaStringPtr mission_id_;
     PROTOBUF_TSAN_DECLARE_MEMBER
   };
   union { Impl_ _impl_; };
@@ -1071,7 +1420,7 @@ class WrapperPLD final : public ::google::protobuf::Message
     kStatus = 1,
     PAYLOAD_NOT_SET = 0,
   };
-  static constexpr int kIndexInFileMessages = 7;
+  static constexpr int kIndexInFileMessages = 8;
   friend void swap(WrapperPLD& a, WrapperPLD& b) { a.Swap(&b); }
   inline void Swap(WrapperPLD* PROTOBUF_NONNULL other) {
     if (other == this) return;
@@ -1438,30 +1787,30 @@ class WrapperDrone final : public ::google::protobuf::Message
 extern const ::google::protobuf::internal::ClassDataFull WrapperDrone_class_data_;
 // -------------------------------------------------------------------
 
-class PlannerResponseList final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:PlannerResponseList) */ {
+class PlannerRoute final : public ::google::protobuf::Message
+/* @@protoc_insertion_point(class_definition:PlannerRoute) */ {
  public:
-  inline PlannerResponseList() : PlannerResponseList(nullptr) {}
-  ~PlannerResponseList() PROTOBUF_FINAL;
+  inline PlannerRoute() : PlannerRoute(nullptr) {}
+  ~PlannerRoute() PROTOBUF_FINAL;
 
 #if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(PlannerResponseList* PROTOBUF_NONNULL msg, std::destroying_delete_t) {
+  void operator delete(PlannerRoute* PROTOBUF_NONNULL msg, std::destroying_delete_t) {
     SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(PlannerResponseList));
+    ::google::protobuf::internal::SizedDelete(msg, sizeof(PlannerRoute));
   }
 #endif
 
   template <typename = void>
-  explicit PROTOBUF_CONSTEXPR PlannerResponseList(::google::protobuf::internal::ConstantInitialized);
+  explicit PROTOBUF_CONSTEXPR PlannerRoute(::google::protobuf::internal::ConstantInitialized);
 
-  inline PlannerResponseList(const PlannerResponseList& from) : PlannerResponseList(nullptr, from) {}
-  inline PlannerResponseList(PlannerResponseList&& from) noexcept
-      : PlannerResponseList(nullptr, ::std::move(from)) {}
-  inline PlannerResponseList& operator=(const PlannerResponseList& from) {
+  inline PlannerRoute(const PlannerRoute& from) : PlannerRoute(nullptr, from) {}
+  inline PlannerRoute(PlannerRoute&& from) noexcept
+      : PlannerRoute(nullptr, ::std::move(from)) {}
+  inline PlannerRoute& operator=(const PlannerRoute& from) {
     CopyFrom(from);
     return *this;
   }
-  inline PlannerResponseList& operator=(PlannerResponseList&& from) noexcept {
+  inline PlannerRoute& operator=(PlannerRoute&& from) noexcept {
     if (this == &from) return *this;
     if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
       InternalSwap(&from);
@@ -1489,13 +1838,13 @@ class PlannerResponseList final : public ::google::protobuf::Message
   static const ::google::protobuf::Reflection* PROTOBUF_NONNULL GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const PlannerResponseList& default_instance() {
-    return *reinterpret_cast<const PlannerResponseList*>(
-        &_PlannerResponseList_default_instance_);
+  static const PlannerRoute& default_instance() {
+    return *reinterpret_cast<const PlannerRoute*>(
+        &_PlannerRoute_default_instance_);
   }
-  static constexpr int kIndexInFileMessages = 2;
-  friend void swap(PlannerResponseList& a, PlannerResponseList& b) { a.Swap(&b); }
-  inline void Swap(PlannerResponseList* PROTOBUF_NONNULL other) {
+  static constexpr int kIndexInFileMessages = 3;
+  friend void swap(PlannerRoute& a, PlannerRoute& b) { a.Swap(&b); }
+  inline void Swap(PlannerRoute* PROTOBUF_NONNULL other) {
     if (other == this) return;
     if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
       InternalSwap(other);
@@ -1503,7 +1852,7 @@ class PlannerResponseList final : public ::google::protobuf::Message
       ::google::protobuf::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(PlannerResponseList* PROTOBUF_NONNULL other) {
+  void UnsafeArenaSwap(PlannerRoute* PROTOBUF_NONNULL other) {
     if (other == this) return;
     ABSL_DCHECK(GetArena() == other->GetArena());
     InternalSwap(other);
@@ -1511,13 +1860,13 @@ class PlannerResponseList final : public ::google::protobuf::Message
 
   // implements Message ----------------------------------------------
 
-  PlannerResponseList* PROTOBUF_NONNULL New(::google::protobuf::Arena* PROTOBUF_NULLABLE arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<PlannerResponseList>(arena);
+  PlannerRoute* PROTOBUF_NONNULL New(::google::protobuf::Arena* PROTOBUF_NULLABLE arena = nullptr) const {
+    return ::google::protobuf::Message::DefaultConstruct<PlannerRoute>(arena);
   }
   using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const PlannerResponseList& from);
+  void CopyFrom(const PlannerRoute& from);
   using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const PlannerResponseList& from) { PlannerResponseList::MergeImpl(*this, from); }
+  void MergeFrom(const PlannerRoute& from) { PlannerRoute::MergeImpl(*this, from); }
 
   private:
   static void MergeImpl(::google::protobuf::MessageLite& to_msg,
@@ -1553,18 +1902,18 @@ class PlannerResponseList final : public ::google::protobuf::Message
   private:
   void SharedCtor(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
   static void SharedDtor(MessageLite& self);
-  void InternalSwap(PlannerResponseList* PROTOBUF_NONNULL other);
+  void InternalSwap(PlannerRoute* PROTOBUF_NONNULL other);
  private:
   template <typename T>
   friend ::absl::string_view(::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "PlannerResponseList"; }
+  static ::absl::string_view FullMessageName() { return "PlannerRoute"; }
 
  protected:
-  explicit PlannerResponseList(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-  PlannerResponseList(::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const PlannerResponseList& from);
-  PlannerResponseList(
-      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, PlannerResponseList&& from) noexcept
-      : PlannerResponseList(arena) {
+  explicit PlannerRoute(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  PlannerRoute(::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const PlannerRoute& from);
+  PlannerRoute(
+      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, PlannerRoute&& from) noexcept
+      : PlannerRoute(arena) {
     *this = ::std::move(from);
   }
   const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL GetClassData() const PROTOBUF_FINAL;
@@ -1581,30 +1930,50 @@ class PlannerResponseList final : public ::google::protobuf::Message
 
   // accessors -------------------------------------------------------
   enum : int {
-    kItemsFieldNumber = 1,
+    kRouteFieldNumber = 3,
+    kRequestIdFieldNumber = 1,
+    kDroneFieldNumber = 2,
   };
-  // repeated .PlannerResponse items = 1;
-  int items_size() const;
+  // .PlannerResponse route = 3;
+  bool has_route() const;
+  void clear_route() ;
+  const ::PlannerResponse& route() const;
+  [[nodiscard]] ::PlannerResponse* PROTOBUF_NULLABLE release_route();
+  ::PlannerResponse* PROTOBUF_NONNULL mutable_route();
+  void set_allocated_route(::PlannerResponse* PROTOBUF_NULLABLE value);
+  void unsafe_arena_set_allocated_route(::PlannerResponse* PROTOBUF_NULLABLE value);
+  ::PlannerResponse* PROTOBUF_NULLABLE unsafe_arena_release_route();
+
   private:
-  int _internal_items_size() const;
+  const ::PlannerResponse& _internal_route() const;
+  ::PlannerResponse* PROTOBUF_NONNULL _internal_mutable_route();
 
   public:
-  void clear_items() ;
-  ::PlannerResponse* PROTOBUF_NONNULL mutable_items(int index);
-  ::google::protobuf::RepeatedPtrField<::PlannerResponse>* PROTOBUF_NONNULL mutable_items();
+  // uint64 request_id = 1;
+  void clear_request_id() ;
+  ::uint64_t request_id() const;
+  void set_request_id(::uint64_t value);
 
   private:
-  const ::google::protobuf::RepeatedPtrField<::PlannerResponse>& _internal_items() const;
-  ::google::protobuf::RepeatedPtrField<::PlannerResponse>* PROTOBUF_NONNULL _internal_mutable_items();
+  ::uint64_t _internal_request_id() const;
+  void _internal_set_request_id(::uint64_t value);
+
   public:
-  const ::PlannerResponse& items(int index) const;
-  ::PlannerResponse* PROTOBUF_NONNULL add_items();
-  const ::google::protobuf::RepeatedPtrField<::PlannerResponse>& items() const;
-  // @@protoc_insertion_point(class_scope:PlannerResponseList)
+  // uint32 drone = 2;
+  void clear_drone() ;
+  ::uint32_t drone() const;
+  void set_drone(::uint32_t value);
+
+  private:
+  ::uint32_t _internal_drone() const;
+  void _internal_set_drone(::uint32_t value);
+
+  public:
+  // @@protoc_insertion_point(class_scope:PlannerRoute)
  private:
   class _Internal;
   friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<0, 1,
+  static const ::google::protobuf::internal::TcParseTable<2, 3,
                                    1, 0,
                                    2>
       _table_;
@@ -1623,42 +1992,45 @@ class PlannerResponseList final : public ::google::protobuf::Message
     inline explicit Impl_(
         ::google::protobuf::internal::InternalVisibility visibility,
         ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
-        const PlannerResponseList& from_msg);
-    ::google::protobuf::RepeatedPtrField< ::PlannerResponse > items_;
+        const PlannerRoute& from_msg);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
     ::google::protobuf::internal::CachedSize _cached_size_;
+    ::PlannerResponse* PROTOBUF_NULLABLE route_;
+    ::uint64_t request_id_;
+    ::uint32_t drone_;
     PROTOBUF_TSAN_DECLARE_MEMBER
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_messages_5fpld_2eproto;
 };
 
-extern const ::google::protobuf::internal::ClassDataFull PlannerResponseList_class_data_;
+extern const ::google::protobuf::internal::ClassDataFull PlannerRoute_class_data_;
 // -------------------------------------------------------------------
 
-class WrapperPlanner final : public ::google::protobuf::Message
-/* @@protoc_insertion_point(class_definition:WrapperPlanner) */ {
+class PlannerResponseList final : public ::google::protobuf::Message
+/* @@protoc_insertion_point(class_definition:PlannerResponseList) */ {
  public:
-  inline WrapperPlanner() : WrapperPlanner(nullptr) {}
-  ~WrapperPlanner() PROTOBUF_FINAL;
+  inline PlannerResponseList() : PlannerResponseList(nullptr) {}
+  ~PlannerResponseList() PROTOBUF_FINAL;
 
 #if defined(PROTOBUF_CUSTOM_VTABLE)
-  void operator delete(WrapperPlanner* PROTOBUF_NONNULL msg, std::destroying_delete_t) {
+  void operator delete(PlannerResponseList* PROTOBUF_NONNULL msg, std::destroying_delete_t) {
     SharedDtor(*msg);
-    ::google::protobuf::internal::SizedDelete(msg, sizeof(WrapperPlanner));
+    ::google::protobuf::internal::SizedDelete(msg, sizeof(PlannerResponseList));
   }
 #endif
 
   template <typename = void>
-  explicit PROTOBUF_CONSTEXPR WrapperPlanner(::google::protobuf::internal::ConstantInitialized);
+  explicit PROTOBUF_CONSTEXPR PlannerResponseList(::google::protobuf::internal::ConstantInitialized);
 
-  inline WrapperPlanner(const WrapperPlanner& from) : WrapperPlanner(nullptr, from) {}
-  inline WrapperPlanner(WrapperPlanner&& from) noexcept
-      : WrapperPlanner(nullptr, ::std::move(from)) {}
-  inline WrapperPlanner& operator=(const WrapperPlanner& from) {
+  inline PlannerResponseList(const PlannerResponseList& from) : PlannerResponseList(nullptr, from) {}
+  inline PlannerResponseList(PlannerResponseList&& from) noexcept
+      : PlannerResponseList(nullptr, ::std::move(from)) {}
+  inline PlannerResponseList& operator=(const PlannerResponseList& from) {
     CopyFrom(from);
     return *this;
   }
-  inline WrapperPlanner& operator=(WrapperPlanner&& from) noexcept {
+  inline PlannerResponseList& operator=(PlannerResponseList&& from) noexcept {
     if (this == &from) return *this;
     if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
       InternalSwap(&from);
@@ -1686,18 +2058,13 @@ class WrapperPlanner final : public ::google::protobuf::Message
   static const ::google::protobuf::Reflection* PROTOBUF_NONNULL GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const WrapperPlanner& default_instance() {
-    return *reinterpret_cast<const WrapperPlanner*>(
-        &_WrapperPlanner_default_instance_);
+  static const PlannerResponseList& default_instance() {
+    return *reinterpret_cast<const PlannerResponseList*>(
+        &_PlannerResponseList_default_instance_);
   }
-  enum PayloadCase {
-    kPlannerResponse = 1,
-    kStatus = 2,
-    PAYLOAD_NOT_SET = 0,
-  };
-  static constexpr int kIndexInFileMessages = 0;
-  friend void swap(WrapperPlanner& a, WrapperPlanner& b) { a.Swap(&b); }
-  inline void Swap(WrapperPlanner* PROTOBUF_NONNULL other) {
+  static constexpr int kIndexInFileMessages = 2;
+  friend void swap(PlannerResponseList& a, PlannerResponseList& b) { a.Swap(&b); }
+  inline void Swap(PlannerResponseList* PROTOBUF_NONNULL other) {
     if (other == this) return;
     if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
       InternalSwap(other);
@@ -1705,7 +2072,7 @@ class WrapperPlanner final : public ::google::protobuf::Message
       ::google::protobuf::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(WrapperPlanner* PROTOBUF_NONNULL other) {
+  void UnsafeArenaSwap(PlannerResponseList* PROTOBUF_NONNULL other) {
     if (other == this) return;
     ABSL_DCHECK(GetArena() == other->GetArena());
     InternalSwap(other);
@@ -1713,13 +2080,13 @@ class WrapperPlanner final : public ::google::protobuf::Message
 
   // implements Message ----------------------------------------------
 
-  WrapperPlanner* PROTOBUF_NONNULL New(::google::protobuf::Arena* PROTOBUF_NULLABLE arena = nullptr) const {
-    return ::google::protobuf::Message::DefaultConstruct<WrapperPlanner>(arena);
+  PlannerResponseList* PROTOBUF_NONNULL New(::google::protobuf::Arena* PROTOBUF_NULLABLE arena = nullptr) const {
+    return ::google::protobuf::Message::DefaultConstruct<PlannerResponseList>(arena);
   }
   using ::google::protobuf::Message::CopyFrom;
-  void CopyFrom(const WrapperPlanner& from);
+  void CopyFrom(const PlannerResponseList& from);
   using ::google::protobuf::Message::MergeFrom;
-  void MergeFrom(const WrapperPlanner& from) { WrapperPlanner::MergeImpl(*this, from); }
+  void MergeFrom(const PlannerResponseList& from) { PlannerResponseList::MergeImpl(*this, from); }
 
   private:
   static void MergeImpl(::google::protobuf::MessageLite& to_msg,
@@ -1755,18 +2122,18 @@ class WrapperPlanner final : public ::google::protobuf::Message
   private:
   void SharedCtor(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
   static void SharedDtor(MessageLite& self);
-  void InternalSwap(WrapperPlanner* PROTOBUF_NONNULL other);
+  void InternalSwap(PlannerResponseList* PROTOBUF_NONNULL other);
  private:
   template <typename T>
   friend ::absl::string_view(::google::protobuf::internal::GetAnyMessageName)();
-  static ::absl::string_view FullMessageName() { return "WrapperPlanner"; }
+  static ::absl::string_view FullMessageName() { return "PlannerResponseList"; }
 
  protected:
-  explicit WrapperPlanner(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
-  WrapperPlanner(::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const WrapperPlanner& from);
-  WrapperPlanner(
-      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, WrapperPlanner&& from) noexcept
-      : WrapperPlanner(arena) {
+  explicit PlannerResponseList(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  PlannerResponseList(::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const PlannerResponseList& from);
+  PlannerResponseList(
+      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, PlannerResponseList&& from) noexcept
+      : PlannerResponseList(arena) {
     *this = ::std::move(from);
   }
   const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL GetClassData() const PROTOBUF_FINAL;
@@ -1783,59 +2150,308 @@ class WrapperPlanner final : public ::google::protobuf::Message
 
   // accessors -------------------------------------------------------
   enum : int {
-    kPlannerResponseFieldNumber = 1,
-    kStatusFieldNumber = 2,
+    kItemsFieldNumber = 1,
+    kRequestIdFieldNumber = 2,
+    kStreamedRoutesFieldNumber = 3,
   };
-  // .PlannerResponseList planner_response = 1;
-  bool has_planner_response() const;
+  // repeated .PlannerResponse items = 1;
+  int items_size() const;
   private:
-  bool _internal_has_planner_response() const;
+  int _internal_items_size() const;
 
   public:
-  void clear_planner_response() ;
-  const ::PlannerResponseList& planner_response() const;
-  [[nodiscard]] ::PlannerResponseList* PROTOBUF_NULLABLE release_planner_response();
-  ::PlannerResponseList* PROTOBUF_NONNULL mutable_planner_response();
-  void set_allocated_planner_response(::PlannerResponseList* PROTOBUF_NULLABLE value);
-  void unsafe_arena_set_allocated_planner_response(::PlannerResponseList* PROTOBUF_NULLABLE value);
-  ::PlannerResponseList* PROTOBUF_NULLABLE unsafe_arena_release_planner_response();
+  void clear_items() ;
+  ::PlannerResponse* PROTOBUF_NONNULL mutable_items(int index);
+  ::google::protobuf::RepeatedPtrField<::PlannerResponse>* PROTOBUF_NONNULL mutable_items();
 
   private:
-  const ::PlannerResponseList& _internal_planner_response() const;
-  ::PlannerResponseList* PROTOBUF_NONNULL _internal_mutable_planner_response();
-
+  const ::google::protobuf::RepeatedPtrField<::PlannerResponse>& _internal_items() const;
+  ::google::protobuf::RepeatedPtrField<::PlannerResponse>* PROTOBUF_NONNULL _internal_mutable_items();
   public:
-  // .Status status = 2;
-  bool has_status() const;
+  const ::PlannerResponse& items(int index) const;
+  ::PlannerResponse* PROTOBUF_NONNULL add_items();
+  const ::google::protobuf::RepeatedPtrField<::PlannerResponse>& items() const;
+  // uint64 request_id = 2;
+  void clear_request_id() ;
+  ::uint64_t request_id() const;
+  void set_request_id(::uint64_t value);
+
   private:
-  bool _internal_has_status() const;
+  ::uint64_t _internal_request_id() const;
+  void _internal_set_request_id(::uint64_t value);
 
   public:
-  void clear_status() ;
-  const ::Status& status() const;
-  [[nodiscard]] ::Status* PROTOBUF_NULLABLE release_status();
-  ::Status* PROTOBUF_NONNULL mutable_status();
-  void set_allocated_status(::Status* PROTOBUF_NULLABLE value);
-  void unsafe_arena_set_allocated_status(::Status* PROTOBUF_NULLABLE value);
-  ::Status* PROTOBUF_NULLABLE unsafe_arena_release_status();
+  // uint32 streamed_routes = 3;
+  void clear_streamed_routes() ;
+  ::uint32_t streamed_routes() const;
+  void set_streamed_routes(::uint32_t value);
 
   private:
-  const ::Status& _internal_status() const;
-  ::Status* PROTOBUF_NONNULL _internal_mutable_status();
+  ::uint32_t _internal_streamed_routes() const;
+  void _internal_set_streamed_routes(::uint32_t value);
 
   public:
-  void clear_payload();
-  PayloadCase payload_case() const;
-  // @@protoc_insertion_point(class_scope:WrapperPlanner)
+  // @@protoc_insertion_point(class_scope:PlannerResponseList)
+ private:
+  class _Internal;
+  friend class ::google::protobuf::internal::TcParser;
+  static const ::google::protobuf::internal::TcParseTable<2, 3,
+                                   1, 0,
+                                   2>
+      _table_;
+
+  friend class ::google::protobuf::MessageLite;
+  friend class ::google::protobuf::Arena;
+  template <typename T>
+  friend class ::google::protobuf::Arena::InternalHelper;
+  using InternalArenaConstructable_ = void;
+  using DestructorSkippable_ = void;
+  struct Impl_ {
+    inline explicit constexpr Impl_(::google::protobuf::internal::ConstantInitialized) noexcept;
+    inline explicit Impl_(
+        ::google::protobuf::internal::InternalVisibility visibility,
+        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+    inline explicit Impl_(
+        ::google::protobuf::internal::InternalVisibility visibility,
+        ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const Impl_& from,
+        const PlannerResponseList& from_msg);
+    ::google::protobuf::internal::HasBits<1> _has_bits_;
+    ::google::protobuf::internal::CachedSize _cached_size_;
+    ::google::protobuf::RepeatedPtrField< ::PlannerResponse > items_;
+    ::uint64_t request_id_;
+    ::uint32_t streamed_routes_;
+    PROTOBUF_TSAN_DECLARE_MEMBER
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_messages_5fpld_2eproto;
+};
+
+extern const ::google::protobuf::internal::ClassDataFull PlannerResponseList_class_data_;
+// -------------------------------------------------------------------
+
+class WrapperPlanner final : public ::google::protobuf::Message
+/* @@protoc_insertion_point(class_definition:WrapperPlanner) */ {
+ public:
+  inline WrapperPlanner() : WrapperPlanner(nullptr) {}
+  ~WrapperPlanner() PROTOBUF_FINAL;
+
+#if defined(PROTOBUF_CUSTOM_VTABLE)
+  void operator delete(WrapperPlanner* PROTOBUF_NONNULL msg, std::destroying_delete_t) {
+    SharedDtor(*msg);
+    ::google::protobuf::internal::SizedDelete(msg, sizeof(WrapperPlanner));
+  }
+#endif
+
+  template <typename = void>
+  explicit PROTOBUF_CONSTEXPR WrapperPlanner(::google::protobuf::internal::ConstantInitialized);
+
+  inline WrapperPlanner(const WrapperPlanner& from) : WrapperPlanner(nullptr, from) {}
+  inline WrapperPlanner(WrapperPlanner&& from) noexcept
+      : WrapperPlanner(nullptr, ::std::move(from)) {}
+  inline WrapperPlanner& operator=(const WrapperPlanner& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline WrapperPlanner& operator=(WrapperPlanner&& from) noexcept {
+    if (this == &from) return *this;
+    if (::google::protobuf::internal::CanMoveWithInternalSwap(GetArena(), from.GetArena())) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance);
+  }
+  inline ::google::protobuf::UnknownFieldSet* PROTOBUF_NONNULL mutable_unknown_fields()
+      ABSL_ATTRIBUTE_LIFETIME_BOUND {
+    return _internal_metadata_.mutable_unknown_fields<::google::protobuf::UnknownFieldSet>();
+  }
+
+  static const ::google::protobuf::Descriptor* PROTOBUF_NONNULL descriptor() {
+    return GetDescriptor();
+  }
+  static const ::google::protobuf::Descriptor* PROTOBUF_NONNULL GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::google::protobuf::Reflection* PROTOBUF_NONNULL GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const WrapperPlanner& default_instance() {
+    return *reinterpret_cast<const WrapperPlanner*>(
+        &_WrapperPlanner_default_instance_);
+  }
+  enum PayloadCase {
+    kPlannerResponse = 1,
+    kStatus = 2,
+    kPlannerRoute = 3,
+    PAYLOAD_NOT_SET = 0,
+  };
+  static constexpr int kIndexInFileMessages = 0;
+  friend void swap(WrapperPlanner& a, WrapperPlanner& b) { a.Swap(&b); }
+  inline void Swap(WrapperPlanner* PROTOBUF_NONNULL other) {
+    if (other == this) return;
+    if (::google::protobuf::internal::CanUseInternalSwap(GetArena(), other->GetArena())) {
+      InternalSwap(other);
+    } else {
+      ::google::protobuf::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(WrapperPlanner* PROTOBUF_NONNULL other) {
+    if (other == this) return;
+    ABSL_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  WrapperPlanner* PROTOBUF_NONNULL New(::google::protobuf::Arena* PROTOBUF_NULLABLE arena = nullptr) const {
+    return ::google::protobuf::Message::DefaultConstruct<WrapperPlanner>(arena);
+  }
+  using ::google::protobuf::Message::CopyFrom;
+  void CopyFrom(const WrapperPlanner& from);
+  using ::google::protobuf::Message::MergeFrom;
+  void MergeFrom(const WrapperPlanner& from) { WrapperPlanner::MergeImpl(*this, from); }
+
+  private:
+  static void MergeImpl(::google::protobuf::MessageLite& to_msg,
+                        const ::google::protobuf::MessageLite& from_msg);
+
+  public:
+  bool IsInitialized() const {
+    return true;
+  }
+  ABSL_ATTRIBUTE_REINITIALIZES void Clear() PROTOBUF_FINAL;
+  #if defined(PROTOBUF_CUSTOM_VTABLE)
+  private:
+  static ::size_t ByteSizeLong(const ::google::protobuf::MessageLite& msg);
+  static ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
+      const ::google::protobuf::MessageLite& msg, ::uint8_t* PROTOBUF_NONNULL target,
+      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream);
+
+  public:
+  ::size_t ByteSizeLong() const { return ByteSizeLong(*this); }
+  ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
+      ::uint8_t* PROTOBUF_NONNULL target,
+      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const {
+    return _InternalSerialize(*this, target, stream);
+  }
+  #else   // PROTOBUF_CUSTOM_VTABLE
+  ::size_t ByteSizeLong() const final;
+  ::uint8_t* PROTOBUF_NONNULL _InternalSerialize(
+      ::uint8_t* PROTOBUF_NONNULL target,
+      ::google::protobuf::io::EpsCopyOutputStream* PROTOBUF_NONNULL stream) const final;
+  #endif  // PROTOBUF_CUSTOM_VTABLE
+  int GetCachedSize() const { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  static void SharedDtor(MessageLite& self);
+  void InternalSwap(WrapperPlanner* PROTOBUF_NONNULL other);
+ private:
+  template <typename T>
+  friend ::absl::string_view(::google::protobuf::internal::GetAnyMessageName)();
+  static ::absl::string_view FullMessageName() { return "WrapperPlanner"; }
+
+ protected:
+  explicit WrapperPlanner(::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  WrapperPlanner(::google::protobuf::Arena* PROTOBUF_NULLABLE arena, const WrapperPlanner& from);
+  WrapperPlanner(
+      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena, WrapperPlanner&& from) noexcept
+      : WrapperPlanner(arena) {
+    *this = ::std::move(from);
+  }
+  const ::google::protobuf::internal::ClassData* PROTOBUF_NONNULL GetClassData() const PROTOBUF_FINAL;
+  static void* PROTOBUF_NONNULL PlacementNew_(
+      const void* PROTOBUF_NONNULL, void* PROTOBUF_NONNULL mem,
+      ::google::protobuf::Arena* PROTOBUF_NULLABLE arena);
+  static constexpr auto InternalNewImpl_();
+
+ public:
+  static constexpr auto InternalGenerateClassData_();
+
+  ::google::protobuf::Metadata GetMetadata() const;
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+  enum : int {
+    kPlannerResponseFieldNumber = 1,
+    kStatusFieldNumber = 2,
+    kPlannerRouteFieldNumber = 3,
+  };
+  // .PlannerResponseList planner_response = 1;
+  bool has_planner_response() const;
+  private:
+  bool _internal_has_planner_response() const;
+
+  public:
+  void clear_planner_response() ;
+  const ::PlannerResponseList& planner_response() const;
+  [[nodiscard]] ::PlannerResponseList* PROTOBUF_NULLABLE release_planner_response();
+  ::PlannerResponseList* PROTOBUF_NONNULL mutable_planner_response();
+  void set_allocated_planner_response(::PlannerResponseList* PROTOBUF_NULLABLE value);
+  void unsafe_arena_set_allocated_planner_response(::PlannerResponseList* PROTOBUF_NULLABLE value);
+  ::PlannerResponseList* PROTOBUF_NULLABLE unsafe_arena_release_planner_response();
+
+  private:
+  const ::PlannerResponseList& _internal_planner_response() const;
+  ::PlannerResponseList* PROTOBUF_NONNULL _internal_mutable_planner_response();
+
+  public:
+  // .Status status = 2;
+  bool has_status() const;
+  private:
+  bool _internal_has_status() const;
+
+  public:
+  void clear_status() ;
+  const ::Status& status() const;
+  [[nodiscard]] ::Status* PROTOBUF_NULLABLE release_status();
+  ::Status* PROTOBUF_NONNULL mutable_status();
+  void set_allocated_status(::Status* PROTOBUF_NULLABLE value);
+  void unsafe_arena_set_allocated_status(::Status* PROTOBUF_NULLABLE value);
+  ::Status* PROTOBUF_NULLABLE unsafe_arena_release_status();
+
+  private:
+  const ::Status& _internal_status() const;
+  ::Status* PROTOBUF_NONNULL _internal_mutable_status();
+
+  public:
+  // .PlannerRoute planner_route = 3;
+  bool has_planner_route() const;
+  private:
+  bool _internal_has_planner_route() const;
+
+  public:
+  void clear_planner_route() ;
+  const ::PlannerRoute& planner_route() const;
+  [[nodiscard]] ::PlannerRoute* PROTOBUF_NULLABLE release_planner_route();
+  ::PlannerRoute* PROTOBUF_NONNULL mutable_planner_route();
+  void set_allocated_planner_route(::PlannerRoute* PROTOBUF_NULLABLE value);
+  void unsafe_arena_set_allocated_planner_route(::PlannerRoute* PROTOBUF_NULLABLE value);
+  ::PlannerRoute* PROTOBUF_NULLABLE unsafe_arena_release_planner_route();
+
+  private:
+  const ::PlannerRoute& _internal_planner_route() const;
+  ::PlannerRoute* PROTOBUF_NONNULL _internal_mutable_planner_route();
+
+  public:
+  void clear_payload();
+  PayloadCase payload_case() const;
+  // @@protoc_insertion_point(class_scope:WrapperPlanner)
  private:
   class _Internal;
   void set_has_planner_response();
   void set_has_status();
+  void set_has_planner_route();
   inline bool has_payload() const;
   inline void clear_has_payload();
   friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<0, 2,
-                                   2, 0,
+  static const ::google::protobuf::internal::TcParseTable<0, 3,
+                                   3, 0,
                                    2>
       _table_;
 
@@ -1859,6 +2475,7 @@ class WrapperPlanner final : public ::google::protobuf::Message
       ::google::protobuf::internal::ConstantInitialized _constinit_;
       ::PlannerResponseList* PROTOBUF_NULLABLE planner_response_;
       ::Status* PROTOBUF_NULLABLE status_;
+      ::PlannerRoute* PROTOBUF_NULLABLE planner_route_;
     } payload_;
     ::google::protobuf::internal::CachedSize _cached_size_;
     ::uint32_t _oneof_case_[1];
@@ -1926,7 +2543,7 @@ class Config_mission final : public ::google::protobuf::Message
     return *reinterpret_cast<const Config_mission*>(
         &_Config_mission_default_instance_);
   }
-  static constexpr int kIndexInFileMessages = 8;
+  static constexpr int kIndexInFileMessages = 9;
   friend void swap(Config_mission& a, Config_mission& b) { a.Swap(&b); }
   inline void Swap(Config_mission* PROTOBUF_NONNULL other) {
     if (other == this) return;
@@ -2015,6 +2632,7 @@ class Config_mission final : public ::google::protobuf::Message
   // accessors -------------------------------------------------------
   enum : int {
     kDroneSimFieldNumber = 4,
+    kMissionIdFieldNumber = 5,
     kPlannerConfigFieldNumber = 1,
     kInfoPlannerFieldNumber = 2,
     kInfoDroneFieldNumber = 3,
@@ -2033,6 +2651,21 @@ class Config_mission final : public ::google::protobuf::Message
   PROTOBUF_ALWAYS_INLINE void _internal_set_drone_sim(const ::std::string& value);
   ::std::string* PROTOBUF_NONNULL _internal_mutable_drone_sim();
 
+  public:
+  // string mission_id = 5;
+  void clear_mission_id() ;
+  const ::std::string& mission_id() const;
+  template <typename Arg_ = const ::std::string&, typename... Args_>
+  void set_mission_id(Arg_&& arg, Args_... args);
+  ::std::string* PROTOBUF_NONNULL mutable_mission_id();
+  [[nodiscard]] ::std::string* PROTOBUF_NULLABLE release_mission_id();
+  void set_allocated_mission_id(::std::string* PROTOBUF_NULLABLE value);
+
+  private:
+  const ::std::string& _internal_mission_id() const;
+  PROTOBUF_ALWAYS_INLINE void _internal_set_mission_id(const ::std::string& value);
+  ::std::string* PROTOBUF_NONNULL _internal_mutable_mission_id();
+
   public:
   // .PlannerMessage planner_config = 1;
   bool has_planner_config() const;
@@ -2083,8 +2716,8 @@ class Config_mission final : public ::google::protobuf::Message
  private:
   class _Internal;
   friend class ::google::protobuf::internal::TcParser;
-  static const ::google::protobuf::internal::TcParseTable<2, 4,
-                                   3, 32,
+  static const ::google::protobuf::internal::TcParseTable<3, 5,
+                                   3, 42,
                                    2>
       _table_;
 
@@ -2106,6 +2739,7 @@ class Config_mission final : public ::google::protobuf::Message
     ::google::protobuf::internal::HasBits<1> _has_bits_;
     ::google::protobuf::internal::CachedSize _cached_size_;
     ::google::protobuf::internal::ArenaStringPtr drone_sim_;
+    ::google::protobuf::internal::ArenaStringPtr mission_id_;
     ::PlannerMessage* PROTOBUF_NULLABLE planner_config_;
     ::Info_Module* PROTOBUF_NULLABLE info_planner_;
     ::Info_Module* PROTOBUF_NULLABLE info_drone_;
@@ -2178,7 +2812,7 @@ class WrapperFromClient final : public ::google::protobuf::Message
     kMessage = 2,
     PAYLOAD_NOT_SET = 0,
   };
-  static constexpr int kIndexInFileMessages = 5;
+  static constexpr int kIndexInFileMessages = 6;
   friend void swap(WrapperFromClient& a, WrapperFromClient& b) { a.Swap(&b); }
   inline void Swap(WrapperFromClient* PROTOBUF_NONNULL other) {
     if (other == this) return;
@@ -2531,19 +3165,100 @@ inline ::Status* PROTOBUF_NONNULL WrapperPlanner::mutable_status()
   return _msg;
 }
 
-inline bool WrapperPlanner::has_payload() const {
-  return payload_case() != PAYLOAD_NOT_SET;
+// .PlannerRoute planner_route = 3;
+inline bool WrapperPlanner::has_planner_route() const {
+  return payload_case() == kPlannerRoute;
 }
-inline void WrapperPlanner::clear_has_payload() {
-  _impl_._oneof_case_[0] = PAYLOAD_NOT_SET;
+inline bool WrapperPlanner::_internal_has_planner_route() const {
+  return payload_case() == kPlannerRoute;
 }
-inline WrapperPlanner::PayloadCase WrapperPlanner::payload_case() const {
-  return WrapperPlanner::PayloadCase(_impl_._oneof_case_[0]);
+inline void WrapperPlanner::set_has_planner_route() {
+  _impl_._oneof_case_[0] = kPlannerRoute;
 }
-// -------------------------------------------------------------------
-
-// WrapperDrone
-
+inline void WrapperPlanner::clear_planner_route() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  if (payload_case() == kPlannerRoute) {
+    if (GetArena() == nullptr) {
+      delete _impl_.payload_.planner_route_;
+    } else if (::google::protobuf::internal::DebugHardenClearOneofMessageOnArena()) {
+      ::google::protobuf::internal::MaybePoisonAfterClear(_impl_.payload_.planner_route_);
+    }
+    clear_has_payload();
+  }
+}
+inline ::PlannerRoute* PROTOBUF_NULLABLE WrapperPlanner::release_planner_route() {
+  // @@protoc_insertion_point(field_release:WrapperPlanner.planner_route)
+  if (payload_case() == kPlannerRoute) {
+    clear_has_payload();
+    auto* temp = _impl_.payload_.planner_route_;
+    if (GetArena() != nullptr) {
+      temp = ::google::protobuf::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.payload_.planner_route_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::PlannerRoute& WrapperPlanner::_internal_planner_route() const {
+  return payload_case() == kPlannerRoute ? *_impl_.payload_.planner_route_ : reinterpret_cast<::PlannerRoute&>(::_PlannerRoute_default_instance_);
+}
+inline const ::PlannerRoute& WrapperPlanner::planner_route() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:WrapperPlanner.planner_route)
+  return _internal_planner_route();
+}
+inline ::PlannerRoute* PROTOBUF_NULLABLE WrapperPlanner::unsafe_arena_release_planner_route() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:WrapperPlanner.planner_route)
+  if (payload_case() == kPlannerRoute) {
+    clear_has_payload();
+    auto* temp = _impl_.payload_.planner_route_;
+    _impl_.payload_.planner_route_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void WrapperPlanner::unsafe_arena_set_allocated_planner_route(
+    ::PlannerRoute* PROTOBUF_NULLABLE value) {
+  // We rely on the oneof clear method to free the earlier contents
+  // of this oneof. We can directly use the pointer we're given to
+  // set the new value.
+  clear_payload();
+  if (value) {
+    set_has_planner_route();
+    _impl_.payload_.planner_route_ = value;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:WrapperPlanner.planner_route)
+}
+inline ::PlannerRoute* PROTOBUF_NONNULL WrapperPlanner::_internal_mutable_planner_route() {
+  if (payload_case() != kPlannerRoute) {
+    clear_payload();
+    set_has_planner_route();
+    _impl_.payload_.planner_route_ = 
+        ::google::protobuf::Message::DefaultConstruct<::PlannerRoute>(GetArena());
+  }
+  return _impl_.payload_.planner_route_;
+}
+inline ::PlannerRoute* PROTOBUF_NONNULL WrapperPlanner::mutable_planner_route()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::PlannerRoute* _msg = _internal_mutable_planner_route();
+  // @@protoc_insertion_point(field_mutable:WrapperPlanner.planner_route)
+  return _msg;
+}
+
+inline bool WrapperPlanner::has_payload() const {
+  return payload_case() != PAYLOAD_NOT_SET;
+}
+inline void WrapperPlanner::clear_has_payload() {
+  _impl_._oneof_case_[0] = PAYLOAD_NOT_SET;
+}
+inline WrapperPlanner::PayloadCase WrapperPlanner::payload_case() const {
+  return WrapperPlanner::PayloadCase(_impl_._oneof_case_[0]);
+}
+// -------------------------------------------------------------------
+
+// WrapperDrone
+
 // .Status status = 1;
 inline bool WrapperDrone::has_status() const {
   return payload_case() == kStatus;
@@ -2688,6 +3403,204 @@ PlannerResponseList::_internal_mutable_items() {
   return &_impl_.items_;
 }
 
+// uint64 request_id = 2;
+inline void PlannerResponseList::clear_request_id() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.request_id_ = ::uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline ::uint64_t PlannerResponseList::request_id() const {
+  // @@protoc_insertion_point(field_get:PlannerResponseList.request_id)
+  return _internal_request_id();
+}
+inline void PlannerResponseList::set_request_id(::uint64_t value) {
+  _internal_set_request_id(value);
+  _impl_._has_bits_[0] |= 0x00000001u;
+  // @@protoc_insertion_point(field_set:PlannerResponseList.request_id)
+}
+inline ::uint64_t PlannerResponseList::_internal_request_id() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.request_id_;
+}
+inline void PlannerResponseList::_internal_set_request_id(::uint64_t value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.request_id_ = value;
+}
+
+// uint32 streamed_routes = 3;
+inline void PlannerResponseList::clear_streamed_routes() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.streamed_routes_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline ::uint32_t PlannerResponseList::streamed_routes() const {
+  // @@protoc_insertion_point(field_get:PlannerResponseList.streamed_routes)
+  return _internal_streamed_routes();
+}
+inline void PlannerResponseList::set_streamed_routes(::uint32_t value) {
+  _internal_set_streamed_routes(value);
+  _impl_._has_bits_[0] |= 0x00000002u;
+  // @@protoc_insertion_point(field_set:PlannerResponseList.streamed_routes)
+}
+inline ::uint32_t PlannerResponseList::_internal_streamed_routes() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.streamed_routes_;
+}
+inline void PlannerResponseList::_internal_set_streamed_routes(::uint32_t value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.streamed_routes_ = value;
+}
+
+// -------------------------------------------------------------------
+
+// PlannerRoute
+
+// uint64 request_id = 1;
+inline void PlannerRoute::clear_request_id() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.request_id_ = ::uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline ::uint64_t PlannerRoute::request_id() const {
+  // @@protoc_insertion_point(field_get:PlannerRoute.request_id)
+  return _internal_request_id();
+}
+inline void PlannerRoute::set_request_id(::uint64_t value) {
+  _internal_set_request_id(value);
+  _impl_._has_bits_[0] |= 0x00000002u;
+  // @@protoc_insertion_point(field_set:PlannerRoute.request_id)
+}
+inline ::uint64_t PlannerRoute::_internal_request_id() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.request_id_;
+}
+inline void PlannerRoute::_internal_set_request_id(::uint64_t value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.request_id_ = value;
+}
+
+// uint32 drone = 2;
+inline void PlannerRoute::clear_drone() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.drone_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline ::uint32_t PlannerRoute::drone() const {
+  // @@protoc_insertion_point(field_get:PlannerRoute.drone)
+  return _internal_drone();
+}
+inline void PlannerRoute::set_drone(::uint32_t value) {
+  _internal_set_drone(value);
+  _impl_._has_bits_[0] |= 0x00000004u;
+  // @@protoc_insertion_point(field_set:PlannerRoute.drone)
+}
+inline ::uint32_t PlannerRoute::_internal_drone() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.drone_;
+}
+inline void PlannerRoute::_internal_set_drone(::uint32_t value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.drone_ = value;
+}
+
+// .PlannerResponse route = 3;
+inline bool PlannerRoute::has_route() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.route_ != nullptr);
+  return value;
+}
+inline void PlannerRoute::clear_route() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  if (_impl_.route_ != nullptr) _impl_.route_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::PlannerResponse& PlannerRoute::_internal_route() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  const ::PlannerResponse* p = _impl_.route_;
+  return p != nullptr ? *p : reinterpret_cast<const ::PlannerResponse&>(::_PlannerResponse_default_instance_);
+}
+inline const ::PlannerResponse& PlannerRoute::route() const ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:PlannerRoute.route)
+  return _internal_route();
+}
+inline void PlannerRoute::unsafe_arena_set_allocated_route(
+    ::PlannerResponse* PROTOBUF_NULLABLE value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.route_);
+  }
+  _impl_.route_ = reinterpret_cast<::PlannerResponse*>(value);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:PlannerRoute.route)
+}
+inline ::PlannerResponse* PROTOBUF_NULLABLE PlannerRoute::release_route() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::PlannerResponse* released = _impl_.route_;
+  _impl_.route_ = nullptr;
+  if (::google::protobuf::internal::DebugHardenForceCopyInRelease()) {
+    auto* old = reinterpret_cast<::google::protobuf::MessageLite*>(released);
+    released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+    if (GetArena() == nullptr) {
+      delete old;
+    }
+  } else {
+    if (GetArena() != nullptr) {
+      released = ::google::protobuf::internal::DuplicateIfNonNull(released);
+    }
+  }
+  return released;
+}
+inline ::PlannerResponse* PROTOBUF_NULLABLE PlannerRoute::unsafe_arena_release_route() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  // @@protoc_insertion_point(field_release:PlannerRoute.route)
+
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::PlannerResponse* temp = _impl_.route_;
+  _impl_.route_ = nullptr;
+  return temp;
+}
+inline ::PlannerResponse* PROTOBUF_NONNULL PlannerRoute::_internal_mutable_route() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  if (_impl_.route_ == nullptr) {
+    auto* p = ::google::protobuf::Message::DefaultConstruct<::PlannerResponse>(GetArena());
+    _impl_.route_ = reinterpret_cast<::PlannerResponse*>(p);
+  }
+  return _impl_.route_;
+}
+inline ::PlannerResponse* PROTOBUF_NONNULL PlannerRoute::mutable_route()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  ::PlannerResponse* _msg = _internal_mutable_route();
+  // @@protoc_insertion_point(field_mutable:PlannerRoute.route)
+  return _msg;
+}
+inline void PlannerRoute::set_allocated_route(::PlannerResponse* PROTOBUF_NULLABLE value) {
+  ::google::protobuf::Arena* message_arena = GetArena();
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  if (message_arena == nullptr) {
+    delete reinterpret_cast<::google::protobuf::MessageLite*>(_impl_.route_);
+  }
+
+  if (value != nullptr) {
+    ::google::protobuf::Arena* submessage_arena = value->GetArena();
+    if (message_arena != submessage_arena) {
+      value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+
+  _impl_.route_ = reinterpret_cast<::PlannerResponse*>(value);
+  // @@protoc_insertion_point(field_set_allocated:PlannerRoute.route)
+}
+
 // -------------------------------------------------------------------
 
 // PlannerResponse
@@ -2711,148 +3624,598 @@ inline void PlannerResponse::set_lon(int index, double value) {
   _internal_mutable_lon()->Set(index, value);
   // @@protoc_insertion_point(field_set:PlannerResponse.lon)
 }
-inline void PlannerResponse::add_lon(double value) {
+inline void PlannerResponse::add_lon(double value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _internal_mutable_lon()->Add(value);
+  // @@protoc_insertion_point(field_add:PlannerResponse.lon)
+}
+inline const ::google::protobuf::RepeatedField<double>& PlannerResponse::lon() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:PlannerResponse.lon)
+  return _internal_lon();
+}
+inline ::google::protobuf::RepeatedField<double>* PROTOBUF_NONNULL PlannerResponse::mutable_lon()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:PlannerResponse.lon)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  return _internal_mutable_lon();
+}
+inline const ::google::protobuf::RepeatedField<double>&
+PlannerResponse::_internal_lon() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.lon_;
+}
+inline ::google::protobuf::RepeatedField<double>* PROTOBUF_NONNULL
+PlannerResponse::_internal_mutable_lon() {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return &_impl_.lon_;
+}
+
+// repeated double lat = 2;
+inline int PlannerResponse::_internal_lat_size() const {
+  return _internal_lat().size();
+}
+inline int PlannerResponse::lat_size() const {
+  return _internal_lat_size();
+}
+inline void PlannerResponse::clear_lat() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.lat_.Clear();
+}
+inline double PlannerResponse::lat(int index) const {
+  // @@protoc_insertion_point(field_get:PlannerResponse.lat)
+  return _internal_lat().Get(index);
+}
+inline void PlannerResponse::set_lat(int index, double value) {
+  _internal_mutable_lat()->Set(index, value);
+  // @@protoc_insertion_point(field_set:PlannerResponse.lat)
+}
+inline void PlannerResponse::add_lat(double value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _internal_mutable_lat()->Add(value);
+  // @@protoc_insertion_point(field_add:PlannerResponse.lat)
+}
+inline const ::google::protobuf::RepeatedField<double>& PlannerResponse::lat() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:PlannerResponse.lat)
+  return _internal_lat();
+}
+inline ::google::protobuf::RepeatedField<double>* PROTOBUF_NONNULL PlannerResponse::mutable_lat()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:PlannerResponse.lat)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  return _internal_mutable_lat();
+}
+inline const ::google::protobuf::RepeatedField<double>&
+PlannerResponse::_internal_lat() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.lat_;
+}
+inline ::google::protobuf::RepeatedField<double>* PROTOBUF_NONNULL
+PlannerResponse::_internal_mutable_lat() {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return &_impl_.lat_;
+}
+
+// repeated sint32 lon_e7_delta = 3;
+inline int PlannerResponse::_internal_lon_e7_delta_size() const {
+  return _internal_lon_e7_delta().size();
+}
+inline int PlannerResponse::lon_e7_delta_size() const {
+  return _internal_lon_e7_delta_size();
+}
+inline void PlannerResponse::clear_lon_e7_delta() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.lon_e7_delta_.Clear();
+}
+inline ::int32_t PlannerResponse::lon_e7_delta(int index) const {
+  // @@protoc_insertion_point(field_get:PlannerResponse.lon_e7_delta)
+  return _internal_lon_e7_delta().Get(index);
+}
+inline void PlannerResponse::set_lon_e7_delta(int index, ::int32_t value) {
+  _internal_mutable_lon_e7_delta()->Set(index, value);
+  // @@protoc_insertion_point(field_set:PlannerResponse.lon_e7_delta)
+}
+inline void PlannerResponse::add_lon_e7_delta(::int32_t value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _internal_mutable_lon_e7_delta()->Add(value);
+  // @@protoc_insertion_point(field_add:PlannerResponse.lon_e7_delta)
+}
+inline const ::google::protobuf::RepeatedField<::int32_t>& PlannerResponse::lon_e7_delta() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:PlannerResponse.lon_e7_delta)
+  return _internal_lon_e7_delta();
+}
+inline ::google::protobuf::RepeatedField<::int32_t>* PROTOBUF_NONNULL PlannerResponse::mutable_lon_e7_delta()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:PlannerResponse.lon_e7_delta)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  return _internal_mutable_lon_e7_delta();
+}
+inline const ::google::protobuf::RepeatedField<::int32_t>&
+PlannerResponse::_internal_lon_e7_delta() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.lon_e7_delta_;
+}
+inline ::google::protobuf::RepeatedField<::int32_t>* PROTOBUF_NONNULL
+PlannerResponse::_internal_mutable_lon_e7_delta() {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return &_impl_.lon_e7_delta_;
+}
+
+// repeated sint32 lat_e7_delta = 4;
+inline int PlannerResponse::_internal_lat_e7_delta_size() const {
+  return _internal_lat_e7_delta().size();
+}
+inline int PlannerResponse::lat_e7_delta_size() const {
+  return _internal_lat_e7_delta_size();
+}
+inline void PlannerResponse::clear_lat_e7_delta() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.lat_e7_delta_.Clear();
+}
+inline ::int32_t PlannerResponse::lat_e7_delta(int index) const {
+  // @@protoc_insertion_point(field_get:PlannerResponse.lat_e7_delta)
+  return _internal_lat_e7_delta().Get(index);
+}
+inline void PlannerResponse::set_lat_e7_delta(int index, ::int32_t value) {
+  _internal_mutable_lat_e7_delta()->Set(index, value);
+  // @@protoc_insertion_point(field_set:PlannerResponse.lat_e7_delta)
+}
+inline void PlannerResponse::add_lat_e7_delta(::int32_t value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _internal_mutable_lat_e7_delta()->Add(value);
+  // @@protoc_insertion_point(field_add:PlannerResponse.lat_e7_delta)
+}
+inline const ::google::protobuf::RepeatedField<::int32_t>& PlannerResponse::lat_e7_delta() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_list:PlannerResponse.lat_e7_delta)
+  return _internal_lat_e7_delta();
+}
+inline ::google::protobuf::RepeatedField<::int32_t>* PROTOBUF_NONNULL PlannerResponse::mutable_lat_e7_delta()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_mutable_list:PlannerResponse.lat_e7_delta)
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  return _internal_mutable_lat_e7_delta();
+}
+inline const ::google::protobuf::RepeatedField<::int32_t>&
+PlannerResponse::_internal_lat_e7_delta() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.lat_e7_delta_;
+}
+inline ::google::protobuf::RepeatedField<::int32_t>* PROTOBUF_NONNULL
+PlannerResponse::_internal_mutable_lat_e7_delta() {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return &_impl_.lat_e7_delta_;
+}
+
+// -------------------------------------------------------------------
+
+// Status
+
+// string type_status = 1;
+inline void Status::clear_type_status() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.type_status_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::std::string& Status::type_status() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:Status.type_status)
+  return _internal_type_status();
+}
+template <typename Arg_, typename... Args_>
+PROTOBUF_ALWAYS_INLINE void Status::set_type_status(Arg_&& arg, Args_... args) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.type_status_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:Status.type_status)
+}
+inline ::std::string* PROTOBUF_NONNULL Status::mutable_type_status()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::std::string* _s = _internal_mutable_type_status();
+  // @@protoc_insertion_point(field_mutable:Status.type_status)
+  return _s;
+}
+inline const ::std::string& Status::_internal_type_status() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.type_status_.Get();
+}
+inline void Status::_internal_set_type_status(const ::std::string& value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.type_status_.Set(value, GetArena());
+}
+inline ::std::string* PROTOBUF_NONNULL Status::_internal_mutable_type_status() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.type_status_.Mutable( GetArena());
+}
+inline ::std::string* PROTOBUF_NULLABLE Status::release_type_status() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  // @@protoc_insertion_point(field_release:Status.type_status)
+  if ((_impl_._has_bits_[0] & 0x00000001u) == 0) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* released = _impl_.type_status_.Release();
+  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString()) {
+    _impl_.type_status_.Set("", GetArena());
+  }
+  return released;
+}
+inline void Status::set_allocated_type_status(::std::string* PROTOBUF_NULLABLE value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.type_status_.SetAllocated(value, GetArena());
+  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.type_status_.IsDefault()) {
+    _impl_.type_status_.Set("", GetArena());
+  }
+  // @@protoc_insertion_point(field_set_allocated:Status.type_status)
+}
+
+// uint64 request_id = 2;
+inline void Status::clear_request_id() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.request_id_ = ::uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline ::uint64_t Status::request_id() const {
+  // @@protoc_insertion_point(field_get:Status.request_id)
+  return _internal_request_id();
+}
+inline void Status::set_request_id(::uint64_t value) {
+  _internal_set_request_id(value);
+  _impl_._has_bits_[0] |= 0x00000008u;
+  // @@protoc_insertion_point(field_set:Status.request_id)
+}
+inline ::uint64_t Status::_internal_request_id() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.request_id_;
+}
+inline void Status::_internal_set_request_id(::uint64_t value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.request_id_ = value;
+}
+
+// string profile = 3;
+inline void Status::clear_profile() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.profile_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::std::string& Status::profile() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:Status.profile)
+  return _internal_profile();
+}
+template <typename Arg_, typename... Args_>
+PROTOBUF_ALWAYS_INLINE void Status::set_profile(Arg_&& arg, Args_... args) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.profile_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:Status.profile)
+}
+inline ::std::string* PROTOBUF_NONNULL Status::mutable_profile()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::std::string* _s = _internal_mutable_profile();
+  // @@protoc_insertion_point(field_mutable:Status.profile)
+  return _s;
+}
+inline const ::std::string& Status::_internal_profile() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.profile_.Get();
+}
+inline void Status::_internal_set_profile(const ::std::string& value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.profile_.Set(value, GetArena());
+}
+inline ::std::string* PROTOBUF_NONNULL Status::_internal_mutable_profile() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.profile_.Mutable( GetArena());
+}
+inline ::std::string* PROTOBUF_NULLABLE Status::release_profile() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  // @@protoc_insertion_point(field_release:Status.profile)
+  if ((_impl_._has_bits_[0] & 0x00000002u) == 0) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* released = _impl_.profile_.Release();
+  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString()) {
+    _impl_.profile_.Set("", GetArena());
+  }
+  return released;
+}
+inline void Status::set_allocated_profile(::std::string* PROTOBUF_NULLABLE value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.profile_.SetAllocated(value, GetArena());
+  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.profile_.IsDefault()) {
+    _impl_.profile_.Set("", GetArena());
+  }
+  // @@protoc_insertion_point(field_set_allocated:Status.profile)
+}
+
+// bool compact_coordinates = 4;
+inline void Status::clear_compact_coordinates() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.compact_coordinates_ = false;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline bool Status::compact_coordinates() const {
+  // @@protoc_insertion_point(field_get:Status.compact_coordinates)
+  return _internal_compact_coordinates();
+}
+inline void Status::set_compact_coordinates(bool value) {
+  _internal_set_compact_coordinates(value);
+  _impl_._has_bits_[0] |= 0x00000010u;
+  // @@protoc_insertion_point(field_set:Status.compact_coordinates)
+}
+inline bool Status::_internal_compact_coordinates() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.compact_coordinates_;
+}
+inline void Status::_internal_set_compact_coordinates(bool value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.compact_coordinates_ = value;
+}
+
+// .PlannerStatus planner_status = 5;
+inline bool Status::has_planner_status() const {
+  return typed_status_case() == kPlannerStatus;
+}
+inline void Status::set_has_planner_status() {
+  _impl_._oneof_case_[0] = kPlannerStatus;
+}
+inline void Status::clear_planner_status() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  if (typed_status_case() == kPlannerStatus) {
+    _impl_.typed_status_.planner_status_ = 0;
+    clear_has_typed_status();
+  }
+}
+inline ::PlannerStatus Status::planner_status() const {
+  // @@protoc_insertion_point(field_get:Status.planner_status)
+  return _internal_planner_status();
+}
+inline void Status::set_planner_status(::PlannerStatus value) {
+  if (typed_status_case() != kPlannerStatus) {
+    clear_typed_status();
+    set_has_planner_status();
+  }
+  _impl_.typed_status_.planner_status_ = value;
+  // @@protoc_insertion_point(field_set:Status.planner_status)
+}
+inline ::PlannerStatus Status::_internal_planner_status() const {
+  if (typed_status_case() == kPlannerStatus) {
+    return static_cast<::PlannerStatus>(_impl_.typed_status_.planner_status_);
+  }
+  return static_cast<::PlannerStatus>(0);
+}
+
+// .DroneStatus drone_status = 6;
+inline bool Status::has_drone_status() const {
+  return typed_status_case() == kDroneStatus;
+}
+inline void Status::set_has_drone_status() {
+  _impl_._oneof_case_[0] = kDroneStatus;
+}
+inline void Status::clear_drone_status() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  if (typed_status_case() == kDroneStatus) {
+    _impl_.typed_status_.drone_status_ = 0;
+    clear_has_typed_status();
+  }
+}
+inline ::DroneStatus Status::drone_status() const {
+  // @@protoc_insertion_point(field_get:Status.drone_status)
+  return _internal_drone_status();
+}
+inline void Status::set_drone_status(::DroneStatus value) {
+  if (typed_status_case() != kDroneStatus) {
+    clear_typed_status();
+    set_has_drone_status();
+  }
+  _impl_.typed_status_.drone_status_ = value;
+  // @@protoc_insertion_point(field_set:Status.drone_status)
+}
+inline ::DroneStatus Status::_internal_drone_status() const {
+  if (typed_status_case() == kDroneStatus) {
+    return static_cast<::DroneStatus>(_impl_.typed_status_.drone_status_);
+  }
+  return static_cast<::DroneStatus>(0);
+}
+
+// .PldStatus pld_status = 7;
+inline bool Status::has_pld_status() const {
+  return typed_status_case() == kPldStatus;
+}
+inline void Status::set_has_pld_status() {
+  _impl_._oneof_case_[0] = kPldStatus;
+}
+inline void Status::clear_pld_status() {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  _internal_mutable_lon()->Add(value);
-  // @@protoc_insertion_point(field_add:PlannerResponse.lon)
+  if (typed_status_case() == kPldStatus) {
+    _impl_.typed_status_.pld_status_ = 0;
+    clear_has_typed_status();
+  }
 }
-inline const ::google::protobuf::RepeatedField<double>& PlannerResponse::lon() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_list:PlannerResponse.lon)
-  return _internal_lon();
+inline ::PldStatus Status::pld_status() const {
+  // @@protoc_insertion_point(field_get:Status.pld_status)
+  return _internal_pld_status();
 }
-inline ::google::protobuf::RepeatedField<double>* PROTOBUF_NONNULL PlannerResponse::mutable_lon()
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_mutable_list:PlannerResponse.lon)
+inline void Status::set_pld_status(::PldStatus value) {
+  if (typed_status_case() != kPldStatus) {
+    clear_typed_status();
+    set_has_pld_status();
+  }
+  _impl_.typed_status_.pld_status_ = value;
+  // @@protoc_insertion_point(field_set:Status.pld_status)
+}
+inline ::PldStatus Status::_internal_pld_status() const {
+  if (typed_status_case() == kPldStatus) {
+    return static_cast<::PldStatus>(_impl_.typed_status_.pld_status_);
+  }
+  return static_cast<::PldStatus>(0);
+}
+
+// uint32 queued_missions = 8;
+inline void Status::clear_queued_missions() {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _internal_mutable_lon();
+  _impl_.queued_missions_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000020u;
 }
-inline const ::google::protobuf::RepeatedField<double>&
-PlannerResponse::_internal_lon() const {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.lon_;
+inline ::uint32_t Status::queued_missions() const {
+  // @@protoc_insertion_point(field_get:Status.queued_missions)
+  return _internal_queued_missions();
 }
-inline ::google::protobuf::RepeatedField<double>* PROTOBUF_NONNULL
-PlannerResponse::_internal_mutable_lon() {
+inline void Status::set_queued_missions(::uint32_t value) {
+  _internal_set_queued_missions(value);
+  _impl_._has_bits_[0] |= 0x00000020u;
+  // @@protoc_insertion_point(field_set:Status.queued_missions)
+}
+inline ::uint32_t Status::_internal_queued_missions() const {
   ::google::protobuf::internal::TSanRead(&_impl_);
-  return &_impl_.lon_;
+  return _impl_.queued_missions_;
+}
+inline void Status::_internal_set_queued_missions(::uint32_t value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.queued_missions_ = value;
 }
 
-// repeated double lat = 2;
-inline int PlannerResponse::_internal_lat_size() const {
-  return _internal_lat().size();
+// uint32 planned_missions = 9;
+inline void Status::clear_planned_missions() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.planned_missions_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000040u;
 }
-inline int PlannerResponse::lat_size() const {
-  return _internal_lat_size();
+inline ::uint32_t Status::planned_missions() const {
+  // @@protoc_insertion_point(field_get:Status.planned_missions)
+  return _internal_planned_missions();
 }
-inline void PlannerResponse::clear_lat() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.lat_.Clear();
+inline void Status::set_planned_missions(::uint32_t value) {
+  _internal_set_planned_missions(value);
+  _impl_._has_bits_[0] |= 0x00000040u;
+  // @@protoc_insertion_point(field_set:Status.planned_missions)
 }
-inline double PlannerResponse::lat(int index) const {
-  // @@protoc_insertion_point(field_get:PlannerResponse.lat)
-  return _internal_lat().Get(index);
+inline ::uint32_t Status::_internal_planned_missions() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.planned_missions_;
 }
-inline void PlannerResponse::set_lat(int index, double value) {
-  _internal_mutable_lat()->Set(index, value);
-  // @@protoc_insertion_point(field_set:PlannerResponse.lat)
+inline void Status::_internal_set_planned_missions(::uint32_t value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.planned_missions_ = value;
 }
-inline void PlannerResponse::add_lat(double value) {
+
+// uint64 last_mission_latency_ms = 10;
+inline void Status::clear_last_mission_latency_ms() {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  _internal_mutable_lat()->Add(value);
-  // @@protoc_insertion_point(field_add:PlannerResponse.lat)
+  _impl_.last_mission_latency_ms_ = ::uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000080u;
 }
-inline const ::google::protobuf::RepeatedField<double>& PlannerResponse::lat() const
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_list:PlannerResponse.lat)
-  return _internal_lat();
+inline ::uint64_t Status::last_mission_latency_ms() const {
+  // @@protoc_insertion_point(field_get:Status.last_mission_latency_ms)
+  return _internal_last_mission_latency_ms();
 }
-inline ::google::protobuf::RepeatedField<double>* PROTOBUF_NONNULL PlannerResponse::mutable_lat()
-    ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_mutable_list:PlannerResponse.lat)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  return _internal_mutable_lat();
+inline void Status::set_last_mission_latency_ms(::uint64_t value) {
+  _internal_set_last_mission_latency_ms(value);
+  _impl_._has_bits_[0] |= 0x00000080u;
+  // @@protoc_insertion_point(field_set:Status.last_mission_latency_ms)
 }
-inline const ::google::protobuf::RepeatedField<double>&
-PlannerResponse::_internal_lat() const {
+inline ::uint64_t Status::_internal_last_mission_latency_ms() const {
   ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.lat_;
+  return _impl_.last_mission_latency_ms_;
 }
-inline ::google::protobuf::RepeatedField<double>* PROTOBUF_NONNULL
-PlannerResponse::_internal_mutable_lat() {
-  ::google::protobuf::internal::TSanRead(&_impl_);
-  return &_impl_.lat_;
+inline void Status::_internal_set_last_mission_latency_ms(::uint64_t value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.last_mission_latency_ms_ = value;
 }
 
-// -------------------------------------------------------------------
-
-// Status
-
-// string type_status = 1;
-inline void Status::clear_type_status() {
+// string mission_id = 11;
+inline void Status::clear_mission_id() {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_.type_status_.ClearToEmpty();
-  _impl_._has_bits_[0] &= ~0x00000001u;
+  _impl_.mission_id_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000004u;
 }
-inline const ::std::string& Status::type_status() const
+inline const ::std::string& Status::mission_id() const
     ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  // @@protoc_insertion_point(field_get:Status.type_status)
-  return _internal_type_status();
+  // @@protoc_insertion_point(field_get:Status.mission_id)
+  return _internal_mission_id();
 }
 template <typename Arg_, typename... Args_>
-PROTOBUF_ALWAYS_INLINE void Status::set_type_status(Arg_&& arg, Args_... args) {
+PROTOBUF_ALWAYS_INLINE void Status::set_mission_id(Arg_&& arg, Args_... args) {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000001u;
-  _impl_.type_status_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
-  // @@protoc_insertion_point(field_set:Status.type_status)
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.mission_id_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:Status.mission_id)
 }
-inline ::std::string* PROTOBUF_NONNULL Status::mutable_type_status()
+inline ::std::string* PROTOBUF_NONNULL Status::mutable_mission_id()
     ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  ::std::string* _s = _internal_mutable_type_status();
-  // @@protoc_insertion_point(field_mutable:Status.type_status)
+  ::std::string* _s = _internal_mutable_mission_id();
+  // @@protoc_insertion_point(field_mutable:Status.mission_id)
   return _s;
 }
-inline const ::std::string& Status::_internal_type_status() const {
+inline const ::std::string& Status::_internal_mission_id() const {
   ::google::protobuf::internal::TSanRead(&_impl_);
-  return _impl_.type_status_.Get();
+  return _impl_.mission_id_.Get();
 }
-inline void Status::_internal_set_type_status(const ::std::string& value) {
+inline void Status::_internal_set_mission_id(const ::std::string& value) {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000001u;
-  _impl_.type_status_.Set(value, GetArena());
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.mission_id_.Set(value, GetArena());
 }
-inline ::std::string* PROTOBUF_NONNULL Status::_internal_mutable_type_status() {
+inline ::std::string* PROTOBUF_NONNULL Status::_internal_mutable_mission_id() {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  _impl_._has_bits_[0] |= 0x00000001u;
-  return _impl_.type_status_.Mutable( GetArena());
+  _impl_._has_bits_[0] |= 0x00000004u;
+  return _impl_.mission_id_.Mutable( GetArena());
 }
-inline ::std::string* PROTOBUF_NULLABLE Status::release_type_status() {
+inline ::std::string* PROTOBUF_NULLABLE Status::release_mission_id() {
   ::google::protobuf::internal::TSanWrite(&_impl_);
-  // @@protoc_insertion_point(field_release:Status.type_status)
-  if ((_impl_._has_bits_[0] & 0x00000001u) == 0) {
+  // @@protoc_insertion_point(field_release:Status.mission_id)
+  if ((_impl_._has_bits_[0] & 0x00000004u) == 0) {
     return nullptr;
   }
-  _impl_._has_bits_[0] &= ~0x00000001u;
-  auto* released = _impl_.type_status_.Release();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  auto* released = _impl_.mission_id_.Release();
   if (::google::protobuf::internal::DebugHardenForceCopyDefaultString()) {
-    _impl_.type_status_.Set("", GetArena());
+    _impl_.mission_id_.Set("", GetArena());
   }
   return released;
 }
-inline void Status::set_allocated_type_status(::std::string* PROTOBUF_NULLABLE value) {
+inline void Status::set_allocated_mission_id(::std::string* PROTOBUF_NULLABLE value) {
   ::google::protobuf::internal::TSanWrite(&_impl_);
   if (value != nullptr) {
-    _impl_._has_bits_[0] |= 0x00000001u;
+    _impl_._has_bits_[0] |= 0x00000004u;
   } else {
-    _impl_._has_bits_[0] &= ~0x00000001u;
+    _impl_._has_bits_[0] &= ~0x00000004u;
   }
-  _impl_.type_status_.SetAllocated(value, GetArena());
-  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.type_status_.IsDefault()) {
-    _impl_.type_status_.Set("", GetArena());
+  _impl_.mission_id_.SetAllocated(value, GetArena());
+  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.mission_id_.IsDefault()) {
+    _impl_.mission_id_.Set("", GetArena());
   }
-  // @@protoc_insertion_point(field_set_allocated:Status.type_status)
+  // @@protoc_insertion_point(field_set_allocated:Status.mission_id)
 }
 
+inline bool Status::has_typed_status() const {
+  return typed_status_case() != TYPED_STATUS_NOT_SET;
+}
+inline void Status::clear_has_typed_status() {
+  _impl_._oneof_case_[0] = TYPED_STATUS_NOT_SET;
+}
+inline Status::TypedStatusCase Status::typed_status_case() const {
+  return Status::TypedStatusCase(_impl_._oneof_case_[0]);
+}
 // -------------------------------------------------------------------
 
 // WrapperFromClient
@@ -3097,6 +4460,71 @@ inline void Command::set_allocated_command(::std::string* PROTOBUF_NULLABLE valu
   // @@protoc_insertion_point(field_set_allocated:Command.command)
 }
 
+// string mission_id = 2;
+inline void Command::clear_mission_id() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.mission_id_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::std::string& Command::mission_id() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:Command.mission_id)
+  return _internal_mission_id();
+}
+template <typename Arg_, typename... Args_>
+PROTOBUF_ALWAYS_INLINE void Command::set_mission_id(Arg_&& arg, Args_... args) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.mission_id_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:Command.mission_id)
+}
+inline ::std::string* PROTOBUF_NONNULL Command::mutable_mission_id()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::std::string* _s = _internal_mutable_mission_id();
+  // @@protoc_insertion_point(field_mutable:Command.mission_id)
+  return _s;
+}
+inline const ::std::string& Command::_internal_mission_id() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.mission_id_.Get();
+}
+inline void Command::_internal_set_mission_id(const ::std::string& value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.mission_id_.Set(value, GetArena());
+}
+inline ::std::string* PROTOBUF_NONNULL Command::_internal_mutable_mission_id() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.mission_id_.Mutable( GetArena());
+}
+inline ::std::string* PROTOBUF_NULLABLE Command::release_mission_id() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  // @@protoc_insertion_point(field_release:Command.mission_id)
+  if ((_impl_._has_bits_[0] & 0x00000002u) == 0) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* released = _impl_.mission_id_.Release();
+  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString()) {
+    _impl_.mission_id_.Set("", GetArena());
+  }
+  return released;
+}
+inline void Command::set_allocated_mission_id(::std::string* PROTOBUF_NULLABLE value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.mission_id_.SetAllocated(value, GetArena());
+  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.mission_id_.IsDefault()) {
+    _impl_.mission_id_.Set("", GetArena());
+  }
+  // @@protoc_insertion_point(field_set_allocated:Command.mission_id)
+}
+
 // -------------------------------------------------------------------
 
 // WrapperPLD
@@ -3197,7 +4625,7 @@ inline WrapperPLD::PayloadCase WrapperPLD::payload_case() const {
 
 // .PlannerMessage planner_config = 1;
 inline bool Config_mission::has_planner_config() const {
-  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
   PROTOBUF_ASSUME(!value || _impl_.planner_config_ != nullptr);
   return value;
 }
@@ -3218,16 +4646,16 @@ inline void Config_mission::unsafe_arena_set_allocated_planner_config(
   }
   _impl_.planner_config_ = reinterpret_cast<::PlannerMessage*>(value);
   if (value != nullptr) {
-    _impl_._has_bits_[0] |= 0x00000002u;
+    _impl_._has_bits_[0] |= 0x00000004u;
   } else {
-    _impl_._has_bits_[0] &= ~0x00000002u;
+    _impl_._has_bits_[0] &= ~0x00000004u;
   }
   // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Config_mission.planner_config)
 }
 inline ::PlannerMessage* PROTOBUF_NULLABLE Config_mission::release_planner_config() {
   ::google::protobuf::internal::TSanWrite(&_impl_);
 
-  _impl_._has_bits_[0] &= ~0x00000002u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
   ::PlannerMessage* released = _impl_.planner_config_;
   _impl_.planner_config_ = nullptr;
   if (::google::protobuf::internal::DebugHardenForceCopyInRelease()) {
@@ -3247,7 +4675,7 @@ inline ::PlannerMessage* PROTOBUF_NULLABLE Config_mission::unsafe_arena_release_
   ::google::protobuf::internal::TSanWrite(&_impl_);
   // @@protoc_insertion_point(field_release:Config_mission.planner_config)
 
-  _impl_._has_bits_[0] &= ~0x00000002u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
   ::PlannerMessage* temp = _impl_.planner_config_;
   _impl_.planner_config_ = nullptr;
   return temp;
@@ -3262,7 +4690,7 @@ inline ::PlannerMessage* PROTOBUF_NONNULL Config_mission::_internal_mutable_plan
 }
 inline ::PlannerMessage* PROTOBUF_NONNULL Config_mission::mutable_planner_config()
     ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_._has_bits_[0] |= 0x00000004u;
   ::PlannerMessage* _msg = _internal_mutable_planner_config();
   // @@protoc_insertion_point(field_mutable:Config_mission.planner_config)
   return _msg;
@@ -3279,9 +4707,9 @@ inline void Config_mission::set_allocated_planner_config(::PlannerMessage* PROTO
     if (message_arena != submessage_arena) {
       value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
     }
-    _impl_._has_bits_[0] |= 0x00000002u;
+    _impl_._has_bits_[0] |= 0x00000004u;
   } else {
-    _impl_._has_bits_[0] &= ~0x00000002u;
+    _impl_._has_bits_[0] &= ~0x00000004u;
   }
 
   _impl_.planner_config_ = reinterpret_cast<::PlannerMessage*>(value);
@@ -3290,14 +4718,14 @@ inline void Config_mission::set_allocated_planner_config(::PlannerMessage* PROTO
 
 // .Info_Module info_planner = 2;
 inline bool Config_mission::has_info_planner() const {
-  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
   PROTOBUF_ASSUME(!value || _impl_.info_planner_ != nullptr);
   return value;
 }
 inline void Config_mission::clear_info_planner() {
   ::google::protobuf::internal::TSanWrite(&_impl_);
   if (_impl_.info_planner_ != nullptr) _impl_.info_planner_->Clear();
-  _impl_._has_bits_[0] &= ~0x00000004u;
+  _impl_._has_bits_[0] &= ~0x00000008u;
 }
 inline const ::Info_Module& Config_mission::_internal_info_planner() const {
   ::google::protobuf::internal::TSanRead(&_impl_);
@@ -3316,16 +4744,16 @@ inline void Config_mission::unsafe_arena_set_allocated_info_planner(
   }
   _impl_.info_planner_ = reinterpret_cast<::Info_Module*>(value);
   if (value != nullptr) {
-    _impl_._has_bits_[0] |= 0x00000004u;
+    _impl_._has_bits_[0] |= 0x00000008u;
   } else {
-    _impl_._has_bits_[0] &= ~0x00000004u;
+    _impl_._has_bits_[0] &= ~0x00000008u;
   }
   // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Config_mission.info_planner)
 }
 inline ::Info_Module* PROTOBUF_NULLABLE Config_mission::release_info_planner() {
   ::google::protobuf::internal::TSanWrite(&_impl_);
 
-  _impl_._has_bits_[0] &= ~0x00000004u;
+  _impl_._has_bits_[0] &= ~0x00000008u;
   ::Info_Module* released = _impl_.info_planner_;
   _impl_.info_planner_ = nullptr;
   if (::google::protobuf::internal::DebugHardenForceCopyInRelease()) {
@@ -3345,7 +4773,7 @@ inline ::Info_Module* PROTOBUF_NULLABLE Config_mission::unsafe_arena_release_inf
   ::google::protobuf::internal::TSanWrite(&_impl_);
   // @@protoc_insertion_point(field_release:Config_mission.info_planner)
 
-  _impl_._has_bits_[0] &= ~0x00000004u;
+  _impl_._has_bits_[0] &= ~0x00000008u;
   ::Info_Module* temp = _impl_.info_planner_;
   _impl_.info_planner_ = nullptr;
   return temp;
@@ -3360,7 +4788,7 @@ inline ::Info_Module* PROTOBUF_NONNULL Config_mission::_internal_mutable_info_pl
 }
 inline ::Info_Module* PROTOBUF_NONNULL Config_mission::mutable_info_planner()
     ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_._has_bits_[0] |= 0x00000008u;
   ::Info_Module* _msg = _internal_mutable_info_planner();
   // @@protoc_insertion_point(field_mutable:Config_mission.info_planner)
   return _msg;
@@ -3377,9 +4805,9 @@ inline void Config_mission::set_allocated_info_planner(::Info_Module* PROTOBUF_N
     if (message_arena != submessage_arena) {
       value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
     }
-    _impl_._has_bits_[0] |= 0x00000004u;
+    _impl_._has_bits_[0] |= 0x00000008u;
   } else {
-    _impl_._has_bits_[0] &= ~0x00000004u;
+    _impl_._has_bits_[0] &= ~0x00000008u;
   }
 
   _impl_.info_planner_ = reinterpret_cast<::Info_Module*>(value);
@@ -3388,14 +4816,14 @@ inline void Config_mission::set_allocated_info_planner(::Info_Module* PROTOBUF_N
 
 // .Info_Module info_drone = 3;
 inline bool Config_mission::has_info_drone() const {
-  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
   PROTOBUF_ASSUME(!value || _impl_.info_drone_ != nullptr);
   return value;
 }
 inline void Config_mission::clear_info_drone() {
   ::google::protobuf::internal::TSanWrite(&_impl_);
   if (_impl_.info_drone_ != nullptr) _impl_.info_drone_->Clear();
-  _impl_._has_bits_[0] &= ~0x00000008u;
+  _impl_._has_bits_[0] &= ~0x00000010u;
 }
 inline const ::Info_Module& Config_mission::_internal_info_drone() const {
   ::google::protobuf::internal::TSanRead(&_impl_);
@@ -3414,16 +4842,16 @@ inline void Config_mission::unsafe_arena_set_allocated_info_drone(
   }
   _impl_.info_drone_ = reinterpret_cast<::Info_Module*>(value);
   if (value != nullptr) {
-    _impl_._has_bits_[0] |= 0x00000008u;
+    _impl_._has_bits_[0] |= 0x00000010u;
   } else {
-    _impl_._has_bits_[0] &= ~0x00000008u;
+    _impl_._has_bits_[0] &= ~0x00000010u;
   }
   // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Config_mission.info_drone)
 }
 inline ::Info_Module* PROTOBUF_NULLABLE Config_mission::release_info_drone() {
   ::google::protobuf::internal::TSanWrite(&_impl_);
 
-  _impl_._has_bits_[0] &= ~0x00000008u;
+  _impl_._has_bits_[0] &= ~0x00000010u;
   ::Info_Module* released = _impl_.info_drone_;
   _impl_.info_drone_ = nullptr;
   if (::google::protobuf::internal::DebugHardenForceCopyInRelease()) {
@@ -3443,7 +4871,7 @@ inline ::Info_Module* PROTOBUF_NULLABLE Config_mission::unsafe_arena_release_inf
   ::google::protobuf::internal::TSanWrite(&_impl_);
   // @@protoc_insertion_point(field_release:Config_mission.info_drone)
 
-  _impl_._has_bits_[0] &= ~0x00000008u;
+  _impl_._has_bits_[0] &= ~0x00000010u;
   ::Info_Module* temp = _impl_.info_drone_;
   _impl_.info_drone_ = nullptr;
   return temp;
@@ -3458,7 +4886,7 @@ inline ::Info_Module* PROTOBUF_NONNULL Config_mission::_internal_mutable_info_dr
 }
 inline ::Info_Module* PROTOBUF_NONNULL Config_mission::mutable_info_drone()
     ABSL_ATTRIBUTE_LIFETIME_BOUND {
-  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_._has_bits_[0] |= 0x00000010u;
   ::Info_Module* _msg = _internal_mutable_info_drone();
   // @@protoc_insertion_point(field_mutable:Config_mission.info_drone)
   return _msg;
@@ -3475,9 +4903,9 @@ inline void Config_mission::set_allocated_info_drone(::Info_Module* PROTOBUF_NUL
     if (message_arena != submessage_arena) {
       value = ::google::protobuf::internal::GetOwnedMessage(message_arena, value, submessage_arena);
     }
-    _impl_._has_bits_[0] |= 0x00000008u;
+    _impl_._has_bits_[0] |= 0x00000010u;
   } else {
-    _impl_._has_bits_[0] &= ~0x00000008u;
+    _impl_._has_bits_[0] &= ~0x00000010u;
   }
 
   _impl_.info_drone_ = reinterpret_cast<::Info_Module*>(value);
@@ -3549,6 +4977,71 @@ inline void Config_mission::set_allocated_drone_sim(::std::string* PROTOBUF_NULL
   // @@protoc_insertion_point(field_set_allocated:Config_mission.drone_sim)
 }
 
+// string mission_id = 5;
+inline void Config_mission::clear_mission_id() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_.mission_id_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::std::string& Config_mission::mission_id() const
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  // @@protoc_insertion_point(field_get:Config_mission.mission_id)
+  return _internal_mission_id();
+}
+template <typename Arg_, typename... Args_>
+PROTOBUF_ALWAYS_INLINE void Config_mission::set_mission_id(Arg_&& arg, Args_... args) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.mission_id_.Set(static_cast<Arg_&&>(arg), args..., GetArena());
+  // @@protoc_insertion_point(field_set:Config_mission.mission_id)
+}
+inline ::std::string* PROTOBUF_NONNULL Config_mission::mutable_mission_id()
+    ABSL_ATTRIBUTE_LIFETIME_BOUND {
+  ::std::string* _s = _internal_mutable_mission_id();
+  // @@protoc_insertion_point(field_mutable:Config_mission.mission_id)
+  return _s;
+}
+inline const ::std::string& Config_mission::_internal_mission_id() const {
+  ::google::protobuf::internal::TSanRead(&_impl_);
+  return _impl_.mission_id_.Get();
+}
+inline void Config_mission::_internal_set_mission_id(const ::std::string& value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.mission_id_.Set(value, GetArena());
+}
+inline ::std::string* PROTOBUF_NONNULL Config_mission::_internal_mutable_mission_id() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.mission_id_.Mutable( GetArena());
+}
+inline ::std::string* PROTOBUF_NULLABLE Config_mission::release_mission_id() {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  // @@protoc_insertion_point(field_release:Config_mission.mission_id)
+  if ((_impl_._has_bits_[0] & 0x00000002u) == 0) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* released = _impl_.mission_id_.Release();
+  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString()) {
+    _impl_.mission_id_.Set("", GetArena());
+  }
+  return released;
+}
+inline void Config_mission::set_allocated_mission_id(::std::string* PROTOBUF_NULLABLE value) {
+  ::google::protobuf::internal::TSanWrite(&_impl_);
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.mission_id_.SetAllocated(value, GetArena());
+  if (::google::protobuf::internal::DebugHardenForceCopyDefaultString() && _impl_.mission_id_.IsDefault()) {
+    _impl_.mission_id_.Set("", GetArena());
+  }
+  // @@protoc_insertion_point(field_set_allocated:Config_mission.mission_id)
+}
+
 // -------------------------------------------------------------------
 
 // Info_Module
@@ -4015,6 +5508,31 @@ inline void Info_Module::set_allocated_key(::std::string* PROTOBUF_NULLABLE valu
 // @@protoc_insertion_point(namespace_scope)
 
 
+namespace google {
+namespace protobuf {
+
+template <>
+struct is_proto_enum<::PlannerStatus> : std::true_type {};
+template <>
+inline const EnumDescriptor* PROTOBUF_NONNULL GetEnumDescriptor<::PlannerStatus>() {
+  return ::PlannerStatus_descriptor();
+}
+template <>
+struct is_proto_enum<::DroneStatus> : std::true_type {};
+template <>
+inline const EnumDescriptor* PROTOBUF_NONNULL GetEnumDescriptor<::DroneStatus>() {
+  return ::DroneStatus_descriptor();
+}
+template <>
+struct is_proto_enum<::PldStatus> : std::true_type {};
+template <>
+inline const EnumDescriptor* PROTOBUF_NONNULL GetEnumDescriptor<::PldStatus>() {
+  return ::PldStatus_descriptor();
+}
+
+}  // namespace protobuf
+}  // namespace google
+
 // @@protoc_insertion_point(global_scope)
 
 #include "google/protobuf/port_undef.inc"
@@ -58,8 +58,40 @@ namespace Struct_Drone {
         CameraAction camera_action;
     };
 
+    enum class Command_Type {
+        WAYPOINT,
+        START,
+        FINISH,
+        START_ALL
+    };
+
+    inline std::string to_string(Command_Type type) {
+        switch (type) {
+            case Command_Type::START:
+                return "START";
+            case Command_Type::FINISH:
+                return "FINISH";
+            case Command_Type::START_ALL:
+                return "START_ALL";
+            default:
+                return "WAYPOINT";
+        }
+    }
+
+    // Compatibility with peers that still send the command type as a string
+    inline Command_Type to_command_type(const std::string& str) {
+        if (str == "START")
+            return Command_Type::START;
+        else if (str == "FINISH")
+            return Command_Type::FINISH;
+        else if (str == "START_ALL")
+            return Command_Type::START_ALL;
+        else
+            return Command_Type::WAYPOINT;
+    }
+
     struct MessagePX4 {
-        std::string type;
+        Command_Type type = Command_Type::WAYPOINT;
         MissionItem mission_item;
     };
 
@@ -8,6 +8,7 @@
  * ============================================================
  * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 #pragma once
+#include <cstdint>
 #include <string>
 #include <filesystem>
 #include "Structs_Planner.h"
@@ -48,6 +49,12 @@ namespace Structs_PLD {
         }
     }
 
+    struct Queue_status {
+        uint32_t queued_missions = 0;
+        uint32_t planned_missions = 0;
+        uint64_t last_mission_latency_ms = 0;
+    };
+
     struct Info_Module {
         std::string docker_name;
         std::string docker_file;
@@ -69,12 +76,14 @@ namespace Structs_PLD {
     };
 
     struct Config_mission {
+        std::string mission_id;
         Struct_Planner::Planner_info planner_info;
         Info_Module planner_module_data;
         Info_Module drone_module_data;
         std::string drone_sim;
 
         void clear(){
+            mission_id.clear();
             planner_info.clear();
             planner_module_data.clear();
             drone_module_data.clear();
@@ -27,6 +27,7 @@ struct Config_struct {
     int max_neighbor;
     double max_distance_for_neighbor;
     int max_ortools_time;
+    int max_queued_requests;
 };
 
 enum class Status {
@@ -34,7 +35,8 @@ enum class Status {
     EXPECTING_DATA,
     ERROR,
     CALCULATING,
-    FINISH
+    FINISH,
+    CANCELLED
 };
 
 inline std::string to_string(Status status) {
@@ -47,6 +49,8 @@ inline std::string to_string(Status status) {
             return "CALCULATING";
         case Status::FINISH:
             return "FINISH";
+        case Status::CANCELLED:
+            return "CANCELLED";
         case Status::UNKNOWN:
             return "UNKNOWN";
         default:
@@ -63,6 +67,8 @@ inline Status to_enum(const std::string& str) {
         return Status::CALCULATING;
     else if (str == "FINISH")
         return Status::FINISH;
+    else if (str == "CANCELLED")
+        return Status::CANCELLED;
     else
         return Status::UNKNOWN;
 }